@@ -0,0 +1,362 @@
+/*
+  TasmotaTimeSeries.cpp - Compressed fixed-size time-series store
+
+  Copyright (C) 2021  Theo Arends and Stephan Hadinger
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TasmotaTimeSeries.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TS_MAGIC          0x31475354      // "TSG1"
+#define TS_NO_WINDOW      0xFF            // no previous leading/trailing window
+
+typedef struct {
+  uint32_t magic;
+  uint8_t  channels;
+  uint8_t  reserved;
+  uint16_t block_size;
+  uint16_t blocks;
+  uint16_t head;                          // index of the oldest block
+  uint16_t used;                          // number of blocks in use
+  uint16_t reserved2;
+} ts_header_t;
+
+typedef struct {
+  uint32_t time;                          // timestamp of the first sample
+  uint16_t count;                         // number of samples
+  uint16_t bits;                          // number of bits used in the payload
+} ts_block_t;
+
+/*********************************************************************************************\
+ * Bit streams, msb first
+\*********************************************************************************************/
+
+class TS_BitWriter {
+public:
+  TS_BitWriter(uint8_t * buf, uint32_t pos, uint32_t cap) : _buf(buf), _pos(pos), _cap(cap), _overflow(false) {}
+
+  void write(uint32_t v, uint32_t n) {    // n <= 32
+    if (_pos + n > _cap) { _overflow = true; return; }
+    while (n) {
+      n--;
+      uint8_t mask = 0x80 >> (_pos & 7);
+      if ((v >> n) & 1) { _buf[_pos >> 3] |= mask; }
+      else              { _buf[_pos >> 3] &= ~mask; }
+      _pos++;
+    }
+  }
+
+  uint8_t * _buf;
+  uint32_t _pos;
+  uint32_t _cap;
+  bool _overflow;
+};
+
+class TS_BitReader {
+public:
+  TS_BitReader(const uint8_t * buf, uint32_t cap) : _buf(buf), _pos(0), _cap(cap), _ok(true) {}
+
+  uint32_t read(uint32_t n) {             // n <= 32
+    if (_pos + n > _cap) { _ok = false; return 0; }
+    uint32_t v = 0;
+    while (n) {
+      n--;
+      v = (v << 1) | ((_buf[_pos >> 3] >> (7 - (_pos & 7))) & 1);
+      _pos++;
+    }
+    return v;
+  }
+
+  const uint8_t * _buf;
+  uint32_t _pos;
+  uint32_t _cap;
+  bool _ok;
+};
+
+/*********************************************************************************************\
+ * Codec
+\*********************************************************************************************/
+
+static void TS_InitState(TimeSeries::state_t * st, uint32_t time) {
+  st->time = time;
+  st->delta = 0;
+  memset(st->leading, TS_NO_WINDOW, sizeof(st->leading));
+  memset(st->trailing, 0, sizeof(st->trailing));
+}
+
+static void TS_Encode(TS_BitWriter & w, TimeSeries::state_t * st, uint32_t channels, uint32_t time, const float * values) {
+  int32_t delta = (int32_t)(time - st->time);
+  int32_t dod = delta - st->delta;
+  if (0 == dod) {
+    w.write(0, 1);
+  } else if ((dod >= -63) && (dod <= 64)) {
+    w.write(0b10, 2);   w.write(dod + 63, 7);
+  } else if ((dod >= -255) && (dod <= 256)) {
+    w.write(0b110, 3);  w.write(dod + 255, 9);
+  } else if ((dod >= -2047) && (dod <= 2048)) {
+    w.write(0b1110, 4); w.write(dod + 2047, 12);
+  } else {
+    w.write(0b1111, 4); w.write((uint32_t)dod, 32);
+  }
+  st->time = time;
+  st->delta = delta;
+
+  for (uint32_t ch = 0; ch < channels; ch++) {
+    uint32_t v;
+    memcpy(&v, &values[ch], sizeof(v));
+    uint32_t x = v ^ st->value[ch];
+    if (0 == x) {
+      w.write(0, 1);
+      continue;
+    }
+    uint32_t lead = __builtin_clz(x);
+    uint32_t trail = __builtin_ctz(x);
+    if ((st->leading[ch] != TS_NO_WINDOW) && (lead >= st->leading[ch]) && (trail >= st->trailing[ch])) {
+      // fits in the previous window
+      w.write(0b10, 2);
+      w.write(x >> st->trailing[ch], 32 - st->leading[ch] - st->trailing[ch]);
+    } else {
+      uint32_t len = 32 - lead - trail;   // 1..32
+      w.write(0b11, 2);
+      w.write(lead, 5);
+      w.write(len - 1, 5);
+      w.write(x >> trail, len);
+      st->leading[ch] = lead;
+      st->trailing[ch] = trail;
+    }
+    st->value[ch] = v;
+  }
+}
+
+static void TS_Decode(TS_BitReader & r, TimeSeries::state_t * st, uint32_t channels) {
+  int32_t dod;
+  if (0 == r.read(1))      { dod = 0; }
+  else if (0 == r.read(1)) { dod = (int32_t)r.read(7) - 63; }
+  else if (0 == r.read(1)) { dod = (int32_t)r.read(9) - 255; }
+  else if (0 == r.read(1)) { dod = (int32_t)r.read(12) - 2047; }
+  else                     { dod = (int32_t)r.read(32); }
+  st->delta += dod;
+  st->time += st->delta;
+
+  for (uint32_t ch = 0; ch < channels; ch++) {
+    if (0 == r.read(1)) { continue; }
+    uint32_t x;
+    if (0 == r.read(1)) {
+      if (st->leading[ch] == TS_NO_WINDOW) { r._ok = false; return; }
+      x = r.read(32 - st->leading[ch] - st->trailing[ch]) << st->trailing[ch];
+    } else {
+      uint32_t lead = r.read(5);
+      uint32_t len = r.read(5) + 1;
+      if (lead + len > 32) { r._ok = false; return; }
+      uint32_t trail = 32 - lead - len;
+      x = r.read(len) << trail;
+      st->leading[ch] = lead;
+      st->trailing[ch] = trail;
+    }
+    st->value[ch] ^= x;
+  }
+}
+
+/*********************************************************************************************\
+ * Store
+\*********************************************************************************************/
+
+TimeSeries::TimeSeries(uint32_t channels, uint32_t block_size) :
+  _buf(nullptr), _size(0), _blocks(0), _count(0)
+{
+  if (channels > TS_MAX_CHANNELS) { channels = TS_MAX_CHANNELS; }
+  if (channels < 1) { channels = 1; }
+  _channels = channels;
+  // blocks are 4 bytes aligned, hold at least a few samples and a bit count on 16 bits
+  block_size = (block_size + 3) & ~3;
+  uint32_t min_size = sizeof(ts_block_t) + 8 * channels;
+  if (block_size < min_size) { block_size = (min_size + 3) & ~3; }
+  if (block_size > 4096) { block_size = 4096; }
+  _block_size = block_size;
+  memset(&_last, 0, sizeof(_last));
+}
+
+TimeSeries::~TimeSeries() {
+  free(_buf);
+}
+
+bool TimeSeries::begin(uint32_t size) {
+  free(_buf);
+  _buf = nullptr;
+  _size = 0;
+  _blocks = 0;
+  _count = 0;
+  if (size < sizeof(ts_header_t)) { return false; }
+  uint32_t blocks = (size - sizeof(ts_header_t)) / _block_size;
+  if (blocks > 0xFFFF) { blocks = 0xFFFF; }
+  if (blocks < 2) { return false; }       // need one block to recycle while the other keeps history
+  _size = sizeof(ts_header_t) + blocks * _block_size;
+  _buf = (uint8_t*) malloc(_size);
+  if (nullptr == _buf) {
+    _size = 0;
+    return false;
+  }
+  _blocks = blocks;
+  clear();
+  return true;
+}
+
+void TimeSeries::clear(void) {
+  _count = 0;
+  memset(&_last, 0, sizeof(_last));
+  if (nullptr == _buf) { return; }
+  ts_header_t * hdr = (ts_header_t*) _buf;
+  memset(hdr, 0, sizeof(ts_header_t));
+  hdr->magic = TS_MAGIC;
+  hdr->channels = _channels;
+  hdr->block_size = _block_size;
+  hdr->blocks = _blocks;
+}
+
+uint8_t * TimeSeries::block(uint32_t n) const {
+  const ts_header_t * hdr = (const ts_header_t*) _buf;
+  return _buf + sizeof(ts_header_t) + ((hdr->head + n) % _blocks) * _block_size;
+}
+
+void TimeSeries::newBlock(uint32_t time, const float * values) {
+  ts_header_t * hdr = (ts_header_t*) _buf;
+  if (hdr->used >= _blocks) {             // recycle the oldest block
+    _count -= ((ts_block_t*) block(0))->count;
+    hdr->head = (hdr->head + 1) % _blocks;
+    hdr->used--;
+  }
+  hdr->used++;
+  uint8_t * blk = block(hdr->used - 1);
+  ts_block_t * bh = (ts_block_t*) blk;
+  bh->time = time;
+  bh->count = 1;
+
+  TS_InitState(&_last, time);
+  TS_BitWriter w(blk + sizeof(ts_block_t), 0, (_block_size - sizeof(ts_block_t)) * 8);
+  for (uint32_t ch = 0; ch < _channels; ch++) {
+    memcpy(&_last.value[ch], &values[ch], sizeof(uint32_t));
+    w.write(_last.value[ch], 32);
+  }
+  bh->bits = w._pos;
+  _count++;
+}
+
+bool TimeSeries::add(uint32_t time, const float * values) {
+  if (nullptr == _buf) { return false; }
+  if (_count && (time <= _last.time)) { return false; }
+
+  ts_header_t * hdr = (ts_header_t*) _buf;
+  if (hdr->used) {
+    uint8_t * blk = block(hdr->used - 1);
+    ts_block_t * bh = (ts_block_t*) blk;
+    if (bh->count < 0xFFFF) {
+      state_t st = _last;
+      TS_BitWriter w(blk + sizeof(ts_block_t), bh->bits, (_block_size - sizeof(ts_block_t)) * 8);
+      TS_Encode(w, &st, _channels, time, values);
+      if (!w._overflow) {
+        bh->bits = w._pos;
+        bh->count++;
+        _last = st;
+        _count++;
+        return true;
+      }
+    }
+  }
+  newBlock(time, values);                 // current block is full, bits written past its end are ignored
+  return true;
+}
+
+bool TimeSeries::decodeBlock(uint32_t n, uint32_t from, uint32_t to, TimeSeriesCallback cb, void * ctx,
+                             uint32_t * reported, state_t * last) const {
+  const uint8_t * blk = block(n);
+  const ts_block_t * bh = (const ts_block_t*) blk;
+  TS_BitReader r(blk + sizeof(ts_block_t), bh->bits);
+
+  state_t st;
+  TS_InitState(&st, bh->time);
+  for (uint32_t ch = 0; ch < _channels; ch++) {
+    st.value[ch] = r.read(32);
+  }
+  float values[TS_MAX_CHANNELS];
+  for (uint32_t i = 0; i < bh->count; i++) {
+    if (i > 0) { TS_Decode(r, &st, _channels); }
+    if (!r._ok) { return false; }
+    if (st.time > to) { return false; }
+    if ((st.time >= from) && cb) {
+      memcpy(values, st.value, _channels * sizeof(float));
+      if (reported) { (*reported)++; }
+      if (!cb(ctx, st.time, values)) { return false; }
+    }
+  }
+  if (last) { *last = st; }
+  return true;
+}
+
+uint32_t TimeSeries::query(uint32_t from, uint32_t to, TimeSeriesCallback cb, void * ctx) const {
+  uint32_t reported = 0;
+  if (nullptr == _buf) { return 0; }
+  const ts_header_t * hdr = (const ts_header_t*) _buf;
+  for (uint32_t n = 0; n < hdr->used; n++) {
+    // skip blocks entirely before `from`, the next block starts after the last sample of this one
+    if ((n + 1 < hdr->used) && (((const ts_block_t*) block(n + 1))->time <= from)) { continue; }
+    if (((const ts_block_t*) block(n))->time > to) { break; }
+    if (!decodeBlock(n, from, to, cb, ctx, &reported, nullptr)) { break; }
+  }
+  return reported;
+}
+
+uint32_t TimeSeries::count(void) const {
+  return _count;
+}
+
+uint32_t TimeSeries::firstTime(void) const {
+  if (0 == _count) { return 0; }
+  return ((const ts_block_t*) block(0))->time;
+}
+
+uint32_t TimeSeries::used(void) const {
+  if (nullptr == _buf) { return 0; }
+  const ts_header_t * hdr = (const ts_header_t*) _buf;
+  uint32_t bytes = sizeof(ts_header_t);
+  for (uint32_t n = 0; n < hdr->used; n++) {
+    bytes += sizeof(ts_block_t) + (((const ts_block_t*) block(n))->bits + 7) / 8;
+  }
+  return bytes;
+}
+
+bool TimeSeries::restore(void) {
+  if (nullptr == _buf) { return false; }
+  const ts_header_t * hdr = (const ts_header_t*) _buf;
+  bool valid = (TS_MAGIC == hdr->magic) && (_channels == hdr->channels) && (_block_size == hdr->block_size) &&
+               (_blocks == hdr->blocks) && (hdr->head < _blocks) && (hdr->used <= _blocks);
+  uint32_t count = 0;
+  uint32_t prev_time = 0;
+  for (uint32_t n = 0; valid && (n < hdr->used); n++) {
+    const ts_block_t * bh = (const ts_block_t*) block(n);
+    valid = (bh->count > 0) && (bh->bits <= (_block_size - sizeof(ts_block_t)) * 8) &&
+            ((0 == n) || (bh->time > prev_time)) &&
+            decodeBlock(n, 0, 0xFFFFFFFF, nullptr, nullptr, nullptr, &_last);
+    prev_time = _last.time;
+    count += bh->count;
+  }
+  if (!valid) {
+    clear();
+    return false;
+  }
+  _count = count;
+  return true;
+}
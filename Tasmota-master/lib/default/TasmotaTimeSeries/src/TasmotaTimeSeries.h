@@ -0,0 +1,96 @@
+/*
+  TasmotaTimeSeries.h - Compressed fixed-size time-series store
+
+  Copyright (C) 2021  Theo Arends and Stephan Hadinger
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TASMOTA_TIMESERIES__
+#define __TASMOTA_TIMESERIES__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*********************************************************************************************\
+ * Time-series of samples made of a timestamp and up to TS_MAX_CHANNELS float values
+ *
+ * Samples are compressed as in Facebook's Gorilla paper:
+ * - timestamps are stored as delta-of-delta, a regular period costs 1 bit per sample
+ * - values are XORed with the previous value of the same channel, and only the
+ *   meaningful bits of the XOR are stored, an unchanged value costs 1 bit
+ *
+ * The store is a single fixed-size buffer made of a header followed by blocks.
+ * Each block starts with an uncompressed timestamp and holds a self-contained
+ * bitstream, so that when the buffer is full the oldest block is simply recycled.
+ * The buffer has no pointer and can be saved to and restored from a file as-is.
+\*********************************************************************************************/
+
+#define TS_MAX_CHANNELS           8
+#define TS_BLOCK_SIZE_DEFAULT     256
+
+// return false to stop the iteration
+typedef bool (*TimeSeriesCallback)(void * ctx, uint32_t time, const float * values);
+
+class TimeSeries {
+public:
+  TimeSeries(uint32_t channels, uint32_t block_size = TS_BLOCK_SIZE_DEFAULT);
+  ~TimeSeries();
+
+  // allocate `size` bytes, returns false if the size is too small or out of memory
+  bool begin(uint32_t size);
+  void clear(void);
+
+  // append a sample, `time` must be strictly increasing
+  bool add(uint32_t time, const float * values);
+
+  // call `cb` for each sample with `from <= time <= to`, returns the number of samples reported
+  uint32_t query(uint32_t from, uint32_t to, TimeSeriesCallback cb, void * ctx) const;
+
+  uint32_t channels(void) const { return _channels; }
+  uint32_t count(void) const;             // number of samples
+  uint32_t firstTime(void) const;         // 0 if empty
+  uint32_t lastTime(void) const { return _count ? _last.time : 0; }
+  uint32_t used(void) const;              // bytes holding compressed samples
+
+  // raw buffer for persistence, call `restore()` after writing to it
+  uint8_t * buffer(void) { return _buf; }
+  uint32_t bufferSize(void) const { return _size; }
+  bool restore(void);                     // validate buffer and resume appending, clears if invalid
+
+  // encoder/decoder state carried from one sample to the next
+  typedef struct {
+    uint32_t time;
+    int32_t delta;
+    uint32_t value[TS_MAX_CHANNELS];
+    uint8_t leading[TS_MAX_CHANNELS];
+    uint8_t trailing[TS_MAX_CHANNELS];
+  } state_t;
+
+protected:
+  uint8_t * block(uint32_t n) const;      // n-th block from the oldest
+  void newBlock(uint32_t time, const float * values);
+  bool decodeBlock(uint32_t n, uint32_t from, uint32_t to, TimeSeriesCallback cb, void * ctx,
+                   uint32_t * reported, state_t * last) const;
+
+  uint8_t * _buf;
+  uint32_t _size;
+  uint16_t _block_size;
+  uint16_t _blocks;
+  uint8_t _channels;
+  uint32_t _count;                        // cached number of samples
+  state_t _last;                          // state after the last sample of the current block
+};
+
+#endif // __TASMOTA_TIMESERIES__
@@ -0,0 +1,132 @@
+/*
+  test-timeseries.cpp - host test of the compressed time-series store
+
+  Build and run from this directory:
+    g++ -O2 -std=gnu++11 -Wall test-timeseries.cpp ../src/TasmotaTimeSeries.cpp -o test-timeseries && ./test-timeseries
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../src/TasmotaTimeSeries.h"
+
+#define CHANNELS    4
+#define SAMPLES     20000
+
+static uint32_t times[SAMPLES];
+static float values[SAMPLES][CHANNELS];
+static uint32_t errors = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAIL line %d: %s\n", __LINE__, #cond); errors++; } } while (0)
+
+// typical per-minute energy samples: power, voltage, current, total kWh
+static void generate(void) {
+  uint32_t t = 1620000000;
+  float power = 100, total = 1234.5f;
+  for (uint32_t i = 0; i < SAMPLES; i++) {
+    t += (i % 97 == 0) ? 61 + (rand() % 300) : 60;    // mostly regular, with some jitter and gaps
+    if (rand() % 10 == 0) { power = (rand() % 2000) / 10.0f; }
+    float voltage = roundf((230 + (rand() % 40 - 20) / 10.0f) * 10) / 10;
+    values[i][0] = power;
+    values[i][1] = voltage;
+    values[i][2] = (power > 0) ? roundf(power / voltage * 1000) / 1000 : 0;
+    total += power / 60000;
+    values[i][3] = total;
+    times[i] = t;
+  }
+  values[10][0] = NAN;                                // odd values must survive bit exact
+  values[11][0] = -0.0f;
+  values[12][0] = INFINITY;
+}
+
+typedef struct {
+  uint32_t next;                                      // index of the next expected sample
+  uint32_t last;                                      // stop after this index
+  bool exact;
+} check_ctx_t;
+
+static bool check_cb(void * ctx, uint32_t time, const float * v) {
+  check_ctx_t * c = (check_ctx_t*) ctx;
+  if ((time != times[c->next]) || memcmp(v, values[c->next], sizeof(float) * CHANNELS)) { c->exact = false; }
+  c->next++;
+  return (c->next <= c->last);
+}
+
+static uint32_t first_index(const TimeSeries & ts) {
+  for (uint32_t i = 0; i < SAMPLES; i++) {
+    if (times[i] == ts.firstTime()) { return i; }
+  }
+  return SAMPLES;
+}
+
+int main(int argc, char* argv[]) {
+  generate();
+
+  TimeSeries ts(CHANNELS);
+  CHECK(ts.begin(16384));
+  CHECK(0 == ts.count());
+  CHECK(0 == ts.query(0, 0xFFFFFFFF, check_cb, nullptr));
+
+  // fill a few samples, check full round-trip
+  for (uint32_t i = 0; i < 100; i++) { CHECK(ts.add(times[i], values[i])); }
+  CHECK(100 == ts.count());
+  CHECK(!ts.add(times[99], values[99]));              // time must increase
+  check_ctx_t c = { 0, 0xFFFFFFFF, true };
+  CHECK(100 == ts.query(0, 0xFFFFFFFF, check_cb, &c));
+  CHECK(c.exact && (100 == c.next));
+
+  // fill until blocks are recycled
+  for (uint32_t i = 100; i < SAMPLES; i++) { CHECK(ts.add(times[i], values[i])); }
+  uint32_t first = first_index(ts);
+  CHECK(first < SAMPLES);
+  CHECK(ts.count() == SAMPLES - first);
+  CHECK(ts.lastTime() == times[SAMPLES - 1]);
+  printf("%u samples kept in %u bytes (%.1f bits/sample, %.1f hours)\n", ts.count(), ts.used(),
+         ts.used() * 8.0 / ts.count(), (ts.lastTime() - ts.firstTime()) / 3600.0);
+
+  c = { first, 0xFFFFFFFF, true };
+  CHECK(ts.count() == ts.query(0, 0xFFFFFFFF, check_cb, &c));
+  CHECK(c.exact && (SAMPLES == c.next));
+
+  // time range in the middle, bounds inclusive
+  uint32_t from = first + 500, to = first + 700;
+  c = { from, 0xFFFFFFFF, true };
+  CHECK(201 == ts.query(times[from], times[to], check_cb, &c));
+  CHECK(c.exact && (to + 1 == c.next));
+  c = { from, 0xFFFFFFFF, true };
+  CHECK(201 == ts.query(times[from] - 1, times[to + 1] - 1, check_cb, &c));
+
+  // callback can stop the iteration
+  c = { from, from + 9, true };
+  CHECK(10 == ts.query(times[from], 0xFFFFFFFF, check_cb, &c));
+
+  // persistence: copy the raw buffer into a new store and continue appending
+  TimeSeries ts2(CHANNELS);
+  CHECK(ts2.begin(16384));
+  memcpy(ts2.buffer(), ts.buffer(), ts.bufferSize());
+  CHECK(ts2.restore());
+  CHECK((ts2.count() == ts.count()) && (ts2.firstTime() == ts.firstTime()) && (ts2.lastTime() == ts.lastTime()));
+  float extra[CHANNELS] = { 1.5f, 231.2f, 0.007f, 1300.25f };
+  CHECK(ts.add(times[SAMPLES - 1] + 60, extra));
+  CHECK(ts2.add(times[SAMPLES - 1] + 60, extra));
+  CHECK(0 == memcmp(ts.buffer(), ts2.buffer(), ts.bufferSize()));
+
+  // corrupted or mismatching buffers are rejected and cleared
+  TimeSeries ts3(CHANNELS - 1);
+  CHECK(ts3.begin(16384));
+  memcpy(ts3.buffer(), ts.buffer(), ts3.bufferSize());
+  CHECK(!ts3.restore());
+  CHECK(0 == ts3.count());
+  ts2.buffer()[0] ^= 0xFF;
+  CHECK(!ts2.restore());
+  CHECK(0 == ts2.count() && ts2.add(times[0], values[0]));
+
+  // a too small buffer is refused
+  TimeSeries ts4(CHANNELS);
+  CHECK(!ts4.begin(300));
+  CHECK(!ts4.add(times[0], values[0]));
+
+  printf("%s (%u errors)\n", errors ? "FAILED" : "OK", errors);
+  return errors ? 1 : 0;
+}
@@ -25,6 +25,7 @@
 \*********************************************************************************************/
 
 const char * k_current_json_buffer = "";
+const JsonParserIndex * k_current_json_index = nullptr;
 
 // returns nibble value or -1 if not an hex digit
 static int32_t asc2byte(char chr) {
@@ -193,6 +194,7 @@ JsonParserArray::const_iterator::const_iterator(const JsonParserArray t): tok(t)
     // ASSERT type == JSMN_ARRAY by constructor
     remaining = tok.t->size;
     tok.nextOne();    // skip array root token
+    if (0 == remaining) { tok.t = nullptr; }    // empty array
   }
 }
 
@@ -249,6 +251,7 @@ JsonParserObject::const_iterator::const_iterator(const JsonParserObject t): tok(
     // ASSERT type == JSMN_OBJECT by constructor
     remaining = tok.t->size;
     tok.nextOne();
+    if (0 == remaining) { tok.t = nullptr; }    // empty object
   }
 }
 
@@ -295,12 +298,31 @@ JsonParser::JsonParser(char * json_in) :
   _size(0),
   _token_len(0),
   _tokens(nullptr),
-  _json(nullptr)
+  _json(nullptr),
+  _own_tokens(false),
+  _index()
 {
   parse(json_in);
 }
 
+JsonParser::JsonParser(char * json_in, jsmntok_t * arena, size_t arena_size) :
+  _size(0),
+  _token_len(0),
+  _tokens(nullptr),
+  _json(nullptr),
+  _own_tokens(false),
+  _index()
+{
+  if ((nullptr != arena) && (arena_size > 0)) {
+    _tokens = arena;
+    _size = (arena_size > 0xFFFF) ? 0xFFFF : arena_size;
+  }
+  parseSinglePass(json_in);
+}
+
 JsonParser::~JsonParser() {
+  if (k_current_json_index == &_index) { k_current_json_index = nullptr; }
+  delete[] _index.table;
   this->free();
 }
 
@@ -391,6 +413,7 @@ const char * JsonParserObject::getStr(const char * needle) const {
 
 void JsonParser::parse(char * json_in) {
   k_current_json_buffer = "";
+  k_current_json_index = nullptr;
   if (nullptr == json_in) { return; }
   _json = json_in;
   k_current_json_buffer = _json;
@@ -411,6 +434,35 @@ void JsonParser::parse(char * json_in) {
   }
 }
 
+void JsonParser::parseSinglePass(char * json_in) {
+  k_current_json_buffer = "";
+  k_current_json_index = nullptr;
+  if (_size > 0) { _tokens[0] = token_bad; }    // the arena may be uninitialized, the root stays invalid until parsed
+  if (nullptr == json_in) { return; }
+  _json = json_in;
+  k_current_json_buffer = _json;
+  size_t json_len = strlen(json_in);
+  if (0 == json_len) { return; }
+  // no arena, start with a guess: tokens of typical payloads take more than 8 chars
+  if ((0 == _size) && !grow(json_len / 8 + 4)) { return; }
+  jsmn_init(&this->_parser);
+  int32_t token_len;
+  // jsmn resumes where it stopped when running out of tokens, no need to start over
+  while (JSMN_ERROR_NOMEM == (token_len = jsmn_parse(&this->_parser, json_in, json_len, _tokens, _size))) {
+    if (!grow(_size + (_size >> 1) + 4)) { break; }
+  }
+  // keep room for the end marker
+  if ((token_len > 0) && (token_len >= _size) && !grow(token_len + 1)) {
+    token_len = JSMN_ERROR_NOMEM;
+  }
+  if (token_len > 0) {
+    _token_len = token_len;
+    postProcess(json_len);
+  } else {
+    _tokens[0] = token_bad;     // don't expose a partially parsed root
+  }
+}
+
 // post process the parsing by pre-munching extended types
 void JsonParser::postProcess(size_t json_len) {
   // add an end marker
@@ -470,6 +522,105 @@ void JsonParser::postProcess(size_t json_len) {
   }
 }
 
+/*********************************************************************************************\
+ * Key index
+ *
+ * The table holds, for each indexed object, a header word `(object token << 16) | mask`
+ * followed by `mask + 1` slots. A slot is `(hash & 0xFFFF0000) | key token`, or 0 if empty
+ * (token 0 is the root and can't be a key). Collisions use linear probing, which keeps
+ * duplicate keys in document order like the linear scan does.
+\*********************************************************************************************/
+
+// case-insensitive FNV-1a hash, `str` can be in PROGMEM
+static uint32_t json_key_hash(const char * str) {
+  uint32_t hash = 2166136261;
+  uint8_t c;
+  while ((c = pgm_read_byte(str++)) != 0) {
+    if ((c >= 'A') && (c <= 'Z')) { c += 'a' - 'A'; }
+    hash = (hash ^ c) * 16777619;
+  }
+  return hash;
+}
+
+// number of slots for an object, at most half full
+static uint32_t json_index_slots(uint32_t keys) {
+  uint32_t slots = 4;
+  while (slots < keys * 2) { slots <<= 1; }
+  return slots;
+}
+
+// look-up `needle` in the index of the current parser
+// returns false if the object is not indexed, `value` is then unchanged
+static bool json_index_find(const jsmntok_t * obj, const char * needle, JsonParserToken & value) {
+  const JsonParserIndex * index = k_current_json_index;
+  if ((nullptr == index) || (obj < index->tokens) || (obj >= index->tokens + index->token_len)) { return false; }
+  uint32_t obj_idx = obj - index->tokens;
+  const uint32_t * head = index->table;
+  const uint32_t * end = index->table + index->table_len;
+  while (head < end) {
+    uint32_t mask = *head & 0xFFFF;
+    if ((*head >> 16) == obj_idx) {
+      const uint32_t * slots = head + 1;
+      uint32_t hash = json_key_hash(needle);
+      for (uint32_t pos = hash & mask; slots[pos]; pos = (pos + 1) & mask) {
+        if (0 == ((slots[pos] ^ hash) & 0xFFFF0000)) {
+          const jsmntok_t * key = index->tokens + (slots[pos] & 0xFFFF);
+          if (0 == strcasecmp_P(&k_current_json_buffer[key->start], needle)) {
+            value = JsonParserToken(key + 1);
+            return true;
+          }
+        }
+      }
+      value = JsonParserToken(&token_bad);
+      return true;
+    }
+    head += mask + 2;
+  }
+  return false;
+}
+
+bool JsonParser::buildKeyIndex(size_t min_keys) {
+  static_assert(sizeof(_token_len) <= 2, "JsonParserIndex packs token indexes on 16 bits");
+  if (k_current_json_index == &_index) { k_current_json_index = nullptr; }
+  delete[] _index.table;
+  _index = JsonParserIndex();
+  if (min_keys < 1) { min_keys = 1; }
+
+  // first count the room needed
+  size_t table_len = 0;
+  for (uint32_t i = 0; i < _token_len; i++) {
+    if ((JSMN_OBJECT == _tokens[i].type) && (_tokens[i].size >= min_keys)) {
+      table_len += 1 + json_index_slots(_tokens[i].size);
+    }
+  }
+  if (0 == table_len) { return true; }     // nothing worth indexing
+  uint32_t * table = new uint32_t[table_len];
+  if (nullptr == table) { return false; }
+  memset(table, 0, table_len * sizeof(uint32_t));
+
+  uint32_t * head = table;
+  for (uint32_t i = 0; i < _token_len; i++) {
+    if ((JSMN_OBJECT == _tokens[i].type) && (_tokens[i].size >= min_keys)) {
+      uint32_t mask = json_index_slots(_tokens[i].size) - 1;
+      uint32_t * slots = head + 1;
+      *head = (i << 16) | mask;
+      for (const auto key : JsonParserObject(&_tokens[i])) {
+        uint32_t hash = json_key_hash(&_json[key.t->start]);
+        uint32_t pos = hash & mask;
+        while (slots[pos]) { pos = (pos + 1) & mask; }
+        slots[pos] = (hash & 0xFFFF0000) | (key.t - _tokens);
+      }
+      head += mask + 2;
+    }
+  }
+  _index.tokens = _tokens;
+  _index.table = table;
+  _index.token_len = _token_len;
+  _index.table_len = table_len;
+  setCurrent();
+  return true;
+}
+
 JsonParserToken JsonParserObject::operator[](const char * needle) const {
   // key can be in PROGMEM
   if ((!this->isValid()) || (nullptr == needle) || (0 == pgm_read_byte(needle))) {
@@ -478,6 +629,9 @@ JsonParserToken JsonParserObject::operator[](const char * needle) const {
   // if needle == "?" then we return the first valid key
   bool wildcard = (strcmp_P("?", needle) == 0);
 
+  JsonParserToken value;
+  if (!wildcard && json_index_find(t, needle, value)) { return value; }
+
   for (const auto key : *this) {
     if (wildcard) { return key.getValue(); }
     if (0 == strcasecmp_P(key.getStr(), needle)) { return key.getValue(); }
@@ -538,15 +692,32 @@ const char * JsonParserObject::findConstCharNull(const char * needle) const {
 // }
 
 void JsonParser::free(void) {
-  if (nullptr != _tokens) {
+  if ((nullptr != _tokens) && _own_tokens) {
     delete[] _tokens;     // TODO
-    _tokens = nullptr;
   }
+  _tokens = nullptr;
+  _own_tokens = false;
 }
 
 void JsonParser::allocate(void) {
   this->free();
   if (_size != 0) {
     _tokens = new jsmntok_t[_size];
+    _own_tokens = true;
   }
 }
+
+bool JsonParser::grow(size_t new_size) {
+  if (new_size > 0xFFFF) { new_size = 0xFFFF; }
+  if (new_size <= _size) { return false; }
+  jsmntok_t * tokens = new jsmntok_t[new_size];
+  if (nullptr == tokens) { return false; }
+  if (nullptr != _tokens) {
+    memcpy(tokens, _tokens, _size * sizeof(jsmntok_t));
+  }
+  this->free();
+  _tokens = tokens;
+  _own_tokens = true;
+  _size = new_size;
+  return true;
+}
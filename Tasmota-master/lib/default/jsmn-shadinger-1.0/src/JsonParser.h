@@ -53,6 +53,23 @@ const extern jsmntok_t token_bad;
 // Warning: this makes code non-reentrant.
 extern const char * k_current_json_buffer;
 
+// Optional hash index of the keys of large objects, see `JsonParser::buildKeyIndex()`
+// Same caveat as above, it belongs to the current JSON parser.
+// Token indexes are packed on 16 bits in `table`, which covers any token count
+// of the parser (`int16_t`, and jsmn limits the input to 2KB anyways).
+typedef struct JsonParserIndex {
+  const jsmntok_t * tokens;     // token buffer the index refers to
+  uint32_t        * table;      // for each indexed object: a header word then `mask + 1` slots
+  uint32_t          token_len;  // number of tokens covered
+  uint32_t          table_len;  // number of words in `table`
+} JsonParserIndex;
+extern const JsonParserIndex * k_current_json_index;
+
+// objects with fewer keys are faster to scan than to hash
+#ifndef JSON_PARSER_INDEX_MIN_KEYS
+#define JSON_PARSER_INDEX_MIN_KEYS    12
+#endif
+
 /*********************************************************************************************\
  * Read-only JSON token object, fits in 32 bits
 \*********************************************************************************************/
@@ -229,11 +246,22 @@ public:
   // Input: `json_in` can be nullptr, but CANNOT be in PROGMEM (remember we need to change characters in-place)
   JsonParser(char * json_in);
 
+  // constructor, parse the json buffer in a single pass
+  // Tokens go to `arena` (for ex. on the stack), which can be nullptr.
+  // If they don't fit, the parser moves to a heap buffer that grows as needed.
+  JsonParser(char * json_in, jsmntok_t * arena, size_t arena_size);
+
   // destructor
   ~JsonParser();
 
   // set the current buffer for attribute access (i.e. set the global)
-  void setCurrent(void) { k_current_json_buffer = _json; }
+  void setCurrent(void) { k_current_json_buffer = _json; k_current_json_index = _index.table ? &_index : nullptr; }
+
+  // build a hash index of the keys for every object with at least `min_keys` keys
+  // so that `JsonParserObject::operator[]` doesn't need to scan all the keys.
+  // Worth it when looking up many keys in the same object.
+  // Returns false if out of memory, lookups still work with a linear scan.
+  bool buildKeyIndex(size_t min_keys = JSON_PARSER_INDEX_MIN_KEYS);
 
   // test if the parsing was successful
   inline explicit operator bool() const { return _token_len > 0; }
@@ -251,6 +279,8 @@ protected:
   jsmntok_t * _tokens;        // pointer to token buffer
   jsmn_parser _parser;        // jmsn_parser structure
   char      * _json;          // json buffer
+  bool        _own_tokens;    // true if `_tokens` was allocated by us
+  JsonParserIndex _index;     // optional key index
 
   // disallocate token buffer
   void free(void);
@@ -258,10 +288,15 @@ protected:
   // allocate token buffer of size _size
   void allocate(void);
 
+  // grow the token buffer to `new_size` keeping its content, returns false if out of memory
+  bool grow(size_t new_size);
+
   // access tokens by index
   const JsonParserToken operator[](int32_t i) const;
   // parse
   void parse(char * json_in);
+  // parse in a single pass, growing the token buffer if needed
+  void parseSinglePass(char * json_in);
   // post-process parsing: insert NULL chars to split strings, compute a more precise token type
   void postProcess(size_t json_len);
 };
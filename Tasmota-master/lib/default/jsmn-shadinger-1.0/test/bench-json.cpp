@@ -0,0 +1,94 @@
+/*
+  bench-json.cpp - host benchmark of JsonParser over typical Tasmota command payloads
+
+  Compares:
+  - the default two-pass parser, with linear key look-ups
+  - the single-pass parser into a stack arena
+  - the single-pass parser with a key index
+
+  Build and run from this directory:
+    g++ -O2 -std=gnu++11 -Ihost bench-json.cpp ../src/JsonParser.cpp ../src/jsmn.cpp -o bench-json && ./bench-json
+*/
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include "../src/JsonParser.h"
+
+static const uint32_t kPasses = 100000;
+
+typedef struct {
+  const char * title;
+  const char * json;
+  const char * keys[24];       // keys looked up by the command, nullptr terminated
+} payload_t;
+
+static const payload_t kPayloads[] = {
+  { "Power",
+    "{\"Power\":\"On\"}",
+    { "Power", nullptr } },
+  { "IRHVAC",
+    "{\"Vendor\":\"Daikin\",\"Model\":-1,\"Mode\":\"Cool\",\"Power\":\"On\",\"Celsius\":\"On\",\"Temp\":22.5,"
+    "\"FanSpeed\":\"Auto\",\"SwingV\":\"Auto\",\"SwingH\":\"Off\",\"Quiet\":\"Off\",\"Turbo\":\"Off\",\"Econo\":\"Off\","
+    "\"Light\":\"On\",\"Filter\":\"Off\",\"Clean\":\"Off\",\"Beep\":\"Off\",\"Sleep\":-1,\"iFeel\":\"Off\","
+    "\"SensorTemp\":21.3,\"StateMode\":\"SendStore\"}",
+    { "Vendor", "Protocol", "Model", "Mode", "Power", "Celsius", "Temp", "FanSpeed", "SwingV", "SwingH",
+      "Quiet", "Turbo", "Econo", "Light", "Filter", "Clean", "Beep", "Sleep", "Clock", "iFeel",
+      "SensorTemp", "StateMode", nullptr } },
+  { "ZbSend",
+    "{\"Device\":\"0x1234\",\"Endpoint\":\"0x03\",\"Manuf\":\"0x115F\",\"Send\":{\"Power\":true,\"Dimmer\":128}}",
+    { "Device", "Group", "Endpoint", "Manuf", "Cluster", "Send", "Write", "Read", "Config", "Response", nullptr } },
+  { "ZbReceived",
+    "{\"Device\":\"0x9C33\",\"Name\":\"Kitchen\",\"Illuminance\":42,\"Occupancy\":1,\"Temperature\":21.5,"
+    "\"Humidity\":48.2,\"Pressure\":1013.2,\"BatteryVoltage\":2.98,\"BatteryPercentage\":87,"
+    "\"Endpoint\":1,\"LinkQuality\":59}",
+    { "Device", "Name", "Illuminance", "Occupancy", "Temperature", "Humidity", "Pressure",
+      "BatteryVoltage", "BatteryPercentage", "Endpoint", "LinkQuality", nullptr } },
+};
+
+enum { kTwoPass, kArena, kArenaIndex };
+static const char * kModes[] = { "two-pass", "arena", "arena+index" };
+
+// look up all `keys`, returns a checksum of what was found
+static uint32_t lookup(JsonParserObject root, const char * const * keys) {
+  uint32_t sum = 0;
+  for (const char * const * key = keys; *key; key++) {
+    JsonParserToken val = root[*key];
+    if (val) { sum += val.getUInt() + val.size() + 1; }
+  }
+  return sum;
+}
+
+// parse `json` and look up all `keys`
+static uint32_t run(char * json, const char * const * keys, uint32_t mode) {
+  if (kTwoPass == mode) {
+    JsonParser parser(json);
+    return lookup(parser.getRootObject(), keys);
+  }
+  jsmntok_t arena[64];
+  JsonParser parser(json, arena, ARRAY_SIZE(arena));
+  if (kArenaIndex == mode) { parser.buildKeyIndex(); }
+  return lookup(parser.getRootObject(), keys);
+}
+
+int main(int argc, char* argv[]) {
+  char buf[1024];
+  for (const payload_t & payload : kPayloads) {
+    uint32_t check[3];
+    for (uint32_t mode = 0; mode < 3; mode++) {
+      check[mode] = 0;
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (uint32_t pass = 0; pass < kPasses; pass++) {
+        strcpy(buf, payload.json);      // parsing is in-place
+        check[mode] += run(buf, payload.keys, mode);
+      }
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      printf("%-11s %-12s %8.1f ns/command\n", payload.title, kModes[mode], elapsed.count() * 1e9 / kPasses);
+    }
+    if ((check[0] != check[1]) || (check[0] != check[2])) {
+      printf("%s: results differ (%u, %u, %u)\n", payload.title, check[0], check[1], check[2]);
+      return 1;
+    }
+  }
+  return 0;
+}
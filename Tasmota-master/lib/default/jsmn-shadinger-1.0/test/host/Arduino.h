@@ -0,0 +1,48 @@
+/*
+  Arduino.h - minimal host stand-in, just enough to build JsonParser on a PC
+
+  Copyright (C) 2021  Stephan Hadinger
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __HOST_ARDUINO__
+#define __HOST_ARDUINO__
+
+#include <ctype.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <string>
+
+#define PROGMEM
+#define PSTR(s)               (s)
+#define pgm_read_byte(x)      (*(const uint8_t*)(x))
+#define strcmp_P(x, y)        strcmp(x, y)
+#define strcasecmp_P(x, y)    strcasecmp(x, y)
+
+class __FlashStringHelper;
+
+class String {
+public:
+  String(const char * s) : _s(s ? s : "") { }
+  explicit String(const __FlashStringHelper * s) : _s(s ? (const char*) s : "") { }
+  const char * c_str(void) const { return _s.c_str(); }
+  void toLowerCase(void) { for (auto & c : _s) { c = tolower(c); } }
+  bool startsWith(const String & s) const { return 0 == _s.compare(0, s._s.size(), s._s); }
+private:
+  std::string _s;
+};
+
+#endif // __HOST_ARDUINO__
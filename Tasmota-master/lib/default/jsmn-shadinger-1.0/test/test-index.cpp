@@ -0,0 +1,142 @@
+/*
+  test-index.cpp - host test of JsonParser key index against the linear look-up
+
+  Build and run from this directory:
+    g++ -O2 -std=gnu++11 -Ihost test-index.cpp ../src/JsonParser.cpp ../src/jsmn.cpp -o test-index && ./test-index
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "../src/JsonParser.h"
+
+static uint32_t errors = 0;
+static uint32_t lookups = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAIL line %d: %s\n", __LINE__, #cond); errors++; } } while (0)
+
+// reference: scan all keys, first match wins
+static JsonParserToken linear(const JsonParserObject & obj, const char * needle) {
+  for (const auto key : obj) {
+    if (0 == strcasecmp(key.getStr(), needle)) { return key.getValue(); }
+  }
+  return JsonParserToken(&token_bad);
+}
+
+static void check_lookup(const JsonParserObject & obj, const char * needle) {
+  JsonParserToken ref = linear(obj, needle);
+  JsonParserToken val = obj[needle];
+  lookups++;
+  if (ref.t != val.t) {
+    printf("FAIL key '%s': linear token %p, indexed token %p\n", needle, (void*)ref.t, (void*)val.t);
+    errors++;
+  }
+}
+
+// look-up every key of every object, in any case, plus a few missing ones
+static void check_all(const JsonParserToken & tok) {
+  if (tok.isObject()) {
+    JsonParserObject obj(tok);
+    for (const auto key : obj) {
+      std::string name = key.getStr();
+      check_lookup(obj, name.c_str());
+      for (auto & c : name) { c = (c >= 'a' && c <= 'z') ? c - 32 : ((c >= 'A' && c <= 'Z') ? c + 32 : c); }
+      check_lookup(obj, name.c_str());
+      check_all(key.getValue());
+    }
+    check_lookup(obj, "Missing");
+    check_lookup(obj, "K0");              // prefix of existing keys
+    check_lookup(obj, "K000");            // existing keys are a prefix
+    check_lookup(obj, "Inner01");         // only in a nested object
+  } else if (tok.isArray()) {
+    for (const auto val : JsonParserArray(tok)) { check_all(val); }
+  }
+}
+
+// object with `n` keys "<prefix>00".. and int values, nested object as value of key `nested_at`
+static std::string make_object(const char * prefix, uint32_t n, const std::string & nested = "", uint32_t nested_at = 0) {
+  std::string s = "{";
+  char buf[32];
+  for (uint32_t i = 0; i < n; i++) {
+    snprintf(buf, sizeof(buf), "%s\"%s%02u\":", i ? "," : "", prefix, i);
+    s += buf;
+    if (nested.size() && (i == nested_at)) {
+      s += nested;
+    } else {
+      snprintf(buf, sizeof(buf), "%u", i * 7);
+      s += buf;
+    }
+  }
+  return s + "}";
+}
+
+int main(int argc, char* argv[]) {
+  // nested objects above and below the index threshold, arrays of objects, duplicate keys
+  std::string inner = make_object("Inner", 14);
+  std::string small = make_object("S", 3);
+  std::string json = make_object("K", 30, inner, 5);
+  json.pop_back();
+  json += ",\"Small\":" + small;
+  json += ",\"List\":[" + make_object("A", 12) + "," + make_object("B", 20) + ",1,\"x\"]";
+  json += ",\"Dup\":1,\"dup\":2,\"DUP\":3,\"K07\":\"again\"}";
+  CHECK(json.size() < 2048);              // jsmn limit
+
+  std::string json2 = json;
+  JsonParser parser(&json[0]);
+  CHECK((bool) parser);
+  CHECK(parser.buildKeyIndex());
+  CHECK(nullptr != k_current_json_index);
+  JsonParserObject root = parser.getRootObject();
+  check_all(root);
+
+  // duplicates resolve to the first one, like the linear scan
+  CHECK(1 == root["dup"].getInt());
+  CHECK(1 == root["DUP"].getInt());
+  CHECK(49 == root["K07"].getInt());
+  CHECK(!root["Missing"]);
+  CHECK(!root[""]);
+  CHECK(root["?"].t == root["K00"].t);    // wildcard is not indexed, first key
+  CHECK(14 == root["K05"].getObject()["Inner02"].getInt());
+  CHECK(!root["K05"].getObject()["K06"]);
+
+  // index every object, including the small ones
+  CHECK(parser.buildKeyIndex(1));
+  check_all(root);
+
+  // another parser's objects are not indexed and use the linear scan
+  JsonParser parser2(&json2[0]);
+  parser2.setCurrent();
+  CHECK(nullptr == k_current_json_index);
+  check_all(parser2.getRootObject());
+  parser.setCurrent();
+  CHECK(nullptr != k_current_json_index);
+  check_all(root);
+
+  // single pass parsing with a too small arena, then index
+  std::string json3 = make_object("K", 60);
+  jsmntok_t arena[8];
+  JsonParser parser3(&json3[0], arena, 8);
+  CHECK((bool) parser3);
+  CHECK(parser3.buildKeyIndex());
+  JsonParserObject root3 = parser3.getRootObject();
+  CHECK(60 == root3.size());
+  check_all(root3);
+  CHECK(59 * 7 == root3["k59"].getInt());
+
+  // empty input leaves an invalid root, even in an arena with garbage
+  char empty[] = "";
+  jsmntok_t arena4[4];
+  memset(arena4, 0x5A, sizeof(arena4));
+  arena4[0].type = JSMN_OBJECT;
+  arena4[0].size = 3;
+  JsonParser parser4(empty, arena4, 4);
+  CHECK(!parser4);
+  CHECK(!parser4.getRoot());
+  CHECK(!parser4.getRootObject());
+  CHECK(0 == parser4.getRootObject().size());
+  JsonParser parser5(nullptr, arena4, 4);
+  CHECK(!parser5.getRootObject());
+
+  printf("%u look-ups, %s (%u errors)\n", lookups, errors ? "FAILED" : "OK", errors);
+  return errors ? 1 : 0;
+}
@@ -62,6 +62,19 @@
 #define STRCASECMP(LHS, RHS) strcasecmp(LHS, RHS)
 #endif  // ESP8266
 #endif  // STRCASECMP
+#ifndef MEMCPY
+#if defined(ESP8266)
+#define MEMCPY(DST, SRC, LEN) memcpy_P(DST, SRC, LEN)
+#else  // ESP8266
+#define MEMCPY(DST, SRC, LEN) memcpy(DST, SRC, LEN)
+#endif  // ESP8266
+#endif  // MEMCPY
+#ifndef FPSTR
+#define FPSTR(X) X
+#endif  // FPSTR
+#ifndef PROGMEM
+#define PROGMEM  // Pretend we have the PROGMEM macro even if we really don't.
+#endif  // PROGMEM
 
 /// Class constructor
 /// @param[in] pin Gpio pin to use when transmitting IR messages.
@@ -3242,40 +3255,223 @@ bool IRac::cmpStates(const stdAc::state_t a, const stdAc::state_t b) {
 /// @return True if it has changed, False if not.
 bool IRac::hasStateChanged(void) { return cmpStates(next, _prev); }
 
+namespace {
+/// Text that the `IRac::strTo...()` routines accept, and what it converts to.
+typedef IRTEXT_CONST_PTR(irac_text_t);
+struct irac_name_t {
+  uint32_t hash;  ///< `irutils::strCaseHash()` of the text, for quick rejects.
+  const irac_text_t *text;
+  int16_t value;
+};
+
+// The hash is calculated at compile-time from the same locale string as the
+// text, so a lookup only needs one string comparison when it matches.
+#define IRAC_NAME(TEXT, STR, VALUE) \
+    {irutils::strCaseHash(STR), &TEXT, static_cast<int16_t>(VALUE)}
+
+const irac_name_t kOpmodeNames[] PROGMEM = {
+    IRAC_NAME(kAutoStr, D_STR_AUTO, stdAc::opmode_t::kAuto),
+    IRAC_NAME(kAutomaticStr, D_STR_AUTOMATIC, stdAc::opmode_t::kAuto),
+    IRAC_NAME(kOffStr, D_STR_OFF, stdAc::opmode_t::kOff),
+    IRAC_NAME(kStopStr, D_STR_STOP, stdAc::opmode_t::kOff),
+    IRAC_NAME(kCoolStr, D_STR_COOL, stdAc::opmode_t::kCool),
+    IRAC_NAME(kCoolingStr, D_STR_COOLING, stdAc::opmode_t::kCool),
+    IRAC_NAME(kHeatStr, D_STR_HEAT, stdAc::opmode_t::kHeat),
+    IRAC_NAME(kHeatingStr, D_STR_HEATING, stdAc::opmode_t::kHeat),
+    IRAC_NAME(kDryStr, D_STR_DRY, stdAc::opmode_t::kDry),
+    IRAC_NAME(kDryingStr, D_STR_DRYING, stdAc::opmode_t::kDry),
+    IRAC_NAME(kDehumidifyStr, D_STR_DEHUMIDIFY, stdAc::opmode_t::kDry),
+    IRAC_NAME(kFanStr, D_STR_FAN, stdAc::opmode_t::kFan),
+    IRAC_NAME(kFanOnlyStr, D_STR_FANONLY, stdAc::opmode_t::kFan),
+    IRAC_NAME(kFan_OnlyStr, D_STR_FAN_ONLY, stdAc::opmode_t::kFan),
+    IRAC_NAME(kFanOnlyWithSpaceStr, D_STR_FANSPACEONLY, stdAc::opmode_t::kFan),
+    IRAC_NAME(kFanOnlyNoSpaceStr, D_STR_FANONLYNOSPACE, stdAc::opmode_t::kFan),
+};
+const irac_name_t kFanspeedNames[] PROGMEM = {
+    IRAC_NAME(kAutoStr, D_STR_AUTO, stdAc::fanspeed_t::kAuto),
+    IRAC_NAME(kAutomaticStr, D_STR_AUTOMATIC, stdAc::fanspeed_t::kAuto),
+    IRAC_NAME(kMinStr, D_STR_MIN, stdAc::fanspeed_t::kMin),
+    IRAC_NAME(kMinimumStr, D_STR_MINIMUM, stdAc::fanspeed_t::kMin),
+    IRAC_NAME(kLowestStr, D_STR_LOWEST, stdAc::fanspeed_t::kMin),
+    IRAC_NAME(kLowStr, D_STR_LOW, stdAc::fanspeed_t::kLow),
+    IRAC_NAME(kLoStr, D_STR_LO, stdAc::fanspeed_t::kLow),
+    IRAC_NAME(kMedStr, D_STR_MED, stdAc::fanspeed_t::kMedium),
+    IRAC_NAME(kMediumStr, D_STR_MEDIUM, stdAc::fanspeed_t::kMedium),
+    IRAC_NAME(kMidStr, D_STR_MID, stdAc::fanspeed_t::kMedium),
+    IRAC_NAME(kHighStr, D_STR_HIGH, stdAc::fanspeed_t::kHigh),
+    IRAC_NAME(kHiStr, D_STR_HI, stdAc::fanspeed_t::kHigh),
+    IRAC_NAME(kMaxStr, D_STR_MAX, stdAc::fanspeed_t::kMax),
+    IRAC_NAME(kMaximumStr, D_STR_MAXIMUM, stdAc::fanspeed_t::kMax),
+    IRAC_NAME(kHighestStr, D_STR_HIGHEST, stdAc::fanspeed_t::kMax),
+};
+const irac_name_t kSwingVNames[] PROGMEM = {
+    IRAC_NAME(kAutoStr, D_STR_AUTO, stdAc::swingv_t::kAuto),
+    IRAC_NAME(kAutomaticStr, D_STR_AUTOMATIC, stdAc::swingv_t::kAuto),
+    IRAC_NAME(kOnStr, D_STR_ON, stdAc::swingv_t::kAuto),
+    IRAC_NAME(kSwingStr, D_STR_SWING, stdAc::swingv_t::kAuto),
+    IRAC_NAME(kOffStr, D_STR_OFF, stdAc::swingv_t::kOff),
+    IRAC_NAME(kStopStr, D_STR_STOP, stdAc::swingv_t::kOff),
+    IRAC_NAME(kMinStr, D_STR_MIN, stdAc::swingv_t::kLowest),
+    IRAC_NAME(kMinimumStr, D_STR_MINIMUM, stdAc::swingv_t::kLowest),
+    IRAC_NAME(kLowestStr, D_STR_LOWEST, stdAc::swingv_t::kLowest),
+    IRAC_NAME(kBottomStr, D_STR_BOTTOM, stdAc::swingv_t::kLowest),
+    IRAC_NAME(kDownStr, D_STR_DOWN, stdAc::swingv_t::kLowest),
+    IRAC_NAME(kLowStr, D_STR_LOW, stdAc::swingv_t::kLow),
+    IRAC_NAME(kMidStr, D_STR_MID, stdAc::swingv_t::kMiddle),
+    IRAC_NAME(kMiddleStr, D_STR_MIDDLE, stdAc::swingv_t::kMiddle),
+    IRAC_NAME(kMedStr, D_STR_MED, stdAc::swingv_t::kMiddle),
+    IRAC_NAME(kMediumStr, D_STR_MEDIUM, stdAc::swingv_t::kMiddle),
+    IRAC_NAME(kCentreStr, D_STR_CENTRE, stdAc::swingv_t::kMiddle),
+    IRAC_NAME(kHighStr, D_STR_HIGH, stdAc::swingv_t::kHigh),
+    IRAC_NAME(kHiStr, D_STR_HI, stdAc::swingv_t::kHigh),
+    IRAC_NAME(kHighestStr, D_STR_HIGHEST, stdAc::swingv_t::kHighest),
+    IRAC_NAME(kMaxStr, D_STR_MAX, stdAc::swingv_t::kHighest),
+    IRAC_NAME(kMaximumStr, D_STR_MAXIMUM, stdAc::swingv_t::kHighest),
+    IRAC_NAME(kTopStr, D_STR_TOP, stdAc::swingv_t::kHighest),
+    IRAC_NAME(kUpStr, D_STR_UP, stdAc::swingv_t::kHighest),
+};
+const irac_name_t kSwingHNames[] PROGMEM = {
+    IRAC_NAME(kAutoStr, D_STR_AUTO, stdAc::swingh_t::kAuto),
+    IRAC_NAME(kAutomaticStr, D_STR_AUTOMATIC, stdAc::swingh_t::kAuto),
+    IRAC_NAME(kOnStr, D_STR_ON, stdAc::swingh_t::kAuto),
+    IRAC_NAME(kSwingStr, D_STR_SWING, stdAc::swingh_t::kAuto),
+    IRAC_NAME(kOffStr, D_STR_OFF, stdAc::swingh_t::kOff),
+    IRAC_NAME(kStopStr, D_STR_STOP, stdAc::swingh_t::kOff),
+    IRAC_NAME(kLeftMaxNoSpaceStr, D_STR_LEFTMAX_NOSPACE,
+              stdAc::swingh_t::kLeftMax),
+    IRAC_NAME(kLeftMaxStr, D_STR_LEFTMAX, stdAc::swingh_t::kLeftMax),
+    IRAC_NAME(kMaxLeftNoSpaceStr, D_STR_MAXLEFT_NOSPACE,
+              stdAc::swingh_t::kLeftMax),
+    IRAC_NAME(kMaxLeftStr, D_STR_MAXLEFT, stdAc::swingh_t::kLeftMax),
+    IRAC_NAME(kLeftStr, D_STR_LEFT, stdAc::swingh_t::kLeft),
+    IRAC_NAME(kMidStr, D_STR_MID, stdAc::swingh_t::kMiddle),
+    IRAC_NAME(kMiddleStr, D_STR_MIDDLE, stdAc::swingh_t::kMiddle),
+    IRAC_NAME(kMedStr, D_STR_MED, stdAc::swingh_t::kMiddle),
+    IRAC_NAME(kMediumStr, D_STR_MEDIUM, stdAc::swingh_t::kMiddle),
+    IRAC_NAME(kCentreStr, D_STR_CENTRE, stdAc::swingh_t::kMiddle),
+    IRAC_NAME(kRightStr, D_STR_RIGHT, stdAc::swingh_t::kRight),
+    IRAC_NAME(kRightMaxNoSpaceStr, D_STR_RIGHTMAX_NOSPACE,
+              stdAc::swingh_t::kRightMax),
+    IRAC_NAME(kRightMaxStr, D_STR_RIGHTMAX, stdAc::swingh_t::kRightMax),
+    IRAC_NAME(kMaxRightNoSpaceStr, D_STR_MAXRIGHT_NOSPACE,
+              stdAc::swingh_t::kRightMax),
+    IRAC_NAME(kMaxRightStr, D_STR_MAXRIGHT, stdAc::swingh_t::kRightMax),
+    IRAC_NAME(kWideStr, D_STR_WIDE, stdAc::swingh_t::kWide),
+};
+const irac_name_t kBoolNames[] PROGMEM = {
+    IRAC_NAME(kOnStr, D_STR_ON, true),
+    IRAC_NAME(k1Str, D_STR_1, true),
+    IRAC_NAME(kYesStr, D_STR_YES, true),
+    IRAC_NAME(kTrueStr, D_STR_TRUE, true),
+    IRAC_NAME(kOffStr, D_STR_OFF, false),
+    IRAC_NAME(k0Str, D_STR_0, false),
+    IRAC_NAME(kNoStr, D_STR_NO, false),
+    IRAC_NAME(kFalseStr, D_STR_FALSE, false),
+};
+const irac_name_t kModelNames[] PROGMEM = {
+    // Gree
+    IRAC_NAME(kYaw1fStr, D_STR_YAW1F, gree_ac_remote_model_t::YAW1F),
+    IRAC_NAME(kYbofbStr, D_STR_YBOFB, gree_ac_remote_model_t::YBOFB),
+    // Haier models
+    IRAC_NAME(kV9014557AStr, D_STR_V9014557_A,
+              haier_ac176_remote_model_t::V9014557_A),
+    IRAC_NAME(kV9014557BStr, D_STR_V9014557_B,
+              haier_ac176_remote_model_t::V9014557_B),
+    // HitachiAc1 models
+    IRAC_NAME(kRlt0541htaaStr, D_STR_RLT0541HTA_A,
+              hitachi_ac1_remote_model_t::R_LT0541_HTA_A),
+    IRAC_NAME(kRlt0541htabStr, D_STR_RLT0541HTA_B,
+              hitachi_ac1_remote_model_t::R_LT0541_HTA_B),
+    // Fujitsu A/C models
+    IRAC_NAME(kArrah2eStr, D_STR_ARRAH2E, fujitsu_ac_remote_model_t::ARRAH2E),
+    IRAC_NAME(kArdb1Str, D_STR_ARDB1, fujitsu_ac_remote_model_t::ARDB1),
+    IRAC_NAME(kArreb1eStr, D_STR_ARREB1E, fujitsu_ac_remote_model_t::ARREB1E),
+    IRAC_NAME(kArjw2Str, D_STR_ARJW2, fujitsu_ac_remote_model_t::ARJW2),
+    IRAC_NAME(kArry4Str, D_STR_ARRY4, fujitsu_ac_remote_model_t::ARRY4),
+    IRAC_NAME(kArrew4eStr, D_STR_ARREW4E, fujitsu_ac_remote_model_t::ARREW4E),
+    // LG A/C models
+    IRAC_NAME(kGe6711ar2853mStr, D_STR_GE6711AR2853M,
+              lg_ac_remote_model_t::GE6711AR2853M),
+    IRAC_NAME(kAkb75215403Str, D_STR_AKB75215403,
+              lg_ac_remote_model_t::AKB75215403),
+    IRAC_NAME(kAkb74955603Str, D_STR_AKB74955603,
+              lg_ac_remote_model_t::AKB74955603),
+    IRAC_NAME(kAkb73757604Str, D_STR_AKB73757604,
+              lg_ac_remote_model_t::AKB73757604),
+    // Panasonic A/C families
+    IRAC_NAME(kLkeStr, D_STR_LKE, panasonic_ac_remote_model_t::kPanasonicLke),
+    IRAC_NAME(kPanasonicLkeStr, D_STR_PANASONICLKE,
+              panasonic_ac_remote_model_t::kPanasonicLke),
+    IRAC_NAME(kNkeStr, D_STR_NKE, panasonic_ac_remote_model_t::kPanasonicNke),
+    IRAC_NAME(kPanasonicNkeStr, D_STR_PANASONICNKE,
+              panasonic_ac_remote_model_t::kPanasonicNke),
+    IRAC_NAME(kDkeStr, D_STR_DKE, panasonic_ac_remote_model_t::kPanasonicDke),
+    IRAC_NAME(kPanasonicDkeStr, D_STR_PANASONICDKE,
+              panasonic_ac_remote_model_t::kPanasonicDke),
+    IRAC_NAME(kPkrStr, D_STR_PKR, panasonic_ac_remote_model_t::kPanasonicDke),
+    IRAC_NAME(kPanasonicPkrStr, D_STR_PANASONICPKR,
+              panasonic_ac_remote_model_t::kPanasonicDke),
+    IRAC_NAME(kJkeStr, D_STR_JKE, panasonic_ac_remote_model_t::kPanasonicJke),
+    IRAC_NAME(kPanasonicJkeStr, D_STR_PANASONICJKE,
+              panasonic_ac_remote_model_t::kPanasonicJke),
+    IRAC_NAME(kCkpStr, D_STR_CKP, panasonic_ac_remote_model_t::kPanasonicCkp),
+    IRAC_NAME(kPanasonicCkpStr, D_STR_PANASONICCKP,
+              panasonic_ac_remote_model_t::kPanasonicCkp),
+    IRAC_NAME(kRkrStr, D_STR_RKR, panasonic_ac_remote_model_t::kPanasonicRkr),
+    IRAC_NAME(kPanasonicRkrStr, D_STR_PANASONICRKR,
+              panasonic_ac_remote_model_t::kPanasonicRkr),
+    // Sharp A/C Models
+    IRAC_NAME(kA907Str, D_STR_A907, sharp_ac_remote_model_t::A907),
+    IRAC_NAME(kA705Str, D_STR_A705, sharp_ac_remote_model_t::A705),
+    IRAC_NAME(kA903Str, D_STR_A903, sharp_ac_remote_model_t::A903),
+    // TCL A/C Models
+    IRAC_NAME(kTac09chsdStr, D_STR_TAC09CHSD, tcl_ac_remote_model_t::TAC09CHSD),
+    IRAC_NAME(kGz055be1Str, D_STR_GZ055BE1, tcl_ac_remote_model_t::GZ055BE1),
+    // Voltas A/C models
+    IRAC_NAME(k122lzfStr, D_STR_122LZF,
+              voltas_ac_remote_model_t::kVoltas122LZF),
+    // Whirlpool A/C models
+    IRAC_NAME(kDg11j13aStr, D_STR_DG11J13A,
+              whirlpool_ac_remote_model_t::DG11J13A),
+    IRAC_NAME(kDg11j104Str, D_STR_DG11J104,
+              whirlpool_ac_remote_model_t::DG11J13A),
+    IRAC_NAME(kDg11j191Str, D_STR_DG11J191,
+              whirlpool_ac_remote_model_t::DG11J191),
+};
+
+#define IRAC_NAMES_SIZE(TABLE) (sizeof(TABLE) / sizeof(TABLE[0]))
+
+/// Look up a string in one of the name tables. (Case insensitive)
+/// @param[in] str A Ptr to a C-style string to be converted.
+/// @param[in] table The name table to search.
+/// @param[in] size The nr. of entries in `table`.
+/// @param[out] value Where to store the value of the matching entry.
+/// @return true, if a match was found. Otherwise, false.
+bool lookupName(const char *str, const irac_name_t *table,
+                const uint16_t size, int16_t *value) {
+  const uint32_t hash = irutils::strCaseHash(str);
+  for (uint16_t i = 0; i < size; i++) {
+    irac_name_t entry;
+    MEMCPY(&entry, &table[i], sizeof(entry));
+    if (entry.hash == hash && !STRCASECMP(str, *entry.text)) {
+      *value = entry.value;
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace
+
 /// Convert the supplied str into the appropriate enum.
 /// @param[in] str A Ptr to a C-style string to be converted.
 /// @param[in] def The enum to return if no conversion was possible.
 /// @return The equivalent enum.
 stdAc::opmode_t IRac::strToOpmode(const char *str,
                                   const stdAc::opmode_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr))
-    return stdAc::opmode_t::kAuto;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, kStopStr))
-    return stdAc::opmode_t::kOff;
-  else if (!STRCASECMP(str, kCoolStr) ||
-           !STRCASECMP(str, kCoolingStr))
-    return stdAc::opmode_t::kCool;
-  else if (!STRCASECMP(str, kHeatStr) ||
-           !STRCASECMP(str, kHeatingStr))
-    return stdAc::opmode_t::kHeat;
-  else if (!STRCASECMP(str, kDryStr) ||
-           !STRCASECMP(str, kDryingStr) ||
-           !STRCASECMP(str, kDehumidifyStr))
-    return stdAc::opmode_t::kDry;
-  else if (!STRCASECMP(str, kFanStr) ||
-          // The following Fans strings with "only" are required to help with
-          // HomeAssistant & Google Home Climate integration.
-          // For compatibility only.
-          // Ref: https://www.home-assistant.io/integrations/google_assistant/#climate-operation-modes
-           !STRCASECMP(str, kFanOnlyStr) ||
-           !STRCASECMP(str, kFan_OnlyStr) ||
-           !STRCASECMP(str, kFanOnlyWithSpaceStr) ||
-           !STRCASECMP(str, kFanOnlyNoSpaceStr))
-    return stdAc::opmode_t::kFan;
-  else
-    return def;
+  int16_t value;
+  if (lookupName(str, kOpmodeNames, IRAC_NAMES_SIZE(kOpmodeNames), &value))
+    return static_cast<stdAc::opmode_t>(value);
+  return def;
 }
 
 /// Convert the supplied str into the appropriate enum.
@@ -3284,29 +3480,10 @@ stdAc::opmode_t IRac::strToOpmode(const char *str,
 /// @return The equivalent enum.
 stdAc::fanspeed_t IRac::strToFanspeed(const char *str,
                                       const stdAc::fanspeed_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr))
-    return stdAc::fanspeed_t::kAuto;
-  else if (!STRCASECMP(str, kMinStr) ||
-           !STRCASECMP(str, kMinimumStr) ||
-           !STRCASECMP(str, kLowestStr))
-    return stdAc::fanspeed_t::kMin;
-  else if (!STRCASECMP(str, kLowStr) ||
-           !STRCASECMP(str, kLoStr))
-    return stdAc::fanspeed_t::kLow;
-  else if (!STRCASECMP(str, kMedStr) ||
-           !STRCASECMP(str, kMediumStr) ||
-           !STRCASECMP(str, kMidStr))
-    return stdAc::fanspeed_t::kMedium;
-  else if (!STRCASECMP(str, kHighStr) ||
-           !STRCASECMP(str, kHiStr))
-    return stdAc::fanspeed_t::kHigh;
-  else if (!STRCASECMP(str, kMaxStr) ||
-           !STRCASECMP(str, kMaximumStr) ||
-           !STRCASECMP(str, kHighestStr))
-    return stdAc::fanspeed_t::kMax;
-  else
-    return def;
+  int16_t value;
+  if (lookupName(str, kFanspeedNames, IRAC_NAMES_SIZE(kFanspeedNames), &value))
+    return static_cast<stdAc::fanspeed_t>(value);
+  return def;
 }
 
 /// Convert the supplied str into the appropriate enum.
@@ -3315,39 +3492,10 @@ stdAc::fanspeed_t IRac::strToFanspeed(const char *str,
 /// @return The equivalent enum.
 stdAc::swingv_t IRac::strToSwingV(const char *str,
                                   const stdAc::swingv_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr) ||
-      !STRCASECMP(str, kOnStr) ||
-      !STRCASECMP(str, kSwingStr))
-    return stdAc::swingv_t::kAuto;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, kStopStr))
-    return stdAc::swingv_t::kOff;
-  else if (!STRCASECMP(str, kMinStr) ||
-           !STRCASECMP(str, kMinimumStr) ||
-           !STRCASECMP(str, kLowestStr) ||
-           !STRCASECMP(str, kBottomStr) ||
-           !STRCASECMP(str, kDownStr))
-    return stdAc::swingv_t::kLowest;
-  else if (!STRCASECMP(str, kLowStr))
-    return stdAc::swingv_t::kLow;
-  else if (!STRCASECMP(str, kMidStr) ||
-           !STRCASECMP(str, kMiddleStr) ||
-           !STRCASECMP(str, kMedStr) ||
-           !STRCASECMP(str, kMediumStr) ||
-           !STRCASECMP(str, kCentreStr))
-    return stdAc::swingv_t::kMiddle;
-  else if (!STRCASECMP(str, kHighStr) ||
-           !STRCASECMP(str, kHiStr))
-    return stdAc::swingv_t::kHigh;
-  else if (!STRCASECMP(str, kHighestStr) ||
-           !STRCASECMP(str, kMaxStr) ||
-           !STRCASECMP(str, kMaximumStr) ||
-           !STRCASECMP(str, kTopStr) ||
-           !STRCASECMP(str, kUpStr))
-    return stdAc::swingv_t::kHighest;
-  else
-    return def;
+  int16_t value;
+  if (lookupName(str, kSwingVNames, IRAC_NAMES_SIZE(kSwingVNames), &value))
+    return static_cast<stdAc::swingv_t>(value);
+  return def;
 }
 
 /// Convert the supplied str into the appropriate enum.
@@ -3356,37 +3504,10 @@ stdAc::swingv_t IRac::strToSwingV(const char *str,
 /// @return The equivalent enum.
 stdAc::swingh_t IRac::strToSwingH(const char *str,
                                   const stdAc::swingh_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr) ||
-      !STRCASECMP(str, kOnStr) || !STRCASECMP(str, kSwingStr))
-    return stdAc::swingh_t::kAuto;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, kStopStr))
-    return stdAc::swingh_t::kOff;
-  else if (!STRCASECMP(str, kLeftMaxNoSpaceStr) ||              // "LeftMax"
-           !STRCASECMP(str, kLeftMaxStr) ||                     // "Left Max"
-           !STRCASECMP(str, kMaxLeftNoSpaceStr) ||              // "MaxLeft"
-           !STRCASECMP(str, kMaxLeftStr))                       // "Max Left"
-    return stdAc::swingh_t::kLeftMax;
-  else if (!STRCASECMP(str, kLeftStr))
-    return stdAc::swingh_t::kLeft;
-  else if (!STRCASECMP(str, kMidStr) ||
-           !STRCASECMP(str, kMiddleStr) ||
-           !STRCASECMP(str, kMedStr) ||
-           !STRCASECMP(str, kMediumStr) ||
-           !STRCASECMP(str, kCentreStr))
-    return stdAc::swingh_t::kMiddle;
-  else if (!STRCASECMP(str, kRightStr))
-    return stdAc::swingh_t::kRight;
-  else if (!STRCASECMP(str, kRightMaxNoSpaceStr) ||              // "RightMax"
-           !STRCASECMP(str, kRightMaxStr) ||                     // "Right Max"
-           !STRCASECMP(str, kMaxRightNoSpaceStr) ||              // "MaxRight"
-           !STRCASECMP(str, kMaxRightStr))                       // "Max Right"
-    return stdAc::swingh_t::kRightMax;
-  else if (!STRCASECMP(str, kWideStr))
-    return stdAc::swingh_t::kWide;
-  else
-    return def;
+  int16_t value;
+  if (lookupName(str, kSwingHNames, IRAC_NAMES_SIZE(kSwingHNames), &value))
+    return static_cast<stdAc::swingh_t>(value);
+  return def;
 }
 
 /// Convert the supplied str into the appropriate enum.
@@ -3396,92 +3517,14 @@ stdAc::swingh_t IRac::strToSwingH(const char *str,
 /// @return The equivalent enum.
 /// @note After adding a new model you should update modelToStr() too.
 int16_t IRac::strToModel(const char *str, const int16_t def) {
-  // Gree
-  if (!STRCASECMP(str, kYaw1fStr)) {
-    return gree_ac_remote_model_t::YAW1F;
-  } else if (!STRCASECMP(str, kYbofbStr)) {
-    return gree_ac_remote_model_t::YBOFB;
-  // Haier models
-  } else if (!STRCASECMP(str, kV9014557AStr)) {
-    return haier_ac176_remote_model_t::V9014557_A;
-  } else if (!STRCASECMP(str, kV9014557BStr)) {
-    return haier_ac176_remote_model_t::V9014557_B;
-  // HitachiAc1 models
-  } else if (!STRCASECMP(str, kRlt0541htaaStr)) {
-    return hitachi_ac1_remote_model_t::R_LT0541_HTA_A;
-  } else if (!STRCASECMP(str, kRlt0541htabStr)) {
-    return hitachi_ac1_remote_model_t::R_LT0541_HTA_B;
-  // Fujitsu A/C models
-  } else if (!STRCASECMP(str, kArrah2eStr)) {
-    return fujitsu_ac_remote_model_t::ARRAH2E;
-  } else if (!STRCASECMP(str, kArdb1Str)) {
-    return fujitsu_ac_remote_model_t::ARDB1;
-  } else if (!STRCASECMP(str, kArreb1eStr)) {
-    return fujitsu_ac_remote_model_t::ARREB1E;
-  } else if (!STRCASECMP(str, kArjw2Str)) {
-    return fujitsu_ac_remote_model_t::ARJW2;
-  } else if (!STRCASECMP(str, kArry4Str)) {
-    return fujitsu_ac_remote_model_t::ARRY4;
-  } else if (!STRCASECMP(str, kArrew4eStr)) {
-    return fujitsu_ac_remote_model_t::ARREW4E;
-  // LG A/C models
-  } else if (!STRCASECMP(str, kGe6711ar2853mStr)) {
-    return lg_ac_remote_model_t::GE6711AR2853M;
-  } else if (!STRCASECMP(str, kAkb75215403Str)) {
-    return lg_ac_remote_model_t::AKB75215403;
-  } else if (!STRCASECMP(str, kAkb74955603Str)) {
-    return lg_ac_remote_model_t::AKB74955603;
-  } else if (!STRCASECMP(str, kAkb73757604Str)) {
-    return lg_ac_remote_model_t::AKB73757604;
-  // Panasonic A/C families
-  } else if (!STRCASECMP(str, kLkeStr) ||
-             !STRCASECMP(str, kPanasonicLkeStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicLke;
-  } else if (!STRCASECMP(str, kNkeStr) ||
-             !STRCASECMP(str, kPanasonicNkeStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicNke;
-  } else if (!STRCASECMP(str, kDkeStr) ||
-             !STRCASECMP(str, kPanasonicDkeStr) ||
-             !STRCASECMP(str, kPkrStr) ||
-             !STRCASECMP(str, kPanasonicPkrStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicDke;
-  } else if (!STRCASECMP(str, kJkeStr) ||
-             !STRCASECMP(str, kPanasonicJkeStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicJke;
-  } else if (!STRCASECMP(str, kCkpStr) ||
-             !STRCASECMP(str, kPanasonicCkpStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicCkp;
-  } else if (!STRCASECMP(str, kRkrStr) ||
-             !STRCASECMP(str, kPanasonicRkrStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicRkr;
-  // Sharp A/C Models
-  } else if (!STRCASECMP(str, kA907Str)) {
-    return sharp_ac_remote_model_t::A907;
-  } else if (!STRCASECMP(str, kA705Str)) {
-    return sharp_ac_remote_model_t::A705;
-  } else if (!STRCASECMP(str, kA903Str)) {
-    return sharp_ac_remote_model_t::A903;
-  // TCL A/C Models
-  } else if (!STRCASECMP(str, kTac09chsdStr)) {
-    return tcl_ac_remote_model_t::TAC09CHSD;
-  } else if (!STRCASECMP(str, kGz055be1Str)) {
-    return tcl_ac_remote_model_t::GZ055BE1;
-  // Voltas A/C models
-  } else if (!STRCASECMP(str, k122lzfStr)) {
-    return voltas_ac_remote_model_t::kVoltas122LZF;
-  // Whirlpool A/C models
-  } else if (!STRCASECMP(str, kDg11j13aStr) ||
-             !STRCASECMP(str, kDg11j104Str)) {
-    return whirlpool_ac_remote_model_t::DG11J13A;
-  } else if (!STRCASECMP(str, kDg11j191Str)) {
-    return whirlpool_ac_remote_model_t::DG11J191;
-  } else {
-    int16_t number = atoi(str);
-    if (number > 0)
-      return number;
-    else
-      return def;
-  }
+  int16_t value;
+  if (lookupName(str, kModelNames, IRAC_NAMES_SIZE(kModelNames), &value))
+    return value;
+  int16_t number = atoi(str);
+  if (number > 0)
+    return number;
+  else
+    return def;
 }
 
 /// Convert the supplied str into the appropriate boolean value.
@@ -3489,25 +3532,89 @@ int16_t IRac::strToModel(const char *str, const int16_t def) {
 /// @param[in] def The boolean value to return if no conversion was possible.
 /// @return The equivalent boolean value.
 bool IRac::strToBool(const char *str, const bool def) {
-  if (!STRCASECMP(str, kOnStr) ||
-      !STRCASECMP(str, k1Str) ||
-      !STRCASECMP(str, kYesStr) ||
-      !STRCASECMP(str, kTrueStr))
-    return true;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, k0Str) ||
-           !STRCASECMP(str, kNoStr) ||
-           !STRCASECMP(str, kFalseStr))
-    return false;
-  else
-    return def;
+  int16_t value;
+  if (lookupName(str, kBoolNames, IRAC_NAMES_SIZE(kBoolNames), &value))
+    return value;
+  return def;
+}
+
+// The text for each of the common A/C settings. These are shared by the String
+// & buffer based conversion routines below.
+// Note: The text may be stored in flash, so it must be read with the `_P`
+//   functions on the ESP8266.
+#define IRAC_TEXT(NAME) reinterpret_cast<const char*>(NAME)
+
+static const char *boolText(const bool value) {
+  return value ? IRAC_TEXT(kOnStr) : IRAC_TEXT(kOffStr);
+}
+
+static const char *opmodeText(const stdAc::opmode_t mode, const bool ha) {
+  switch (mode) {
+    case stdAc::opmode_t::kOff:  return IRAC_TEXT(kOffStr);
+    case stdAc::opmode_t::kAuto: return IRAC_TEXT(kAutoStr);
+    case stdAc::opmode_t::kCool: return IRAC_TEXT(kCoolStr);
+    case stdAc::opmode_t::kHeat: return IRAC_TEXT(kHeatStr);
+    case stdAc::opmode_t::kDry:  return IRAC_TEXT(kDryStr);
+    case stdAc::opmode_t::kFan:  return ha ? IRAC_TEXT(kFan_OnlyStr)
+                                           : IRAC_TEXT(kFanStr);
+    default:                     return IRAC_TEXT(kUnknownStr);
+  }
+}
+
+static const char *fanspeedText(const stdAc::fanspeed_t speed) {
+  switch (speed) {
+    case stdAc::fanspeed_t::kAuto:   return IRAC_TEXT(kAutoStr);
+    case stdAc::fanspeed_t::kMax:    return IRAC_TEXT(kMaxStr);
+    case stdAc::fanspeed_t::kHigh:   return IRAC_TEXT(kHighStr);
+    case stdAc::fanspeed_t::kMedium: return IRAC_TEXT(kMediumStr);
+    case stdAc::fanspeed_t::kLow:    return IRAC_TEXT(kLowStr);
+    case stdAc::fanspeed_t::kMin:    return IRAC_TEXT(kMinStr);
+    default:                         return IRAC_TEXT(kUnknownStr);
+  }
+}
+
+static const char *swingvText(const stdAc::swingv_t swingv) {
+  switch (swingv) {
+    case stdAc::swingv_t::kOff:     return IRAC_TEXT(kOffStr);
+    case stdAc::swingv_t::kAuto:    return IRAC_TEXT(kAutoStr);
+    case stdAc::swingv_t::kHighest: return IRAC_TEXT(kHighestStr);
+    case stdAc::swingv_t::kHigh:    return IRAC_TEXT(kHighStr);
+    case stdAc::swingv_t::kMiddle:  return IRAC_TEXT(kMiddleStr);
+    case stdAc::swingv_t::kLow:     return IRAC_TEXT(kLowStr);
+    case stdAc::swingv_t::kLowest:  return IRAC_TEXT(kLowestStr);
+    default:                        return IRAC_TEXT(kUnknownStr);
+  }
+}
+
+static const char *swinghText(const stdAc::swingh_t swingh) {
+  switch (swingh) {
+    case stdAc::swingh_t::kOff:      return IRAC_TEXT(kOffStr);
+    case stdAc::swingh_t::kAuto:     return IRAC_TEXT(kAutoStr);
+    case stdAc::swingh_t::kLeftMax:  return IRAC_TEXT(kLeftMaxStr);
+    case stdAc::swingh_t::kLeft:     return IRAC_TEXT(kLeftStr);
+    case stdAc::swingh_t::kMiddle:   return IRAC_TEXT(kMiddleStr);
+    case stdAc::swingh_t::kRight:    return IRAC_TEXT(kRightStr);
+    case stdAc::swingh_t::kRightMax: return IRAC_TEXT(kRightMaxStr);
+    case stdAc::swingh_t::kWide:     return IRAC_TEXT(kWideStr);
+    default:                         return IRAC_TEXT(kUnknownStr);
+  }
 }
 
 /// Convert the supplied boolean into the appropriate String.
 /// @param[in] value The boolean value to be converted.
 /// @return The equivalent String for the locale.
 String IRac::boolToString(const bool value) {
-  return value ? kOnStr : kOffStr;
+  return FPSTR(boolText(value));
+}
+
+/// Convert the supplied boolean into the appropriate text, without using the
+/// heap.
+/// @param[in] value The boolean value to be converted.
+/// @param[out] buf The buffer to write the text to. Always NUL terminated.
+/// @param[in] len The size of `buf` in bytes.
+/// @return The nr. of characters written, excluding the NUL.
+uint16_t IRac::boolToString(const bool value, char *buf, const uint16_t len) {
+  return irutils::copyString(buf, len, boolText(value));
 }
 
 /// Convert the supplied operation mode into the appropriate String.
@@ -3515,63 +3622,73 @@ String IRac::boolToString(const bool value) {
 /// @param[in] ha A flag to indicate we want GoogleHome/HomeAssistant output.
 /// @return The equivalent String for the locale.
 String IRac::opmodeToString(const stdAc::opmode_t mode, const bool ha) {
-  switch (mode) {
-    case stdAc::opmode_t::kOff:  return kOffStr;
-    case stdAc::opmode_t::kAuto: return kAutoStr;
-    case stdAc::opmode_t::kCool: return kCoolStr;
-    case stdAc::opmode_t::kHeat: return kHeatStr;
-    case stdAc::opmode_t::kDry:  return kDryStr;
-    case stdAc::opmode_t::kFan:  return ha ? kFan_OnlyStr : kFanStr;
-    default:                     return kUnknownStr;
-  }
+  return FPSTR(opmodeText(mode, ha));
+}
+
+/// Convert the supplied operation mode into the appropriate text, without
+/// using the heap.
+/// @param[in] mode The enum to be converted.
+/// @param[out] buf The buffer to write the text to. Always NUL terminated.
+/// @param[in] len The size of `buf` in bytes.
+/// @param[in] ha A flag to indicate we want GoogleHome/HomeAssistant output.
+/// @return The nr. of characters written, excluding the NUL.
+uint16_t IRac::opmodeToString(const stdAc::opmode_t mode, char *buf,
+                              const uint16_t len, const bool ha) {
+  return irutils::copyString(buf, len, opmodeText(mode, ha));
 }
 
 /// Convert the supplied fan speed enum into the appropriate String.
 /// @param[in] speed The enum to be converted.
 /// @return The equivalent String for the locale.
 String IRac::fanspeedToString(const stdAc::fanspeed_t speed) {
-  switch (speed) {
-    case stdAc::fanspeed_t::kAuto:   return kAutoStr;
-    case stdAc::fanspeed_t::kMax:    return kMaxStr;
-    case stdAc::fanspeed_t::kHigh:   return kHighStr;
-    case stdAc::fanspeed_t::kMedium: return kMediumStr;
-    case stdAc::fanspeed_t::kLow:    return kLowStr;
-    case stdAc::fanspeed_t::kMin:    return kMinStr;
-    default:                         return kUnknownStr;
-  }
+  return FPSTR(fanspeedText(speed));
+}
+
+/// Convert the supplied fan speed enum into the appropriate text, without
+/// using the heap.
+/// @param[in] speed The enum to be converted.
+/// @param[out] buf The buffer to write the text to. Always NUL terminated.
+/// @param[in] len The size of `buf` in bytes.
+/// @return The nr. of characters written, excluding the NUL.
+uint16_t IRac::fanspeedToString(const stdAc::fanspeed_t speed, char *buf,
+                                const uint16_t len) {
+  return irutils::copyString(buf, len, fanspeedText(speed));
 }
 
 /// Convert the supplied enum into the appropriate String.
 /// @param[in] swingv The enum to be converted.
 /// @return The equivalent String for the locale.
 String IRac::swingvToString(const stdAc::swingv_t swingv) {
-  switch (swingv) {
-    case stdAc::swingv_t::kOff:     return kOffStr;
-    case stdAc::swingv_t::kAuto:    return kAutoStr;
-    case stdAc::swingv_t::kHighest: return kHighestStr;
-    case stdAc::swingv_t::kHigh:    return kHighStr;
-    case stdAc::swingv_t::kMiddle:  return kMiddleStr;
-    case stdAc::swingv_t::kLow:     return kLowStr;
-    case stdAc::swingv_t::kLowest:  return kLowestStr;
-    default:                        return kUnknownStr;
-  }
+  return FPSTR(swingvText(swingv));
+}
+
+/// Convert the supplied enum into the appropriate text, without using the
+/// heap.
+/// @param[in] swingv The enum to be converted.
+/// @param[out] buf The buffer to write the text to. Always NUL terminated.
+/// @param[in] len The size of `buf` in bytes.
+/// @return The nr. of characters written, excluding the NUL.
+uint16_t IRac::swingvToString(const stdAc::swingv_t swingv, char *buf,
+                              const uint16_t len) {
+  return irutils::copyString(buf, len, swingvText(swingv));
 }
 
 /// Convert the supplied enum into the appropriate String.
 /// @param[in] swingh The enum to be converted.
 /// @return The equivalent String for the locale.
 String IRac::swinghToString(const stdAc::swingh_t swingh) {
-  switch (swingh) {
-    case stdAc::swingh_t::kOff:      return kOffStr;
-    case stdAc::swingh_t::kAuto:     return kAutoStr;
-    case stdAc::swingh_t::kLeftMax:  return kLeftMaxStr;
-    case stdAc::swingh_t::kLeft:     return kLeftStr;
-    case stdAc::swingh_t::kMiddle:   return kMiddleStr;
-    case stdAc::swingh_t::kRight:    return kRightStr;
-    case stdAc::swingh_t::kRightMax: return kRightMaxStr;
-    case stdAc::swingh_t::kWide:     return kWideStr;
-    default:                         return kUnknownStr;
-  }
+  return FPSTR(swinghText(swingh));
+}
+
+/// Convert the supplied enum into the appropriate text, without using the
+/// heap.
+/// @param[in] swingh The enum to be converted.
+/// @param[out] buf The buffer to write the text to. Always NUL terminated.
+/// @param[in] len The size of `buf` in bytes.
+/// @return The nr. of characters written, excluding the NUL.
+uint16_t IRac::swinghToString(const stdAc::swingh_t swingh, char *buf,
+                              const uint16_t len) {
+  return irutils::copyString(buf, len, swinghText(swingh));
 }
 
 namespace IRAcUtils {
@@ -99,6 +99,16 @@ class IRac {
   static String fanspeedToString(const stdAc::fanspeed_t speed);
   static String swingvToString(const stdAc::swingv_t swingv);
   static String swinghToString(const stdAc::swingh_t swingh);
+  static uint16_t boolToString(const bool value, char *buf,
+                               const uint16_t len);
+  static uint16_t opmodeToString(const stdAc::opmode_t mode, char *buf,
+                                 const uint16_t len, const bool ha = false);
+  static uint16_t fanspeedToString(const stdAc::fanspeed_t speed, char *buf,
+                                   const uint16_t len);
+  static uint16_t swingvToString(const stdAc::swingv_t swingv, char *buf,
+                                 const uint16_t len);
+  static uint16_t swinghToString(const stdAc::swingh_t swingh, char *buf,
+                                 const uint16_t len);
   stdAc::state_t getState(void);
   stdAc::state_t getStatePrev(void);
   bool hasStateChanged(void);
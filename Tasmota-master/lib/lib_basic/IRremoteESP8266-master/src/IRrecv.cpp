@@ -21,6 +21,11 @@ extern "C" {
 #include "IRremoteESP8266.h"
 #include "IRutils.h"
 
+#if (defined(UNIT_TEST) && ENABLE_INCREMENTAL_DECODE)
+// Used to help simulate elapsed time in unit tests.
+extern uint32_t _IRtimer_unittest_now;
+#endif  // UNIT_TEST && ENABLE_INCREMENTAL_DECODE
+
 #ifdef UNIT_TEST
 #undef ICACHE_RAM_ATTR
 #define ICACHE_RAM_ATTR
@@ -204,6 +209,9 @@ static void USE_IRAM_ATTR gpio_intr() {
   params.rawlen++;
 
   start = now;
+#if ENABLE_INCREMENTAL_DECODE
+  params.lastedge = now;
+#endif  // ENABLE_INCREMENTAL_DECODE
 
 #if defined(ESP8266)
   os_timer_arm(&timer, params.timeout, ONCE);
@@ -298,6 +306,13 @@ IRrecv::IRrecv(const uint16_t recvpin, const uint16_t bufsize,
 #if DECODE_HASH
   _unknown_threshold = kUnknownThreshold;
 #endif  // DECODE_HASH
+#if ENABLE_DECODE_INDEX
+  _decode_index = true;
+#endif  // ENABLE_DECODE_INDEX
+#if ENABLE_INCREMENTAL_DECODE
+  _incremental = false;
+  _resetIncremental();
+#endif  // ENABLE_INCREMENTAL_DECODE
   _tolerance = kTolerance;
 }
 
@@ -378,6 +393,9 @@ void IRrecv::resume(void) {
   params.rcvstate = kIdleState;
   params.rawlen = 0;
   params.overflow = false;
+#if ENABLE_INCREMENTAL_DECODE
+  _resetIncremental();
+#endif  // ENABLE_INCREMENTAL_DECODE
 #if defined(ESP32)
   timerAlarmDisable(timer);
 #endif  // ESP32
@@ -434,6 +452,346 @@ void IRrecv::setTolerance(const uint8_t percent) {
 /// @return A integer percentage.
 uint8_t IRrecv::getTolerance(void) { return _tolerance; }
 
+#if ENABLE_DECODE_INDEX
+/// Enable or disable the header timing pre-classifier used by `decode()`.
+/// @param[in] enable true to skip decoders whose header can't match, false to
+///   try every enabled decoder (the historical behaviour).
+void IRrecv::enableDecodeIndex(const bool enable) { _decode_index = enable; }
+
+namespace _IRrecv {
+/// Percentage window the header index is built with. It needs to be wider than
+/// the largest tolerance any decoder applies to its header.
+const uint8_t kDecodeIndexTolerance = 50;
+/// Non-scaling slack (uSecs) added around each header timing to cover the
+/// mark/space excess adjustment the decoders make.
+const uint16_t kDecodeIndexSlack = kMarkExcess * 2;
+
+/// Floor of log2(x).
+constexpr uint8_t log2Floor(const uint32_t x) {
+  return (x < 2) ? 0 : 1 + log2Floor(x >> 1);
+}
+
+/// Quantize a duration into a quarter-octave logarithmic bucket.
+/// @param[in] usecs Nr. of uSeconds.
+/// @return A bucket number. Larger durations never produce smaller buckets.
+constexpr uint8_t quantize(const uint32_t usecs) {
+  return (usecs < 4) ? usecs : log2Floor(usecs) * 4 +
+      ((usecs >> (log2Floor(usecs) - 2)) & 3);
+}
+
+/// Lowest bucket a header timing could be measured in. 0 means "don't care".
+constexpr uint8_t bucketLow(const uint32_t usecs) {
+  return (usecs <= kDecodeIndexSlack) ? 0 :
+      quantize((usecs - kDecodeIndexSlack) * (100 - kDecodeIndexTolerance) /
+               100);
+}
+
+/// Highest bucket a header timing could be measured in. 0 means "don't care".
+constexpr uint8_t bucketHigh(const uint32_t usecs) {
+  return (usecs == 0) ? UINT8_MAX :
+      quantize((usecs + kDecodeIndexSlack) * (100 + kDecodeIndexTolerance) /
+               100 + 1);
+}
+
+/// Header timings of the protocols the index knows about.
+typedef struct {
+  uint8_t protocol;    // decode_type_t
+  uint8_t mark_low;    // Quantized header mark range.
+  uint8_t mark_high;
+  uint8_t space_low;   // Quantized header space range.
+  uint8_t space_high;
+} decode_index_t;
+
+#define HDR_RANGE(protocol, mark, space_min, space_max) \
+  {protocol, bucketLow(mark), bucketHigh(mark), \
+   bucketLow(space_min), bucketHigh(space_max)}
+#define HDR(protocol, mark, space) HDR_RANGE(protocol, mark, space, space)
+
+/// The first mark & space (in uSecs) each indexed decoder requires at the
+/// start offset. A space of 0 means the decoder doesn't have a fixed one.
+/// Values mirror the header/leader constants in the matching ir_*.cpp file.
+/// Protocols not listed here (e.g. those without a header) are always tried.
+/// Several entries for the same protocol are OR'ed together.
+const decode_index_t kDecodeIndex[] = {
+  HDR_RANGE(NEC, 8960, 2240, 4480),  // Normal & repeat messages.
+  HDR_RANGE(NEC_LIKE, 8960, 2240, 4480),
+  HDR_RANGE(AIWA_RC_T501, 8960, 2240, 4480),  // Uses decodeNEC().
+  HDR_RANGE(SANYO_LC7461, 8960, 2240, 4480),  // Uses decodeNEC().
+  HDR(EPSON, 8960, 4480),
+  HDR(MIDEA24, 8960, 4480),
+  HDR(CARRIER_AC, 8532, 4228),
+  HDR(CARRIER_AC40, 8402, 4166),
+  HDR(CARRIER_AC64, 8940, 4556),
+  HDR(PIONEER, 8506, 4191),
+  HDR(MILESTAG2, 2400, 600),
+  HDR(SONY, 2400, 0),
+  HDR(MITSUBISHI_AC, 3400, 1750),
+  HDR(MITSUBISHI2, 8400, 4200),
+  HDR(MITSUBISHI136, 3324, 1474),
+  HDR(MITSUBISHI112, 3450, 0),
+  HDR(MITSUBISHI112, 3000, 0),  // TCL112AC shares decodeMitsubishi112().
+  HDR(MITSUBISHI_HEAVY_152, 3140, 1630),  // Both the 152 & 88 bit variants.
+  HDR(RC6, 2664, 0),
+  HDR(RCMM, 416, 277),
+  HDR(FUJITSU_AC, 3324, 1574),
+  HDR(PANASONIC, 3456, 1728),
+  HDR(PANASONIC_AC, 3456, 1728),
+  HDR(PANASONIC_AC32, 3543, 3450),
+  HDR(LG, 8500, 0),
+  HDR(LG, 3200, 0),  // LG2
+  HDR(LG, 4500, 0),  // LG32
+  HDR(GICABLE, 9000, 4400),
+  HDR(SAMSUNG, 4480, 4480),
+  HDR(SAMSUNG36, 4515, 4438),
+  HDR(SAMSUNG_AC, 586, 17844),
+  HDR(WHYNTER, 750, 750),
+  HDR(DISH, 400, 6100),
+  HDR(COOLIX, 4692, 4416),
+  HDR(NIKAI, 4000, 4000),
+  HDR(KELVINATOR, 9010, 4505),
+  HDR(DAIKIN, 428, 428),  // Leading zero bits.
+  HDR(DAIKIN2, 10024, 25180),
+  HDR(DAIKIN216, 3440, 1750),
+  HDR(DAIKIN160, 5000, 2145),
+  HDR(DAIKIN176, 5070, 2140),
+  HDR(DAIKIN128, 9800, 9800),
+  HDR(DAIKIN152, 433, 433),  // Leading zero bits.
+  HDR(DAIKIN64, 9800, 9800),
+  HDR(TOSHIBA_AC, 4400, 4300),
+  HDR(MIDEA, 4480, 4480),
+  HDR(GREE, 9000, 4500),
+  HDR(HAIER_AC, 3000, 3000),
+  HDR(HAIER_AC_YRW02, 3000, 3000),
+  HDR(HAIER_AC176, 3000, 3000),
+  HDR(HITACHI_AC, 3300, 1700),
+  HDR(HITACHI_AC1, 3400, 3400),
+  HDR(HITACHI_AC2, 3300, 1700),
+  HDR(HITACHI_AC3, 3400, 1660),
+  HDR(HITACHI_AC344, 3300, 1700),
+  HDR(HITACHI_AC424, 29784, 49290),
+  HDR(WHIRLPOOL_AC, 8950, 4484),
+  HDR(ELECTRA_AC, 9166, 4470),
+  HDR(VESTEL_AC, 3110, 9066),
+  HDR(TECO, 9000, 4440),
+  HDR(LEGOPF, 158, 1026),
+  HDR(ARGO, 6400, 3300),
+  HDR(SHARP_AC, 3800, 1900),
+  HDR(GOODWEATHER, 6820, 6820),
+  HDR(INAX, 9000, 4500),
+  HDR(TROTEC, 5952, 7364),
+  HDR(TROTEC_3550, 12000, 5130),
+  HDR(NEOCLIMA, 6112, 7391),
+  HDR(AMCOR, 8200, 4200),
+  HDR(DELONGHI_AC, 8984, 4200),
+  HDR(DOSHISHA, 3412, 1722),
+  HDR(TRUMA, 20200, 1000),
+  HDR(TECHNIBEL_AC, 8836, 4380),
+  HDR(CORONA_AC, 3500, 1680),
+  HDR(ZEPEAL, 2330, 3380),
+  HDR(SANYO_AC, 8500, 4200),
+  HDR(SANYO_AC88, 5400, 2000),
+  HDR(METZ, 880, 2336),
+  HDR(TRANSCOLD, 5944, 7563),
+  HDR(ECOCLIM, 5730, 1935),
+  HDR(TEKNOPOINT, 3600, 1600),
+  HDR(KELON, 9000, 4600),
+  HDR(BOSE, 1100, 1350),
+  HDR(ARRIS, 2560, 1920),
+  HDR(RHOSS, 3042, 4248),
+  HDR(AIRTON, 6630, 3350),
+};
+
+#undef HDR
+#undef HDR_RANGE
+}  // namespace _IRrecv
+
+/// Work out which protocols could possibly start at the given offset.
+/// Every protocol is a candidate unless it is in the header index and none of
+/// its entries fit the mark & space found at the offset.
+/// @param[in] results Ptr to the data to decode.
+/// @param[in] offset The starting index to use when attempting to decode.
+void IRrecv::_buildDecodeCandidates(const decode_results *results,
+                                    const uint16_t offset) {
+  using _IRrecv::kDecodeIndex;
+  for (uint8_t i = 0; i < kLastDecodeType / 32 + 1; i++)
+    _decode_candidates[i] = UINT32_MAX;
+  // Don't narrow anything down if we can't trust the index.
+  if (!_decode_index || _tolerance > kDecodeIndexMaxTolerance ||
+      offset + 1 >= results->rawlen) return;
+  const uint8_t mark = _IRrecv::quantize(results->rawbuf[offset] * kRawTick);
+  const uint8_t space = _IRrecv::quantize(
+      results->rawbuf[offset + 1] * kRawTick);
+  const uint8_t entries = sizeof(kDecodeIndex) / sizeof(kDecodeIndex[0]);
+  for (uint8_t i = 0; i < entries; i++) {
+    const uint8_t protocol = kDecodeIndex[i].protocol;
+    _decode_candidates[protocol / 32] &= ~(1UL << (protocol % 32));
+  }
+  for (uint8_t i = 0; i < entries; i++) {
+    if (mark < kDecodeIndex[i].mark_low || mark > kDecodeIndex[i].mark_high ||
+        space < kDecodeIndex[i].space_low ||
+        space > kDecodeIndex[i].space_high) continue;
+    const uint8_t protocol = kDecodeIndex[i].protocol;
+    _decode_candidates[protocol / 32] |= 1UL << (protocol % 32);
+  }
+}
+
+/// Is it worth trying to decode the given protocol at the current offset?
+/// @param[in] protocol The protocol the decoder will attempt.
+/// @return false if the protocol's header can't possibly match, else true.
+bool IRrecv::_isDecodeCandidate(const decode_type_t protocol) {
+  return _decode_candidates[protocol / 32] & (1UL << (protocol % 32));
+}
+#else  // ENABLE_DECODE_INDEX
+/// @cond IGNORE
+void IRrecv::_buildDecodeCandidates(const decode_results *,
+                                    const uint16_t) {}
+bool IRrecv::_isDecodeCandidate(const decode_type_t) { return true; }
+/// @endcond
+#endif  // ENABLE_DECODE_INDEX
+
+#if ENABLE_INCREMENTAL_DECODE
+/// Enable or disable recognising simple messages while they are still being
+/// captured.
+/// When enabled, `decode()` watches the capture as it arrives. As soon as it
+/// holds a complete message for one of a handful of simple remote protocols
+/// (followed by a long enough gap), the capture is ended without waiting for
+/// the timeout, and decoded as usual. Anything else is decoded once the
+/// capture times out, exactly as before.
+/// @param[in] enable true to enable, false to always wait for the timeout.
+/// @note `decode()` needs to be called frequently for this to be of any use.
+void IRrecv::enableIncrementalDecode(const bool enable) {
+  _incremental = enable;
+  _resetIncremental();
+}
+
+namespace _IRrecv {
+/// Timings of a protocol whose end `decode()` can spot while capturing.
+typedef struct {
+  uint16_t hdrmark;
+  uint16_t hdrspace;
+  uint16_t onemark;
+  uint16_t onespace;
+  uint16_t zeromark;
+  uint16_t zerospace;
+  uint16_t footermark;  // 0 means the message ends with the last data mark.
+  uint16_t nbits;
+  uint32_t gap;  // Extra gap needed before the message is known to be over.
+} incremental_protocol_t;
+
+/// Some multi-frame protocols are made of NEC-like frames, so their first
+/// frame alone looks like a complete NEC message. Only take an NEC message as
+/// complete after a gap longer than any gap between the frames of those
+/// protocols, otherwise they are cut short and decoded as NEC.
+/// @note The chain picks the largest gap of the enabled protocols. If it is
+///   longer than the capture timeout, the timeout simply ends the capture first.
+#if DECODE_EPSON
+// Epson repeats its NEC frame every kNecMinCommandLength (108080us), leaving
+// up to 108080 - 49880 (an all zero frame) of gap between them.
+const uint32_t kIncrementalNecGap = 58200;
+#elif DECODE_PIONEER
+const uint32_t kIncrementalNecGap = 25181;  // kPioneerMinGap
+#elif DECODE_CARRIER_AC
+const uint32_t kIncrementalNecGap = 20000;  // kCarrierAcGap
+#else
+const uint32_t kIncrementalNecGap = 0;
+#endif
+
+/// Simple remote protocols that can be recognised while still capturing.
+/// These only need to be good enough to tell when a message has finished. The
+/// protocol's own decoder still has the final say once the capture is ended.
+/// @note The values mirror the timing constants in the ir_*.cpp files.
+const incremental_protocol_t kIncrementalProtocols[] = {
+#if DECODE_NEC
+    {8960, 4480, 560, 1680, 560, 560, 560, kNECBits, kIncrementalNecGap},
+#endif  // DECODE_NEC
+#if DECODE_SAMSUNG
+    {4480, 4480, 560, 1680, 560, 560, 560, kSamsungBits, 0},
+#endif  // DECODE_SAMSUNG
+#if DECODE_PANASONIC
+    {3456, 1728, 432, 1296, 432, 432, 432, kPanasonicBits, 0},
+#endif  // DECODE_PANASONIC
+#if DECODE_JVC
+    {8400, 4200, 525, 1725, 525, 525, 525, kJvcBits, 0},
+#endif  // DECODE_JVC
+#if DECODE_SONY
+    // Sony has no footer, and comes in several sizes.
+    {2400, 600, 1200, 600, 600, 600, 0, kSony12Bits, 0},
+    {2400, 600, 1200, 600, 600, 600, 0, kSony15Bits, 0},
+    {2400, 600, 1200, 600, 600, 600, 0, kSony20Bits, 0},
+#endif  // DECODE_SONY
+};
+const uint8_t kIncrementalProtocolsSize =
+    sizeof(kIncrementalProtocols) / sizeof(kIncrementalProtocols[0]);
+}  // namespace _IRrecv
+
+/// Start watching for a new message from scratch.
+void IRrecv::_resetIncremental(void) {
+  _incremental_pos = kStartOffset;
+  _incremental_alive = (1 << _IRrecv::kIncrementalProtocolsSize) - 1;
+}
+
+/// Examine any new entries in the capture buffer, to see if they have
+/// completed a message for one of the incremental protocols.
+/// A message is only complete once the gap after it is longer than any space
+/// inside it, so longer protocols that share the same timings aren't cut short,
+/// and longer than the gaps of multi-frame protocols that start the same way.
+/// @return true if the capture can be ended now, otherwise false.
+bool IRrecv::_incrementalComplete(void) {
+  // Take a copy of rawlen as the interrupt handler may still be adding to it.
+  const uint16_t rawlen = params.rawlen;
+  if (rawlen < _incremental_pos) _resetIncremental();  // A new capture.
+  while (_incremental_alive && _incremental_pos < rawlen) {
+    const uint16_t entry = params.rawbuf[_incremental_pos];
+    const uint16_t pos = _incremental_pos - kStartOffset;
+    for (uint8_t i = 0; i < _IRrecv::kIncrementalProtocolsSize; i++) {
+      if (!(_incremental_alive & (1 << i))) continue;
+      const _IRrecv::incremental_protocol_t *p =
+          &_IRrecv::kIncrementalProtocols[i];
+      // Position of the last mark of the message.
+      const uint16_t last = p->footermark ? 2 * p->nbits + 2 : 2 * p->nbits;
+      const uint32_t longest = std::max(
+          p->gap, (uint32_t)std::max(p->hdrspace, p->onespace));
+      bool ok;
+      if (pos == 0)
+        ok = matchMark(entry, p->hdrmark);
+      else if (pos == 1)
+        ok = matchSpace(entry, p->hdrspace);
+      else if (pos == last && p->footermark)
+        ok = matchMark(entry, p->footermark);
+      else if (pos <= last && !(pos & 1))
+        ok = matchMark(entry, p->onemark) || matchMark(entry, p->zeromark);
+      else if (pos < last)
+        ok = matchSpace(entry, p->onespace) || matchSpace(entry, p->zerospace);
+      else if (entry * kRawTick > ticksHigh(longest, _tolerance))
+        return true;  // The gap after the message. We're done.
+      else
+        ok = false;  // Not a gap, so the message is longer than this protocol.
+      if (!ok) _incremental_alive &= ~(1 << i);
+    }
+    _incremental_pos++;
+  }
+  // We've seen everything captured so far. Is a message waiting on its gap?
+#ifndef UNIT_TEST
+  const uint32_t now = micros();
+#else
+  const uint32_t now = _IRtimer_unittest_now;
+#endif  // UNIT_TEST
+  const uint32_t elapsed = now - params.lastedge;  // Handles wrap-around.
+  const uint16_t pos = _incremental_pos - kStartOffset;
+  for (uint8_t i = 0; i < _IRrecv::kIncrementalProtocolsSize; i++) {
+    if (!(_incremental_alive & (1 << i))) continue;
+    const _IRrecv::incremental_protocol_t *p =
+        &_IRrecv::kIncrementalProtocols[i];
+    const uint16_t last = p->footermark ? 2 * p->nbits + 2 : 2 * p->nbits;
+    const uint32_t longest = std::max(
+        p->gap, (uint32_t)std::max(p->hdrspace, p->onespace));
+    if (pos == last + 1 && elapsed > ticksHigh(longest, _tolerance))
+      return true;
+  }
+  return false;
+}
+#endif  // ENABLE_INCREMENTAL_DECODE
+
 #if ENABLE_NOISE_FILTER_OPTION
 /// Remove or merge pulses in the capture buffer that are too short.
 /// @param[in,out] results Ptr to the decode_results we are going to filter.
@@ -502,9 +860,17 @@ void IRrecv::crudeNoiseFilter(decode_results *results, const uint16_t floor) {
 ///     100 - 150 usecs is "Danger, Will Robinson!".
 ///     150 - 200 usecs expect broken protocols.
 ///     At 200+ usecs, you **have** protocols you can't decode!!
+/// @note If `enableIncrementalDecode()` is in use, some simple messages can be
+///   returned before the capture has timed out.
 /// @return A boolean indicating if an IR message is ready or not.
 bool IRrecv::decode(decode_results *results, irparams_t *save,
                     uint8_t max_skip, uint16_t noise_floor) {
+#if ENABLE_INCREMENTAL_DECODE
+  // If a simple message has already arrived in full, end the capture now
+  // rather than waiting for it to time out.
+  if (_incremental && params.rcvstate == kMarkState && _incrementalComplete())
+    params.rcvstate = kStopState;
+#endif  // ENABLE_INCREMENTAL_DECODE
   // Proceed only if an IR message been received.
 #ifndef UNIT_TEST
   if (params.rcvstate != kStopState) return false;
@@ -560,12 +926,14 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
   for (uint16_t offset = kStartOffset;
        offset <= (max_skip * 2) + kStartOffset;
        offset += 2) {
+    _buildDecodeCandidates(results, offset);
 #if DECODE_AIWA_RC_T501
     DPRINTLN("Attempting Aiwa RC T501 decode");
     // Try decodeAiwaRCT501() before decodeSanyoLC7461() & decodeNEC()
     // because the protocols are similar. This protocol is more specific than
     // those ones, so should go before them.
-    if (decodeAiwaRCT501(results, offset)) return true;
+    if (_isDecodeCandidate(AIWA_RC_T501) && decodeAiwaRCT501(results, offset))
+      return true;
 #endif
 #if DECODE_SANYO
     DPRINTLN("Attempting Sanyo LC7461 decode");
@@ -573,7 +941,8 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
     // similar in timings & structure, but the Sanyo one is much longer than the
     // NEC protocol (42 vs 32 bits) so this one should be tried first to try to
     // reduce false detection as a NEC packet.
-    if (decodeSanyoLC7461(results, offset)) return true;
+    if (_isDecodeCandidate(SANYO_LC7461) && decodeSanyoLC7461(results, offset))
+      return true;
 #endif
 #if DECODE_CARRIER_AC
     DPRINTLN("Attempting Carrier AC decode");
@@ -581,7 +950,8 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
     // similar in timings & structure, but the Carrier one is much longer than
     // the NEC protocol (3x32 bits vs 1x32 bits) so this one should be tried
     // first to try to reduce false detection as a NEC packet.
-    if (decodeCarrierAC(results, offset)) return true;
+    if (_isDecodeCandidate(CARRIER_AC) && decodeCarrierAC(results, offset))
+      return true;
 #endif
 #if DECODE_PIONEER
     DPRINTLN("Attempting Pioneer decode");
@@ -589,7 +959,8 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
     // similar in timings & structure, but the Pioneer one is much longer than
     // the NEC protocol (2x32 bits vs 1x32 bits) so this one should be tried
     // first to try to reduce false detection as a NEC packet.
-    if (decodePioneer(results, offset)) return true;
+    if (_isDecodeCandidate(PIONEER) && decodePioneer(results, offset))
+      return true;
 #endif
 #if DECODE_EPSON
   DPRINTLN("Attempting Epson decode");
@@ -597,23 +968,24 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
   // similar in timings & structure, but the Epson one is much longer than the
   // NEC protocol (3x32 identical bits vs 1x32 bits) so this one should be tried
   // first to try to reduce false detection as a NEC packet.
-  if (decodeEpson(results, offset)) return true;
+  if (_isDecodeCandidate(EPSON) && decodeEpson(results, offset)) return true;
 #endif
 #if DECODE_NEC
     DPRINTLN("Attempting NEC decode");
-    if (decodeNEC(results, offset)) return true;
+    if (_isDecodeCandidate(NEC) && decodeNEC(results, offset)) return true;
 #endif
 #if DECODE_MILESTAG2
     DPRINTLN("Attempting MilesTag2 decode");
   // Try decodeMilestag2() before decodeSony() because the protocols are
   // similar in timings & structure, but the Miles one differs in nbits
   // so this one should be tried first to try to reduce false detection
-    if (decodeMilestag2(results, offset, kMilesTag2MsgBits) ||
-        decodeMilestag2(results, offset, kMilesTag2ShotBits)) return true;
+    if (_isDecodeCandidate(MILESTAG2) &&
+        (decodeMilestag2(results, offset, kMilesTag2MsgBits) ||
+         decodeMilestag2(results, offset, kMilesTag2ShotBits))) return true;
 #endif
 #if DECODE_SONY
     DPRINTLN("Attempting Sony decode");
-    if (decodeSony(results, offset)) return true;
+    if (_isDecodeCandidate(SONY) && decodeSony(results, offset)) return true;
 #endif
 #if DECODE_MITSUBISHI
     DPRINTLN("Attempting Mitsubishi decode");
@@ -621,11 +993,13 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif
 #if DECODE_MITSUBISHI_AC
     DPRINTLN("Attempting Mitsubishi AC decode");
-    if (decodeMitsubishiAC(results, offset)) return true;
+    if (_isDecodeCandidate(MITSUBISHI_AC) &&
+        decodeMitsubishiAC(results, offset)) return true;
 #endif
 #if DECODE_MITSUBISHI2
     DPRINTLN("Attempting Mitsubishi2 decode");
-    if (decodeMitsubishi2(results, offset)) return true;
+    if (_isDecodeCandidate(MITSUBISHI2) && decodeMitsubishi2(results, offset))
+      return true;
 #endif
 #if DECODE_RC5
     DPRINTLN("Attempting RC5 decode");
@@ -633,17 +1007,18 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif
 #if DECODE_RC6
     DPRINTLN("Attempting RC6 decode");
-    if (decodeRC6(results, offset)) return true;
+    if (_isDecodeCandidate(RC6) && decodeRC6(results, offset)) return true;
 #endif
 #if DECODE_RCMM
     DPRINTLN("Attempting RC-MM decode");
-    if (decodeRCMM(results, offset)) return true;
+    if (_isDecodeCandidate(RCMM) && decodeRCMM(results, offset)) return true;
 #endif
 #if DECODE_FUJITSU_AC
     // Fujitsu A/C needs to precede Panasonic and Denon as it has a short
     // message which looks exactly the same as a Panasonic/Denon message.
     DPRINTLN("Attempting Fujitsu A/C decode");
-    if (decodeFujitsuAC(results, offset)) return true;
+    if (_isDecodeCandidate(FUJITSU_AC) && decodeFujitsuAC(results, offset))
+      return true;
 #endif
 #if DECODE_DENON
     // Denon needs to precede Panasonic as it is a special case of Panasonic.
@@ -655,20 +1030,24 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif
 #if DECODE_PANASONIC
     DPRINTLN("Attempting Panasonic decode");
-    if (decodePanasonic(results, offset)) return true;
+    if (_isDecodeCandidate(PANASONIC) && decodePanasonic(results, offset))
+      return true;
 #endif
 #if DECODE_LG
     DPRINTLN("Attempting LG (28-bit) decode");
-    if (decodeLG(results, offset, kLgBits, true)) return true;
+    if (_isDecodeCandidate(LG) && decodeLG(results, offset, kLgBits, true))
+      return true;
     DPRINTLN("Attempting LG (32-bit) decode");
     // LG32 should be tried before Samsung
-    if (decodeLG(results, offset, kLg32Bits, true)) return true;
+    if (_isDecodeCandidate(LG) && decodeLG(results, offset, kLg32Bits, true))
+      return true;
 #endif
 #if DECODE_GICABLE
     // Note: Needs to happen before JVC decode, because it looks similar except
     //       with a required NEC-like repeat code.
     DPRINTLN("Attempting GICable decode");
-    if (decodeGICable(results, offset)) return true;
+    if (_isDecodeCandidate(GICABLE) && decodeGICable(results, offset))
+      return true;
 #endif
 #if DECODE_JVC
     DPRINTLN("Attempting JVC decode");
@@ -676,19 +1055,22 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif
 #if DECODE_SAMSUNG
     DPRINTLN("Attempting SAMSUNG decode");
-    if (decodeSAMSUNG(results, offset)) return true;
+    if (_isDecodeCandidate(SAMSUNG) && decodeSAMSUNG(results, offset))
+      return true;
 #endif
 #if DECODE_SAMSUNG36
     DPRINTLN("Attempting Samsung36 decode");
-    if (decodeSamsung36(results, offset)) return true;
+    if (_isDecodeCandidate(SAMSUNG36) && decodeSamsung36(results, offset))
+      return true;
 #endif
 #if DECODE_WHYNTER
     DPRINTLN("Attempting Whynter decode");
-    if (decodeWhynter(results, offset)) return true;
+    if (_isDecodeCandidate(WHYNTER) && decodeWhynter(results, offset))
+      return true;
 #endif
 #if DECODE_DISH
     DPRINTLN("Attempting DISH decode");
-    if (decodeDISH(results, offset)) return true;
+    if (_isDecodeCandidate(DISH) && decodeDISH(results, offset)) return true;
 #endif
 #if DECODE_SHARP
     DPRINTLN("Attempting Sharp decode");
@@ -696,41 +1078,49 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif
 #if DECODE_COOLIX
     DPRINTLN("Attempting Coolix decode");
-    if (decodeCOOLIX(results, offset)) return true;
+    if (_isDecodeCandidate(COOLIX) && decodeCOOLIX(results, offset))
+      return true;
 #endif
 #if DECODE_NIKAI
     DPRINTLN("Attempting Nikai decode");
-    if (decodeNikai(results, offset)) return true;
+    if (_isDecodeCandidate(NIKAI) && decodeNikai(results, offset)) return true;
 #endif
 #if DECODE_KELVINATOR
     // Kelvinator based-devices use a similar code to Gree ones, to avoid false
     // matches this needs to happen before decodeGree().
     DPRINTLN("Attempting Kelvinator decode");
-    if (decodeKelvinator(results, offset)) return true;
+    if (_isDecodeCandidate(KELVINATOR) && decodeKelvinator(results, offset))
+      return true;
 #endif
 #if DECODE_DAIKIN
     DPRINTLN("Attempting Daikin decode");
-    if (decodeDaikin(results, offset)) return true;
+    if (_isDecodeCandidate(DAIKIN) && decodeDaikin(results, offset))
+      return true;
 #endif
 #if DECODE_DAIKIN2
     DPRINTLN("Attempting Daikin2 decode");
-    if (decodeDaikin2(results, offset)) return true;
+    if (_isDecodeCandidate(DAIKIN2) && decodeDaikin2(results, offset))
+      return true;
 #endif
 #if DECODE_DAIKIN216
     DPRINTLN("Attempting Daikin216 decode");
-    if (decodeDaikin216(results, offset)) return true;
+    if (_isDecodeCandidate(DAIKIN216) && decodeDaikin216(results, offset))
+      return true;
 #endif
 #if DECODE_TOSHIBA_AC
     DPRINTLN("Attempting Toshiba AC 72bit decode");
-    if (decodeToshibaAC(results, offset)) return true;
+    if (_isDecodeCandidate(TOSHIBA_AC) && decodeToshibaAC(results, offset))
+      return true;
     DPRINTLN("Attempting Toshiba AC 80bit decode");
-    if (decodeToshibaAC(results, offset, kToshibaACBitsLong)) return true;
+    if (_isDecodeCandidate(TOSHIBA_AC) &&
+        decodeToshibaAC(results, offset, kToshibaACBitsLong)) return true;
     DPRINTLN("Attempting Toshiba AC 56bit decode");
-    if (decodeToshibaAC(results, offset, kToshibaACBitsShort)) return true;
+    if (_isDecodeCandidate(TOSHIBA_AC) &&
+        decodeToshibaAC(results, offset, kToshibaACBitsShort)) return true;
 #endif
 #if DECODE_MIDEA
     DPRINTLN("Attempting Midea decode");
-    if (decodeMidea(results, offset)) return true;
+    if (_isDecodeCandidate(MIDEA) && decodeMidea(results, offset)) return true;
 #endif
 #if DECODE_MAGIQUEST
     DPRINTLN("Attempting Magiquest decode");
@@ -753,7 +1143,8 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
     // other protocols that are NEC-like as well, as turning off strict may
     // cause this to match other valid protocols.
     DPRINTLN("Attempting NEC (non-strict) decode");
-    if (decodeNEC(results, offset, kNECBits, false)) {
+    if (_isDecodeCandidate(NEC_LIKE) &&
+        decodeNEC(results, offset, kNECBits, false)) {
       results->decode_type = NEC_LIKE;
       return true;
     }
@@ -766,84 +1157,100 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
     // Gree based-devices use a similar code to Kelvinator ones, to avoid false
     // matches this needs to happen after decodeKelvinator().
     DPRINTLN("Attempting Gree decode");
-    if (decodeGree(results, offset)) return true;
+    if (_isDecodeCandidate(GREE) && decodeGree(results, offset)) return true;
 #endif
 #if DECODE_HAIER_AC
     DPRINTLN("Attempting Haier AC decode");
-    if (decodeHaierAC(results, offset)) return true;
+    if (_isDecodeCandidate(HAIER_AC) && decodeHaierAC(results, offset))
+      return true;
 #endif
 #if DECODE_HAIER_AC_YRW02
     DPRINTLN("Attempting Haier AC YR-W02 decode");
-    if (decodeHaierACYRW02(results, offset)) return true;
+    if (_isDecodeCandidate(HAIER_AC_YRW02) &&
+        decodeHaierACYRW02(results, offset)) return true;
 #endif
 #if DECODE_HAIER_AC176
     DPRINTLN("Attempting Haier AC 176 bit decode");
-    if (decodeHaierAC176(results, offset)) return true;
+    if (_isDecodeCandidate(HAIER_AC176) && decodeHaierAC176(results, offset))
+      return true;
 #endif  // DECODE_HAIER_AC176
 #if DECODE_HITACHI_AC424
     // HitachiAc424 should be checked before HitachiAC, HitachiAC2,
     // & HitachiAC184
     DPRINTLN("Attempting Hitachi AC 424 decode");
-    if (decodeHitachiAc424(results, offset, kHitachiAc424Bits)) return true;
+    if (_isDecodeCandidate(HITACHI_AC424) &&
+        decodeHitachiAc424(results, offset, kHitachiAc424Bits)) return true;
 #endif  // DECODE_HITACHI_AC424
 #if DECODE_MITSUBISHI136
     // Needs to happen before HitachiAc3 decode.
     DPRINTLN("Attempting Mitsubishi136 decode");
-    if (decodeMitsubishi136(results, offset)) return true;
+    if (_isDecodeCandidate(MITSUBISHI136) &&
+        decodeMitsubishi136(results, offset)) return true;
 #endif  // DECODE_MITSUBISHI136
 #if DECODE_HITACHI_AC3
     // HitachiAc3 should be checked before HitachiAC & HitachiAC2
     // Attempt normal before the short version.
     DPRINTLN("Attempting Hitachi AC3 decode");
     // Order these in decreasing bit size, as it is more optimal.
-    if (decodeHitachiAc3(results, offset, kHitachiAc3Bits) ||
-        decodeHitachiAc3(results, offset, kHitachiAc3Bits - 4 * 8) ||
-        decodeHitachiAc3(results, offset, kHitachiAc3Bits - 6 * 8) ||
-        decodeHitachiAc3(results, offset, kHitachiAc3MinBits + 2 * 8) ||
-        decodeHitachiAc3(results, offset, kHitachiAc3MinBits))
+    if (_isDecodeCandidate(HITACHI_AC3) &&
+        (decodeHitachiAc3(results, offset, kHitachiAc3Bits) ||
+         decodeHitachiAc3(results, offset, kHitachiAc3Bits - 4 * 8) ||
+         decodeHitachiAc3(results, offset, kHitachiAc3Bits - 6 * 8) ||
+         decodeHitachiAc3(results, offset, kHitachiAc3MinBits + 2 * 8) ||
+         decodeHitachiAc3(results, offset, kHitachiAc3MinBits)))
       return true;
 #endif  // DECODE_HITACHI_AC3
 #if DECODE_HITACHI_AC344
     // HitachiAC344 should be checked before HitachiAC
     DPRINTLN("Attempting Hitachi AC344 decode");
-    if (decodeHitachiAC(results, offset, kHitachiAc344Bits, true, false))
+    if (_isDecodeCandidate(HITACHI_AC344) &&
+        decodeHitachiAC(results, offset, kHitachiAc344Bits, true, false))
       return true;
 #endif  // DECODE_HITACHI_AC344
 #if DECODE_HITACHI_AC2
     // HitachiAC2 should be checked before HitachiAC
     DPRINTLN("Attempting Hitachi AC2 decode");
-    if (decodeHitachiAC(results, offset, kHitachiAc2Bits)) return true;
+    if (_isDecodeCandidate(HITACHI_AC2) &&
+        decodeHitachiAC(results, offset, kHitachiAc2Bits)) return true;
 #endif  // DECODE_HITACHI_AC2
 #if DECODE_HITACHI_AC
     DPRINTLN("Attempting Hitachi AC decode");
-    if (decodeHitachiAC(results, offset, kHitachiAcBits)) return true;
+    if (_isDecodeCandidate(HITACHI_AC) &&
+        decodeHitachiAC(results, offset, kHitachiAcBits)) return true;
 #endif
 #if DECODE_HITACHI_AC1
     DPRINTLN("Attempting Hitachi AC1 decode");
-    if (decodeHitachiAC(results, offset, kHitachiAc1Bits)) return true;
+    if (_isDecodeCandidate(HITACHI_AC1) &&
+        decodeHitachiAC(results, offset, kHitachiAc1Bits)) return true;
 #endif
 #if DECODE_WHIRLPOOL_AC
     DPRINTLN("Attempting Whirlpool AC decode");
-    if (decodeWhirlpoolAC(results, offset)) return true;
+    if (_isDecodeCandidate(WHIRLPOOL_AC) && decodeWhirlpoolAC(results, offset))
+      return true;
 #endif
 #if DECODE_SAMSUNG_AC
     DPRINTLN("Attempting Samsung AC (extended) decode");
     // Check the extended size first, as it should fail fast due to longer
     // length.
-    if (decodeSamsungAC(results, offset, kSamsungAcExtendedBits)) return true;
+    if (_isDecodeCandidate(SAMSUNG_AC) &&
+        decodeSamsungAC(results, offset, kSamsungAcExtendedBits)) return true;
     // Now check for the more common length.
     DPRINTLN("Attempting Samsung AC decode");
-    if (decodeSamsungAC(results, offset, kSamsungAcBits)) return true;
+    if (_isDecodeCandidate(SAMSUNG_AC) &&
+        decodeSamsungAC(results, offset, kSamsungAcBits)) return true;
 #endif
 #if DECODE_ELECTRA_AC
     DPRINTLN("Attempting Electra AC decode");
-    if (decodeElectraAC(results, offset)) return true;
+    if (_isDecodeCandidate(ELECTRA_AC) && decodeElectraAC(results, offset))
+      return true;
 #endif
 #if DECODE_PANASONIC_AC
     DPRINTLN("Attempting Panasonic AC decode");
-    if (decodePanasonicAC(results, offset)) return true;
+    if (_isDecodeCandidate(PANASONIC_AC) && decodePanasonicAC(results, offset))
+      return true;
     DPRINTLN("Attempting Panasonic AC short decode");
-    if (decodePanasonicAC(results, offset, kPanasonicAcShortBits)) return true;
+    if (_isDecodeCandidate(PANASONIC_AC) &&
+        decodePanasonicAC(results, offset, kPanasonicAcShortBits)) return true;
 #endif
 #if DECODE_LUTRON
     DPRINTLN("Attempting Lutron decode");
@@ -855,76 +1262,90 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif
 #if DECODE_VESTEL_AC
     DPRINTLN("Attempting Vestel AC decode");
-    if (decodeVestelAc(results, offset)) return true;
+    if (_isDecodeCandidate(VESTEL_AC) && decodeVestelAc(results, offset))
+      return true;
 #endif
 #if DECODE_MITSUBISHI112 || DECODE_TCL112AC
     // Mitsubish112 and Tcl112 share the same decoder.
     DPRINTLN("Attempting Mitsubishi112/TCL112AC decode");
-    if (decodeMitsubishi112(results, offset)) return true;
+    if (_isDecodeCandidate(MITSUBISHI112) &&
+        decodeMitsubishi112(results, offset)) return true;
 #endif  // DECODE_MITSUBISHI112 || DECODE_TCL112AC
 #if DECODE_TECO
     DPRINTLN("Attempting Teco decode");
-    if (decodeTeco(results, offset)) return true;
+    if (_isDecodeCandidate(TECO) && decodeTeco(results, offset)) return true;
 #endif
 #if DECODE_LEGOPF
     DPRINTLN("Attempting LEGOPF decode");
-    if (decodeLegoPf(results, offset)) return true;
+    if (_isDecodeCandidate(LEGOPF) && decodeLegoPf(results, offset))
+      return true;
 #endif
 #if DECODE_MITSUBISHIHEAVY
     DPRINTLN("Attempting MITSUBISHIHEAVY (152 bit) decode");
-    if (decodeMitsubishiHeavy(results, offset, kMitsubishiHeavy152Bits))
+    if (_isDecodeCandidate(MITSUBISHI_HEAVY_152) &&
+        decodeMitsubishiHeavy(results, offset, kMitsubishiHeavy152Bits))
       return true;
     DPRINTLN("Attempting MITSUBISHIHEAVY (88 bit) decode");
-    if (decodeMitsubishiHeavy(results, offset, kMitsubishiHeavy88Bits))
+    if (_isDecodeCandidate(MITSUBISHI_HEAVY_152) &&
+        decodeMitsubishiHeavy(results, offset, kMitsubishiHeavy88Bits))
       return true;
 #endif
 #if DECODE_ARGO
     DPRINTLN("Attempting Argo decode");
-    if (decodeArgo(results, offset)) return true;
+    if (_isDecodeCandidate(ARGO) && decodeArgo(results, offset)) return true;
 #endif  // DECODE_ARGO
 #if DECODE_SHARP_AC
     DPRINTLN("Attempting SHARP_AC decode");
-    if (decodeSharpAc(results, offset)) return true;
+    if (_isDecodeCandidate(SHARP_AC) && decodeSharpAc(results, offset))
+      return true;
 #endif
 #if DECODE_GOODWEATHER
     DPRINTLN("Attempting GOODWEATHER decode");
-    if (decodeGoodweather(results, offset)) return true;
+    if (_isDecodeCandidate(GOODWEATHER) && decodeGoodweather(results, offset))
+      return true;
 #endif  // DECODE_GOODWEATHER
 #if DECODE_INAX
     DPRINTLN("Attempting Inax decode");
-    if (decodeInax(results, offset)) return true;
+    if (_isDecodeCandidate(INAX) && decodeInax(results, offset)) return true;
 #endif  // DECODE_INAX
 #if DECODE_TROTEC
     DPRINTLN("Attempting Trotec decode");
-    if (decodeTrotec(results, offset)) return true;
+    if (_isDecodeCandidate(TROTEC) && decodeTrotec(results, offset))
+      return true;
 #endif  // DECODE_TROTEC
 #if DECODE_TROTEC_3550
     DPRINTLN("Attempting Trotec 3550 decode");
-    if (decodeTrotec3550(results, offset)) return true;
+    if (_isDecodeCandidate(TROTEC_3550) && decodeTrotec3550(results, offset))
+      return true;
 #endif  // DECODE_TROTEC_3550
 #if DECODE_DAIKIN160
     DPRINTLN("Attempting Daikin160 decode");
-    if (decodeDaikin160(results, offset)) return true;
+    if (_isDecodeCandidate(DAIKIN160) && decodeDaikin160(results, offset))
+      return true;
 #endif  // DECODE_DAIKIN160
 #if DECODE_NEOCLIMA
     DPRINTLN("Attempting Neoclima decode");
-    if (decodeNeoclima(results, offset)) return true;
+    if (_isDecodeCandidate(NEOCLIMA) && decodeNeoclima(results, offset))
+      return true;
 #endif  // DECODE_NEOCLIMA
 #if DECODE_DAIKIN176
     DPRINTLN("Attempting Daikin176 decode");
-    if (decodeDaikin176(results, offset)) return true;
+    if (_isDecodeCandidate(DAIKIN176) && decodeDaikin176(results, offset))
+      return true;
 #endif  // DECODE_DAIKIN176
 #if DECODE_DAIKIN128
     DPRINTLN("Attempting Daikin128 decode");
-    if (decodeDaikin128(results, offset)) return true;
+    if (_isDecodeCandidate(DAIKIN128) && decodeDaikin128(results, offset))
+      return true;
 #endif  // DECODE_DAIKIN128
 #if DECODE_AMCOR
     DPRINTLN("Attempting Amcor decode");
-    if (decodeAmcor(results, offset)) return true;
+    if (_isDecodeCandidate(AMCOR) && decodeAmcor(results, offset)) return true;
 #endif  // DECODE_AMCOR
 #if DECODE_DAIKIN152
     DPRINTLN("Attempting Daikin152 decode");
-    if (decodeDaikin152(results, offset)) return true;
+    if (_isDecodeCandidate(DAIKIN152) && decodeDaikin152(results, offset))
+      return true;
 #endif  // DECODE_DAIKIN152
 #if DECODE_SYMPHONY
     DPRINTLN("Attempting Symphony decode");
@@ -932,7 +1353,8 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif  // DECODE_SYMPHONY
 #if DECODE_DAIKIN64
     DPRINTLN("Attempting Daikin64 decode");
-    if (decodeDaikin64(results, offset)) return true;
+    if (_isDecodeCandidate(DAIKIN64) && decodeDaikin64(results, offset))
+      return true;
 #endif  // DECODE_DAIKIN64
 #if DECODE_AIRWELL
     DPRINTLN("Attempting Airwell decode");
@@ -940,16 +1362,18 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif  // DECODE_AIRWELL
 #if DECODE_DELONGHI_AC
     DPRINTLN("Attempting Delonghi AC decode");
-    if (decodeDelonghiAc(results, offset)) return true;
+    if (_isDecodeCandidate(DELONGHI_AC) && decodeDelonghiAc(results, offset))
+      return true;
 #endif  // DECODE_DELONGHI_AC
 #if DECODE_DOSHISHA
     DPRINTLN("Attempting Doshisha decode");
-    if (decodeDoshisha(results, offset)) return true;
+    if (_isDecodeCandidate(DOSHISHA) && decodeDoshisha(results, offset))
+      return true;
 #endif  // DECODE_DOSHISHA
 #if DECODE_TRUMA
     // Needs to happen before decodeMultibrackets() as they can appear similar.
     DPRINTLN("Attempting Truma decode");
-    if (decodeTruma(results, offset)) return true;
+    if (_isDecodeCandidate(TRUMA) && decodeTruma(results, offset)) return true;
 #endif  // DECODE_TRUMA
 #if DECODE_MULTIBRACKETS
     DPRINTLN("Attempting Multibrackets decode");
@@ -957,31 +1381,38 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif  // DECODE_MULTIBRACKETS
 #if DECODE_CARRIER_AC40
     DPRINTLN("Attempting Carrier 40bit decode");
-    if (decodeCarrierAC40(results, offset)) return true;
+    if (_isDecodeCandidate(CARRIER_AC40) && decodeCarrierAC40(results, offset))
+      return true;
 #endif  // DECODE_CARRIER_AC40
 #if DECODE_CARRIER_AC64
     DPRINTLN("Attempting Carrier 64bit decode");
-    if (decodeCarrierAC64(results, offset)) return true;
+    if (_isDecodeCandidate(CARRIER_AC64) && decodeCarrierAC64(results, offset))
+      return true;
 #endif  // DECODE_CARRIER_AC64
 #if DECODE_TECHNIBEL_AC
     DPRINTLN("Attempting Technibel AC decode");
-    if (decodeTechnibelAc(results, offset)) return true;
+    if (_isDecodeCandidate(TECHNIBEL_AC) && decodeTechnibelAc(results, offset))
+      return true;
 #endif  // DECODE_TECHNIBEL_AC
 #if DECODE_CORONA_AC
     DPRINTLN("Attempting CoronaAc decode");
-    if (decodeCoronaAc(results, offset)) return true;
+    if (_isDecodeCandidate(CORONA_AC) && decodeCoronaAc(results, offset))
+      return true;
 #endif  // DECODE_CORONA_AC
 #if DECODE_MIDEA24
     DPRINTLN("Attempting Midea-Nec decode");
-    if (decodeMidea24(results, offset)) return true;
+    if (_isDecodeCandidate(MIDEA24) && decodeMidea24(results, offset))
+      return true;
 #endif  // DECODE_MIDEA24
 #if DECODE_ZEPEAL
     DPRINTLN("Attempting Zepeal decode");
-    if (decodeZepeal(results, offset)) return true;
+    if (_isDecodeCandidate(ZEPEAL) && decodeZepeal(results, offset))
+      return true;
 #endif  // DECODE_ZEPEAL
 #if DECODE_SANYO_AC
     DPRINTLN("Attempting Sanyo AC decode");
-    if (decodeSanyoAc(results, offset)) return true;
+    if (_isDecodeCandidate(SANYO_AC) && decodeSanyoAc(results, offset))
+      return true;
 #endif  // DECODE_SANYO_AC
 #if DECODE_VOLTAS
   DPRINTLN("Attempting Voltas decode");
@@ -989,11 +1420,12 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif  // DECODE_VOLTAS
 #if DECODE_METZ
     DPRINTLN("Attempting Metz decode");
-    if (decodeMetz(results, offset)) return true;
+    if (_isDecodeCandidate(METZ) && decodeMetz(results, offset)) return true;
 #endif  // DECODE_METZ
 #if DECODE_TRANSCOLD
     DPRINTLN("Attempting Transcold decode");
-    if (decodeTranscold(results, offset)) return true;
+    if (_isDecodeCandidate(TRANSCOLD) && decodeTranscold(results, offset))
+      return true;
 #endif  // DECODE_TRANSCOLD
 // #if DECODE_MIRAGE
 //     DPRINTLN("Attempting Mirage decode");
@@ -1009,15 +1441,18 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif  // DECODE_ELITESCREENS
 #if DECODE_PANASONIC_AC32
     DPRINTLN("Attempting Panasonic AC (32bit) long decode");
-    if (decodePanasonicAC32(results, offset, kPanasonicAc32Bits)) return true;
+    if (_isDecodeCandidate(PANASONIC_AC32) &&
+        decodePanasonicAC32(results, offset, kPanasonicAc32Bits)) return true;
     DPRINTLN("Attempting Panasonic AC (32bit) short decode");
-    if (decodePanasonicAC32(results, offset, kPanasonicAc32Bits / 2))
+    if (_isDecodeCandidate(PANASONIC_AC32) &&
+        decodePanasonicAC32(results, offset, kPanasonicAc32Bits / 2))
       return true;
 #endif  // DECODE_PANASONIC_AC32
 #if DECODE_ECOCLIM
     DPRINTLN("Attempting Ecoclim decode");
-    if (decodeEcoclim(results, offset, kEcoclimBits) ||
-        decodeEcoclim(results, offset, kEcoclimShortBits)) return true;
+    if (_isDecodeCandidate(ECOCLIM) &&
+        (decodeEcoclim(results, offset, kEcoclimBits) ||
+         decodeEcoclim(results, offset, kEcoclimShortBits))) return true;
 #endif  // DECODE_ECOCLIM
 #if DECODE_XMP
     DPRINTLN("Attempting XMP decode");
@@ -1025,31 +1460,34 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 #endif  // DECODE_XMP
 #if DECODE_TEKNOPOINT
     DPRINTLN("Attempting Teknopoint decode");
-    if (decodeTeknopoint(results, offset)) return true;
+    if (_isDecodeCandidate(TEKNOPOINT) && decodeTeknopoint(results, offset))
+      return true;
 #endif  // DECODE_TEKNOPOINT
 #if DECODE_KELON
     DPRINTLN("Attempting Kelon decode");
-    if (decodeKelon(results, offset)) return true;
+    if (_isDecodeCandidate(KELON) && decodeKelon(results, offset)) return true;
 #endif  // DECODE_KELON
 #if DECODE_SANYO_AC88
     DPRINTLN("Attempting SanyoAc88 decode");
-    if (decodeSanyoAc88(results, offset)) return true;
+    if (_isDecodeCandidate(SANYO_AC88) && decodeSanyoAc88(results, offset))
+      return true;
 #endif  // DECODE_SANYO_AC88
 #if DECODE_BOSE
     DPRINTLN("Attempting Bose decode");
-    if (decodeBose(results, offset)) return true;
+    if (_isDecodeCandidate(BOSE) && decodeBose(results, offset)) return true;
 #endif  // DECODE_BOSE
 #if DECODE_ARRIS
     DPRINTLN("Attempting Arris decode");
-    if (decodeArris(results, offset)) return true;
+    if (_isDecodeCandidate(ARRIS) && decodeArris(results, offset)) return true;
 #endif  // DECODE_ARRIS
 #if DECODE_RHOSS
     DPRINTLN("Attempting Rhoss decode");
-    if (decodeRhoss(results, offset)) return true;
+    if (_isDecodeCandidate(RHOSS) && decodeRhoss(results, offset)) return true;
 #endif  // DECODE_RHOSS
 #if DECODE_AIRTON
     DPRINTLN("Attempting Airton decode");
-    if (decodeAirton(results, offset)) return true;
+    if (_isDecodeCandidate(AIRTON) && decodeAirton(results, offset))
+      return true;
 #endif  // DECODE_AIRTON
   // Typically new protocols are added above this line.
   }
@@ -1073,6 +1511,20 @@ uint8_t IRrecv::_validTolerance(const uint8_t percentage) {
     return (percentage > 100) ? _tolerance : percentage;
 }
 
+namespace _IRrecv {
+/// Scale a period by a percentage using only integer maths.
+/// @note Avoids (soft) floating point in the innermost matching loops.
+/// @param[in] usecs Nr. of uSeconds.
+/// @param[in] percent The percentage to scale by. e.g. 75 is 75% (<= 200)
+/// @return The scaled value, rounded down.
+static inline uint32_t scalePercent(const uint32_t usecs,
+                                    const uint16_t percent) {
+  // Only use 64 bit maths when a 32 bit multiply could overflow.
+  if (usecs <= UINT32_MAX / 200) return usecs * percent / 100;
+  return (uint32_t)((uint64_t)usecs * percent / 100);
+}
+}  // namespace _IRrecv
+
 /// Calculate the lower bound of the nr. of ticks.
 /// @param[in] usecs Nr. of uSeconds.
 /// @param[in] tolerance Percent as an integer. e.g. 10 is 10%
@@ -1080,10 +1532,10 @@ uint8_t IRrecv::_validTolerance(const uint8_t percentage) {
 /// @return Nr. of ticks.
 uint32_t IRrecv::ticksLow(const uint32_t usecs, const uint8_t tolerance,
                           const uint16_t delta) {
-  // max() used to ensure the result can't drop below 0 before the cast.
-  return ((uint32_t)std::max(
-      (int32_t)(usecs * (1.0 - _validTolerance(tolerance) / 100.0) - delta),
-      0));
+  const uint32_t scaled = _IRrecv::scalePercent(
+      usecs, 100 - _validTolerance(tolerance));
+  // Ensure the result can't drop below 0.
+  return (scaled > delta) ? scaled - delta : 0;
 }
 
 /// Calculate the upper bound of the nr. of ticks.
@@ -1093,8 +1545,57 @@ uint32_t IRrecv::ticksLow(const uint32_t usecs, const uint8_t tolerance,
 /// @return Nr. of ticks.
 uint32_t IRrecv::ticksHigh(const uint32_t usecs, const uint8_t tolerance,
                            const uint16_t delta) {
-  return ((uint32_t)(usecs * (1.0 + _validTolerance(tolerance) / 100.0)) + 1 +
-          delta);
+  return _IRrecv::scalePercent(usecs, 100 + _validTolerance(tolerance)) + 1 +
+      delta;
+}
+
+/// Precompute the range of measured tick values that will match a period.
+/// @note Matching against the result with inWindow() is equivalent to
+///   calling match() with the same arguments, but the bounds only need to be
+///   calculated once per timing value rather than once per pulse.
+/// @param[in] desired The expected period (in usecs) we are matching against.
+/// @param[in] tolerance A percentage expressed as an integer. e.g. 10 is 10%.
+/// @param[in] delta A non-scaling (+/-) error margin (in useconds).
+/// @return A match_window_t with the inclusive bounds in ticks.
+match_window_t IRrecv::matchWindow(const uint32_t desired,
+                                   const uint8_t tolerance,
+                                   const uint16_t delta) {
+  match_window_t window;
+  // Round inwards so a tick count is in the window iff it is in range in uSecs.
+  window.low = (ticksLow(desired, tolerance, delta) + kRawTick - 1) / kRawTick;
+  window.high = ticksHigh(desired, tolerance, delta) / kRawTick;
+  return window;
+}
+
+/// Check if a measured period is inside a precomputed match window.
+/// @param[in] measured The recorded period of the signal pulse. (in ticks)
+/// @param[in] window The acceptable range, as returned by matchWindow().
+/// @return A Boolean. true if it matches, false if it doesn't.
+bool IRrecv::inWindow(const uint32_t measured, const match_window_t window) {
+  return measured >= window.low && measured <= window.high;
+}
+
+/// Precompute the match windows for the bit timings of a data section.
+/// Equivalent to the checks matchMark() & matchSpace() perform.
+/// @param[in] onemark Nr. of uSeconds in an expected mark signal for a '1' bit.
+/// @param[in] onespace Nr. of uSecs in an expected space signal for a '1' bit.
+/// @param[in] zeromark Nr. of uSecs in an expected mark signal for a '0' bit.
+/// @param[in] zerospace Nr. of uSecs in an expected space signal for a '0' bit.
+/// @param[in] tolerance Percentage error margin to allow. (Default: kUseDefTol)
+/// @param[in] excess Nr. of uSeconds. (Def: kMarkExcess)
+/// @return A match_data_windows_t structure.
+match_data_windows_t IRrecv::matchDataWindows(const uint16_t onemark,
+                                              const uint32_t onespace,
+                                              const uint16_t zeromark,
+                                              const uint32_t zerospace,
+                                              const uint8_t tolerance,
+                                              const int16_t excess) {
+  match_data_windows_t windows;
+  windows.onemark = matchWindow((uint32_t)onemark + excess, tolerance);
+  windows.onespace = matchWindow(onespace - excess, tolerance);
+  windows.zeromark = matchWindow((uint32_t)zeromark + excess, tolerance);
+  windows.zerospace = matchWindow(zerospace - excess, tolerance);
+  return windows;
 }
 
 /// Check if we match a pulse(measured) with the desired within
@@ -1106,11 +1607,10 @@ uint32_t IRrecv::ticksHigh(const uint32_t usecs, const uint8_t tolerance,
 /// @return A Boolean. true if it matches, false if it doesn't.
 bool IRrecv::match(uint32_t measured, uint32_t desired, uint8_t tolerance,
                    uint16_t delta) {
-  measured *= kRawTick;  // Convert to uSecs.
   DPRINT("Matching: ");
   DPRINT(ticksLow(desired, tolerance, delta));
   DPRINT(" <= ");
-  DPRINT(measured);
+  DPRINT(measured * kRawTick);
   DPRINT(" <= ");
   DPRINTLN(ticksHigh(desired, tolerance, delta));
 #ifdef UNIT_TEST
@@ -1124,8 +1624,7 @@ bool IRrecv::match(uint32_t measured, uint32_t desired, uint8_t tolerance,
   // If there is a legit case, then this should be removed.
   assert(ticksHigh(desired, tolerance, delta) >= desired);
 #endif  // UNIT_TEST
-  return (measured >= ticksLow(desired, tolerance, delta) &&
-          measured <= ticksHigh(desired, tolerance, delta));
+  return inWindow(measured, matchWindow(desired, tolerance, delta));
 }
 
 /// Check if we match a pulse(measured) of at least desired within
@@ -1318,6 +1817,27 @@ match_result_t IRrecv::matchData(
     const uint32_t onespace, const uint16_t zeromark, const uint32_t zerospace,
     const uint8_t tolerance, const int16_t excess, const bool MSBfirst,
     const bool expectlastspace) {
+  return _matchData(data_ptr, nbits,
+                    matchDataWindows(onemark, onespace, zeromark, zerospace,
+                                     tolerance, excess),
+                    MSBfirst, expectlastspace);
+}
+
+/// Match & decode the typical data section of an IR message, using
+/// precomputed match windows.
+/// @param[in] data_ptr A pointer to where we are at in the capture buffer.
+/// @param[in] nbits Nr. of data bits we expect.
+/// @param[in] windows The bit timings, as returned by matchDataWindows().
+/// @param[in] MSBfirst Bit order to save the data in. (Def: true)
+///   true is Most Significant Bit First Order, false is Least Significant First
+/// @param[in] expectlastspace Do we expect a space at the end of the message?
+/// @return A match_result_t structure containing the success (or not), the
+///   data value, and how many buffer entries were used.
+match_result_t IRrecv::_matchData(volatile uint16_t *data_ptr,
+                                  const uint16_t nbits,
+                                  const match_data_windows_t &windows,
+                                  const bool MSBfirst,
+                                  const bool expectlastspace) {
   match_result_t result;
   result.success = false;  // Fail by default.
   result.data = 0;
@@ -1325,11 +1845,11 @@ match_result_t IRrecv::matchData(
     for (result.used = 0; result.used < nbits * 2;
          result.used += 2, data_ptr += 2) {
       // Is the bit a '1'?
-      if (matchMark(*data_ptr, onemark, tolerance, excess) &&
-          matchSpace(*(data_ptr + 1), onespace, tolerance, excess)) {
+      if (inWindow(*data_ptr, windows.onemark) &&
+          inWindow(*(data_ptr + 1), windows.onespace)) {
         result.data = (result.data << 1) | 1;
-      } else if (matchMark(*data_ptr, zeromark, tolerance, excess) &&
-                 matchSpace(*(data_ptr + 1), zerospace, tolerance, excess)) {
+      } else if (inWindow(*data_ptr, windows.zeromark) &&
+                 inWindow(*(data_ptr + 1), windows.zerospace)) {
         result.data <<= 1;  // The bit is a '0'.
       } else {
         if (!MSBfirst) result.data = reverseBits(result.data, result.used / 2);
@@ -1339,14 +1859,12 @@ match_result_t IRrecv::matchData(
     result.success = true;
   } else {  // We are expecting data without a final space.
     // Match all but the last bit, as it may not match easily.
-    result = matchData(data_ptr, nbits ? nbits - 1 : 0, onemark, onespace,
-                       zeromark, zerospace, tolerance, excess, true, true);
+    result = _matchData(data_ptr, nbits ? nbits - 1 : 0, windows, true, true);
     if (result.success) {
       // Is the bit a '1'?
-      if (matchMark(*(data_ptr + result.used), onemark, tolerance, excess))
+      if (inWindow(*(data_ptr + result.used), windows.onemark))
         result.data = (result.data << 1) | 1;
-      else if (matchMark(*(data_ptr + result.used), zeromark, tolerance,
-               excess))
+      else if (inWindow(*(data_ptr + result.used), windows.zeromark))
         result.data <<= 1;  // The bit is a '0'.
       else
         result.success = false;
@@ -1381,14 +1899,39 @@ uint16_t IRrecv::matchBytes(volatile uint16_t *data_ptr, uint8_t *result_ptr,
                             const uint8_t tolerance, const int16_t excess,
                             const bool MSBfirst, const bool expectlastspace) {
   // Check if there is enough capture buffer to possibly have the desired bytes.
+  if (remaining + expectlastspace < (nbytes * 8 * 2) + 1)
+    return 0;  // Nope, so abort.
+  return _matchBytes(data_ptr, result_ptr, remaining, nbytes,
+                     matchDataWindows(onemark, onespace, zeromark, zerospace,
+                                      tolerance, excess),
+                     MSBfirst, expectlastspace);
+}
+
+/// Match & decode the typical data section of an IR message, using
+/// precomputed match windows.
+/// The bytes are stored at result_ptr. The first byte in the result equates to
+/// the first byte encountered, and so on.
+/// @param[in] data_ptr A pointer to where we are at in the capture buffer.
+/// @param[out] result_ptr A ptr to where to start storing the bytes we decoded.
+/// @param[in] remaining The size of the capture buffer remaining.
+/// @param[in] nbytes Nr. of data bytes we expect.
+/// @param[in] windows The bit timings, as returned by matchDataWindows().
+/// @param[in] MSBfirst Bit order to save the data in. (Def: true)
+///   true is Most Significant Bit First Order, false is Least Significant First
+/// @param[in] expectlastspace Do we expect a space at the end of the message?
+/// @return If successful, how many buffer entries were used. Otherwise 0.
+uint16_t IRrecv::_matchBytes(volatile uint16_t *data_ptr, uint8_t *result_ptr,
+                             const uint16_t remaining, const uint16_t nbytes,
+                             const match_data_windows_t &windows,
+                             const bool MSBfirst, const bool expectlastspace) {
+  // Check if there is enough capture buffer to possibly have the desired bytes.
   if (remaining + expectlastspace < (nbytes * 8 * 2) + 1)
     return 0;  // Nope, so abort.
   uint16_t offset = 0;
   for (uint16_t byte_pos = 0; byte_pos < nbytes; byte_pos++) {
     bool lastspace = (byte_pos + 1 == nbytes) ? expectlastspace : true;
-    match_result_t result = matchData(data_ptr + offset, 8, onemark, onespace,
-                                      zeromark, zerospace, tolerance, excess,
-                                      MSBfirst, lastspace);
+    match_result_t result = _matchData(data_ptr + offset, 8, windows, MSBfirst,
+                                       lastspace);
     if (result.success == false) return 0;  // Fail
     result_ptr[byte_pos] = (uint8_t)result.data;
     offset += result.used;
@@ -1468,20 +2011,19 @@ uint16_t IRrecv::_matchGeneric(volatile uint16_t *data_ptr,
     return 0;
 
   // Data
+  const match_data_windows_t windows = matchDataWindows(onemark, onespace,
+                                                        zeromark, zerospace,
+                                                        tolerance, excess);
   if (use_bits) {  // Bits.
-    match_result_t result = IRrecv::matchData(data_ptr + offset, nbits,
-                                              onemark, onespace,
-                                              zeromark, zerospace, tolerance,
-                                              excess, MSBfirst, kexpectspace);
+    match_result_t result = _matchData(data_ptr + offset, nbits, windows,
+                                       MSBfirst, kexpectspace);
     if (!result.success) return 0;
     *result_bits_ptr = result.data;
     offset += result.used;
   } else {  // bytes
-    uint16_t data_used = IRrecv::matchBytes(data_ptr + offset, result_bytes_ptr,
-                                            remaining - offset, nbits / 8,
-                                            onemark, onespace,
-                                            zeromark, zerospace, tolerance,
-                                            excess, MSBfirst, kexpectspace);
+    uint16_t data_used = _matchBytes(data_ptr + offset, result_bytes_ptr,
+                                     remaining - offset, nbits / 8, windows,
+                                     MSBfirst, kexpectspace);
     if (!data_used) return 0;
     offset += data_used;
   }
@@ -1847,6 +2389,11 @@ uint16_t IRrecv::matchManchesterData(volatile const uint16_t *data_ptr,
 
   // Convert to ticks. Optimisation: Saves on math/extra instructions later.
   uint16_t bank = starting_balance / kRawTick;
+  // Precompute the short & long interval bounds once, rather than per entry.
+  const match_window_t short_window = matchWindow(half_period, tolerance,
+                                                  excess);
+  const match_window_t long_window = matchWindow(half_period * 2, tolerance,
+                                                 excess);
 
   // Data
   // Loop through the buffer till we run out of buffer, or nr of half periods.
@@ -1873,7 +2420,7 @@ uint16_t IRrecv::matchManchesterData(volatile const uint16_t *data_ptr,
     DPRINTLN(bank * kRawTick);
     // Check if we don't have a short interval.
     DPRINTLN("DEBUG: Checking for short interval");
-    if (!match(bank, half_period, tolerance, excess)) {
+    if (!inWindow(bank, short_window)) {
       DPRINTLN("DEBUG: It is. Exiting");
       return 0;  // Not valid.
     }
@@ -1903,13 +2450,13 @@ uint16_t IRrecv::matchManchesterData(volatile const uint16_t *data_ptr,
     data |= currentBit;
 
     // Check if we have a long interval.
-    if (match(bank, half_period * 2, tolerance, excess)) {
+    if (inWindow(bank, long_window)) {
       // It is, so flip the bit we need to append, and remove a half_period of
       // time from the bank.
       DPRINTLN("DEBUG: long interval detected");
       currentBit = !currentBit;
       bank -= raw_half_period;
-    } else if (match(bank, half_period, tolerance, excess)) {
+    } else if (inWindow(bank, short_window)) {
       // It is a short interval, so eat up all the time and move on.
       DPRINTLN("DEBUG: short interval detected");
       bank = 0;
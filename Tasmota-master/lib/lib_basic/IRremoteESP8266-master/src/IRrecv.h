@@ -33,6 +33,9 @@ const uint8_t kMarkState = 3;
 const uint8_t kSpaceState = 4;
 const uint8_t kStopState = 5;
 const uint8_t kTolerance = 25;   // default percent tolerance in measurements.
+// The decode index is built to be safe up to this base tolerance.
+// A higher `setTolerance()` value disables the index.
+const uint8_t kDecodeIndexMaxTolerance = 40;
 const uint8_t kUseDefTol = 255;  // Indicate to use the class default tolerance.
 const uint16_t kRawTick = 2;     // Capture tick to uSec factor.
 #define RAWTICK kRawTick  // Deprecated. For legacy user code support only.
@@ -77,6 +80,9 @@ typedef struct {
   uint16_t rawlen;   // counter of entries in rawbuf.
   uint8_t overflow;  // Buffer overflow indicator.
   uint8_t timeout;   // Nr. of milliSeconds before we give up.
+#if ENABLE_INCREMENTAL_DECODE
+  uint32_t lastedge;  // Time (in uSeconds) of the most recent edge.
+#endif  // ENABLE_INCREMENTAL_DECODE
 } irparams_t;
 
 /// Results from a data match
@@ -86,6 +92,20 @@ typedef struct {
   uint16_t used;  // How many buffer positions were used.
 } match_result_t;
 
+/// A precomputed range of acceptable durations for matching a pulse.
+typedef struct {
+  uint32_t low;   // Shortest acceptable period. (in ticks)
+  uint32_t high;  // Longest acceptable period. (in ticks)
+} match_window_t;
+
+/// Precomputed match windows for the bit timings of a data section.
+typedef struct {
+  match_window_t onemark;
+  match_window_t onespace;
+  match_window_t zeromark;
+  match_window_t zerospace;
+} match_data_windows_t;
+
 // Classes
 
 /// Results returned from the decoder
@@ -135,6 +155,12 @@ class IRrecv {
 #if DECODE_HASH
   void setUnknownThreshold(const uint16_t length);
 #endif
+#if ENABLE_DECODE_INDEX
+  void enableDecodeIndex(const bool enable = true);
+#endif  // ENABLE_DECODE_INDEX
+#if ENABLE_INCREMENTAL_DECODE
+  void enableIncrementalDecode(const bool enable = true);
+#endif  // ENABLE_INCREMENTAL_DECODE
   bool match(const uint32_t measured, const uint32_t desired,
              const uint8_t tolerance = kUseDefTol,
              const uint16_t delta = 0);
@@ -162,6 +188,18 @@ class IRrecv {
 #if DECODE_HASH
   uint16_t _unknown_threshold;
 #endif
+#if ENABLE_DECODE_INDEX
+  bool _decode_index;
+  // Bitmap (by decode_type_t) of the protocols worth trying at this offset.
+  uint32_t _decode_candidates[kLastDecodeType / 32 + 1];
+#endif  // ENABLE_DECODE_INDEX
+#if ENABLE_INCREMENTAL_DECODE
+  bool _incremental;
+  uint16_t _incremental_pos;    // Next capture entry to be examined.
+  uint16_t _incremental_alive;  // Bitmap of protocols still matching.
+  void _resetIncremental(void);
+  bool _incrementalComplete(void);
+#endif  // ENABLE_INCREMENTAL_DECODE
 #ifdef UNIT_TEST
   volatile irparams_t *_getParamsPtr(void);
 #endif  // UNIT_TEST
@@ -175,6 +213,16 @@ class IRrecv {
   uint32_t ticksHigh(const uint32_t usecs,
                      const uint8_t tolerance = kUseDefTol,
                      const uint16_t delta = 0);
+  match_window_t matchWindow(const uint32_t desired,
+                             const uint8_t tolerance = kUseDefTol,
+                             const uint16_t delta = 0);
+  static bool inWindow(const uint32_t measured, const match_window_t window);
+  match_data_windows_t matchDataWindows(const uint16_t onemark,
+                                        const uint32_t onespace,
+                                        const uint16_t zeromark,
+                                        const uint32_t zerospace,
+                                        const uint8_t tolerance = kUseDefTol,
+                                        const int16_t excess = kMarkExcess);
   bool matchAtLeast(const uint32_t measured, const uint32_t desired,
                     const uint8_t tolerance = kUseDefTol,
                     const uint16_t delta = 0);
@@ -203,6 +251,10 @@ class IRrecv {
                            const int16_t excess = kMarkExcess,
                            const bool MSBfirst = true,
                            const bool expectlastspace = true);
+  match_result_t _matchData(volatile uint16_t *data_ptr, const uint16_t nbits,
+                            const match_data_windows_t &windows,
+                            const bool MSBfirst = true,
+                            const bool expectlastspace = true);
   uint16_t matchBytes(volatile uint16_t *data_ptr, uint8_t *result_ptr,
                       const uint16_t remaining, const uint16_t nbytes,
                       const uint16_t onemark, const uint32_t onespace,
@@ -211,6 +263,11 @@ class IRrecv {
                       const int16_t excess = kMarkExcess,
                       const bool MSBfirst = true,
                       const bool expectlastspace = true);
+  uint16_t _matchBytes(volatile uint16_t *data_ptr, uint8_t *result_ptr,
+                       const uint16_t remaining, const uint16_t nbytes,
+                       const match_data_windows_t &windows,
+                       const bool MSBfirst = true,
+                       const bool expectlastspace = true);
   uint16_t matchGeneric(volatile uint16_t *data_ptr,
                         uint64_t *result_ptr,
                         const uint16_t remaining, const uint16_t nbits,
@@ -272,6 +329,9 @@ class IRrecv {
                            const bool MSBfirst = true,
                            const bool GEThomas = true);
   void crudeNoiseFilter(decode_results *results, const uint16_t floor = 0);
+  void _buildDecodeCandidates(const decode_results *results,
+                              const uint16_t offset);
+  bool _isDecodeCandidate(const decode_type_t protocol);
   bool decodeHash(decode_results *results);
 #if DECODE_VOLTAS
   bool decodeVoltas(decode_results *results,
@@ -866,6 +866,34 @@
 #define ENABLE_NOISE_FILTER_OPTION true
 #endif  // ENABLE_NOISE_FILTER_OPTION
 
+// Pre-classify the header (first mark & space) of a capture before trying the
+// protocol decoders in `IRrecv::decode()`. Decoders whose header timings can't
+// possibly match the capture are skipped instead of each being tried in turn.
+// This mostly helps with unknown/noisy messages, which would otherwise run
+// through every enabled decoder before falling back to `decodeHash()`.
+// Note: It costs a small table (~0.5k) of header timings.
+//       The option to disable this feature is here if your project is _really_
+//       tight on resources.
+#ifndef ENABLE_DECODE_INDEX
+#define ENABLE_DECODE_INDEX true
+#endif  // ENABLE_DECODE_INDEX
+
+// Allow `IRrecv::decode()` to recognise the end of some simple remote protocols
+// (NEC, Samsung, Panasonic, JVC, & Sony) while the message is still being
+// captured, rather than always waiting for the capture timeout to expire.
+// This removes the timeout from the latency of a button press on those
+// protocols. Everything else is still decoded after the timeout as normal.
+// Note: When multi-frame protocols built from NEC-like frames (Epson, Pioneer,
+//       Carrier AC) are enabled, NEC needs a gap longer than theirs, which is
+//       usually longer than the capture timeout, so NEC gains nothing.
+// Note: Even when this option is enabled, it is _off_ by default, and needs to
+//       be turned on via `IRrecv::enableIncrementalDecode()`.
+#ifndef ENABLE_INCREMENTAL_DECODE
+#define ENABLE_INCREMENTAL_DECODE (DECODE_NEC || DECODE_SAMSUNG || \
+                                   DECODE_PANASONIC || DECODE_JVC || \
+                                   DECODE_SONY)
+#endif  // ENABLE_INCREMENTAL_DECODE
+
 /// Enumerator for defining and numbering of supported IR protocol.
 /// @note Always add to the end of the list and should never remove entries
 ///  or change order. Projects may save the type number for later usage
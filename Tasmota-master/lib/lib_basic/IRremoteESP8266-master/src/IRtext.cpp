@@ -9,6 +9,7 @@
 #include <Arduino.h>
 #endif  // UNIT_TEST
 #include "IRremoteESP8266.h"
+#include "IRutils.h"
 #include "i18n.h"
 
 #ifndef PROGMEM
@@ -271,120 +272,136 @@ IRTEXT_CONST_STRING(kDg11j191Str, D_STR_DG11J191);  ///< "DG11J191"
 
 // Protocol Names
 // Needs to be in decode_type_t order.
+// New protocol strings should be added to the end of this list.
+#define IRTEXT_PROTOCOL_NAMES(NAME) \
+    NAME(D_STR_UNUSED) \
+    NAME(D_STR_RC5) \
+    NAME(D_STR_RC6) \
+    NAME(D_STR_NEC) \
+    NAME(D_STR_SONY) \
+    NAME(D_STR_PANASONIC) \
+    NAME(D_STR_JVC) \
+    NAME(D_STR_SAMSUNG) \
+    NAME(D_STR_WHYNTER) \
+    NAME(D_STR_AIWA_RC_T501) \
+    NAME(D_STR_LG) \
+    NAME(D_STR_SANYO) \
+    NAME(D_STR_MITSUBISHI) \
+    NAME(D_STR_DISH) \
+    NAME(D_STR_SHARP) \
+    NAME(D_STR_COOLIX) \
+    NAME(D_STR_DAIKIN) \
+    NAME(D_STR_DENON) \
+    NAME(D_STR_KELVINATOR) \
+    NAME(D_STR_SHERWOOD) \
+    NAME(D_STR_MITSUBISHI_AC) \
+    NAME(D_STR_RCMM) \
+    NAME(D_STR_SANYO_LC7461) \
+    NAME(D_STR_RC5X) \
+    NAME(D_STR_GREE) \
+    NAME(D_STR_PRONTO) \
+    NAME(D_STR_NEC_LIKE) \
+    NAME(D_STR_ARGO) \
+    NAME(D_STR_TROTEC) \
+    NAME(D_STR_NIKAI) \
+    NAME(D_STR_RAW) \
+    NAME(D_STR_GLOBALCACHE) \
+    NAME(D_STR_TOSHIBA_AC) \
+    NAME(D_STR_FUJITSU_AC) \
+    NAME(D_STR_MIDEA) \
+    NAME(D_STR_MAGIQUEST) \
+    NAME(D_STR_LASERTAG) \
+    NAME(D_STR_CARRIER_AC) \
+    NAME(D_STR_HAIER_AC) \
+    NAME(D_STR_MITSUBISHI2) \
+    NAME(D_STR_HITACHI_AC) \
+    NAME(D_STR_HITACHI_AC1) \
+    NAME(D_STR_HITACHI_AC2) \
+    NAME(D_STR_GICABLE) \
+    NAME(D_STR_HAIER_AC_YRW02) \
+    NAME(D_STR_WHIRLPOOL_AC) \
+    NAME(D_STR_SAMSUNG_AC) \
+    NAME(D_STR_LUTRON) \
+    NAME(D_STR_ELECTRA_AC) \
+    NAME(D_STR_PANASONIC_AC) \
+    NAME(D_STR_PIONEER) \
+    NAME(D_STR_LG2) \
+    NAME(D_STR_MWM) \
+    NAME(D_STR_DAIKIN2) \
+    NAME(D_STR_VESTEL_AC) \
+    NAME(D_STR_TECO) \
+    NAME(D_STR_SAMSUNG36) \
+    NAME(D_STR_TCL112AC) \
+    NAME(D_STR_LEGOPF) \
+    NAME(D_STR_MITSUBISHI_HEAVY_88) \
+    NAME(D_STR_MITSUBISHI_HEAVY_152) \
+    NAME(D_STR_DAIKIN216) \
+    NAME(D_STR_SHARP_AC) \
+    NAME(D_STR_GOODWEATHER) \
+    NAME(D_STR_INAX) \
+    NAME(D_STR_DAIKIN160) \
+    NAME(D_STR_NEOCLIMA) \
+    NAME(D_STR_DAIKIN176) \
+    NAME(D_STR_DAIKIN128) \
+    NAME(D_STR_AMCOR) \
+    NAME(D_STR_DAIKIN152) \
+    NAME(D_STR_MITSUBISHI136) \
+    NAME(D_STR_MITSUBISHI112) \
+    NAME(D_STR_HITACHI_AC424) \
+    NAME(D_STR_SONY_38K) \
+    NAME(D_STR_EPSON) \
+    NAME(D_STR_SYMPHONY) \
+    NAME(D_STR_HITACHI_AC3) \
+    NAME(D_STR_DAIKIN64) \
+    NAME(D_STR_AIRWELL) \
+    NAME(D_STR_DELONGHI_AC) \
+    NAME(D_STR_DOSHISHA) \
+    NAME(D_STR_MULTIBRACKETS) \
+    NAME(D_STR_CARRIER_AC40) \
+    NAME(D_STR_CARRIER_AC64) \
+    NAME(D_STR_HITACHI_AC344) \
+    NAME(D_STR_CORONA_AC) \
+    NAME(D_STR_MIDEA24) \
+    NAME(D_STR_ZEPEAL) \
+    NAME(D_STR_SANYO_AC) \
+    NAME(D_STR_VOLTAS) \
+    NAME(D_STR_METZ) \
+    NAME(D_STR_TRANSCOLD) \
+    NAME(D_STR_TECHNIBEL_AC) \
+    NAME(D_STR_MYPROTOCOL) \
+    NAME(D_STR_ELITESCREENS) \
+    NAME(D_STR_PANASONIC_AC32) \
+    NAME(D_STR_MILESTAG2) \
+    NAME(D_STR_ECOCLIM) \
+    NAME(D_STR_XMP) \
+    NAME(D_STR_TRUMA) \
+    NAME(D_STR_HAIER_AC176) \
+    NAME(D_STR_TEKNOPOINT) \
+    NAME(D_STR_KELON) \
+    NAME(D_STR_TROTEC_3550) \
+    NAME(D_STR_SANYO_AC88) \
+    NAME(D_STR_BOSE) \
+    NAME(D_STR_ARRIS) \
+    NAME(D_STR_RHOSS) \
+    NAME(D_STR_AIRTON)
+
+#define IRTEXT_PROTOCOL_NAME_STR(STR) STR "\x0"
 IRTEXT_CONST_BLOB_DECL(kAllProtocolNamesStr) {
-    D_STR_UNUSED "\x0"
-    D_STR_RC5 "\x0"
-    D_STR_RC6 "\x0"
-    D_STR_NEC "\x0"
-    D_STR_SONY "\x0"
-    D_STR_PANASONIC "\x0"
-    D_STR_JVC "\x0"
-    D_STR_SAMSUNG "\x0"
-    D_STR_WHYNTER "\x0"
-    D_STR_AIWA_RC_T501 "\x0"
-    D_STR_LG "\x0"
-    D_STR_SANYO "\x0"
-    D_STR_MITSUBISHI "\x0"
-    D_STR_DISH "\x0"
-    D_STR_SHARP "\x0"
-    D_STR_COOLIX "\x0"
-    D_STR_DAIKIN "\x0"
-    D_STR_DENON "\x0"
-    D_STR_KELVINATOR "\x0"
-    D_STR_SHERWOOD "\x0"
-    D_STR_MITSUBISHI_AC "\x0"
-    D_STR_RCMM "\x0"
-    D_STR_SANYO_LC7461 "\x0"
-    D_STR_RC5X "\x0"
-    D_STR_GREE "\x0"
-    D_STR_PRONTO "\x0"
-    D_STR_NEC_LIKE "\x0"
-    D_STR_ARGO "\x0"
-    D_STR_TROTEC "\x0"
-    D_STR_NIKAI "\x0"
-    D_STR_RAW "\x0"
-    D_STR_GLOBALCACHE "\x0"
-    D_STR_TOSHIBA_AC "\x0"
-    D_STR_FUJITSU_AC "\x0"
-    D_STR_MIDEA "\x0"
-    D_STR_MAGIQUEST "\x0"
-    D_STR_LASERTAG "\x0"
-    D_STR_CARRIER_AC "\x0"
-    D_STR_HAIER_AC "\x0"
-    D_STR_MITSUBISHI2 "\x0"
-    D_STR_HITACHI_AC "\x0"
-    D_STR_HITACHI_AC1 "\x0"
-    D_STR_HITACHI_AC2 "\x0"
-    D_STR_GICABLE "\x0"
-    D_STR_HAIER_AC_YRW02 "\x0"
-    D_STR_WHIRLPOOL_AC "\x0"
-    D_STR_SAMSUNG_AC "\x0"
-    D_STR_LUTRON "\x0"
-    D_STR_ELECTRA_AC "\x0"
-    D_STR_PANASONIC_AC "\x0"
-    D_STR_PIONEER "\x0"
-    D_STR_LG2 "\x0"
-    D_STR_MWM "\x0"
-    D_STR_DAIKIN2 "\x0"
-    D_STR_VESTEL_AC "\x0"
-    D_STR_TECO "\x0"
-    D_STR_SAMSUNG36 "\x0"
-    D_STR_TCL112AC "\x0"
-    D_STR_LEGOPF "\x0"
-    D_STR_MITSUBISHI_HEAVY_88 "\x0"
-    D_STR_MITSUBISHI_HEAVY_152 "\x0"
-    D_STR_DAIKIN216 "\x0"
-    D_STR_SHARP_AC "\x0"
-    D_STR_GOODWEATHER "\x0"
-    D_STR_INAX "\x0"
-    D_STR_DAIKIN160 "\x0"
-    D_STR_NEOCLIMA "\x0"
-    D_STR_DAIKIN176 "\x0"
-    D_STR_DAIKIN128 "\x0"
-    D_STR_AMCOR "\x0"
-    D_STR_DAIKIN152 "\x0"
-    D_STR_MITSUBISHI136 "\x0"
-    D_STR_MITSUBISHI112 "\x0"
-    D_STR_HITACHI_AC424 "\x0"
-    D_STR_SONY_38K "\x0"
-    D_STR_EPSON "\x0"
-    D_STR_SYMPHONY "\x0"
-    D_STR_HITACHI_AC3 "\x0"
-    D_STR_DAIKIN64 "\x0"
-    D_STR_AIRWELL "\x0"
-    D_STR_DELONGHI_AC "\x0"
-    D_STR_DOSHISHA "\x0"
-    D_STR_MULTIBRACKETS "\x0"
-    D_STR_CARRIER_AC40 "\x0"
-    D_STR_CARRIER_AC64 "\x0"
-    D_STR_HITACHI_AC344 "\x0"
-    D_STR_CORONA_AC "\x0"
-    D_STR_MIDEA24 "\x0"
-    D_STR_ZEPEAL "\x0"
-    D_STR_SANYO_AC "\x0"
-    D_STR_VOLTAS "\x0"
-    D_STR_METZ "\x0"
-    D_STR_TRANSCOLD "\x0"
-    D_STR_TECHNIBEL_AC "\x0"
-    //D_STR_MIRAGE "\x0"
-    D_STR_MYPROTOCOL "\x0"
-    D_STR_ELITESCREENS "\x0"
-    D_STR_PANASONIC_AC32 "\x0"
-    D_STR_MILESTAG2 "\x0"
-    D_STR_ECOCLIM "\x0"
-    D_STR_XMP "\x0"
-    D_STR_TRUMA "\x0"
-    D_STR_HAIER_AC176 "\x0"
-    D_STR_TEKNOPOINT "\x0"
-    D_STR_KELON "\x0"
-    D_STR_TROTEC_3550 "\x0"
-    D_STR_SANYO_AC88 "\x0"
-    D_STR_BOSE "\x0"
-    D_STR_ARRIS "\x0"
-    D_STR_RHOSS "\x0"
-    D_STR_AIRTON "\x0"
-    ///< New protocol strings should be added just above this line.
+    IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_STR)
     "\x0"  ///< This string requires double null termination.
 };
 
 IRTEXT_CONST_BLOB_PTR(kAllProtocolNamesStr);
+
+// Case insensitive hashes of the protocol names, in the same order.
+// These let `strToDecodeType()` skip the names that can't possibly match.
+#define IRTEXT_PROTOCOL_NAME_HASH(STR) \
+    static_cast<uint16_t>(irutils::strCaseHash(STR)),
+const uint16_t kAllProtocolNamesHash[] PROGMEM = {
+    IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_HASH)
+};
+const uint16_t kAllProtocolNamesHashSize =
+    sizeof(kAllProtocolNamesHash) / sizeof(kAllProtocolNamesHash[0]);
+static_assert(sizeof(kAllProtocolNamesHash) / sizeof(kAllProtocolNamesHash[0])
+              >= kLastDecodeType + 1,
+              "Every protocol in decode_type_t needs a name.");
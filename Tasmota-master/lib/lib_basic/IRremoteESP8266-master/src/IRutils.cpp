@@ -34,6 +34,20 @@
 #define STRLEN(PTR) strlen(PTR)
 #endif  // ESP8266
 #endif  // STRLEN
+#ifndef MEMCPY
+#if defined(ESP8266)
+#define MEMCPY(DST, SRC, LEN) memcpy_P(DST, SRC, LEN)
+#else  // ESP8266
+#define MEMCPY(DST, SRC, LEN) memcpy(DST, SRC, LEN)
+#endif  // ESP8266
+#endif  // MEMCPY
+#ifndef READ_WORD
+#if defined(ESP8266)
+#define READ_WORD(PTR) pgm_read_word(PTR)
+#else  // ESP8266
+#define READ_WORD(PTR) (*(PTR))
+#endif  // ESP8266
+#endif  // READ_WORD
 #ifndef FPSTR
 #define FPSTR(X) X
 #endif  // FPSTR
@@ -63,18 +77,31 @@ uint64_t reverseBits(uint64_t input, uint16_t nbits) {
 /// @returns A String representation of the integer.
 /// @note Based on Arduino's Print::printNumber()
 String uint64ToString(uint64_t input, uint8_t base) {
-  String result = "";
+  char buf[sizeof(input) * 8 + 1];  // Worst case is base 2.
+  uint64ToString(input, buf, sizeof(buf), base);
+  return String(buf);
+}
+
+/// Convert a uint64_t (unsigned long long) to a string, without using the
+/// heap.
+/// @param[in] input The value to print
+/// @param[out] buf The buffer to write the text to. Always NUL terminated.
+/// @param[in] len The size of `buf` in bytes.
+/// @param[in] base The output base.
+/// @return The nr. of characters written, excluding the NUL.
+/// @note If `buf` is too small, only the most significant digits are written.
+uint16_t uint64ToString(uint64_t input, char *buf, const uint16_t len,
+                        uint8_t base) {
+  if (!len) return 0;
   // prevent issues if called with base <= 1
   if (base < 2) base = 10;
   // Check we have a base that we can actually print.
   // i.e. [0-9A-Z] == 36
   if (base > 36) base = 10;
 
-  // Reserve some string space to reduce fragmentation.
-  // 16 bytes should store a uint64 in hex text which is the likely worst case.
-  // 64 bytes would be the worst case (base 2).
-  result.reserve(16);
-
+  // Generate the digits in reverse order, then copy them out.
+  char digits[sizeof(input) * 8];
+  uint8_t ndigits = 0;
   do {
     char c = input % base;
     input /= base;
@@ -83,9 +110,12 @@ String uint64ToString(uint64_t input, uint8_t base) {
       c += '0';
     else
       c += 'A' - 10;
-    result = c + result;
+    digits[ndigits++] = c;
   } while (input);
-  return result;
+  uint16_t written = 0;
+  while (ndigits && written < len - 1) buf[written++] = digits[--ndigits];
+  buf[written] = '\0';
+  return written;
 }
 
 /// Convert a int64_t (signed long long) to a string.
@@ -113,22 +143,41 @@ void serialPrintUint64(uint64_t input, uint8_t base) {
 }
 #endif
 
+/// Find the nth name in the list of protocol names.
+/// @param[in] index Position of the name in `kAllProtocolNamesStr`.
+/// @return A ptr to the (possibly flash based) name. Empty if no such name.
+static const char *protocolName(const uint16_t index) {
+  auto *ptr = reinterpret_cast<const char*>(kAllProtocolNamesStr);
+  for (uint16_t i = 0; i <= index && STRLEN(ptr); i++) {
+    if (i == index) return ptr;
+    ptr += STRLEN(ptr) + 1;
+  }
+  return ptr;  // Ran out of names, so it's empty.
+}
+
+/// Find the name of a protocol type (enum etc).
+/// @param[in] protocol Nr. (enum) of the protocol.
+/// @return A ptr to the (possibly flash based) name. kUnknownStr if no match.
+static const char *typeToName(const decode_type_t protocol) {
+  if (protocol > kLastDecodeType || protocol == decode_type_t::UNKNOWN)
+    return reinterpret_cast<const char*>(kUnknownStr);
+  return protocolName(protocol);
+}
+
 /// Convert a C-style string to a decode_type_t.
 /// @param[in] str A C-style string containing a protocol name or number.
 /// @return A decode_type_t enum. (decode_type_t::UNKNOWN if no match.)
 decode_type_t strToDecodeType(const char * const str) {
-  auto *ptr = reinterpret_cast<const char*>(kAllProtocolNamesStr);
-  uint16_t length = STRLEN(ptr);
-  for (uint16_t i = 0; length; i++) {
-    if (!STRCASECMP(str, ptr)) return (decode_type_t)i;
-    ptr += length + 1;
-    length = STRLEN(ptr);
-  }
-  // Handle integer values of the type by converting to a string and back again.
-  decode_type_t result = strToDecodeType(
-      typeToString((decode_type_t)atoi(str)).c_str());
-  if (result > 0)
-    return result;
+  // Only compare the names whose hash matches. (Usually just the right one.)
+  const uint16_t hash = irutils::strCaseHash(str);
+  for (uint16_t i = 0; i < kAllProtocolNamesHashSize; i++)
+    if (READ_WORD(&kAllProtocolNamesHash[i]) == hash &&
+        !STRCASECMP(str, protocolName(i)))
+      return (decode_type_t)i;
+  // Handle integer values of the type.
+  const int number = atoi(str);
+  if (number > 0 && number <= kLastDecodeType)
+    return (decode_type_t)number;
 
   return decode_type_t::UNKNOWN;
 }
@@ -140,22 +189,7 @@ decode_type_t strToDecodeType(const char * const str) {
 String typeToString(const decode_type_t protocol, const bool isRepeat) {
   String result = "";
   result.reserve(30);  // Size of longest protocol name + " (Repeat)"
-  if (protocol > kLastDecodeType || protocol == decode_type_t::UNKNOWN) {
-    result = kUnknownStr;
-  } else {
-    auto *ptr = reinterpret_cast<const char*>(kAllProtocolNamesStr);
-    if (protocol > kLastDecodeType || protocol == decode_type_t::UNKNOWN) {
-      result = kUnknownStr;
-    } else {
-      for (uint16_t i = 0; i <= protocol && STRLEN(ptr); i++) {
-        if (i == protocol) {
-          result = FPSTR(ptr);
-          break;
-        }
-        ptr += STRLEN(ptr) + 1;
-      }
-    }
-  }
+  result = FPSTR(typeToName(protocol));
   if (isRepeat) {
     result += kSpaceLBraceStr;
     result += kRepeatStr;
@@ -164,6 +198,26 @@ String typeToString(const decode_type_t protocol, const bool isRepeat) {
   return result;
 }
 
+/// Convert a protocol type (enum etc) to a human readable string, without
+/// using the heap.
+/// @param[in] protocol Nr. (enum) of the protocol.
+/// @param[out] buf The buffer to write the text to. Always NUL terminated.
+/// @param[in] len The size of `buf` in bytes.
+/// @param[in] isRepeat A flag indicating if it is a repeat message.
+/// @return The nr. of characters written, excluding the NUL.
+uint16_t typeToString(const decode_type_t protocol, char *buf,
+                      const uint16_t len, const bool isRepeat) {
+  uint16_t written = irutils::copyString(buf, len, typeToName(protocol));
+  if (isRepeat) {
+    written += irutils::copyString(buf + written, len - written,
+        reinterpret_cast<const char*>(kSpaceLBraceStr));
+    written += irutils::copyString(buf + written, len - written,
+                                   reinterpret_cast<const char*>(kRepeatStr));
+    written += irutils::copyString(buf + written, len - written, ")");
+  }
+  return written;
+}
+
 /// Does the given protocol use a complex state as part of the decode?
 /// @param[in] protocol The decode_type_t protocol we are enquiring about.
 /// @return True if the protocol uses a state array. False if just an integer.
@@ -366,20 +420,34 @@ String resultToTimingInfo(const decode_results * const results) {
 /// @param[in] result A ptr to a decode_results structure.
 /// @return A String containing the output.
 String resultToHexidecimal(const decode_results * const result) {
-  String output = F("0x");
-  // Reserve some space for the string to reduce heap fragmentation.
-  output.reserve(2 * kStateSizeMax + 2);  // Should cover worst cases.
+  char buf[2 * kStateSizeMax + 3];  // "0x" + the largest state + NUL.
+  resultToHexidecimal(result, buf, sizeof(buf));
+  return String(buf);
+}
+
+/// Convert the decode_results structure's value/state to simple hexadecimal,
+/// without using the heap.
+/// @param[in] result A ptr to a decode_results structure.
+/// @param[out] buf The buffer to write the text to. Always NUL terminated.
+///   `2 * kStateSizeMax + 3` bytes will hold the largest possible result.
+/// @param[in] len The size of `buf` in bytes.
+/// @return The nr. of characters written, excluding the NUL.
+uint16_t resultToHexidecimal(const decode_results * const result, char *buf,
+                             const uint16_t len) {
+  uint16_t written = irutils::copyString(buf, len, "0x");
   if (hasACState(result->decode_type)) {
 #if DECODE_AC
     for (uint16_t i = 0; result->bits > i * 8; i++) {
-      if (result->state[i] < 0x10) output += '0';  // Zero pad
-      output += uint64ToString(result->state[i], 16);
+      if (result->state[i] < 0x10)  // Zero pad
+        written += irutils::copyString(buf + written, len - written, "0");
+      written += uint64ToString(result->state[i], buf + written, len - written,
+                                16);
     }
 #endif  // DECODE_AC
   } else {
-    output += uint64ToString(result->value, 16);
+    written += uint64ToString(result->value, buf + written, len - written, 16);
   }
-  return output;
+  return written;
 }
 
 /// Dump out the decode_results structure into a human readable format.
@@ -519,6 +587,21 @@ float celsiusToFahrenheit(const float deg) { return (deg * 9.0) / 5.0 + 32.0; }
 float fahrenheitToCelsius(const float deg) { return (deg - 32.0) * 5.0 / 9.0; }
 
 namespace irutils {
+  /// Copy a (possibly flash based) string into a buffer, without using the
+  /// heap.
+  /// @param[out] buf The buffer to write the text to. Always NUL terminated
+  ///   if `len` is non-zero.
+  /// @param[in] len The size of `buf` in bytes.
+  /// @param[in] str The string to copy. Truncated if `buf` is too small.
+  /// @return The nr. of characters written, excluding the NUL.
+  uint16_t copyString(char *buf, const uint16_t len, const char *str) {
+    if (!len) return 0;
+    const uint16_t written = std::min(STRLEN(str), (size_t)(len - 1));
+    MEMCPY(buf, str, written);
+    buf[written] = '\0';
+    return written;
+  }
+
   /// Create a String with a colon separated "label: value" pair suitable for
   /// Humans.
   /// @param[in] value The value to come after the label.
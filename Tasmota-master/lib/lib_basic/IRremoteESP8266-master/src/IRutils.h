@@ -20,14 +20,20 @@ const uint8_t kHighNibble = 4;
 const uint8_t kModeBitsSize = 3;
 uint64_t reverseBits(uint64_t input, uint16_t nbits);
 String uint64ToString(uint64_t input, uint8_t base = 10);
+uint16_t uint64ToString(uint64_t input, char *buf, const uint16_t len,
+                        uint8_t base = 10);
 String int64ToString(int64_t input, uint8_t base = 10);
 String typeToString(const decode_type_t protocol,
                     const bool isRepeat = false);
+uint16_t typeToString(const decode_type_t protocol, char *buf,
+                      const uint16_t len, const bool isRepeat = false);
 void serialPrintUint64(uint64_t input, uint8_t base = 10);
 String resultToSourceCode(const decode_results * const results);
 String resultToTimingInfo(const decode_results * const results);
 String resultToHumanReadableBasic(const decode_results * const results);
 String resultToHexidecimal(const decode_results * const result);
+uint16_t resultToHexidecimal(const decode_results * const result, char *buf,
+                             const uint16_t len);
 bool hasACState(const decode_type_t protocol);
 uint16_t getCorrectedRawLength(const decode_results * const results);
 uint16_t *resultToRawArray(const decode_results * const decode);
@@ -90,6 +96,21 @@ namespace irutils {
   String htmlEscape(const String unescaped);
   String msToString(uint32_t const msecs);
   String minsToString(const uint16_t mins);
+  uint16_t copyString(char *buf, const uint16_t len, const char *str);
+  /// Case insensitive (ASCII) FNV-1a hash of a C-style string.
+  /// This is `constexpr` so tables of names can be hashed at compile-time.
+  /// @param[in] str A Ptr to the string to hash. (Must not be in flash.)
+  /// @param[in] hash The hash of any preceding text.
+  /// @return The 32 bit hash.
+  constexpr uint32_t strCaseHash(const char *str,
+                                 const uint32_t hash = 2166136261UL) {
+    return *str ? strCaseHash(str + 1,
+                              (hash ^ static_cast<uint8_t>(
+                                  (*str >= 'A' && *str <= 'Z') ? *str + 32
+                                                               : *str)) *
+                                  16777619UL)
+                : hash;
+  }
   uint8_t sumNibbles(const uint8_t * const start, const uint16_t length,
                      const uint8_t init = 0);
   uint8_t sumNibbles(const uint64_t data, const uint8_t count = 16,
@@ -0,0 +1,70 @@
+// Copyright 2021 IRremoteESP8266 contributors
+// Host benchmark for parsing the text of an A/C command.
+//
+// Times the string to enum conversions a JSON A/C command (e.g. Tasmota's
+// IRHVAC) needs: the protocol, model, mode, fan speed, swing & on/off values.
+//
+// Usage:
+//   make benchmark
+
+#include <chrono>  // NOLINT(build/c++11)
+#include <cstdio>
+#include "IRac.h"
+#include "IRremoteESP8266.h"
+#include "IRutils.h"
+
+namespace {
+const uint32_t kPasses = 200000;
+
+struct command_t {
+  const char *title;
+  const char *vendor;
+  const char *model;
+  const char *mode;
+  const char *fanspeed;
+  const char *swingv;
+  const char *swingh;
+  const char *power;
+};
+
+const command_t kCommands[] = {
+    {"Common", "COOLIX", "-1", "Cool", "Auto", "Off", "Off", "On"},
+    {"Late in the tables", "AIRTON", "DG11J191", "fan_only", "Highest",
+     "Up", "Max Right", "False"},
+    {"Aliases & mixed case", "daikin", "panasonicrkr", "HEATING", "medium",
+     "centre", "wide", "yes"},
+    {"Numbers", "16", "3", "Cool", "Auto", "Off", "Off", "1"},
+    {"Unknown values", "NOSUCHVENDOR", "NOSUCHMODEL", "Sideways", "Warp",
+     "Diagonal", "Outwards", "Maybe"},
+};
+
+// Parse a command the way an IRHVAC command handler would.
+// Returns a value depending on all the results so nothing is optimised away.
+uint32_t parse(const command_t &command) {
+  uint32_t total = strToDecodeType(command.vendor);
+  total += IRac::strToModel(command.model);
+  total += static_cast<uint32_t>(IRac::strToOpmode(command.mode));
+  total += static_cast<uint32_t>(IRac::strToFanspeed(command.fanspeed));
+  total += static_cast<uint32_t>(IRac::strToSwingV(command.swingv));
+  total += static_cast<uint32_t>(IRac::strToSwingH(command.swingh));
+  // Power, Celsius, Light, Beep, Econo, Filter, Turbo, Quiet & Clean.
+  for (uint8_t i = 0; i < 9; i++) total += IRac::strToBool(command.power);
+  return total;
+}
+}  // namespace
+
+int main() {
+  uint64_t total = 0;
+  for (const command_t &command : kCommands) {
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    for (uint32_t pass = 0; pass < kPasses; pass++) total += parse(command);
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    std::printf("%-22s %8.1f ns/command\n", command.title,
+                elapsed.count() * 1e9 / kPasses);
+  }
+  std::printf("(checksum %llu)\n",
+              static_cast<unsigned long long>(total));  // NOLINT(runtime/int)
+  return 0;
+}
@@ -2560,6 +2560,80 @@ TEST(TestIRac, strToModel) {
   EXPECT_EQ(0, IRac::strToModel("FOOBAR", 0));
 }
 
+// Every name we output should parse back to the same value, in any case.
+TEST(TestIRac, strToRoundTrips) {
+  for (int i = -1; i <= (int)stdAc::opmode_t::kLastOpmodeEnum; i++) {
+    stdAc::opmode_t mode = (stdAc::opmode_t)i;
+    for (bool ha : {false, true}) {
+      String name = IRac::opmodeToString(mode, ha);
+      EXPECT_EQ(mode, IRac::strToOpmode(name.c_str())) << name;
+      for (auto &c : name) c = tolower(c);
+      EXPECT_EQ(mode, IRac::strToOpmode(name.c_str())) << name;
+    }
+  }
+  for (int i = 0; i <= (int)stdAc::fanspeed_t::kLastFanspeedEnum; i++) {
+    stdAc::fanspeed_t speed = (stdAc::fanspeed_t)i;
+    String name = IRac::fanspeedToString(speed);
+    EXPECT_EQ(speed, IRac::strToFanspeed(name.c_str())) << name;
+    for (auto &c : name) c = toupper(c);
+    EXPECT_EQ(speed, IRac::strToFanspeed(name.c_str())) << name;
+  }
+  for (int i = -1; i <= (int)stdAc::swingv_t::kLastSwingvEnum; i++) {
+    stdAc::swingv_t swingv = (stdAc::swingv_t)i;
+    String name = IRac::swingvToString(swingv);
+    EXPECT_EQ(swingv, IRac::strToSwingV(name.c_str())) << name;
+  }
+  for (int i = -1; i <= (int)stdAc::swingh_t::kLastSwinghEnum; i++) {
+    stdAc::swingh_t swingh = (stdAc::swingh_t)i;
+    String name = IRac::swinghToString(swingh);
+    EXPECT_EQ(swingh, IRac::strToSwingH(name.c_str())) << name;
+  }
+  for (bool value : {false, true}) {
+    EXPECT_EQ(value, IRac::strToBool(IRac::boolToString(value).c_str(),
+                                     !value));
+  }
+  // Models are only unique per protocol, so check each protocol's names.
+  uint16_t models = 0;
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    for (int16_t model = 1; model < 16; model++) {
+      String name = irutils::modelToStr((decode_type_t)i, model);
+      if (name == kUnknownStr) continue;
+      models++;
+      EXPECT_EQ(model, IRac::strToModel(name.c_str())) << name;
+      for (auto &c : name) c = tolower(c);
+      EXPECT_EQ(model, IRac::strToModel(name.c_str())) << name;
+    }
+  }
+  EXPECT_LT(20, models);
+}
+
+// Check every alternative name each setting can be given.
+TEST(TestIRac, strToAliases) {
+  EXPECT_EQ(stdAc::opmode_t::kDry, IRac::strToOpmode("dehumidify"));
+  EXPECT_EQ(stdAc::opmode_t::kFan, IRac::strToOpmode("fan only"));
+  EXPECT_EQ(stdAc::opmode_t::kFan, IRac::strToOpmode("FANONLY"));
+  EXPECT_EQ(stdAc::opmode_t::kOff, IRac::strToOpmode("Stop"));
+  EXPECT_EQ(stdAc::fanspeed_t::kMin, IRac::strToFanspeed("lowest"));
+  EXPECT_EQ(stdAc::fanspeed_t::kMedium, IRac::strToFanspeed("mid"));
+  EXPECT_EQ(stdAc::fanspeed_t::kMax, IRac::strToFanspeed("highest"));
+  EXPECT_EQ(stdAc::swingv_t::kAuto, IRac::strToSwingV("swing"));
+  EXPECT_EQ(stdAc::swingv_t::kLowest, IRac::strToSwingV("down"));
+  EXPECT_EQ(stdAc::swingv_t::kHighest, IRac::strToSwingV("top"));
+  EXPECT_EQ(stdAc::swingh_t::kLeftMax, IRac::strToSwingH("leftmax"));
+  EXPECT_EQ(stdAc::swingh_t::kRightMax, IRac::strToSwingH("Max Right"));
+  EXPECT_EQ(panasonic_ac_remote_model_t::kPanasonicDke,
+            IRac::strToModel("pkr"));
+  EXPECT_EQ(whirlpool_ac_remote_model_t::DG11J13A,
+            IRac::strToModel("DG11J104"));
+  // Close, but no match.
+  EXPECT_EQ(stdAc::opmode_t::kHeat,
+            IRac::strToOpmode("Coo", stdAc::opmode_t::kHeat));
+  EXPECT_EQ(stdAc::opmode_t::kHeat,
+            IRac::strToOpmode("Cooler", stdAc::opmode_t::kHeat));
+  EXPECT_EQ(stdAc::opmode_t::kHeat,
+            IRac::strToOpmode("", stdAc::opmode_t::kHeat));
+}
+
 TEST(TestIRac, boolToString) {
   EXPECT_EQ("On", IRac::boolToString(true));
   EXPECT_EQ("Off", IRac::boolToString(false));
@@ -2597,6 +2671,33 @@ TEST(TestIRac, swinghToString) {
   EXPECT_EQ("UNKNOWN", IRac::swinghToString((stdAc::swingh_t)500));
 }
 
+TEST(TestIRac, ToStringIntoBuffer) {
+  char buf[16];
+  EXPECT_EQ(2, IRac::boolToString(true, buf, sizeof(buf)));
+  EXPECT_STREQ("On", buf);
+  EXPECT_EQ(3, IRac::boolToString(false, buf, sizeof(buf)));
+  EXPECT_STREQ("Off", buf);
+  EXPECT_EQ(4, IRac::opmodeToString(stdAc::opmode_t::kCool, buf, sizeof(buf)));
+  EXPECT_STREQ("Cool", buf);
+  EXPECT_EQ(8, IRac::opmodeToString(stdAc::opmode_t::kFan, buf, sizeof(buf),
+                                    true));
+  EXPECT_STREQ("fan_only", buf);
+  EXPECT_EQ(7, IRac::opmodeToString((stdAc::opmode_t)500, buf, sizeof(buf)));
+  EXPECT_STREQ("UNKNOWN", buf);
+  EXPECT_EQ(3, IRac::fanspeedToString(stdAc::fanspeed_t::kLow, buf,
+                                      sizeof(buf)));
+  EXPECT_STREQ("Low", buf);
+  EXPECT_EQ(7, IRac::swingvToString(stdAc::swingv_t::kHighest, buf,
+                                    sizeof(buf)));
+  EXPECT_STREQ("Highest", buf);
+  EXPECT_EQ(4, IRac::swinghToString(stdAc::swingh_t::kWide, buf,
+                                    sizeof(buf)));
+  EXPECT_STREQ("Wide", buf);
+  // Too small a buffer truncates the result.
+  EXPECT_EQ(3, IRac::swingvToString(stdAc::swingv_t::kHighest, buf, 4));
+  EXPECT_STREQ("Hig", buf);
+}
+
 // Check that we keep the previous state info if the message is a special
 // state-less command.
 TEST(TestIRac, CoolixDecodeToState) {
@@ -0,0 +1,188 @@
+// Copyright 2021 IRremoteESP8266 contributors
+// Host benchmark for IRrecv::decode().
+//
+// Builds a corpus of messages from the library's own send routines, plus some
+// unknown/noisy captures, then times decode() over it with the header timing
+// index enabled & disabled. Both runs must produce identical results.
+// Also times the matchData() inner loop on its own.
+//
+// Usage:
+//   make benchmark
+
+#include <chrono>  // NOLINT(build/c++11)
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "IRrecv.h"
+#include "IRremoteESP8266.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+
+namespace {
+const uint32_t kPasses = 200;
+const uint16_t kNoiseFrames = 32;
+const uint16_t kMatchBits = 1024;
+const uint32_t kMatchPasses = 2000;
+
+struct frame_t {
+  std::string name;
+  std::vector<uint16_t> rawbuf;
+};
+
+// Record the last thing sent by `irsend` into the corpus.
+void addFrame(std::vector<frame_t> *corpus, IRsendTest *irsend,
+              const std::string &name) {
+  irsend->makeDecodeResult();
+  frame_t frame;
+  frame.name = name;
+  frame.rawbuf.assign(irsend->capture.rawbuf,
+                      irsend->capture.rawbuf + irsend->capture.rawlen);
+  corpus->push_back(frame);
+}
+
+// Messages for every protocol we can send.
+std::vector<frame_t> buildKnownCorpus(IRsendTest *irsend) {
+  std::vector<frame_t> corpus;
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    decode_type_t protocol = static_cast<decode_type_t>(i);
+    uint16_t nbits = IRsend::defaultBits(protocol);
+    if (!nbits) continue;
+    irsend->reset();
+    bool sent;
+    if (hasACState(protocol)) {
+      uint8_t state[kStateSizeMax];
+      for (uint16_t j = 0; j < kStateSizeMax; j++) state[j] = j * 0x15 + i;
+      sent = irsend->send(protocol, state, nbits / 8);
+    } else {
+      uint64_t data = 0xA5C3E1F00F1E3C5A;
+      if (nbits < 64) data &= (1ULL << nbits) - 1;
+      sent = irsend->send(protocol, data, nbits);
+    }
+    if (sent) addFrame(&corpus, irsend, typeToString(protocol).c_str());
+  }
+  return corpus;
+}
+
+// Unknown & noisy frames. These are the worst case for decode() as every
+// decoder gets a chance at them before decodeHash() does.
+std::vector<frame_t> buildNoiseCorpus(IRsendTest *irsend) {
+  std::vector<frame_t> corpus;
+  uint32_t seed = 0x2545F491;
+  for (uint16_t n = 0; n < kNoiseFrames; n++) {
+    uint16_t noise[kNoiseFrames * 4 + 8];
+    uint16_t len = 8 + n * 4;
+    for (uint16_t j = 0; j < len; j++) {
+      seed ^= seed << 13;
+      seed ^= seed >> 17;
+      seed ^= seed << 5;
+      noise[j] = 200 + seed % 5000;
+    }
+    irsend->reset();
+    irsend->sendRaw(noise, len, 38);
+    addFrame(&corpus, irsend, "NOISE");
+  }
+  return corpus;
+}
+
+// Decode every frame in the corpus `kPasses` times.
+// Returns the number of decodes per second & records the results of the
+// last pass.
+double timeDecodes(IRrecv *irrecv, const std::vector<frame_t> &corpus,
+                   std::vector<decode_results> *results) {
+  std::vector<uint16_t> rawbuf;
+  results->resize(corpus.size());
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (uint32_t pass = 0; pass < kPasses; pass++) {
+    for (size_t i = 0; i < corpus.size(); i++) {
+      rawbuf = corpus[i].rawbuf;
+      decode_results *capture = &(*results)[i];
+      capture->decode_type = UNKNOWN;
+      capture->bits = 0;
+      capture->rawbuf = rawbuf.data();
+      capture->rawlen = rawbuf.size();
+      capture->overflow = false;
+      capture->repeat = false;
+      irrecv->decode(capture);
+    }
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return (corpus.size() * kPasses) / elapsed.count();
+}
+
+// Time a corpus with & without the index, and check the results agree.
+// Returns the number of mismatched results.
+int bench(IRrecv *irrecv, const char *title,
+          const std::vector<frame_t> &corpus) {
+  std::vector<decode_results> without_index, with_index;
+#if ENABLE_DECODE_INDEX
+  irrecv->enableDecodeIndex(false);
+#endif  // ENABLE_DECODE_INDEX
+  double before = timeDecodes(irrecv, corpus, &without_index);
+#if ENABLE_DECODE_INDEX
+  irrecv->enableDecodeIndex(true);
+#endif  // ENABLE_DECODE_INDEX
+  double after = timeDecodes(irrecv, corpus, &with_index);
+
+  int mismatches = 0;
+  for (size_t i = 0; i < corpus.size(); i++) {
+    if (without_index[i].decode_type != with_index[i].decode_type ||
+        without_index[i].bits != with_index[i].bits ||
+        (!hasACState(with_index[i].decode_type) &&
+         without_index[i].value != with_index[i].value)) {
+      std::printf("MISMATCH: %s decoded as %s without the index, %s with it\n",
+                  corpus[i].name.c_str(),
+                  typeToString(without_index[i].decode_type).c_str(),
+                  typeToString(with_index[i].decode_type).c_str());
+      mismatches++;
+    }
+  }
+  std::printf("%s: %u frames (x%u passes)\n", title,
+              static_cast<unsigned>(corpus.size()), kPasses);
+  std::printf("  decode() without index: %12.0f decodes/sec (%.2f us/frame)\n",
+              before, 1e6 / before);
+  std::printf("  decode() with index:    %12.0f decodes/sec (%.2f us/frame, "
+              "%.2fx)\n", after, 1e6 / after, after / before);
+  return mismatches;
+}
+
+// Time matchData() over a long NEC-style (560/1690us) bit stream.
+void benchMatchData(IRrecv *irrecv) {
+  std::vector<uint16_t> rawbuf(kMatchBits * 2);
+  uint32_t seed = 0x9E3779B9;
+  for (uint16_t i = 0; i < kMatchBits; i++) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    rawbuf[i * 2] = (560 + seed % 64) / kRawTick;
+    rawbuf[i * 2 + 1] = ((seed & 0x100 ? 1690 : 560) + seed % 64) / kRawTick;
+  }
+  uint64_t total = 0;
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (uint32_t pass = 0; pass < kMatchPasses; pass++)
+    for (uint16_t i = 0; i < kMatchBits; i += 64) {
+      match_result_t result = irrecv->matchData(rawbuf.data() + i * 2, 64,
+                                                560, 1690, 560, 560);
+      total += result.used;
+    }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  std::printf("matchData(): %.1f ns/bit (%llu entries matched)\n",
+              elapsed.count() * 1e9 / (kMatchBits * kMatchPasses),
+              static_cast<unsigned long long>(total));  // NOLINT(runtime/int)
+}
+}  // namespace
+
+int main() {
+  static IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  int mismatches = 0;
+  mismatches += bench(&irrecv, "Known protocols", buildKnownCorpus(&irsend));
+  mismatches += bench(&irrecv, "Unknown/noise", buildNoiseCorpus(&irsend));
+  benchMatchData(&irrecv);
+  return mismatches ? 1 : 0;
+}
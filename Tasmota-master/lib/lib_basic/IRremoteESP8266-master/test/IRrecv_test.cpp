@@ -5,6 +5,7 @@
 #include "IRremoteESP8266.h"
 #include "IRsend.h"
 #include "IRsend_test.h"
+#include "IRutils.h"
 #include "gtest/gtest.h"
 
 // Tests for the IRrecv object.
@@ -491,6 +492,52 @@ TEST(TestDecode, DecodeAiwa) {
   EXPECT_EQ(0x7F, irsend.capture.value);
 }
 
+// Tests for the integer tolerance window calculations.
+TEST(TestMatchWindow, TicksLowAndHigh) {
+  IRrecv irrecv(1);
+  // 25% of 560 is 140, less a delta of 10.
+  EXPECT_EQ(410, irrecv.ticksLow(560, 25, 10));
+  EXPECT_EQ(711, irrecv.ticksHigh(560, 25, 10));
+  // Fractions round down.
+  EXPECT_EQ(1267, irrecv.ticksLow(1690, 25));
+  EXPECT_EQ(2113, irrecv.ticksHigh(1690, 25));
+  // Can't go below zero.
+  EXPECT_EQ(0, irrecv.ticksLow(100, 50, 60));
+  EXPECT_EQ(0, irrecv.ticksLow(100, 100));
+  EXPECT_EQ(201, irrecv.ticksHigh(100, 100));
+  // An invalid tolerance uses the default one.
+  EXPECT_EQ(irrecv.ticksLow(1000, kTolerance), irrecv.ticksLow(1000, 101));
+  // Large values don't overflow.
+  EXPECT_EQ(3000000000, irrecv.ticksLow(4000000000, 25));
+  EXPECT_EQ(4200000001, irrecv.ticksHigh(3000000000, 40));
+}
+
+TEST(TestMatchWindow, SameAsMatch) {
+  IRrecv irrecv(1);
+  const uint32_t periods[] = {1, 2, 3, 100, 333, 560, 1690, 4500, 9000,
+                              20000, 65535, 100000};
+  const uint8_t tolerances[] = {0, 1, 10, 25, 33, 40, 50, 99, 100, 200};
+  const uint16_t deltas[] = {0, 1, 50, 100, 599};
+  for (uint32_t desired : periods)
+    for (uint8_t tolerance : tolerances)
+      for (uint16_t delta : deltas) {
+        match_window_t window = irrecv.matchWindow(desired, tolerance, delta);
+        // Check around both edges of the window, in ticks.
+        for (uint32_t edge : {window.low, window.high})
+          for (uint32_t measured = (edge > 2) ? edge - 2 : 0;
+               measured <= edge + 2; measured++) {
+            bool expected =
+                measured * kRawTick >= irrecv.ticksLow(desired, tolerance,
+                                                       delta) &&
+                measured * kRawTick <= irrecv.ticksHigh(desired, tolerance,
+                                                        delta);
+            EXPECT_EQ(expected, irrecv.inWindow(measured, window))
+                << "desired=" << desired << " tolerance=" << +tolerance
+                << " delta=" << delta << " measured=" << measured;
+          }
+      }
+}
+
 // Test matchData() on space encoded data.
 TEST(TestMatchData, SpaceEncoded) {
   IRsendTest irsend(0);
@@ -2019,3 +2066,239 @@ TEST(TestMatchManchesterData, SimulateLongFooter) {
   EXPECT_EQ("f38000d50m1000s2000m1000s1000m2000s5000",
             irsend.outputStr());
 }
+
+// Tests for the header timing index used by decode().
+
+#if ENABLE_DECODE_INDEX
+// Decode the current capture with the index enabled & disabled, and confirm
+// both paths agree on the result.
+void checkDecodeIndex(IRsendTest *irsend, IRrecv *irrecv) {
+  irsend->makeDecodeResult();
+  irrecv->enableDecodeIndex(true);
+  bool indexed = irrecv->decode(&irsend->capture);
+  decode_results with_index = irsend->capture;
+
+  irsend->makeDecodeResult();
+  irrecv->enableDecodeIndex(false);
+  bool unindexed = irrecv->decode(&irsend->capture);
+  irrecv->enableDecodeIndex(true);
+
+  EXPECT_EQ(unindexed, indexed);
+  EXPECT_EQ(irsend->capture.decode_type, with_index.decode_type);
+  EXPECT_EQ(irsend->capture.bits, with_index.bits);
+  if (hasACState(irsend->capture.decode_type)) {
+    EXPECT_STATE_EQ(with_index.state, irsend->capture.state,
+                    irsend->capture.bits);
+  } else {
+    EXPECT_EQ(irsend->capture.value, with_index.value);
+    EXPECT_EQ(irsend->capture.address, with_index.address);
+    EXPECT_EQ(irsend->capture.command, with_index.command);
+  }
+}
+
+TEST(TestDecodeIndex, SameResultsForAllProtocols) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    decode_type_t protocol = static_cast<decode_type_t>(i);
+    uint16_t nbits = IRsend::defaultBits(protocol);
+    if (!nbits) continue;
+    irsend.reset();
+    if (hasACState(protocol)) {
+      uint8_t state[kStateSizeMax];
+      for (uint16_t j = 0; j < kStateSizeMax; j++) state[j] = j * 0x15 + i;
+      if (!irsend.send(protocol, state, nbits / 8)) continue;
+    } else {
+      uint64_t data = 0xA5C3E1F00F1E3C5A;
+      if (nbits < 64) data &= (1ULL << nbits) - 1;
+      if (!irsend.send(protocol, data, nbits)) continue;
+    }
+    SCOPED_TRACE(typeToString(protocol));
+    checkDecodeIndex(&irsend, &irrecv);
+  }
+}
+
+TEST(TestDecodeIndex, UnknownAndShortMessages) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+
+  // A valid NEC message is still found with the index enabled.
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(NEC, irsend.capture.decode_type);
+  EXPECT_EQ(0x807F40BF, irsend.capture.value);
+
+  // Noise with no recognisable header falls through to the hash decoder.
+  irsend.reset();
+  uint16_t noise[23] = {
+      1234, 321, 2345, 876, 432, 1500, 789, 250, 3000, 1111, 640, 2222,
+      380, 900, 1700, 560, 4100, 300, 820, 1950, 470, 1300, 700};
+  irsend.sendRaw(noise, 23, 38);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(UNKNOWN, irsend.capture.decode_type);
+  checkDecodeIndex(&irsend, &irrecv);
+
+  // Messages too short to contain a header are handled by both paths.
+  irsend.reset();
+  irsend.mark(600);
+  checkDecodeIndex(&irsend, &irrecv);
+}
+#endif  // ENABLE_DECODE_INDEX
+
+// Tests for spotting the end of a message while it is still being captured.
+
+#if ENABLE_INCREMENTAL_DECODE
+// Capture the last thing sent by `irsend` the way the interrupt handler would,
+// asking the receiver if the message is complete every 100us along the way.
+// `silence` usecs of nothing are added after the last entry.
+// Returns the number of entries captured when the receiver said the message
+// was complete, or 0 if it never did.
+uint16_t pollCapture(IRsendTest *irsend, IRrecv *irrecv,
+                     const uint32_t silence = 0) {
+  volatile irparams_t *params = irrecv->_getParamsPtr();
+  irsend->makeDecodeResult();
+  irrecv->resume();
+  // The first edge starts the capture.
+  params->rawbuf[params->rawlen++] = 1;
+  params->rcvstate = kMarkState;
+  _IRtimer_unittest_now = 1000;
+  // Capture each entry as its ending edge arrives.
+  for (uint16_t i = 1; i < irsend->capture.rawlen - 1; i++) {
+    params->rawbuf[params->rawlen++] = irsend->capture.rawbuf[i];
+    params->lastedge = _IRtimer_unittest_now;
+    // Poll while the next entry is in progress.
+    uint32_t duration = irsend->capture.rawbuf[i + 1] * kRawTick;
+    if (i + 2 == irsend->capture.rawlen) duration += silence;
+    for (uint32_t t = 0; t < duration; t += 100) {
+      _IRtimer_unittest_now = params->lastedge + t;
+      if (irrecv->_incrementalComplete()) return i;
+    }
+    _IRtimer_unittest_now = params->lastedge + duration;
+  }
+  return 0;
+}
+
+TEST(TestIncrementalDecode, NEC) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irrecv.enableIncrementalDecode();
+
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  // Epson is enabled, so it takes longer than the gap between NEC-like frames
+  // before an NEC message is known to be over.
+  EXPECT_EQ(0, pollCapture(&irsend, &irrecv));
+  // Header, data & footer mark.
+  EXPECT_EQ(2 + 2 * kNECBits + 1, pollCapture(&irsend, &irrecv, 100000));
+}
+
+TEST(TestIncrementalDecode, Sony) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irrecv.enableIncrementalDecode();
+
+  // Sony has no footer mark, and the shorter sizes mustn't cut off the longer.
+  irsend.reset();
+  irsend.sendSony(0x240, kSony12Bits, 0);
+  EXPECT_EQ(2 + 2 * kSony12Bits - 1, pollCapture(&irsend, &irrecv));
+  irsend.reset();
+  irsend.sendSony(0x240C, kSony15Bits, 0);
+  EXPECT_EQ(2 + 2 * kSony15Bits - 1, pollCapture(&irsend, &irrecv));
+  irsend.reset();
+  irsend.sendSony(0x240C3, kSony20Bits, 0);
+  EXPECT_EQ(2 + 2 * kSony20Bits - 1, pollCapture(&irsend, &irrecv));
+}
+
+TEST(TestIncrementalDecode, LongerMessagesAreNotCutShort) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irrecv.enableIncrementalDecode();
+
+  // Sanyo LC7461 has NEC's timings, but more bits.
+  irsend.reset();
+  irsend.sendSanyoLC7461(0x2468DCB56A9);
+  EXPECT_EQ(0, pollCapture(&irsend, &irrecv));
+  // Not one of the incremental protocols.
+  irsend.reset();
+  irsend.sendRC5(0x175);
+  EXPECT_EQ(0, pollCapture(&irsend, &irrecv));
+}
+
+TEST(TestIncrementalDecode, MultiFrameProtocolsAreNotCutShort) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1, 1024);  // Big enough for all the frames.
+  irsend.begin();
+  irrecv.enableIncrementalDecode();
+
+  // These are made of NEC-like frames. The first frame mustn't be taken for a
+  // complete NEC message.
+  irsend.reset();
+  irsend.sendPioneer(0x659A05FAF50AC53A);
+  EXPECT_EQ(0, pollCapture(&irsend, &irrecv));
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(PIONEER, irsend.capture.decode_type);
+  EXPECT_EQ(0x659A05FAF50AC53A, irsend.capture.value);
+
+  irsend.reset();
+  irsend.sendEpson(0xC1AA09F6);  // Sent 3 times.
+  EXPECT_EQ(0, pollCapture(&irsend, &irrecv));
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(EPSON, irsend.capture.decode_type);
+  EXPECT_EQ(0xC1AA09F6, irsend.capture.value);
+
+  irsend.reset();
+  irsend.sendEpson(0x0, kEpsonBits, 1);  // The longest gap between frames.
+  EXPECT_EQ(0, pollCapture(&irsend, &irrecv));
+
+  irsend.reset();
+  irsend.sendCarrierAC(0x4CCA541D);  // 3 frames.
+  EXPECT_EQ(0, pollCapture(&irsend, &irrecv));
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(CARRIER_AC, irsend.capture.decode_type);
+  EXPECT_EQ(0x4CCA541D, irsend.capture.value);
+
+  // The other simple protocols still finish early, even with repeats.
+  irsend.reset();
+  irsend.sendSAMSUNG(0xE0E09966, kSamsungBits, 1);
+  EXPECT_EQ(2 + 2 * kSamsungBits + 1, pollCapture(&irsend, &irrecv));
+  irsend.reset();
+  irsend.sendSony(0x240C, kSony15Bits, 2);
+  EXPECT_EQ(2 + 2 * kSony15Bits - 1, pollCapture(&irsend, &irrecv));
+}
+
+TEST(TestIncrementalDecode, Disabled) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  volatile irparams_t *params = irrecv._getParamsPtr();
+
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irrecv.enableIncrementalDecode();
+  ASSERT_NE(0, pollCapture(&irsend, &irrecv, 100000));
+  // decode() should end the capture & decode it.
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(kStopState, params->rcvstate);
+  EXPECT_EQ(NEC, irsend.capture.decode_type);
+  EXPECT_EQ(0x807F40BF, irsend.capture.value);
+
+  // But not when it's turned off.
+  irrecv.enableIncrementalDecode(false);
+  ASSERT_NE(0, pollCapture(&irsend, &irrecv, 100000));
+  irsend.makeDecodeResult();
+  irrecv.decode(&irsend.capture);
+  EXPECT_EQ(kMarkState, params->rcvstate);
+}
+#endif  // ENABLE_INCREMENTAL_DECODE
@@ -94,6 +94,24 @@ TEST(TestUint64ToString, SillyBases) {
   EXPECT_EQ("9IX", uint64ToString(12345, 36));     // But we *can* do base-36.
 }
 
+TEST(TestUint64ToString, IntoBuffer) {
+  char buf[65];
+  EXPECT_EQ(1, uint64ToString(0, buf, sizeof(buf)));
+  EXPECT_STREQ("0", buf);
+  EXPECT_EQ(16, uint64ToString(0xFFFFFFFFFFFFFFFF, buf, sizeof(buf), 16));
+  EXPECT_STREQ("FFFFFFFFFFFFFFFF", buf);
+  EXPECT_EQ(64, uint64ToString(0xFFFFFFFFFFFFFFFF, buf, sizeof(buf), 2));
+  EXPECT_EQ(uint64ToString(0xFFFFFFFFFFFFFFFF, 2), buf);
+  EXPECT_EQ(5, uint64ToString(12345, buf, sizeof(buf), 37));
+  EXPECT_STREQ("12345", buf);
+  // Too small a buffer keeps the most significant digits.
+  EXPECT_EQ(3, uint64ToString(12345, buf, 4));
+  EXPECT_STREQ("123", buf);
+  EXPECT_EQ(0, uint64ToString(12345, buf, 1));
+  EXPECT_STREQ("", buf);
+  EXPECT_EQ(0, uint64ToString(12345, buf, 0));
+}
+
 TEST(TestGetCorrectedRawLength, NoLargeValues) {
   IRsendTest irsend(0);
   IRrecv irrecv(1);
@@ -401,6 +419,33 @@ TEST(TestStrToDecodeType, strToDecodeType) {
   EXPECT_EQ(decode_type_t::NEC, strToDecodeType("NEC"));
   EXPECT_EQ(decode_type_t::KELVINATOR, strToDecodeType("KELVINATOR"));
   EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("foo"));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType(""));
+  EXPECT_EQ(decode_type_t::UNUSED, strToDecodeType("UNUSED"));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("UNKNOWN"));
+  // Case insensitive.
+  EXPECT_EQ(decode_type_t::NEC, strToDecodeType("nec"));
+  EXPECT_EQ(decode_type_t::MITSUBISHI_HEAVY_152,
+            strToDecodeType("Mitsubishi_Heavy_152"));
+  // Numbers.
+  EXPECT_EQ(decode_type_t::NEC, strToDecodeType("3"));
+  EXPECT_EQ(kLastDecodeType,
+            strToDecodeType(uint64ToString(kLastDecodeType).c_str()));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("0"));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("-1"));
+  EXPECT_EQ(decode_type_t::UNKNOWN,
+            strToDecodeType(uint64ToString(kLastDecodeType + 1).c_str()));
+}
+
+// Every protocol name should parse back to its protocol, in any case.
+TEST(TestStrToDecodeType, RoundTrips) {
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    String name = typeToString((decode_type_t)i);
+    EXPECT_EQ(i, strToDecodeType(name.c_str())) << name;
+    for (auto &c : name) c = tolower(c);
+    EXPECT_EQ(i, strToDecodeType(name.c_str())) << name;
+    name += "?";
+    EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType(name.c_str())) << name;
+  }
 }
 
 TEST(TestUtils, htmlEscape) {
@@ -504,6 +549,56 @@ TEST(TestUtils, TypeStringConversionRangeTests) {
   }
 }
 
+TEST(TestUtils, TypeToStringIntoBuffer) {
+  char buf[40];
+  for (int i = -1; i <= kLastDecodeType + 1; i++) {
+    decode_type_t protocol = (decode_type_t)i;
+    String expected = typeToString(protocol);
+    EXPECT_EQ(expected.length(), typeToString(protocol, buf, sizeof(buf)));
+    EXPECT_EQ(expected, buf);
+    expected = typeToString(protocol, true);
+    EXPECT_EQ(expected.length(),
+              typeToString(protocol, buf, sizeof(buf), true));
+    EXPECT_EQ(expected, buf);
+  }
+  // Too small a buffer truncates the result.
+  EXPECT_EQ(3, typeToString(decode_type_t::NEC, buf, 4, true));
+  EXPECT_STREQ("NEC", buf);
+  EXPECT_EQ(5, typeToString(decode_type_t::NEC, buf, 6, true));
+  EXPECT_STREQ("NEC (", buf);
+}
+
+TEST(TestUtils, ResultToHexidecimalIntoBuffer) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  char buf[2 * kStateSizeMax + 3];
+
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(10, resultToHexidecimal(&irsend.capture, buf, sizeof(buf)));
+  EXPECT_STREQ("0x807F40BF", buf);
+  EXPECT_EQ(resultToHexidecimal(&irsend.capture), buf);
+
+  const uint8_t state[kKelvinatorStateLength] = {
+      0x19, 0x0B, 0x80, 0x50, 0x00, 0x00, 0x00, 0xE0,
+      0x19, 0x0B, 0x80, 0x70, 0x00, 0x00, 0x10, 0xF0};
+  irsend.reset();
+  irsend.sendKelvinator(state);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  ASSERT_EQ(KELVINATOR, irsend.capture.decode_type);
+  EXPECT_EQ(2 + 2 * kKelvinatorStateLength,
+            resultToHexidecimal(&irsend.capture, buf, sizeof(buf)));
+  EXPECT_STREQ("0x190B8050000000E0190B8070000010F0", buf);
+  EXPECT_EQ(resultToHexidecimal(&irsend.capture), buf);
+  // Too small a buffer truncates the result.
+  EXPECT_EQ(5, resultToHexidecimal(&irsend.capture, buf, 6));
+  EXPECT_STREQ("0x190", buf);
+}
+
 TEST(TestUtils, MinsToString) {
   EXPECT_EQ("00:00", irutils::minsToString(0));
   EXPECT_EQ("00:01", irutils::minsToString(1));
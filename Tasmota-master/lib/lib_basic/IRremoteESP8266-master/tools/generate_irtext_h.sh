@@ -19,6 +19,7 @@ cat >${OUTPUT} << EOF
 #ifndef IRTEXT_H_
 #define IRTEXT_H_
 
+#include <stdint.h>
 #include "i18n.h"
 
 // Constant text to be shared across all object files.
@@ -37,7 +38,7 @@ class __FlashStringHelper;
 EOF
 
 # Parse and output contents of INPUT file.
-sed 's/ PROGMEM//' ${INPUT} | egrep "^(const )?char" | cut -f1 -d= |
+sed 's/ PROGMEM//' ${INPUT} | egrep "^(const )?(char|uint16_t)" | cut -f1 -d= |
     sed 's/ $/;/;s/^/extern /' | sort -u >> ${OUTPUT}
 egrep '^\s{,10}IRTEXT_CONST_STRING\(' ${INPUT} | cut -f2 -d\( | cut -f1 -d, |
     sed 's/^/extern IRTEXT_CONST_PTR\(/;s/$/\);/' | sort -u >> ${OUTPUT}
@@ -53,30 +53,38 @@ extern int l_getswitch(bvm *vm);
 
 extern int l_i2cenabled(bvm *vm);
 
+extern int l_rule_compile(bvm *vm);
+extern int l_rules_match(bvm *vm);
+
+extern int be_timer_push(bvm *vm);
+extern int be_timer_remove(bvm *vm);
+
 // KV class
 /********************************************************************
 ** Solidified function: init
 ********************************************************************/
 be_local_closure(kv_init,   /* name */
   be_nested_proto(
-    3,                          /* nstack */
-    3,                          /* argc */
+    4,                          /* nstack */
+    4,                          /* argc */
     0,                          /* varg */
     0,                          /* has upvals */
     NULL,                       /* no upvals */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 2]) {     /* constants */
+    ( &(const bvalue[ 3]) {     /* constants */
     /* K0   */  be_nested_string("k", -301188886, 1),
     /* K1   */  be_nested_string("v", -217300791, 1),
+    /* K2   */  be_nested_string("c", -435409838, 1),
     }),
     ((bstring*) &be_const_str_init),
     ((bstring*) &be_const_str_input),
-    ( &(const binstruction[ 3]) {  /* code */
+    ( &(const binstruction[ 4]) {  /* code */
       0x90020001,  //  0000  SETMBR	R0	K0	R1
       0x90020202,  //  0001  SETMBR	R0	K1	R2
-      0x80000000,  //  0002  RET	0
+      0x90020403,  //  0002  SETMBR	R0	K2	R3
+      0x80000000,  //  0003  RET	0
     })
   )
 );
@@ -87,12 +95,13 @@ be_local_closure(kv_init,   /* name */
 ** Solidified class: KV
 ********************************************************************/
 be_local_class(KV,
-    2,
+    3,
     NULL,
-    be_nested_map(3,
+    be_nested_map(4,
     ( (struct bmapnode*) &(const bmapnode[]) {
-        { be_nested_key("k", -301188886, 1, 2), be_const_var(0) },
+        { be_nested_key("c", -435409838, 1, -1), be_const_var(2) },
         { be_nested_key("v", -217300791, 1, -1), be_const_var(1) },
+        { be_nested_key("k", -301188886, 1, 0), be_const_var(0) },
         { be_nested_key("init", 380752755, 4, -1), be_const_closure(kv_init_closure) },
     })),
     (be_nested_const_str("KV", 955173972, 2))
@@ -103,8 +112,8 @@ be_local_class(KV,
 ********************************************************************/
 be_local_closure(kv,   /* name */
   be_nested_proto(
-    7,                          /* nstack */
-    3,                          /* argc */
+    9,                          /* nstack */
+    4,                          /* argc */
     0,                          /* varg */
     0,                          /* has upvals */
     NULL,                       /* no upvals */
@@ -116,14 +125,15 @@ be_local_closure(kv,   /* name */
     }),
     (be_nested_const_str("kv", 1497177492, 2)),
     ((bstring*) &be_const_str_input),
-    ( &(const binstruction[ 7]) {  /* code */
-      0x580C0000,  //  0000  LDCONST	R3	K0
+    ( &(const binstruction[ 8]) {  /* code */
+      0x58100000,  //  0000  LDCONST	R4	K0
       0xB4000000,  //  0001  CLASS	K0
-      0x5C100600,  //  0002  MOVE	R4	R3
-      0x5C140200,  //  0003  MOVE	R5	R1
-      0x5C180400,  //  0004  MOVE	R6	R2
-      0x7C100400,  //  0005  CALL	R4	2
-      0x80040800,  //  0006  RET	1	R4
+      0x5C140800,  //  0002  MOVE	R5	R4
+      0x5C180200,  //  0003  MOVE	R6	R1
+      0x5C1C0400,  //  0004  MOVE	R7	R2
+      0x5C200600,  //  0005  MOVE	R8	R3
+      0x7C140600,  //  0006  CALL	R5	3
+      0x80040A00,  //  0007  RET	1	R5
     })
   )
 );
@@ -365,18 +375,19 @@ be_local_closure(remove_rule,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 5]) {     /* constants */
+    ( &(const bvalue[ 6]) {     /* constants */
     /* K0   */  be_nested_string("_rules", -28750191, 6),
     /* K1   */  be_const_int(0),
     /* K2   */  be_nested_string("k", -301188886, 1),
     /* K3   */  be_nested_string("remove", -611183107, 6),
     /* K4   */  be_const_int(1),
+    /* K5   */  be_nested_string("_rules_idx", 343761325, 10),
     }),
     (be_nested_const_str("remove_rule", -838755968, 11)),
     ((bstring*) &be_const_str_input),
-    ( &(const binstruction[21]) {  /* code */
+    ( &(const binstruction[23]) {  /* code */
       0x88080100,  //  0000  GETMBR	R2	R0	K0
-      0x780A0011,  //  0001  JMPF	R2	#0014
+      0x780A0013,  //  0001  JMPF	R2	#0016
       0x58080001,  //  0002  LDCONST	R2	K1
       0x600C000C,  //  0003  GETGBL	R3	G12
       0x88100100,  //  0004  GETMBR	R4	R0	K0
@@ -395,7 +406,9 @@ be_local_closure(remove_rule,   /* name */
       0x70020000,  //  0011  JMP		#0013
       0x00080504,  //  0012  ADD	R2	R2	K4
       0x7001FFEE,  //  0013  JMP		#0003
-      0x80000000,  //  0014  RET	0
+      0x4C0C0000,  //  0014  LDNIL	R3
+      0x90020A03,  //  0015  SETMBR	R0	K5	R3
+      0x80000000,  //  0016  RET	0
     })
   )
 );
@@ -628,7 +641,7 @@ be_local_closure(chars_in_string,   /* name */
 ********************************************************************/
 be_local_closure(set_timer,   /* name */
   be_nested_proto(
-    10,                          /* nstack */
+    9,                          /* nstack */
     4,                          /* argc */
     0,                          /* varg */
     0,                          /* has upvals */
@@ -636,31 +649,58 @@ be_local_closure(set_timer,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 4]) {     /* constants */
+    ( &(const bvalue[ 7]) {     /* constants */
     /* K0   */  be_nested_string("_timers", -1694866380, 7),
-    /* K1   */  be_nested_string("push", -2022703139, 4),
-    /* K2   */  be_nested_string("Timer", -346839614, 5),
-    /* K3   */  be_nested_string("millis", 1214679063, 6),
+    /* K1   */  be_nested_string("Timer", -346839614, 5),
+    /* K2   */  be_nested_string("millis", 1214679063, 6),
+    /* K3   */  be_nested_string("_timer_push", 2147276404, 11),
+    /* K4   */  be_nested_string("_timers_id", 1255637444, 10),
+    /* K5   */  be_nested_string("find", -1108310694, 4),
+    /* K6   */  be_nested_string("push", -2022703139, 4),
     }),
     (be_nested_const_str("set_timer", 2135414533, 9)),
     ((bstring*) &be_const_str_input),
-    ( &(const binstruction[16]) {  /* code */
-      0x88100100,  //  0000  GETMBR R4  R0  K0
-      0x74120002,  //  0001  JMPT R4  #0005
-      0x60100012,  //  0002  GETGBL R4  G18
-      0x7C100000,  //  0003  CALL R4  0
-      0x90020004,  //  0004  SETMBR R0  K0  R4
-      0x88100100,  //  0005  GETMBR R4  R0  K0
-      0x8C100901,  //  0006  GETMET R4  R4  K1
-      0xB81A0400,  //  0007  GETNGBL  R6  K2
-      0x8C1C0103,  //  0008  GETMET R7  R0  K3
-      0x5C240200,  //  0009  MOVE R9  R1
-      0x7C1C0400,  //  000A  CALL R7  2
-      0x5C200400,  //  000B  MOVE R8  R2
-      0x5C240600,  //  000C  MOVE R9  R3
-      0x7C180600,  //  000D  CALL R6  3
-      0x7C100400,  //  000E  CALL R4  2
-      0x80000000,  //  000F  RET  0
+    ( &(const binstruction[40]) {  /* code */
+      0x88100100,  //  0000  GETMBR	R4	R0	K0
+      0x74120002,  //  0001  JMPT	R4	#0005
+      0x60100012,  //  0002  GETGBL	R4	G18
+      0x7C100000,  //  0003  CALL	R4	0
+      0x90020004,  //  0004  SETMBR	R0	K0	R4
+      0xB8120200,  //  0005  GETNGBL	R4	K1
+      0x8C140102,  //  0006  GETMET	R5	R0	K2
+      0x5C1C0200,  //  0007  MOVE	R7	R1
+      0x7C140400,  //  0008  CALL	R5	2
+      0x5C180400,  //  0009  MOVE	R6	R2
+      0x5C1C0600,  //  000A  MOVE	R7	R3
+      0x7C100600,  //  000B  CALL	R4	3
+      0x8C140103,  //  000C  GETMET	R5	R0	K3
+      0x5C1C0800,  //  000D  MOVE	R7	R4
+      0x7C140400,  //  000E  CALL	R5	2
+      0x4C140000,  //  000F  LDNIL	R5
+      0x20140605,  //  0010  NE	R5	R3	R5
+      0x78160014,  //  0011  JMPF	R5	#0027
+      0x88140104,  //  0012  GETMBR	R5	R0	K4
+      0x74160002,  //  0013  JMPT	R5	#0017
+      0x60140013,  //  0014  GETGBL	R5	G19
+      0x7C140000,  //  0015  CALL	R5	0
+      0x90020805,  //  0016  SETMBR	R0	K4	R5
+      0x88140104,  //  0017  GETMBR	R5	R0	K4
+      0x8C140B05,  //  0018  GETMET	R5	R5	K5
+      0x5C1C0600,  //  0019  MOVE	R7	R3
+      0x7C140400,  //  001A  CALL	R5	2
+      0x4C180000,  //  001B  LDNIL	R6
+      0x1C180A06,  //  001C  EQ	R6	R5	R6
+      0x781A0005,  //  001D  JMPF	R6	#0024
+      0x88180104,  //  001E  GETMBR	R6	R0	K4
+      0x601C0012,  //  001F  GETGBL	R7	G18
+      0x7C1C0000,  //  0020  CALL	R7	0
+      0x40200E04,  //  0021  CONNECT	R8	R7	R4
+      0x98180607,  //  0022  SETIDX	R6	R3	R7
+      0x70020002,  //  0023  JMP		#0027
+      0x8C180B06,  //  0024  GETMET	R6	R5	K6
+      0x5C200800,  //  0025  MOVE	R8	R4
+      0x7C180400,  //  0026  CALL	R6	2
+      0x80000000,  //  0027  RET	0
     })
   )
 );
@@ -672,7 +712,7 @@ be_local_closure(set_timer,   /* name */
 ********************************************************************/
 be_local_closure(add_rule,   /* name */
   be_nested_proto(
-    9,                          /* nstack */
+    12,                          /* nstack */
     3,                          /* argc */
     0,                          /* varg */
     0,                          /* has upvals */
@@ -680,17 +720,19 @@ be_local_closure(add_rule,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 6]) {     /* constants */
+    ( &(const bvalue[ 8]) {     /* constants */
     /* K0   */  be_nested_string("_rules", -28750191, 6),
     /* K1   */  be_nested_string("function", -1630125495, 8),
     /* K2   */  be_nested_string("push", -2022703139, 4),
     /* K3   */  be_nested_string("kv", 1497177492, 2),
-    /* K4   */  be_nested_string("value_error", 773297791, 11),
-    /* K5   */  be_nested_string("the second argument is not a function", -340392827, 37),
+    /* K4   */  be_nested_string("_rule_compile", 320267774, 13),
+    /* K5   */  be_nested_string("_rules_idx", 343761325, 10),
+    /* K6   */  be_nested_string("value_error", 773297791, 11),
+    /* K7   */  be_nested_string("the second argument is not a function", -340392827, 37),
     }),
     (be_nested_const_str("add_rule", 596540743, 8)),
     ((bstring*) &be_const_str_input),
-    ( &(const binstruction[20]) {  /* code */
+    ( &(const binstruction[25]) {  /* code */
       0x880C0100,  //  0000  GETMBR	R3	R0	K0
       0x740E0002,  //  0001  JMPT	R3	#0005
       0x600C0012,  //  0002  GETGBL	R3	G18
@@ -700,17 +742,22 @@ be_local_closure(add_rule,   /* name */
       0x5C100400,  //  0006  MOVE	R4	R2
       0x7C0C0200,  //  0007  CALL	R3	1
       0x1C0C0701,  //  0008  EQ	R3	R3	K1
-      0x780E0007,  //  0009  JMPF	R3	#0012
+      0x780E000C,  //  0009  JMPF	R3	#0017
       0x880C0100,  //  000A  GETMBR	R3	R0	K0
       0x8C0C0702,  //  000B  GETMET	R3	R3	K2
       0x8C140103,  //  000C  GETMET	R5	R0	K3
       0x5C1C0200,  //  000D  MOVE	R7	R1
       0x5C200400,  //  000E  MOVE	R8	R2
-      0x7C140600,  //  000F  CALL	R5	3
-      0x7C0C0400,  //  0010  CALL	R3	2
-      0x70020000,  //  0011  JMP		#0013
-      0xB0060905,  //  0012  RAISE	1	K4	K5
-      0x80000000,  //  0013  RET	0
+      0x8C240104,  //  000F  GETMET	R9	R0	K4
+      0x5C2C0200,  //  0010  MOVE	R11	R1
+      0x7C240400,  //  0011  CALL	R9	2
+      0x7C140800,  //  0012  CALL	R5	4
+      0x7C0C0400,  //  0013  CALL	R3	2
+      0x4C0C0000,  //  0014  LDNIL	R3
+      0x90020A03,  //  0015  SETMBR	R0	K5	R3
+      0x70020000,  //  0016  JMP		#0018
+      0xB0060D07,  //  0017  RAISE	1	K6	K7
+      0x80000000,  //  0018  RET	0
     })
   )
 );
@@ -722,7 +769,7 @@ be_local_closure(add_rule,   /* name */
 ********************************************************************/
 be_local_closure(run_deferred,   /* name */
   be_nested_proto(
-    6,                          /* nstack */
+    10,                          /* nstack */
     1,                          /* argc */
     0,                          /* varg */
     0,                          /* has upvals */
@@ -730,46 +777,65 @@ be_local_closure(run_deferred,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 8]) {     /* constants */
+    ( &(const bvalue[10]) {     /* constants */
     /* K0   */  be_nested_string("_timers", -1694866380, 7),
     /* K1   */  be_const_int(0),
-    /* K2   */  be_nested_string("size", 597743964, 4),
-    /* K3   */  be_nested_string("time_reached", 2075136773, 12),
-    /* K4   */  be_nested_string("due", -399437003, 3),
-    /* K5   */  be_nested_string("f", -485742695, 1),
-    /* K6   */  be_nested_string("remove", -611183107, 6),
-    /* K7   */  be_const_int(1),
+    /* K2   */  be_nested_string("time_reached", 2075136773, 12),
+    /* K3   */  be_nested_string("due", -399437003, 3),
+    /* K4   */  be_nested_string("f", -485742695, 1),
+    /* K5   */  be_nested_string("_timer_remove", -821546120, 13),
+    /* K6   */  be_nested_string("id", 926444256, 2),
+    /* K7   */  be_nested_string("_timers_id", 1255637444, 10),
+    /* K8   */  be_nested_string("remove", -611183107, 6),
+    /* K9   */  be_nested_string("find", -1108310694, 4),
     }),
     (be_nested_const_str("run_deferred", 371594696, 12)),
     ((bstring*) &be_const_str_input),
-    ( &(const binstruction[27]) {  /* code */
-      0x88040100,  //  0000  GETMBR R1  R0  K0
-      0x78060017,  //  0001  JMPF R1  #001A
-      0x58040001,  //  0002  LDCONST  R1  K1
-      0x88080100,  //  0003  GETMBR R2  R0  K0
-      0x8C080502,  //  0004  GETMET R2  R2  K2
-      0x7C080200,  //  0005  CALL R2  1
-      0x14080202,  //  0006  LT R2  R1  R2
-      0x780A0011,  //  0007  JMPF R2  #001A
-      0x8C080103,  //  0008  GETMET R2  R0  K3
-      0x88100100,  //  0009  GETMBR R4  R0  K0
-      0x94100801,  //  000A  GETIDX R4  R4  R1
-      0x88100904,  //  000B  GETMBR R4  R4  K4
-      0x7C080400,  //  000C  CALL R2  2
-      0x780A0009,  //  000D  JMPF R2  #0018
-      0x88080100,  //  000E  GETMBR R2  R0  K0
-      0x94080401,  //  000F  GETIDX R2  R2  R1
-      0x88080505,  //  0010  GETMBR R2  R2  K5
-      0x880C0100,  //  0011  GETMBR R3  R0  K0
-      0x8C0C0706,  //  0012  GETMET R3  R3  K6
-      0x5C140200,  //  0013  MOVE R5  R1
-      0x7C0C0400,  //  0014  CALL R3  2
-      0x5C0C0400,  //  0015  MOVE R3  R2
-      0x7C0C0000,  //  0016  CALL R3  0
-      0x70020000,  //  0017  JMP    #0019
-      0x00040307,  //  0018  ADD  R1  R1  K7
-      0x7001FFE8,  //  0019  JMP    #0003
-      0x80000000,  //  001A  RET  0
+    ( &(const binstruction[44]) {  /* code */
+      0x88040100,  //  0000  GETMBR	R1	R0	K0
+      0x78060028,  //  0001  JMPF	R1	#002B
+      0x6004000C,  //  0002  GETGBL	R1	G12
+      0x88080100,  //  0003  GETMBR	R2	R0	K0
+      0x7C040200,  //  0004  CALL	R1	1
+      0x24040301,  //  0005  GT	R1	R1	K1
+      0x78060023,  //  0006  JMPF	R1	#002B
+      0x8C040102,  //  0007  GETMET	R1	R0	K2
+      0x880C0100,  //  0008  GETMBR	R3	R0	K0
+      0x940C0701,  //  0009  GETIDX	R3	R3	K1
+      0x880C0703,  //  000A  GETMBR	R3	R3	K3
+      0x7C040400,  //  000B  CALL	R1	2
+      0x7806001D,  //  000C  JMPF	R1	#002B
+      0x88040100,  //  000D  GETMBR	R1	R0	K0
+      0x94040301,  //  000E  GETIDX	R1	R1	K1
+      0x88080304,  //  000F  GETMBR	R2	R1	K4
+      0x8C0C0105,  //  0010  GETMET	R3	R0	K5
+      0x5C140200,  //  0011  MOVE	R5	R1
+      0x7C0C0400,  //  0012  CALL	R3	2
+      0x880C0306,  //  0013  GETMBR	R3	R1	K6
+      0x4C100000,  //  0014  LDNIL	R4
+      0x200C0604,  //  0015  NE	R3	R3	R4
+      0x780E0010,  //  0016  JMPF	R3	#0028
+      0x880C0306,  //  0017  GETMBR	R3	R1	K6
+      0x88100107,  //  0018  GETMBR	R4	R0	K7
+      0x940C0803,  //  0019  GETIDX	R3	R4	R3
+      0x8C140708,  //  001A  GETMET	R5	R3	K8
+      0x8C1C0709,  //  001B  GETMET	R7	R3	K9
+      0x5C240200,  //  001C  MOVE	R9	R1
+      0x7C1C0400,  //  001D  CALL	R7	2
+      0x7C140400,  //  001E  CALL	R5	2
+      0x6010000C,  //  001F  GETGBL	R4	G12
+      0x5C140600,  //  0020  MOVE	R5	R3
+      0x7C100200,  //  0021  CALL	R4	1
+      0x1C100901,  //  0022  EQ	R4	R4	K1
+      0x78120003,  //  0023  JMPF	R4	#0028
+      0x88100107,  //  0024  GETMBR	R4	R0	K7
+      0x8C100908,  //  0025  GETMET	R4	R4	K8
+      0x88180306,  //  0026  GETMBR	R6	R1	K6
+      0x7C100400,  //  0027  CALL	R4	2
+      0x5C0C0400,  //  0028  MOVE	R3	R2
+      0x7C0C0000,  //  0029  CALL	R3	0
+      0x7001FFD6,  //  002A  JMP		#0002
+      0x80000000,  //  002B  RET	0
     })
   )
 );
@@ -1174,7 +1240,7 @@ be_local_closure(find_op,   /* name */
 ********************************************************************/
 be_local_closure(remove_timer,   /* name */
   be_nested_proto(
-    6,                          /* nstack */
+    7,                          /* nstack */
     2,                          /* argc */
     0,                          /* varg */
     0,                          /* has upvals */
@@ -1182,41 +1248,42 @@ be_local_closure(remove_timer,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 7]) {     /* constants */
-    /* K0   */  be_nested_string("tasmota", 424643812, 7),
-    /* K1   */  be_nested_string("_timers", -1694866380, 7),
+    ( &(const bvalue[ 6]) {     /* constants */
+    /* K0   */  be_nested_string("_timers_id", 1255637444, 10),
+    /* K1   */  be_nested_string("find", -1108310694, 4),
     /* K2   */  be_const_int(0),
-    /* K3   */  be_nested_string("size", 597743964, 4),
-    /* K4   */  be_nested_string("id", 926444256, 2),
+    /* K3   */  be_nested_string("_timer_remove", -821546120, 13),
+    /* K4   */  be_const_int(1),
     /* K5   */  be_nested_string("remove", -611183107, 6),
-    /* K6   */  be_const_int(1),
     }),
     (be_nested_const_str("remove_timer", -153495081, 12)),
     ((bstring*) &be_const_str_input),
-    ( &(const binstruction[23]) {  /* code */
-      0xB80A0000,  //  0000  GETNGBL  R2  K0
-      0x88080501,  //  0001  GETMBR R2  R2  K1
-      0x780A0012,  //  0002  JMPF R2  #0016
-      0x58080002,  //  0003  LDCONST  R2  K2
-      0xB80E0000,  //  0004  GETNGBL  R3  K0
-      0x880C0701,  //  0005  GETMBR R3  R3  K1
-      0x8C0C0703,  //  0006  GETMET R3  R3  K3
-      0x7C0C0200,  //  0007  CALL R3  1
-      0x140C0403,  //  0008  LT R3  R2  R3
-      0x780E000B,  //  0009  JMPF R3  #0016
-      0x880C0101,  //  000A  GETMBR R3  R0  K1
-      0x940C0602,  //  000B  GETIDX R3  R3  R2
-      0x880C0704,  //  000C  GETMBR R3  R3  K4
-      0x1C0C0601,  //  000D  EQ R3  R3  R1
-      0x780E0004,  //  000E  JMPF R3  #0014
-      0x880C0101,  //  000F  GETMBR R3  R0  K1
-      0x8C0C0705,  //  0010  GETMET R3  R3  K5
-      0x5C140400,  //  0011  MOVE R5  R2
-      0x7C0C0400,  //  0012  CALL R3  2
-      0x70020000,  //  0013  JMP    #0015
-      0x00080506,  //  0014  ADD  R2  R2  K6
-      0x7001FFED,  //  0015  JMP    #0004
-      0x80000000,  //  0016  RET  0
+    ( &(const binstruction[25]) {  /* code */
+      0x88080100,  //  0000  GETMBR	R2	R0	K0
+      0x780A0015,  //  0001  JMPF	R2	#0018
+      0x88080100,  //  0002  GETMBR	R2	R0	K0
+      0x8C080501,  //  0003  GETMET	R2	R2	K1
+      0x5C100200,  //  0004  MOVE	R4	R1
+      0x7C080400,  //  0005  CALL	R2	2
+      0x4C0C0000,  //  0006  LDNIL	R3
+      0x200C0403,  //  0007  NE	R3	R2	R3
+      0x780E000E,  //  0008  JMPF	R3	#0018
+      0x580C0002,  //  0009  LDCONST	R3	K2
+      0x6010000C,  //  000A  GETGBL	R4	G12
+      0x5C140400,  //  000B  MOVE	R5	R2
+      0x7C100200,  //  000C  CALL	R4	1
+      0x14100604,  //  000D  LT	R4	R3	R4
+      0x78120004,  //  000E  JMPF	R4	#0014
+      0x8C100103,  //  000F  GETMET	R4	R0	K3
+      0x94180403,  //  0010  GETIDX	R6	R2	R3
+      0x7C100400,  //  0011  CALL	R4	2
+      0x000C0704,  //  0012  ADD	R3	R3	K4
+      0x7001FFF5,  //  0013  JMP		#000A
+      0x88100100,  //  0014  GETMBR	R4	R0	K0
+      0x8C100905,  //  0015  GETMET	R4	R4	K5
+      0x5C180200,  //  0016  MOVE	R6	R1
+      0x7C100400,  //  0017  CALL	R4	2
+      0x80000000,  //  0018  RET	0
     })
   )
 );
@@ -1271,7 +1338,7 @@ be_local_closure(get_light,   /* name */
 ********************************************************************/
 be_local_closure(exec_rules,   /* name */
   be_nested_proto(
-    12,                          /* nstack */
+    8,                          /* nstack */
     2,                          /* argc */
     0,                          /* varg */
     0,                          /* has upvals */
@@ -1279,7 +1346,7 @@ be_local_closure(exec_rules,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[12]) {     /* constants */
+    ( &(const bvalue[ 8]) {     /* constants */
     /* K0   */  be_nested_string("_rules", -28750191, 6),
     /* K1   */  be_nested_string("cmd_res", 921166762, 7),
     /* K2   */  be_nested_string("json", 916562499, 4),
@@ -1287,63 +1354,44 @@ be_local_closure(exec_rules,   /* name */
     /* K4   */  be_nested_string("log", 1062293841, 3),
     /* K5   */  be_nested_string("BRY: ERROR, bad json: ", -1579831487, 22),
     /* K6   */  be_const_int(3),
-    /* K7   */  be_const_int(0),
-    /* K8   */  be_nested_string("try_rule", 1986449405, 8),
-    /* K9   */  be_nested_string("k", -301188886, 1),
-    /* K10  */  be_nested_string("v", -217300791, 1),
-    /* K11  */  be_const_int(1),
+    /* K7   */  be_nested_string("run_rules", -1141543098, 9),
     }),
     (be_nested_const_str("exec_rules", 1445221092, 10)),
     ((bstring*) &be_const_str_input),
-    ( &(const binstruction[48]) {  /* code */
+    ( &(const binstruction[33]) {  /* code */
       0x88080100,  //  0000  GETMBR	R2	R0	K0
       0x740A0003,  //  0001  JMPT	R2	#0006
       0x88080101,  //  0002  GETMBR	R2	R0	K1
       0x4C0C0000,  //  0003  LDNIL	R3
       0x20080403,  //  0004  NE	R2	R2	R3
-      0x780A0027,  //  0005  JMPF	R2	#002E
-      0xA40A0400,  //  0006  IMPORT	R2	K2
-      0x8C0C0503,  //  0007  GETMET	R3	R2	K3
-      0x5C140200,  //  0008  MOVE	R5	R1
-      0x7C0C0400,  //  0009  CALL	R3	2
-      0x50100000,  //  000A  LDBOOL	R4	0	0
-      0x4C140000,  //  000B  LDNIL	R5
-      0x1C140605,  //  000C  EQ	R5	R3	R5
-      0x78160004,  //  000D  JMPF	R5	#0013
-      0x8C140104,  //  000E  GETMET	R5	R0	K4
-      0x001E0A01,  //  000F  ADD	R7	K5	R1
-      0x58200006,  //  0010  LDCONST	R8	K6
-      0x7C140600,  //  0011  CALL	R5	3
-      0x5C0C0200,  //  0012  MOVE	R3	R1
-      0x88140101,  //  0013  GETMBR	R5	R0	K1
-      0x4C180000,  //  0014  LDNIL	R6
-      0x20140A06,  //  0015  NE	R5	R5	R6
-      0x78160000,  //  0016  JMPF	R5	#0018
-      0x90020203,  //  0017  SETMBR	R0	K1	R3
-      0x88140100,  //  0018  GETMBR	R5	R0	K0
-      0x78160012,  //  0019  JMPF	R5	#002D
-      0x58140007,  //  001A  LDCONST	R5	K7
-      0x6018000C,  //  001B  GETGBL	R6	G12
-      0x881C0100,  //  001C  GETMBR	R7	R0	K0
-      0x7C180200,  //  001D  CALL	R6	1
-      0x14180A06,  //  001E  LT	R6	R5	R6
-      0x781A000C,  //  001F  JMPF	R6	#002D
-      0x88180100,  //  0020  GETMBR	R6	R0	K0
-      0x94180C05,  //  0021  GETIDX	R6	R6	R5
-      0x8C1C0108,  //  0022  GETMET	R7	R0	K8
-      0x5C240600,  //  0023  MOVE	R9	R3
-      0x88280D09,  //  0024  GETMBR	R10	R6	K9
-      0x882C0D0A,  //  0025  GETMBR	R11	R6	K10
-      0x7C1C0800,  //  0026  CALL	R7	4
-      0x741E0001,  //  0027  JMPT	R7	#002A
-      0x74120000,  //  0028  JMPT	R4	#002A
-      0x50100001,  //  0029  LDBOOL	R4	0	1
-      0x50100200,  //  002A  LDBOOL	R4	1	0
-      0x00140B0B,  //  002B  ADD	R5	R5	K11
-      0x7001FFED,  //  002C  JMP		#001B
-      0x80040800,  //  002D  RET	1	R4
-      0x50080000,  //  002E  LDBOOL	R2	0	0
-      0x80040400,  //  002F  RET	1	R2
+      0x780A0018,  //  0005  JMPF	R2	#001F
+      0x4C080000,  //  0006  LDNIL	R2
+      0x880C0101,  //  0007  GETMBR	R3	R0	K1
+      0x4C100000,  //  0008  LDNIL	R4
+      0x200C0604,  //  0009  NE	R3	R3	R4
+      0x780E000D,  //  000A  JMPF	R3	#0019
+      0xA40E0400,  //  000B  IMPORT	R3	K2
+      0x8C100703,  //  000C  GETMET	R4	R3	K3
+      0x5C180200,  //  000D  MOVE	R6	R1
+      0x7C100400,  //  000E  CALL	R4	2
+      0x5C080800,  //  000F  MOVE	R2	R4
+      0x4C100000,  //  0010  LDNIL	R4
+      0x1C100404,  //  0011  EQ	R4	R2	R4
+      0x78120004,  //  0012  JMPF	R4	#0018
+      0x8C100104,  //  0013  GETMET	R4	R0	K4
+      0x001A0A01,  //  0014  ADD	R6	K5	R1
+      0x581C0006,  //  0015  LDCONST	R7	K6
+      0x7C100600,  //  0016  CALL	R4	3
+      0x5C080200,  //  0017  MOVE	R2	R1
+      0x90020202,  //  0018  SETMBR	R0	K1	R2
+      0x8C0C0107,  //  0019  GETMET	R3	R0	K7
+      0x5C140200,  //  001A  MOVE	R5	R1
+      0x5C180400,  //  001B  MOVE	R6	R2
+      0x501C0000,  //  001C  LDBOOL	R7	0	0
+      0x7C0C0800,  //  001D  CALL	R3	4
+      0x80040600,  //  001E  RET	1	R3
+      0x50080000,  //  001F  LDBOOL	R2	0	0
+      0x80040400,  //  0020  RET	1	R2
     })
   )
 );
@@ -1355,7 +1403,7 @@ be_local_closure(exec_rules,   /* name */
 ********************************************************************/
 be_local_closure(exec_tele,   /* name */
   be_nested_proto(
-    12,                          /* nstack */
+    7,                          /* nstack */
     2,                          /* argc */
     0,                          /* varg */
     0,                          /* has upvals */
@@ -1363,64 +1411,153 @@ be_local_closure(exec_tele,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[12]) {     /* constants */
-    /* K0   */  be_nested_string("_rules", -28750191, 6),
-    /* K1   */  be_nested_string("json", 916562499, 4),
-    /* K2   */  be_nested_string("load", -435725847, 4),
-    /* K3   */  be_nested_string("log", 1062293841, 3),
-    /* K4   */  be_nested_string("BRY: ERROR, bad json: ", -1579831487, 22),
-    /* K5   */  be_const_int(3),
-    /* K6   */  be_nested_string("Tele", 1329980653, 4),
-    /* K7   */  be_const_int(0),
-    /* K8   */  be_nested_string("try_rule", 1986449405, 8),
-    /* K9   */  be_nested_string("k", -301188886, 1),
-    /* K10  */  be_nested_string("v", -217300791, 1),
-    /* K11  */  be_const_int(1),
+    ( &(const bvalue[ 1]) {     /* constants */
+    /* K0   */  be_nested_string("run_rules", -1141543098, 9),
     }),
     (be_nested_const_str("exec_tele", 1020751601, 9)),
     ((bstring*) &be_const_str_input),
-    ( &(const binstruction[41]) {  /* code */
-      0x88080100,  //  0000  GETMBR	R2	R0	K0
-      0x780A0024,  //  0001  JMPF	R2	#0027
-      0xA40A0200,  //  0002  IMPORT	R2	K1
-      0x8C0C0502,  //  0003  GETMET	R3	R2	K2
-      0x5C140200,  //  0004  MOVE	R5	R1
-      0x7C0C0400,  //  0005  CALL	R3	2
-      0x50100000,  //  0006  LDBOOL	R4	0	0
-      0x4C140000,  //  0007  LDNIL	R5
-      0x1C140605,  //  0008  EQ	R5	R3	R5
-      0x78160004,  //  0009  JMPF	R5	#000F
-      0x8C140103,  //  000A  GETMET	R5	R0	K3
-      0x001E0801,  //  000B  ADD	R7	K4	R1
-      0x58200005,  //  000C  LDCONST	R8	K5
-      0x7C140600,  //  000D  CALL	R5	3
-      0x5C0C0200,  //  000E  MOVE	R3	R1
-      0x60140013,  //  000F  GETGBL	R5	G19
-      0x7C140000,  //  0010  CALL	R5	0
-      0x98160C03,  //  0011  SETIDX	R5	K6	R3
-      0x5C0C0A00,  //  0012  MOVE	R3	R5
-      0x58140007,  //  0013  LDCONST	R5	K7
-      0x6018000C,  //  0014  GETGBL	R6	G12
-      0x881C0100,  //  0015  GETMBR	R7	R0	K0
-      0x7C180200,  //  0016  CALL	R6	1
-      0x14180A06,  //  0017  LT	R6	R5	R6
-      0x781A000C,  //  0018  JMPF	R6	#0026
-      0x88180100,  //  0019  GETMBR	R6	R0	K0
-      0x94180C05,  //  001A  GETIDX	R6	R6	R5
-      0x8C1C0108,  //  001B  GETMET	R7	R0	K8
-      0x5C240600,  //  001C  MOVE	R9	R3
-      0x88280D09,  //  001D  GETMBR	R10	R6	K9
-      0x882C0D0A,  //  001E  GETMBR	R11	R6	K10
-      0x7C1C0800,  //  001F  CALL	R7	4
-      0x741E0001,  //  0020  JMPT	R7	#0023
-      0x74120000,  //  0021  JMPT	R4	#0023
-      0x50100001,  //  0022  LDBOOL	R4	0	1
-      0x50100200,  //  0023  LDBOOL	R4	1	0
-      0x00140B0B,  //  0024  ADD	R5	R5	K11
-      0x7001FFED,  //  0025  JMP		#0014
-      0x80040800,  //  0026  RET	1	R4
-      0x50080000,  //  0027  LDBOOL	R2	0	0
-      0x80040400,  //  0028  RET	1	R2
+    ( &(const binstruction[ 6]) {  /* code */
+      0x8C080100,  //  0000  GETMET	R2	R0	K0
+      0x5C100200,  //  0001  MOVE	R4	R1
+      0x4C140000,  //  0002  LDNIL	R5
+      0x50180200,  //  0003  LDBOOL	R6	1	0
+      0x7C080800,  //  0004  CALL	R2	4
+      0x80040400,  //  0005  RET	1	R2
+    })
+  )
+);
+/*******************************************************************/
+
+
+/********************************************************************
+** Solidified function: run_rules
+********************************************************************/
+be_local_closure(run_rules,   /* name */
+  be_nested_proto(
+    13,                          /* nstack */
+    4,                          /* argc */
+    0,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[15]) {     /* constants */
+    /* K0   */  be_nested_string("_rules", -28750191, 6),
+    /* K1   */  be_nested_string("_rules_match", -1452600965, 12),
+    /* K2   */  be_const_int(0),
+    /* K3   */  be_nested_string("json", 916562499, 4),
+    /* K4   */  be_nested_string("load", -435725847, 4),
+    /* K5   */  be_nested_string("log", 1062293841, 3),
+    /* K6   */  be_nested_string("BRY: ERROR, bad json: ", -1579831487, 22),
+    /* K7   */  be_const_int(3),
+    /* K8   */  be_nested_string("string", 398550328, 6),
+    /* K9   */  be_nested_string("Tele", 1329980653, 4),
+    /* K10  */  be_nested_string("try_rule", 1986449405, 8),
+    /* K11  */  be_nested_string("k", -301188886, 1),
+    /* K12  */  be_nested_string("v", -217300791, 1),
+    /* K13  */  be_const_int(1),
+    /* K14  */  be_const_int(2),
+    }),
+    (be_nested_const_str("run_rules", -1141543098, 9)),
+    ((bstring*) &be_const_str_input),
+    ( &(const binstruction[96]) {  /* code */
+      0x88100100,  //  0000  GETMBR	R4	R0	K0
+      0x74120001,  //  0001  JMPT	R4	#0004
+      0x50100000,  //  0002  LDBOOL	R4	0	0
+      0x80040800,  //  0003  RET	1	R4
+      0x8C100101,  //  0004  GETMET	R4	R0	K1
+      0x5C180200,  //  0005  MOVE	R6	R1
+      0x5C1C0600,  //  0006  MOVE	R7	R3
+      0x7C100600,  //  0007  CALL	R4	3
+      0x4C140000,  //  0008  LDNIL	R5
+      0x20140805,  //  0009  NE	R5	R4	R5
+      0x78160006,  //  000A  JMPF	R5	#0012
+      0x6014000C,  //  000B  GETGBL	R5	G12
+      0x5C180800,  //  000C  MOVE	R6	R4
+      0x7C140200,  //  000D  CALL	R5	1
+      0x1C140B02,  //  000E  EQ	R5	R5	K2
+      0x78160001,  //  000F  JMPF	R5	#0012
+      0x50140000,  //  0010  LDBOOL	R5	0	0
+      0x80040A00,  //  0011  RET	1	R5
+      0x4C140000,  //  0012  LDNIL	R5
+      0x1C140405,  //  0013  EQ	R5	R2	R5
+      0x7816000C,  //  0014  JMPF	R5	#0022
+      0xA4160600,  //  0015  IMPORT	R5	K3
+      0x8C180B04,  //  0016  GETMET	R6	R5	K4
+      0x5C200200,  //  0017  MOVE	R8	R1
+      0x7C180400,  //  0018  CALL	R6	2
+      0x5C080C00,  //  0019  MOVE	R2	R6
+      0x4C180000,  //  001A  LDNIL	R6
+      0x1C180406,  //  001B  EQ	R6	R2	R6
+      0x781A0004,  //  001C  JMPF	R6	#0022
+      0x8C180105,  //  001D  GETMET	R6	R0	K5
+      0x00220C01,  //  001E  ADD	R8	K6	R1
+      0x58240007,  //  001F  LDCONST	R9	K7
+      0x7C180600,  //  0020  CALL	R6	3
+      0x5C080200,  //  0021  MOVE	R2	R1
+      0x60140004,  //  0022  GETGBL	R5	G4
+      0x5C180400,  //  0023  MOVE	R6	R2
+      0x7C140200,  //  0024  CALL	R5	1
+      0x1C140B08,  //  0025  EQ	R5	R5	K8
+      0x78160000,  //  0026  JMPF	R5	#0028
+      0x4C100000,  //  0027  LDNIL	R4
+      0x780E0003,  //  0028  JMPF	R3	#002D
+      0x60140013,  //  0029  GETGBL	R5	G19
+      0x7C140000,  //  002A  CALL	R5	0
+      0x98161202,  //  002B  SETIDX	R5	K9	R2
+      0x5C080A00,  //  002C  MOVE	R2	R5
+      0x4C140000,  //  002D  LDNIL	R5
+      0x1C140805,  //  002E  EQ	R5	R4	R5
+      0x78160014,  //  002F  JMPF	R5	#0045
+      0x50140000,  //  0030  LDBOOL	R5	0	0
+      0x58180002,  //  0031  LDCONST	R6	K2
+      0x601C000C,  //  0032  GETGBL	R7	G12
+      0x88200100,  //  0033  GETMBR	R8	R0	K0
+      0x7C1C0200,  //  0034  CALL	R7	1
+      0x141C0C07,  //  0035  LT	R7	R6	R7
+      0x781E000C,  //  0036  JMPF	R7	#0044
+      0x881C0100,  //  0037  GETMBR	R7	R0	K0
+      0x941C0E06,  //  0038  GETIDX	R7	R7	R6
+      0x8C20010A,  //  0039  GETMET	R8	R0	K10
+      0x5C280400,  //  003A  MOVE	R10	R2
+      0x882C0F0B,  //  003B  GETMBR	R11	R7	K11
+      0x88300F0C,  //  003C  GETMBR	R12	R7	K12
+      0x7C200800,  //  003D  CALL	R8	4
+      0x74220001,  //  003E  JMPT	R8	#0041
+      0x74160000,  //  003F  JMPT	R5	#0041
+      0x50140001,  //  0040  LDBOOL	R5	0	1
+      0x50140200,  //  0041  LDBOOL	R5	1	0
+      0x00180D0D,  //  0042  ADD	R6	R6	K13
+      0x7001FFED,  //  0043  JMP		#0032
+      0x80040A00,  //  0044  RET	1	R5
+      0x58140002,  //  0045  LDCONST	R5	K2
+      0x6018000C,  //  0046  GETGBL	R6	G12
+      0x5C1C0800,  //  0047  MOVE	R7	R4
+      0x7C180200,  //  0048  CALL	R6	1
+      0x14180A06,  //  0049  LT	R6	R5	R6
+      0x781A0012,  //  004A  JMPF	R6	#005E
+      0x94180805,  //  004B  GETIDX	R6	R4	R5
+      0x5C1C0400,  //  004C  MOVE	R7	R2
+      0x5820000E,  //  004D  LDCONST	R8	K14
+      0x6024000C,  //  004E  GETGBL	R9	G12
+      0x5C280C00,  //  004F  MOVE	R10	R6
+      0x7C240200,  //  0050  CALL	R9	1
+      0x14241009,  //  0051  LT	R9	R8	R9
+      0x78260003,  //  0052  JMPF	R9	#0057
+      0x94240C08,  //  0053  GETIDX	R9	R6	R8
+      0x941C0E09,  //  0054  GETIDX	R7	R7	R9
+      0x0020110D,  //  0055  ADD	R8	R8	K13
+      0x7001FFF6,  //  0056  JMP		#004E
+      0x94240D02,  //  0057  GETIDX	R9	R6	K2
+      0x5C280E00,  //  0058  MOVE	R10	R7
+      0x942C0D0D,  //  0059  GETIDX	R11	R6	K13
+      0x5C300400,  //  005A  MOVE	R12	R2
+      0x7C240600,  //  005B  CALL	R9	3
+      0x00140B0D,  //  005C  ADD	R5	R5	K13
+      0x7001FFE7,  //  005D  JMP		#0046
+      0x50180200,  //  005E  LDBOOL	R6	1	0
+      0x80040C00,  //  005F  RET	1	R6
     })
   )
 );
@@ -2066,7 +2203,9 @@ void be_load_tasmota_ntvlib(bvm *vm)
 /* @const_object_info_begin
 class be_class_tasmota (scope: global, name: Tasmota) {
     _rules, var
+    _rules_idx, var
     _timers, var
+    _timers_id, var
     _ccmd, var
     _drivers, var
     _cb, var
@@ -2133,9 +2272,14 @@ class be_class_tasmota (scope: global, name: Tasmota) {
     add_rule, closure(add_rule_closure)
     remove_rule, closure(remove_rule_closure)
     try_rule, closure(try_rule_closure)
+    _rule_compile, func(l_rule_compile)
+    _rules_match, func(l_rules_match)
+    run_rules, closure(run_rules_closure)
     exec_rules, closure(exec_rules_closure)
     exec_tele, closure(exec_tele_closure)
     set_timer, closure(set_timer_closure)
+    _timer_push, func(be_timer_push)
+    _timer_remove, func(be_timer_remove)
     run_deferred, closure(run_deferred_closure)
     remove_timer, closure(remove_timer_closure)
     add_cmd, closure(add_cmd_closure)
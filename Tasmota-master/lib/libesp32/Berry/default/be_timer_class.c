@@ -89,20 +89,170 @@ be_local_closure(init,   /* name */
 ** Solidified class: Timer
 ********************************************************************/
 be_local_class(Timer,
-    3,
+    4,
     NULL,
-    be_nested_map(5,
+    be_nested_map(6,
     ( (struct bmapnode*) &(const bmapnode[]) {
-        { be_nested_key("tostring", -1995258651, 8, 4), be_const_closure(tostring_closure) },
-        { be_nested_key("id", 926444256, 2, 2), be_const_var(2) },
-        { be_nested_key("f", -485742695, 1, -1), be_const_var(1) },
-        { be_nested_key("due", -399437003, 3, -1), be_const_var(0) },
+        { be_nested_key("id", 926444256, 2, -1), be_const_var(2) },
+        { be_nested_key("tostring", -1995258651, 8, -1), be_const_closure(tostring_closure) },
+        { be_nested_key("idx", -2049979064, 3, -1), be_const_var(3) },
         { be_nested_key("init", 380752755, 4, -1), be_const_closure(init_closure) },
+        { be_nested_key("due", -399437003, 3, -1), be_const_var(0) },
+        { be_nested_key("f", -485742695, 1, 4), be_const_var(1) },
     })),
     (be_nested_const_str("Timer", -346839614, 5))
 );
 /*******************************************************************/
 
+/********************************************************************
+** Timer heap
+**
+** `tasmota._timers` is a binary min-heap of Timer instances ordered
+** by `due`, so the next timer is always `_timers[0]`. Each Timer keeps
+** its position in `idx`, so insert and remove are both O(log n).
+** `due` values are millis() and wrap around, they are compared by
+** difference like `time_reached()`.
+*******************************************************************/
+#define timer_before(a, b)      ((int32_t)((uint32_t)(a) - (uint32_t)(b)) < 0)
+
+/* push `list[i]` on the stack and return its `due` */
+static int32_t timer_get(bvm *vm, int list, int i)
+{
+    int32_t due;
+    be_pushint(vm, i);
+    be_getindex(vm, list);
+    be_remove(vm, -2);
+    be_getmember(vm, -1, "due");
+    due = be_toint(vm, -1);
+    be_pop(vm, 1);
+    return due;
+}
+
+/* move the timer on top of the stack to `list[i]`, and pop it */
+static void timer_set(bvm *vm, int list, int i)
+{
+    be_pushint(vm, i);
+    be_setmember(vm, -2, "idx");
+    be_pushint(vm, i);
+    be_pushvalue(vm, -3);
+    be_setindex(vm, list);
+    be_pop(vm, 4);
+}
+
+/* place the timer on top of the stack, with deadline `due`, from position `i` upwards */
+static void timer_sift_up(bvm *vm, int list, int i, int32_t due)
+{
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!timer_before(due, timer_get(vm, list, parent))) {
+            be_pop(vm, 1);
+            break;
+        }
+        timer_set(vm, list, i);
+        i = parent;
+    }
+    timer_set(vm, list, i);
+}
+
+/* place the timer on top of the stack, with deadline `due`, from position `i` downwards */
+static void timer_sift_down(bvm *vm, int list, int i, int32_t due, int size)
+{
+    int child;
+    while ((child = 2 * i + 1) < size) {
+        int32_t child_due = timer_get(vm, list, child);
+        be_pop(vm, 1);
+        if (child + 1 < size) {
+            int32_t right_due = timer_get(vm, list, child + 1);
+            be_pop(vm, 1);
+            if (timer_before(right_due, child_due)) {
+                child++;
+                child_due = right_due;
+            }
+        }
+        if (!timer_before(child_due, due)) {
+            break;
+        }
+        timer_get(vm, list, child);
+        timer_set(vm, list, i);
+        i = child;
+    }
+    timer_set(vm, list, i);
+}
+
+/* push the raw list of `self._timers` and return its index on the stack */
+static int timer_list(bvm *vm)
+{
+    be_getmember(vm, 1, "_timers");
+    be_getmember(vm, -1, ".p");
+    return be_absindex(vm, -1);
+}
+
+/* Berry: `tasmota._timer_push(t:Timer) -> nil` */
+int be_timer_push(bvm *vm)
+{
+    if (be_top(vm) >= 2 && be_isinstance(vm, 2)) {
+        int list = timer_list(vm);
+        int size = be_data_size(vm, list);
+        int32_t due;
+        be_pushvalue(vm, 2);
+        be_data_push(vm, list);
+        be_getmember(vm, -1, "due");
+        due = be_toint(vm, -1);
+        be_pop(vm, 1);
+        timer_sift_up(vm, list, size, due);
+        be_return_nil(vm);
+    }
+    be_raise(vm, "type_error", NULL);
+    be_return_nil(vm);
+}
+
+/* Berry: `tasmota._timer_remove(t:Timer) -> nil` */
+/* does nothing if the timer is not in the heap */
+int be_timer_remove(bvm *vm)
+{
+    if (be_top(vm) >= 2 && be_isinstance(vm, 2)) {
+        int list, size, i, last;
+        be_getmember(vm, 2, "idx");
+        if (!be_isint(vm, -1)) {
+            be_return_nil(vm);
+        }
+        i = be_toint(vm, -1);
+        list = timer_list(vm);
+        size = be_data_size(vm, list);
+        if (i < 0 || i >= size) {
+            be_return_nil(vm);
+        }
+        be_pushnil(vm);
+        be_setmember(vm, 2, "idx");
+        be_pop(vm, 1);
+        last = size - 1;
+        if (i < last) {
+            /* move the last timer to the free position */
+            int32_t due = timer_get(vm, list, last);
+            bbool up = bfalse;
+            be_pushint(vm, last);
+            be_data_remove(vm, list);
+            be_pop(vm, 1);
+            if (i > 0) {
+                up = timer_before(due, timer_get(vm, list, (i - 1) / 2));
+                be_pop(vm, 1);
+            }
+            if (up) {
+                timer_sift_up(vm, list, i, due);
+            } else {
+                timer_sift_down(vm, list, i, due, last);
+            }
+        } else {
+            be_pushint(vm, last);
+            be_data_remove(vm, list);
+            be_pop(vm, 1);
+        }
+        be_return_nil(vm);
+    }
+    be_raise(vm, "type_error", NULL);
+    be_return_nil(vm);
+}
+
 void be_load_Timer_class(bvm *vm) {
     be_pushntvclass(vm, &be_class_Timer);
     be_setglobal(vm, "Timer");
@@ -86,6 +86,49 @@
  **/
 #define BE_VM_OBSERVABILITY_SAMPLING    20
 
+/* Macro: BE_USE_COMPUTED_GOTO
+ * Dispatch VM instructions with GCC labels-as-values (threaded code):
+ * each instruction jumps directly to the handler of the next one
+ * instead of going back to a central switch statement.
+ * Only used with GCC or Clang, ignored otherwise.
+ * Default: 0
+ **/
+#define BE_USE_COMPUTED_GOTO            1
+
+/* Macro: BE_MEMBER_CACHE_SIZE
+ * Number of entries of the VM cache of instance member look-ups,
+ * keyed on the class and the member name. Each entry uses 20 bytes
+ * on a 32 bits target (40 bytes on a 64 bits host). Must be a power
+ * of 2, 0 disables the cache.
+ * Default: 0
+ **/
+#define BE_MEMBER_CACHE_SIZE            32
+
+/* Macro: BE_GC_STEP_BUDGET
+ * Maximum number of objects the garbage collector visits in one step
+ * when it destroys and frees the unreachable objects. Only the sweep is
+ * incremental: the first step still marks all the reachable objects at
+ * once, so its pause grows with the live objects. The destructors and
+ * the sweep are spread over the following allocations. 0 frees
+ * everything at once.
+ * Default: 0
+ **/
+#define BE_GC_STEP_BUDGET               128
+
+/* Macro: BE_USE_MEM_POOL
+ * Allocate the small blocks (up to BE_MEM_POOL_MAX_SIZE bytes) from
+ * free lists of size classes, carved in chunks of BE_MEM_POOL_CHUNK_SIZE
+ * bytes, instead of calling malloc for each of them. This reduces the
+ * heap fragmentation and the cost of the allocations. At the end of each
+ * garbage collection the chunks whose blocks are all free are released.
+ * Default: 0
+ **/
+#ifndef BE_USE_MEM_POOL
+#define BE_USE_MEM_POOL                 1
+#endif
+#define BE_MEM_POOL_MAX_SIZE            64
+#define BE_MEM_POOL_CHUNK_SIZE          1024
+
 /* Macro: BE_STACK_TOTAL_MAX
  * Set the maximum total stack size.
  * Default: 20000
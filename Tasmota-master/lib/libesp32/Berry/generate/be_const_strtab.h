@@ -1,351 +1,358 @@
-extern const bcstring be_const_str_SERIAL_6N2;
-extern const bcstring be_const_str__begin_transmission;
-extern const bcstring be_const_str_set_light;
-extern const bcstring be_const_str_time_reached;
-extern const bcstring be_const_str_SERIAL_5E2;
-extern const bcstring be_const_str___lower__;
-extern const bcstring be_const_str_SERIAL_7O1;
-extern const bcstring be_const_str_getbits;
-extern const bcstring be_const_str_input;
-extern const bcstring be_const_str_dot_size;
-extern const bcstring be_const_str_publish_result;
-extern const bcstring be_const_str_web_send_decimal;
-extern const bcstring be_const_str_def;
-extern const bcstring be_const_str__cmd;
-extern const bcstring be_const_str_begin;
-extern const bcstring be_const_str_resp_cmnd;
-extern const bcstring be_const_str_assert;
-extern const bcstring be_const_str_set;
-extern const bcstring be_const_str_tag;
-extern const bcstring be_const_str_check_privileged_access;
-extern const bcstring be_const_str_kv;
-extern const bcstring be_const_str_publish;
-extern const bcstring be_const_str_read32;
-extern const bcstring be_const_str_load;
-extern const bcstring be_const_str_read13;
-extern const bcstring be_const_str_search;
-extern const bcstring be_const_str_dac_voltage;
-extern const bcstring be_const_str_finish;
-extern const bcstring be_const_str_hex;
-extern const bcstring be_const_str_isinstance;
-extern const bcstring be_const_str_rand;
-extern const bcstring be_const_str_POST;
-extern const bcstring be_const_str_SERIAL_6E2;
-extern const bcstring be_const_str_classname;
-extern const bcstring be_const_str__global_def;
-extern const bcstring be_const_str_open;
-extern const bcstring be_const_str_redirect;
-extern const bcstring be_const_str_AES_GCM;
-extern const bcstring be_const_str_resp_cmnd_failed;
-extern const bcstring be_const_str_reverse_gamma10;
-extern const bcstring be_const_str_strftime;
-extern const bcstring be_const_str_insert;
-extern const bcstring be_const_str_false;
-extern const bcstring be_const_str_arg_size;
+extern const bcstring be_const_str_imin;
+extern const bcstring be_const_str_tanh;
+extern const bcstring be_const_str_SERIAL_5N2;
+extern const bcstring be_const_str_SERIAL_6O2;
+extern const bcstring be_const_str_I2C_Driver;
+extern const bcstring be_const_str__request_from;
+extern const bcstring be_const_str_add;
+extern const bcstring be_const_str_content_start;
+extern const bcstring be_const_str_compile;
+extern const bcstring be_const_str_resp_cmnd_str;
+extern const bcstring be_const_str_state;
+extern const bcstring be_const_str_iter;
+extern const bcstring be_const_str_AudioGeneratorWAV;
+extern const bcstring be_const_str__timer_remove;
+extern const bcstring be_const_str_attrdump;
+extern const bcstring be_const_str_fromstring;
+extern const bcstring be_const_str_arch;
+extern const bcstring be_const_str_bus;
 extern const bcstring be_const_str_serial;
-extern const bcstring be_const_str_OneWire;
+extern const bcstring be_const_str_allocated;
+extern const bcstring be_const_str_find;
+extern const bcstring be_const_str_gamma10;
+extern const bcstring be_const_str_erase;
+extern const bcstring be_const_str_read13;
+extern const bcstring be_const_str_SERIAL_7O2;
 extern const bcstring be_const_str_scale_uint;
-extern const bcstring be_const_str_return;
-extern const bcstring be_const_str_wire;
-extern const bcstring be_const_str_write_bytes;
-extern const bcstring be_const_str__global_addr;
-extern const bcstring be_const_str_exec_tele;
-extern const bcstring be_const_str_target_search;
-extern const bcstring be_const_str_gamma8;
-extern const bcstring be_const_str_pi;
-extern const bcstring be_const_str_state;
-extern const bcstring be_const_str_depower;
-extern const bcstring be_const_str_init;
-extern const bcstring be_const_str_member;
-extern const bcstring be_const_str__end_transmission;
-extern const bcstring be_const_str_digital_read;
-extern const bcstring be_const_str_imin;
-extern const bcstring be_const_str_hs2rgb;
-extern const bcstring be_const_str_keys;
-extern const bcstring be_const_str_real;
-extern const bcstring be_const_str_sin;
-extern const bcstring be_const_str_SERIAL_7N1;
-extern const bcstring be_const_str_ctypes_bytes;
-extern const bcstring be_const_str_ctypes_bytes_dyn;
-extern const bcstring be_const_str_raise;
-extern const bcstring be_const_str_GET;
-extern const bcstring be_const_str__settings_def;
-extern const bcstring be_const_str_read24;
-extern const bcstring be_const_str_cos;
-extern const bcstring be_const_str_remove_driver;
-extern const bcstring be_const_str__settings_ptr;
-extern const bcstring be_const_str_memory;
+extern const bcstring be_const_str__cb;
+extern const bcstring be_const_str_arg;
+extern const bcstring be_const_str_reduce;
+extern const bcstring be_const_str_upper;
+extern const bcstring be_const_str_tan;
+extern const bcstring be_const_str_encrypt;
 extern const bcstring be_const_str_set_auth;
-extern const bcstring be_const_str_content_send_style;
-extern const bcstring be_const_str_class;
-extern const bcstring be_const_str_SERIAL_7E2;
+extern const bcstring be_const_str_webclient;
+extern const bcstring be_const_str_arg_name;
+extern const bcstring be_const_str_concat;
+extern const bcstring be_const_str_run_rules;
+extern const bcstring be_const_str_deg;
+extern const bcstring be_const_str_get;
+extern const bcstring be_const_str_SERIAL_8E1;
+extern const bcstring be_const_str_delay;
 extern const bcstring be_const_str_shared_key;
-extern const bcstring be_const_str_tanh;
-extern const bcstring be_const_str_nil;
-extern const bcstring be_const_str_get_power;
-extern const bcstring be_const_str_last_modified;
-extern const bcstring be_const_str_resolvecmnd;
-extern const bcstring be_const_str__read;
-extern const bcstring be_const_str_atan;
-extern const bcstring be_const_str_content_button;
-extern const bcstring be_const_str_setbits;
-extern const bcstring be_const_str_upper;
-extern const bcstring be_const_str_contains;
-extern const bcstring be_const_str_time_str;
-extern const bcstring be_const_str_arch;
-extern const bcstring be_const_str_fromptr;
-extern const bcstring be_const_str_push;
-extern const bcstring be_const_str_srand;
-extern const bcstring be_const_str_geti;
-extern const bcstring be_const_str_seti;
-extern const bcstring be_const_str_add_cmd;
-extern const bcstring be_const_str_cmd;
-extern const bcstring be_const_str_get_switch;
-extern const bcstring be_const_str_size;
-extern const bcstring be_const_str_try;
-extern const bcstring be_const_str_web_send;
-extern const bcstring be_const_str_except;
-extern const bcstring be_const_str_SERIAL_5O1;
-extern const bcstring be_const_str_SERIAL_8E2;
-extern const bcstring be_const_str__available;
-extern const bcstring be_const_str_codedump;
-extern const bcstring be_const_str_wire2;
-extern const bcstring be_const_str_dump;
+extern const bcstring be_const_str_for;
+extern const bcstring be_const_str__drivers;
+extern const bcstring be_const_str_opt_call;
+extern const bcstring be_const_str_clear;
+extern const bcstring be_const_str_detect;
+extern const bcstring be_const_str_response_append;
+extern const bcstring be_const_str_strftime;
+extern const bcstring be_const_str__timer_push;
+extern const bcstring be_const_str__timers;
+extern const bcstring be_const_str_import;
+extern const bcstring be_const_str_SERIAL_7E1;
+extern const bcstring be_const_str_i2c_enabled;
+extern const bcstring be_const_str_pow;
+extern const bcstring be_const_str__cmd;
+extern const bcstring be_const_str_gamma8;
 extern const bcstring be_const_str_exec_cmd;
-extern const bcstring be_const_str_add;
+extern const bcstring be_const_str_write_file;
 extern const bcstring be_const_str_exp;
-extern const bcstring be_const_str_isrunning;
-extern const bcstring be_const_str_remove_rule;
 extern const bcstring be_const_str_run_deferred;
-extern const bcstring be_const_str_scan;
-extern const bcstring be_const_str_for;
-extern const bcstring be_const_str_set_timer;
-extern const bcstring be_const_str_url_encode;
-extern const bcstring be_const_str_addr;
-extern const bcstring be_const_str___upper__;
-extern const bcstring be_const_str_loop;
-extern const bcstring be_const_str_AudioGeneratorWAV;
-extern const bcstring be_const_str_chars_in_string;
-extern const bcstring be_const_str_cosh;
-extern const bcstring be_const_str_import;
-extern const bcstring be_const_str_SERIAL_5N2;
-extern const bcstring be_const_str_type;
-extern const bcstring be_const_str_clear;
-extern const bcstring be_const_str_SERIAL_8N1;
-extern const bcstring be_const_str_issubclass;
-extern const bcstring be_const_str_remove_timer;
-extern const bcstring be_const_str_sinh;
-extern const bcstring be_const_str_AudioGeneratorMP3;
-extern const bcstring be_const_str_Wire;
-extern const bcstring be_const_str_get_light;
+extern const bcstring be_const_str_set_light;
+extern const bcstring be_const_str_collect;
 extern const bcstring be_const_str_get_option;
-extern const bcstring be_const_str_list;
-extern const bcstring be_const_str_stop;
-extern const bcstring be_const_str_try_rule;
-extern const bcstring be_const_str_webclient;
-extern const bcstring be_const_str_dot_p2;
-extern const bcstring be_const_str_has;
-extern const bcstring be_const_str__request_from;
-extern const bcstring be_const_str_setrange;
-extern const bcstring be_const_str_I2C_Driver;
-extern const bcstring be_const_str_ceil;
-extern const bcstring be_const_str_else;
-extern const bcstring be_const_str_concat;
-extern const bcstring be_const_str_set_power;
-extern const bcstring be_const_str_tomap;
-extern const bcstring be_const_str_resp_cmnd_error;
-extern const bcstring be_const_str_add_header;
-extern const bcstring be_const_str_eth;
-extern const bcstring be_const_str_write_bit;
+extern const bcstring be_const_str_open;
+extern const bcstring be_const_str_read_sensors;
+extern const bcstring be_const_str_end;
+extern const bcstring be_const_str_SERIAL_7N2;
+extern const bcstring be_const_str__rules_match;
+extern const bcstring be_const_str_read24;
+extern const bcstring be_const_str_web_send_decimal;
+extern const bcstring be_const_str_;
+extern const bcstring be_const_str__def;
 extern const bcstring be_const_str_exists;
-extern const bcstring be_const_str_pow;
-extern const bcstring be_const_str_select;
-extern const bcstring be_const_str_allocated;
+extern const bcstring be_const_str_traceback;
+extern const bcstring be_const_str_escape;
+extern const bcstring be_const_str_yield;
+extern const bcstring be_const_str_var;
+extern const bcstring be_const_str_event;
+extern const bcstring be_const_str_AudioOutputI2S;
+extern const bcstring be_const_str__ptr;
+extern const bcstring be_const_str_deinit;
+extern const bcstring be_const_str_srand;
 extern const bcstring be_const_str_classof;
-extern const bcstring be_const_str_if;
-extern const bcstring be_const_str_SERIAL_5E1;
-extern const bcstring be_const_str_arg;
-extern const bcstring be_const_str_cb_dispatch;
-extern const bcstring be_const_str_response_append;
-extern const bcstring be_const_str_pin_used;
-extern const bcstring be_const_str_write;
-extern const bcstring be_const_str_write8;
-extern const bcstring be_const_str_SERIAL_6O2;
-extern const bcstring be_const_str_log;
-extern const bcstring be_const_str_pin_mode;
-extern const bcstring be_const_str_read12;
-extern const bcstring be_const_str_resp_cmnd_str;
+extern const bcstring be_const_str__settings_def;
 extern const bcstring be_const_str_abs;
-extern const bcstring be_const_str_digital_write;
-extern const bcstring be_const_str_static;
-extern const bcstring be_const_str_bytes;
-extern const bcstring be_const_str_find_op;
-extern const bcstring be_const_str_call;
-extern const bcstring be_const_str_cmd_res;
-extern const bcstring be_const_str_opt_eq;
-extern const bcstring be_const_str_save;
-extern const bcstring be_const_str_find_key_i;
-extern const bcstring be_const_str__cb;
-extern const bcstring be_const_str_Tasmota;
 extern const bcstring be_const_str_public_key;
-extern const bcstring be_const_str_as;
-extern const bcstring be_const_str_dot_w;
-extern const bcstring be_const_str_SERIAL_8O1;
-extern const bcstring be_const_str_compile;
-extern const bcstring be_const_str_range;
-extern const bcstring be_const_str_add_rule;
-extern const bcstring be_const_str__ptr;
-extern const bcstring be_const_str_delay;
-extern const bcstring be_const_str_pop;
-extern const bcstring be_const_str_reset;
-extern const bcstring be_const_str_wire_scan;
-extern const bcstring be_const_str_reset_search;
-extern const bcstring be_const_str_tolower;
-extern const bcstring be_const_str_SERIAL_7O2;
-extern const bcstring be_const_str_asin;
-extern const bcstring be_const_str_nan;
-extern const bcstring be_const_str_deg;
-extern const bcstring be_const_str_log10;
-extern const bcstring be_const_str_char;
-extern const bcstring be_const_str_get_size;
-extern const bcstring be_const_str_opt_call;
-extern const bcstring be_const_str_end;
-extern const bcstring be_const_str_SERIAL_7N2;
-extern const bcstring be_const_str_time_dump;
-extern const bcstring be_const_str_listdir;
-extern const bcstring be_const_str_wifi;
-extern const bcstring be_const_str_read_bytes;
-extern const bcstring be_const_str_reverse;
+extern const bcstring be_const_str_do;
+extern const bcstring be_const_str_read;
+extern const bcstring be_const_str_type;
 extern const bcstring be_const_str_SERIAL_6E1;
-extern const bcstring be_const_str_SERIAL_5O2;
-extern const bcstring be_const_str_SERIAL_8E1;
+extern const bcstring be_const_str_EC_C25519;
+extern const bcstring be_const_str_GET;
+extern const bcstring be_const_str_return;
 extern const bcstring be_const_str_asstring;
-extern const bcstring be_const_str_deinit;
-extern const bcstring be_const_str_encrypt;
-extern const bcstring be_const_str_iter;
-extern const bcstring be_const_str_millis;
-extern const bcstring be_const_str_AudioOutput;
 extern const bcstring be_const_str_members;
-extern const bcstring be_const_str_rtc;
-extern const bcstring be_const_str_SERIAL_6N1;
-extern const bcstring be_const_str__write;
-extern const bcstring be_const_str_content_start;
+extern const bcstring be_const_str_number;
+extern const bcstring be_const_str_wifi;
+extern const bcstring be_const_str_write_bytes;
+extern const bcstring be_const_str_else;
+extern const bcstring be_const_str_call;
+extern const bcstring be_const_str_content_send;
+extern const bcstring be_const_str_load;
+extern const bcstring be_const_str_resize;
+extern const bcstring be_const_str_addr;
+extern const bcstring be_const_str_SERIAL_7O1;
+extern const bcstring be_const_str_close;
+extern const bcstring be_const_str_input;
+extern const bcstring be_const_str_loop;
+extern const bcstring be_const_str_Tasmota;
+extern const bcstring be_const_str_bytes;
+extern const bcstring be_const_str_eth;
+extern const bcstring be_const_str_set_useragent;
+extern const bcstring be_const_str_get_free_heap;
+extern const bcstring be_const_str_keys;
+extern const bcstring be_const_str_SERIAL_5E2;
+extern const bcstring be_const_str_asin;
+extern const bcstring be_const_str_dac_voltage;
+extern const bcstring be_const_str_POST;
+extern const bcstring be_const_str_remove_timer;
+extern const bcstring be_const_str_class;
+extern const bcstring be_const_str_AudioOutput;
+extern const bcstring be_const_str_Wire;
+extern const bcstring be_const_str_list;
+extern const bcstring be_const_str_url_encode;
+extern const bcstring be_const_str_isinstance;
+extern const bcstring be_const_str_cos;
+extern const bcstring be_const_str_pin_used;
+extern const bcstring be_const_str_def;
+extern const bcstring be_const_str__rules_idx;
+extern const bcstring be_const_str_sin;
+extern const bcstring be_const_str_pin_mode;
+extern const bcstring be_const_str_remove_driver;
+extern const bcstring be_const_str_str;
+extern const bcstring be_const_str_break;
+extern const bcstring be_const_str_exec_tele;
+extern const bcstring be_const_str_get_size;
+extern const bcstring be_const_str_reset_search;
+extern const bcstring be_const_str_assert;
+extern const bcstring be_const_str__timers_id;
+extern const bcstring be_const_str__ccmd;
+extern const bcstring be_const_str_hs2rgb;
 extern const bcstring be_const_str_module;
-extern const bcstring be_const_str_item;
-extern const bcstring be_const_str_remove_cmd;
-extern const bcstring be_const_str_MD5;
+extern const bcstring be_const_str_read_bytes;
+extern const bcstring be_const_str_set_power;
 extern const bcstring be_const_str_sqrt;
-extern const bcstring be_const_str_SERIAL_5N1;
-extern const bcstring be_const_str_break;
-extern const bcstring be_const_str_map;
-extern const bcstring be_const_str_setmember;
-extern const bcstring be_const_str_tostring;
-extern const bcstring be_const_str_AudioGenerator;
-extern const bcstring be_const_str_while;
-extern const bcstring be_const_str_event;
+extern const bcstring be_const_str_log10;
+extern const bcstring be_const_str_save;
+extern const bcstring be_const_str_false;
+extern const bcstring be_const_str__rules;
+extern const bcstring be_const_str_dot_w;
+extern const bcstring be_const_str_content_flush;
+extern const bcstring be_const_str_init;
 extern const bcstring be_const_str_resp_cmnd_done;
-extern const bcstring be_const_str_AudioOutputI2S;
-extern const bcstring be_const_str_has_arg;
-extern const bcstring be_const_str_bool;
-extern const bcstring be_const_str_floor;
-extern const bcstring be_const_str_read;
-extern const bcstring be_const_str_remove;
-extern const bcstring be_const_str_calldepth;
-extern const bcstring be_const_str_lower;
-extern const bcstring be_const_str_path;
-extern const bcstring be_const_str_gamma10;
-extern const bcstring be_const_str_get;
-extern const bcstring be_const_str_elif;
-extern const bcstring be_const_str__buffer;
+extern const bcstring be_const_str_AudioFileSourceFS;
+extern const bcstring be_const_str_AudioGenerator;
+extern const bcstring be_const_str_seti;
+extern const bcstring be_const_str_ceil;
+extern const bcstring be_const_str_remove_rule;
+extern const bcstring be_const_str_SERIAL_8E2;
+extern const bcstring be_const_str_get_power;
+extern const bcstring be_const_str_tolower;
+extern const bcstring be_const_str_cmd_res;
+extern const bcstring be_const_str_SERIAL_6E2;
+extern const bcstring be_const_str_add_driver;
+extern const bcstring be_const_str_getbits;
+extern const bcstring be_const_str_time_dump;
 extern const bcstring be_const_str_exec_rules;
 extern const bcstring be_const_str_pin;
-extern const bcstring be_const_str_collect;
-extern const bcstring be_const_str_enabled;
+extern const bcstring be_const_str_write8;
+extern const bcstring be_const_str_real;
+extern const bcstring be_const_str_SERIAL_8N2;
 extern const bcstring be_const_str_global;
-extern const bcstring be_const_str_acos;
-extern const bcstring be_const_str_content_stop;
-extern const bcstring be_const_str_read8;
-extern const bcstring be_const_str_wire1;
-extern const bcstring be_const_str_fromstring;
-extern const bcstring be_const_str_setitem;
-extern const bcstring be_const_str__debug_present;
-extern const bcstring be_const_str_erase;
-extern const bcstring be_const_str_i2c_enabled;
-extern const bcstring be_const_str_resize;
-extern const bcstring be_const_str_decrypt;
-extern const bcstring be_const_str_escape;
-extern const bcstring be_const_str_isnan;
+extern const bcstring be_const_str_int;
+extern const bcstring be_const_str_name;
+extern const bcstring be_const_str_millis;
+extern const bcstring be_const_str_dot_len;
+extern const bcstring be_const_str_read32;
+extern const bcstring be_const_str_rtc;
+extern const bcstring be_const_str_web_send;
+extern const bcstring be_const_str_get_string;
+extern const bcstring be_const_str_last_modified;
 extern const bcstring be_const_str_skip;
-extern const bcstring be_const_str_var;
 extern const bcstring be_const_str_dot_p;
-extern const bcstring be_const_str_write_file;
+extern const bcstring be_const_str_SERIAL_5E1;
+extern const bcstring be_const_str_tr;
 extern const bcstring be_const_str_copy;
-extern const bcstring be_const_str_str;
-extern const bcstring be_const_str_super;
-extern const bcstring be_const_str_update;
-extern const bcstring be_const_str__def;
-extern const bcstring be_const_str__drivers;
-extern const bcstring be_const_str_imax;
-extern const bcstring be_const_str_add_driver;
-extern const bcstring be_const_str_dot_len;
+extern const bcstring be_const_str_cosh;
+extern const bcstring be_const_str_get_switch;
+extern const bcstring be_const_str__debug_present;
+extern const bcstring be_const_str_floor;
+extern const bcstring be_const_str_true;
+extern const bcstring be_const_str__settings_ptr;
+extern const bcstring be_const_str_wire2;
+extern const bcstring be_const_str_try;
+extern const bcstring be_const_str_opt_eq;
+extern const bcstring be_const_str_sinh;
+extern const bcstring be_const_str_reset;
+extern const bcstring be_const_str_except;
+extern const bcstring be_const_str_search;
+extern const bcstring be_const_str_OneWire;
+extern const bcstring be_const_str_format;
+extern const bcstring be_const_str_hex;
+extern const bcstring be_const_str_nan;
+extern const bcstring be_const_str_pi;
+extern const bcstring be_const_str_cmd;
+extern const bcstring be_const_str_SERIAL_5O2;
+extern const bcstring be_const_str_add_header;
+extern const bcstring be_const_str_set_timeouts;
+extern const bcstring be_const_str_stop;
+extern const bcstring be_const_str_time_reached;
+extern const bcstring be_const_str_try_rule;
+extern const bcstring be_const_str_dot_p1;
+extern const bcstring be_const_str_begin;
+extern const bcstring be_const_str_enabled;
+extern const bcstring be_const_str_toptr;
+extern const bcstring be_const_str_add_cmd;
+extern const bcstring be_const_str_available;
+extern const bcstring be_const_str_digital_read;
+extern const bcstring be_const_str_listdir;
+extern const bcstring be_const_str_publish;
+extern const bcstring be_const_str_setrange;
+extern const bcstring be_const_str_log;
+extern const bcstring be_const_str_map;
+extern const bcstring be_const_str_finish;
+extern const bcstring be_const_str___upper__;
+extern const bcstring be_const_str_ctypes_bytes_dyn;
+extern const bcstring be_const_str_digital_write;
+extern const bcstring be_const_str_tag;
+extern const bcstring be_const_str_SERIAL_6N2;
+extern const bcstring be_const_str_chars_in_string;
+extern const bcstring be_const_str_publish_result;
+extern const bcstring be_const_str__available;
+extern const bcstring be_const_str_select;
+extern const bcstring be_const_str___lower__;
+extern const bcstring be_const_str_find_key_i;
+extern const bcstring be_const_str_atan;
+extern const bcstring be_const_str_gen_cb;
+extern const bcstring be_const_str_AudioGeneratorMP3;
+extern const bcstring be_const_str_SERIAL_5N1;
 extern const bcstring be_const_str_SERIAL_6O1;
-extern const bcstring be_const_str_attrdump;
-extern const bcstring be_const_str_on;
-extern const bcstring be_const_str_rad;
-extern const bcstring be_const_str_bus;
-extern const bcstring be_const_str_yield;
-extern const bcstring be_const_str_top;
-extern const bcstring be_const_str_get_string;
-extern const bcstring be_const_str_read_sensors;
+extern const bcstring be_const_str__end_transmission;
 extern const bcstring be_const_str_settings;
-extern const bcstring be_const_str__get_cb;
-extern const bcstring be_const_str_int;
-extern const bcstring be_const_str_opt_neq;
-extern const bcstring be_const_str_gen_cb;
-extern const bcstring be_const_str__timers;
+extern const bcstring be_const_str_wire_scan;
+extern const bcstring be_const_str_geti;
+extern const bcstring be_const_str_isnan;
+extern const bcstring be_const_str_resp_cmnd_failed;
+extern const bcstring be_const_str_has;
+extern const bcstring be_const_str_static;
+extern const bcstring be_const_str_get_light;
+extern const bcstring be_const_str_time_str;
 extern const bcstring be_const_str_continue;
-extern const bcstring be_const_str_SERIAL_7E1;
-extern const bcstring be_const_str_AudioFileSource;
-extern const bcstring be_const_str_format;
-extern const bcstring be_const_str_EC_C25519;
-extern const bcstring be_const_str_close;
-extern const bcstring be_const_str_content_flush;
-extern const bcstring be_const_str_reduce;
-extern const bcstring be_const_str_tr;
-extern const bcstring be_const_str_available;
-extern const bcstring be_const_str_traceback;
-extern const bcstring be_const_str_opt_add;
-extern const bcstring be_const_str_SERIAL_8N2;
+extern const bcstring be_const_str_bool;
+extern const bcstring be_const_str_SERIAL_8O1;
+extern const bcstring be_const_str_rand;
 extern const bcstring be_const_str_wd;
-extern const bcstring be_const_str___iterator__;
-extern const bcstring be_const_str_fromb64;
-extern const bcstring be_const_str_number;
+extern const bcstring be_const_str_if;
+extern const bcstring be_const_str_dump;
+extern const bcstring be_const_str_pop;
 extern const bcstring be_const_str_print;
-extern const bcstring be_const_str_set_useragent;
-extern const bcstring be_const_str_tan;
-extern const bcstring be_const_str_do;
-extern const bcstring be_const_str_;
+extern const bcstring be_const_str_scan;
+extern const bcstring be_const_str_toupper;
+extern const bcstring be_const_str__write;
+extern const bcstring be_const_str_target_search;
+extern const bcstring be_const_str_codedump;
+extern const bcstring be_const_str_decrypt;
+extern const bcstring be_const_str_range;
+extern const bcstring be_const_str_SERIAL_8N1;
+extern const bcstring be_const_str_depower;
+extern const bcstring be_const_str_classname;
+extern const bcstring be_const_str_top;
+extern const bcstring be_const_str_memory;
+extern const bcstring be_const_str_reverse_gamma10;
+extern const bcstring be_const_str_add_rule;
+extern const bcstring be_const_str_content_send_style;
+extern const bcstring be_const_str_content_stop;
+extern const bcstring be_const_str_resp_cmnd_error;
+extern const bcstring be_const_str_setbits;
+extern const bcstring be_const_str__begin_transmission;
+extern const bcstring be_const_str__buffer;
+extern const bcstring be_const_str_insert;
+extern const bcstring be_const_str_on;
+extern const bcstring be_const_str__global_def;
+extern const bcstring be_const_str_imax;
+extern const bcstring be_const_str_wire1;
+extern const bcstring be_const_str_elif;
+extern const bcstring be_const_str_count;
+extern const bcstring be_const_str_kv;
+extern const bcstring be_const_str_size;
+extern const bcstring be_const_str_write_bit;
+extern const bcstring be_const_str_nil;
+extern const bcstring be_const_str_reverse;
+extern const bcstring be_const_str_set_timer;
+extern const bcstring be_const_str__rule_compile;
+extern const bcstring be_const_str_calldepth;
+extern const bcstring be_const_str_path;
+extern const bcstring be_const_str_atan2;
+extern const bcstring be_const_str_issubclass;
+extern const bcstring be_const_str_check_privileged_access;
+extern const bcstring be_const_str_has_arg;
+extern const bcstring be_const_str_rad;
+extern const bcstring be_const_str_wire;
+extern const bcstring be_const_str_fromptr;
+extern const bcstring be_const_str_read12;
+extern const bcstring be_const_str_resp_cmnd;
+extern const bcstring be_const_str_dot_p2;
+extern const bcstring be_const_str_member;
+extern const bcstring be_const_str_set;
+extern const bcstring be_const_str_SERIAL_7E2;
+extern const bcstring be_const_str_setitem;
+extern const bcstring be_const_str_write;
 extern const bcstring be_const_str_opt_connect;
-extern const bcstring be_const_str__rules;
-extern const bcstring be_const_str_dot_p1;
-extern const bcstring be_const_str_find;
-extern const bcstring be_const_str_name;
-extern const bcstring be_const_str_toptr;
-extern const bcstring be_const_str_arg_name;
-extern const bcstring be_const_str_byte;
+extern const bcstring be_const_str_remove;
+extern const bcstring be_const_str__read;
 extern const bcstring be_const_str_gc;
-extern const bcstring be_const_str_count;
+extern const bcstring be_const_str__global_addr;
+extern const bcstring be_const_str_setmember;
+extern const bcstring be_const_str_MD5;
+extern const bcstring be_const_str_split;
+extern const bcstring be_const_str_raise;
+extern const bcstring be_const_str_super;
+extern const bcstring be_const_str_update;
+extern const bcstring be_const_str_push;
+extern const bcstring be_const_str_byte;
+extern const bcstring be_const_str_read8;
 extern const bcstring be_const_str_counters;
 extern const bcstring be_const_str_tob64;
-extern const bcstring be_const_str_AudioFileSourceFS;
-extern const bcstring be_const_str_get_free_heap;
-extern const bcstring be_const_str_atan2;
-extern const bcstring be_const_str_set_timeouts;
-extern const bcstring be_const_str_toupper;
-extern const bcstring be_const_str__ccmd;
-extern const bcstring be_const_str_content_send;
-extern const bcstring be_const_str_flush;
-extern const bcstring be_const_str_true;
-extern const bcstring be_const_str_detect;
+extern const bcstring be_const_str_arg_size;
+extern const bcstring be_const_str_redirect;
+extern const bcstring be_const_str_opt_add;
+extern const bcstring be_const_str_AudioFileSource;
+extern const bcstring be_const_str__get_cb;
+extern const bcstring be_const_str_lower;
+extern const bcstring be_const_str_tomap;
 extern const bcstring be_const_str_SERIAL_8O2;
-extern const bcstring be_const_str_split;
+extern const bcstring be_const_str_cb_dispatch;
+extern const bcstring be_const_str_SERIAL_5O1;
+extern const bcstring be_const_str_flush;
+extern const bcstring be_const_str_tostring;
+extern const bcstring be_const_str_as;
+extern const bcstring be_const_str_AES_GCM;
+extern const bcstring be_const_str___iterator__;
+extern const bcstring be_const_str_acos;
+extern const bcstring be_const_str_fromb64;
+extern const bcstring be_const_str_dot_size;
+extern const bcstring be_const_str_contains;
+extern const bcstring be_const_str_find_op;
+extern const bcstring be_const_str_opt_neq;
+extern const bcstring be_const_str_isrunning;
+extern const bcstring be_const_str_SERIAL_6N1;
+extern const bcstring be_const_str_char;
+extern const bcstring be_const_str_resolvecmnd;
+extern const bcstring be_const_str_SERIAL_7N1;
+extern const bcstring be_const_str_item;
+extern const bcstring be_const_str_remove_cmd;
+extern const bcstring be_const_str_while;
+extern const bcstring be_const_str_content_button;
+extern const bcstring be_const_str_ctypes_bytes;
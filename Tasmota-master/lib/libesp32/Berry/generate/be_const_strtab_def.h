@@ -1,524 +1,535 @@
-be_define_const_str(SERIAL_6N2, "SERIAL_6N2", 148562844u, 0, 10, &be_const_str__begin_transmission);
-be_define_const_str(_begin_transmission, "_begin_transmission", 2779461176u, 0, 19, &be_const_str_set_light);
-be_define_const_str(set_light, "set_light", 3176076152u, 0, 9, NULL);
-be_define_const_str(time_reached, "time_reached", 2075136773u, 0, 12, NULL);
-be_define_const_str(SERIAL_5E2, "SERIAL_5E2", 1180552854u, 0, 10, &be_const_str___lower__);
-be_define_const_str(__lower__, "__lower__", 123855590u, 0, 9, NULL);
-be_define_const_str(SERIAL_7O1, "SERIAL_7O1", 1823802675u, 0, 10, &be_const_str_getbits);
-be_define_const_str(getbits, "getbits", 3094168979u, 0, 7, &be_const_str_input);
-be_define_const_str(input, "input", 4191711099u, 0, 5, NULL);
-be_define_const_str(dot_size, ".size", 1965188224u, 0, 5, &be_const_str_publish_result);
-be_define_const_str(publish_result, "publish_result", 2013351252u, 0, 14, &be_const_str_web_send_decimal);
-be_define_const_str(web_send_decimal, "web_send_decimal", 1407210204u, 0, 16, &be_const_str_def);
-be_define_const_str(def, "def", 3310976652u, 55, 3, NULL);
-be_define_const_str(_cmd, "_cmd", 3419822142u, 0, 4, &be_const_str_begin);
-be_define_const_str(begin, "begin", 1748273790u, 0, 5, &be_const_str_resp_cmnd);
-be_define_const_str(resp_cmnd, "resp_cmnd", 2869459626u, 0, 9, NULL);
-be_define_const_str(assert, "assert", 2774883451u, 0, 6, &be_const_str_set);
-be_define_const_str(set, "set", 3324446467u, 0, 3, &be_const_str_tag);
-be_define_const_str(tag, "tag", 2516003219u, 0, 3, NULL);
-be_define_const_str(check_privileged_access, "check_privileged_access", 3692933968u, 0, 23, &be_const_str_kv);
-be_define_const_str(kv, "kv", 1497177492u, 0, 2, &be_const_str_publish);
-be_define_const_str(publish, "publish", 264247304u, 0, 7, &be_const_str_read32);
-be_define_const_str(read32, "read32", 1741276240u, 0, 6, NULL);
-be_define_const_str(load, "load", 3859241449u, 0, 4, &be_const_str_read13);
-be_define_const_str(read13, "read13", 12887293u, 0, 6, &be_const_str_search);
-be_define_const_str(search, "search", 2150836393u, 0, 6, NULL);
-be_define_const_str(dac_voltage, "dac_voltage", 1552257222u, 0, 11, &be_const_str_finish);
-be_define_const_str(finish, "finish", 1494643858u, 0, 6, &be_const_str_hex);
-be_define_const_str(hex, "hex", 4273249610u, 0, 3, &be_const_str_isinstance);
-be_define_const_str(isinstance, "isinstance", 3669352738u, 0, 10, &be_const_str_rand);
-be_define_const_str(rand, "rand", 2711325910u, 0, 4, NULL);
-be_define_const_str(POST, "POST", 1929554311u, 0, 4, &be_const_str_SERIAL_6E2);
-be_define_const_str(SERIAL_6E2, "SERIAL_6E2", 317471867u, 0, 10, NULL);
-be_define_const_str(classname, "classname", 1998589948u, 0, 9, NULL);
-be_define_const_str(_global_def, "_global_def", 646007001u, 0, 11, &be_const_str_open);
-be_define_const_str(open, "open", 3546203337u, 0, 4, &be_const_str_redirect);
-be_define_const_str(redirect, "redirect", 389758641u, 0, 8, NULL);
-be_define_const_str(AES_GCM, "AES_GCM", 3832208678u, 0, 7, &be_const_str_resp_cmnd_failed);
-be_define_const_str(resp_cmnd_failed, "resp_cmnd_failed", 2136281562u, 0, 16, &be_const_str_reverse_gamma10);
-be_define_const_str(reverse_gamma10, "reverse_gamma10", 739112262u, 0, 15, NULL);
-be_define_const_str(strftime, "strftime", 187738851u, 0, 8, NULL);
-be_define_const_str(insert, "insert", 3332609576u, 0, 6, &be_const_str_false);
-be_define_const_str(false, "false", 184981848u, 62, 5, NULL);
-be_define_const_str(arg_size, "arg_size", 3310243257u, 0, 8, &be_const_str_serial);
+be_define_const_str(imin, "imin", 2714127864u, 0, 4, &be_const_str_tanh);
+be_define_const_str(tanh, "tanh", 153638352u, 0, 4, NULL);
+be_define_const_str(SERIAL_5N2, "SERIAL_5N2", 3363364537u, 0, 10, &be_const_str_SERIAL_6O2);
+be_define_const_str(SERIAL_6O2, "SERIAL_6O2", 316486129u, 0, 10, NULL);
+be_define_const_str(I2C_Driver, "I2C_Driver", 1714501658u, 0, 10, NULL);
+be_define_const_str(_request_from, "_request_from", 3965148604u, 0, 13, &be_const_str_add);
+be_define_const_str(add, "add", 993596020u, 0, 3, NULL);
+be_define_const_str(content_start, "content_start", 2937509069u, 0, 13, NULL);
+be_define_const_str(compile, "compile", 1000265118u, 0, 7, &be_const_str_resp_cmnd_str);
+be_define_const_str(resp_cmnd_str, "resp_cmnd_str", 737845590u, 0, 13, &be_const_str_state);
+be_define_const_str(state, "state", 2016490230u, 0, 5, NULL);
+be_define_const_str(iter, "iter", 3124256359u, 0, 4, NULL);
+be_define_const_str(AudioGeneratorWAV, "AudioGeneratorWAV", 2746509368u, 0, 17, &be_const_str__timer_remove);
+be_define_const_str(_timer_remove, "_timer_remove", 3473421176u, 0, 13, &be_const_str_attrdump);
+be_define_const_str(attrdump, "attrdump", 1521571304u, 0, 8, &be_const_str_fromstring);
+be_define_const_str(fromstring, "fromstring", 610302344u, 0, 10, NULL);
+be_define_const_str(arch, "arch", 2952804297u, 0, 4, &be_const_str_bus);
+be_define_const_str(bus, "bus", 1607822841u, 0, 3, &be_const_str_serial);
 be_define_const_str(serial, "serial", 3687697785u, 0, 6, NULL);
-be_define_const_str(OneWire, "OneWire", 2298990722u, 0, 7, &be_const_str_scale_uint);
+be_define_const_str(allocated, "allocated", 429986098u, 0, 9, &be_const_str_find);
+be_define_const_str(find, "find", 3186656602u, 0, 4, NULL);
+be_define_const_str(gamma10, "gamma10", 3472052483u, 0, 7, NULL);
+be_define_const_str(erase, "erase", 1010949589u, 0, 5, &be_const_str_read13);
+be_define_const_str(read13, "read13", 12887293u, 0, 6, NULL);
+be_define_const_str(SERIAL_7O2, "SERIAL_7O2", 1840580294u, 0, 10, &be_const_str_scale_uint);
 be_define_const_str(scale_uint, "scale_uint", 3090811094u, 0, 10, NULL);
-be_define_const_str(return, "return", 2246981567u, 60, 6, NULL);
-be_define_const_str(wire, "wire", 4082753944u, 0, 4, &be_const_str_write_bytes);
-be_define_const_str(write_bytes, "write_bytes", 1227543792u, 0, 11, NULL);
-be_define_const_str(_global_addr, "_global_addr", 533766721u, 0, 12, &be_const_str_exec_tele);
-be_define_const_str(exec_tele, "exec_tele", 1020751601u, 0, 9, &be_const_str_target_search);
-be_define_const_str(target_search, "target_search", 1947846553u, 0, 13, NULL);
-be_define_const_str(gamma8, "gamma8", 3802843830u, 0, 6, &be_const_str_pi);
-be_define_const_str(pi, "pi", 1213090802u, 0, 2, &be_const_str_state);
-be_define_const_str(state, "state", 2016490230u, 0, 5, NULL);
-be_define_const_str(depower, "depower", 3563819571u, 0, 7, &be_const_str_init);
-be_define_const_str(init, "init", 380752755u, 0, 4, &be_const_str_member);
-be_define_const_str(member, "member", 719708611u, 0, 6, NULL);
-be_define_const_str(_end_transmission, "_end_transmission", 3237480400u, 0, 17, &be_const_str_digital_read);
-be_define_const_str(digital_read, "digital_read", 3585496928u, 0, 12, &be_const_str_imin);
-be_define_const_str(imin, "imin", 2714127864u, 0, 4, NULL);
-be_define_const_str(hs2rgb, "hs2rgb", 1040816349u, 0, 6, &be_const_str_keys);
-be_define_const_str(keys, "keys", 4182378701u, 0, 4, &be_const_str_real);
-be_define_const_str(real, "real", 3604983901u, 0, 4, &be_const_str_sin);
-be_define_const_str(sin, "sin", 3761252941u, 0, 3, NULL);
-be_define_const_str(SERIAL_7N1, "SERIAL_7N1", 1891060246u, 0, 10, NULL);
-be_define_const_str(ctypes_bytes, "ctypes_bytes", 3879019703u, 0, 12, &be_const_str_ctypes_bytes_dyn);
-be_define_const_str(ctypes_bytes_dyn, "ctypes_bytes_dyn", 915205307u, 0, 16, &be_const_str_raise);
-be_define_const_str(raise, "raise", 1593437475u, 70, 5, NULL);
-be_define_const_str(GET, "GET", 2531704439u, 0, 3, &be_const_str__settings_def);
-be_define_const_str(_settings_def, "_settings_def", 3775560307u, 0, 13, &be_const_str_read24);
-be_define_const_str(read24, "read24", 1808533811u, 0, 6, NULL);
-be_define_const_str(cos, "cos", 4220379804u, 0, 3, &be_const_str_remove_driver);
-be_define_const_str(remove_driver, "remove_driver", 1030243768u, 0, 13, NULL);
-be_define_const_str(_settings_ptr, "_settings_ptr", 1825772182u, 0, 13, &be_const_str_memory);
-be_define_const_str(memory, "memory", 2229924270u, 0, 6, &be_const_str_set_auth);
-be_define_const_str(set_auth, "set_auth", 1057170930u, 0, 8, NULL);
-be_define_const_str(content_send_style, "content_send_style", 1087907647u, 0, 18, &be_const_str_class);
-be_define_const_str(class, "class", 2872970239u, 57, 5, NULL);
-be_define_const_str(SERIAL_7E2, "SERIAL_7E2", 97385204u, 0, 10, &be_const_str_shared_key);
-be_define_const_str(shared_key, "shared_key", 2200833624u, 0, 10, &be_const_str_tanh);
-be_define_const_str(tanh, "tanh", 153638352u, 0, 4, &be_const_str_nil);
-be_define_const_str(nil, "nil", 228849900u, 63, 3, NULL);
-be_define_const_str(get_power, "get_power", 3009799377u, 0, 9, &be_const_str_last_modified);
-be_define_const_str(last_modified, "last_modified", 772177145u, 0, 13, &be_const_str_resolvecmnd);
-be_define_const_str(resolvecmnd, "resolvecmnd", 993361485u, 0, 11, NULL);
-be_define_const_str(_read, "_read", 346717030u, 0, 5, NULL);
-be_define_const_str(atan, "atan", 108579519u, 0, 4, &be_const_str_content_button);
-be_define_const_str(content_button, "content_button", 1956476087u, 0, 14, &be_const_str_setbits);
-be_define_const_str(setbits, "setbits", 2762408167u, 0, 7, &be_const_str_upper);
+be_define_const_str(_cb, "_cb", 4043300367u, 0, 3, &be_const_str_arg);
+be_define_const_str(arg, "arg", 1047474471u, 0, 3, &be_const_str_reduce);
+be_define_const_str(reduce, "reduce", 2002030311u, 0, 6, &be_const_str_upper);
 be_define_const_str(upper, "upper", 176974407u, 0, 5, NULL);
-be_define_const_str(contains, "contains", 1825239352u, 0, 8, &be_const_str_time_str);
-be_define_const_str(time_str, "time_str", 2613827612u, 0, 8, NULL);
-be_define_const_str(arch, "arch", 2952804297u, 0, 4, &be_const_str_fromptr);
-be_define_const_str(fromptr, "fromptr", 666189689u, 0, 7, &be_const_str_push);
-be_define_const_str(push, "push", 2272264157u, 0, 4, &be_const_str_srand);
-be_define_const_str(srand, "srand", 465518633u, 0, 5, NULL);
-be_define_const_str(geti, "geti", 2381006490u, 0, 4, &be_const_str_seti);
-be_define_const_str(seti, "seti", 1500556254u, 0, 4, NULL);
-be_define_const_str(add_cmd, "add_cmd", 3361630879u, 0, 7, &be_const_str_cmd);
-be_define_const_str(cmd, "cmd", 4136785899u, 0, 3, NULL);
-be_define_const_str(get_switch, "get_switch", 164821028u, 0, 10, &be_const_str_size);
-be_define_const_str(size, "size", 597743964u, 0, 4, NULL);
-be_define_const_str(try, "try", 2887626766u, 68, 3, NULL);
-be_define_const_str(web_send, "web_send", 2989941448u, 0, 8, &be_const_str_except);
-be_define_const_str(except, "except", 950914032u, 69, 6, NULL);
-be_define_const_str(SERIAL_5O1, "SERIAL_5O1", 3782657917u, 0, 10, &be_const_str_SERIAL_8E2);
-be_define_const_str(SERIAL_8E2, "SERIAL_8E2", 2421454473u, 0, 10, &be_const_str__available);
-be_define_const_str(_available, "_available", 1306196581u, 0, 10, NULL);
-be_define_const_str(codedump, "codedump", 1786337906u, 0, 8, &be_const_str_wire2);
-be_define_const_str(wire2, "wire2", 3229499038u, 0, 5, NULL);
-be_define_const_str(dump, "dump", 3663001223u, 0, 4, &be_const_str_exec_cmd);
-be_define_const_str(exec_cmd, "exec_cmd", 493567399u, 0, 8, NULL);
-be_define_const_str(add, "add", 993596020u, 0, 3, &be_const_str_exp);
-be_define_const_str(exp, "exp", 1923516200u, 0, 3, &be_const_str_isrunning);
-be_define_const_str(isrunning, "isrunning", 1688182268u, 0, 9, &be_const_str_remove_rule);
-be_define_const_str(remove_rule, "remove_rule", 3456211328u, 0, 11, &be_const_str_run_deferred);
-be_define_const_str(run_deferred, "run_deferred", 371594696u, 0, 12, &be_const_str_scan);
-be_define_const_str(scan, "scan", 3974641896u, 0, 4, &be_const_str_for);
+be_define_const_str(tan, "tan", 2633446552u, 0, 3, NULL);
+be_define_const_str(encrypt, "encrypt", 2194327650u, 0, 7, &be_const_str_set_auth);
+be_define_const_str(set_auth, "set_auth", 1057170930u, 0, 8, &be_const_str_webclient);
+be_define_const_str(webclient, "webclient", 4076389146u, 0, 9, NULL);
+be_define_const_str(arg_name, "arg_name", 1345046155u, 0, 8, NULL);
+be_define_const_str(concat, "concat", 4124019837u, 0, 6, NULL);
+be_define_const_str(run_rules, "run_rules", 3153424198u, 0, 9, NULL);
+be_define_const_str(deg, "deg", 3327754271u, 0, 3, &be_const_str_get);
+be_define_const_str(get, "get", 1410115415u, 0, 3, NULL);
+be_define_const_str(SERIAL_8E1, "SERIAL_8E1", 2371121616u, 0, 10, &be_const_str_delay);
+be_define_const_str(delay, "delay", 1322381784u, 0, 5, &be_const_str_shared_key);
+be_define_const_str(shared_key, "shared_key", 2200833624u, 0, 10, &be_const_str_for);
 be_define_const_str(for, "for", 2901640080u, 54, 3, NULL);
-be_define_const_str(set_timer, "set_timer", 2135414533u, 0, 9, &be_const_str_url_encode);
-be_define_const_str(url_encode, "url_encode", 528392145u, 0, 10, NULL);
-be_define_const_str(addr, "addr", 1087856498u, 0, 4, NULL);
-be_define_const_str(__upper__, "__upper__", 3612202883u, 0, 9, &be_const_str_loop);
-be_define_const_str(loop, "loop", 3723446379u, 0, 4, NULL);
-be_define_const_str(AudioGeneratorWAV, "AudioGeneratorWAV", 2746509368u, 0, 17, &be_const_str_chars_in_string);
-be_define_const_str(chars_in_string, "chars_in_string", 3148785132u, 0, 15, &be_const_str_cosh);
-be_define_const_str(cosh, "cosh", 4099687964u, 0, 4, &be_const_str_import);
+be_define_const_str(_drivers, "_drivers", 3260328985u, 0, 8, NULL);
+be_define_const_str(opt_call, "()", 685372826u, 0, 2, &be_const_str_clear);
+be_define_const_str(clear, "clear", 1550717474u, 0, 5, &be_const_str_detect);
+be_define_const_str(detect, "detect", 8884370u, 0, 6, NULL);
+be_define_const_str(response_append, "response_append", 450346371u, 0, 15, &be_const_str_strftime);
+be_define_const_str(strftime, "strftime", 187738851u, 0, 8, NULL);
+be_define_const_str(_timer_push, "_timer_push", 2147276404u, 0, 11, &be_const_str__timers);
+be_define_const_str(_timers, "_timers", 2600100916u, 0, 7, &be_const_str_import);
 be_define_const_str(import, "import", 288002260u, 66, 6, NULL);
-be_define_const_str(SERIAL_5N2, "SERIAL_5N2", 3363364537u, 0, 10, &be_const_str_type);
+be_define_const_str(SERIAL_7E1, "SERIAL_7E1", 147718061u, 0, 10, &be_const_str_i2c_enabled);
+be_define_const_str(i2c_enabled, "i2c_enabled", 218388101u, 0, 11, &be_const_str_pow);
+be_define_const_str(pow, "pow", 1479764693u, 0, 3, NULL);
+be_define_const_str(_cmd, "_cmd", 3419822142u, 0, 4, &be_const_str_gamma8);
+be_define_const_str(gamma8, "gamma8", 3802843830u, 0, 6, NULL);
+be_define_const_str(exec_cmd, "exec_cmd", 493567399u, 0, 8, &be_const_str_write_file);
+be_define_const_str(write_file, "write_file", 3177658879u, 0, 10, NULL);
+be_define_const_str(exp, "exp", 1923516200u, 0, 3, &be_const_str_run_deferred);
+be_define_const_str(run_deferred, "run_deferred", 371594696u, 0, 12, &be_const_str_set_light);
+be_define_const_str(set_light, "set_light", 3176076152u, 0, 9, NULL);
+be_define_const_str(collect, "collect", 2399039025u, 0, 7, &be_const_str_get_option);
+be_define_const_str(get_option, "get_option", 2123730033u, 0, 10, &be_const_str_open);
+be_define_const_str(open, "open", 3546203337u, 0, 4, &be_const_str_read_sensors);
+be_define_const_str(read_sensors, "read_sensors", 892689201u, 0, 12, NULL);
+be_define_const_str(end, "end", 1787721130u, 56, 3, NULL);
+be_define_const_str(SERIAL_7N2, "SERIAL_7N2", 1874282627u, 0, 10, &be_const_str__rules_match);
+be_define_const_str(_rules_match, "_rules_match", 2842366331u, 0, 12, &be_const_str_read24);
+be_define_const_str(read24, "read24", 1808533811u, 0, 6, NULL);
+be_define_const_str(web_send_decimal, "web_send_decimal", 1407210204u, 0, 16, NULL);
+be_define_const_str(, "", 2166136261u, 0, 0, &be_const_str__def);
+be_define_const_str(_def, "_def", 1985022181u, 0, 4, &be_const_str_exists);
+be_define_const_str(exists, "exists", 1002329533u, 0, 6, &be_const_str_traceback);
+be_define_const_str(traceback, "traceback", 3385188109u, 0, 9, NULL);
+be_define_const_str(escape, "escape", 2652972038u, 0, 6, &be_const_str_yield);
+be_define_const_str(yield, "yield", 1821831854u, 0, 5, &be_const_str_var);
+be_define_const_str(var, "var", 2317739966u, 64, 3, NULL);
+be_define_const_str(event, "event", 4264611999u, 0, 5, NULL);
+be_define_const_str(AudioOutputI2S, "AudioOutputI2S", 638031784u, 0, 14, &be_const_str__ptr);
+be_define_const_str(_ptr, "_ptr", 306235816u, 0, 4, &be_const_str_deinit);
+be_define_const_str(deinit, "deinit", 2345559592u, 0, 6, NULL);
+be_define_const_str(srand, "srand", 465518633u, 0, 5, NULL);
+be_define_const_str(classof, "classof", 1796577762u, 0, 7, NULL);
+be_define_const_str(_settings_def, "_settings_def", 3775560307u, 0, 13, &be_const_str_abs);
+be_define_const_str(abs, "abs", 709362235u, 0, 3, NULL);
+be_define_const_str(public_key, "public_key", 4169142980u, 0, 10, &be_const_str_do);
+be_define_const_str(do, "do", 1646057492u, 65, 2, NULL);
+be_define_const_str(read, "read", 3470762949u, 0, 4, &be_const_str_type);
 be_define_const_str(type, "type", 1361572173u, 0, 4, NULL);
-be_define_const_str(clear, "clear", 1550717474u, 0, 5, NULL);
-be_define_const_str(SERIAL_8N1, "SERIAL_8N1", 2369297235u, 0, 10, &be_const_str_issubclass);
-be_define_const_str(issubclass, "issubclass", 4078395519u, 0, 10, &be_const_str_remove_timer);
-be_define_const_str(remove_timer, "remove_timer", 4141472215u, 0, 12, &be_const_str_sinh);
+be_define_const_str(SERIAL_6E1, "SERIAL_6E1", 334249486u, 0, 10, NULL);
+be_define_const_str(EC_C25519, "EC_C25519", 95492591u, 0, 9, &be_const_str_GET);
+be_define_const_str(GET, "GET", 2531704439u, 0, 3, &be_const_str_return);
+be_define_const_str(return, "return", 2246981567u, 60, 6, NULL);
+be_define_const_str(asstring, "asstring", 1298225088u, 0, 8, &be_const_str_members);
+be_define_const_str(members, "members", 937576464u, 0, 7, &be_const_str_number);
+be_define_const_str(number, "number", 467038368u, 0, 6, &be_const_str_wifi);
+be_define_const_str(wifi, "wifi", 120087624u, 0, 4, &be_const_str_write_bytes);
+be_define_const_str(write_bytes, "write_bytes", 1227543792u, 0, 11, &be_const_str_else);
+be_define_const_str(else, "else", 3183434736u, 52, 4, NULL);
+be_define_const_str(call, "call", 3018949801u, 0, 4, &be_const_str_content_send);
+be_define_const_str(content_send, "content_send", 1673733649u, 0, 12, &be_const_str_load);
+be_define_const_str(load, "load", 3859241449u, 0, 4, &be_const_str_resize);
+be_define_const_str(resize, "resize", 3514612129u, 0, 6, NULL);
+be_define_const_str(addr, "addr", 1087856498u, 0, 4, NULL);
+be_define_const_str(SERIAL_7O1, "SERIAL_7O1", 1823802675u, 0, 10, &be_const_str_close);
+be_define_const_str(close, "close", 667630371u, 0, 5, &be_const_str_input);
+be_define_const_str(input, "input", 4191711099u, 0, 5, &be_const_str_loop);
+be_define_const_str(loop, "loop", 3723446379u, 0, 4, NULL);
+be_define_const_str(Tasmota, "Tasmota", 4047617668u, 0, 7, &be_const_str_bytes);
+be_define_const_str(bytes, "bytes", 1706151940u, 0, 5, &be_const_str_eth);
+be_define_const_str(eth, "eth", 2191266556u, 0, 3, &be_const_str_set_useragent);
+be_define_const_str(set_useragent, "set_useragent", 612237244u, 0, 13, NULL);
+be_define_const_str(get_free_heap, "get_free_heap", 625069757u, 0, 13, &be_const_str_keys);
+be_define_const_str(keys, "keys", 4182378701u, 0, 4, NULL);
+be_define_const_str(SERIAL_5E2, "SERIAL_5E2", 1180552854u, 0, 10, &be_const_str_asin);
+be_define_const_str(asin, "asin", 4272848550u, 0, 4, &be_const_str_dac_voltage);
+be_define_const_str(dac_voltage, "dac_voltage", 1552257222u, 0, 11, NULL);
+be_define_const_str(POST, "POST", 1929554311u, 0, 4, &be_const_str_remove_timer);
+be_define_const_str(remove_timer, "remove_timer", 4141472215u, 0, 12, &be_const_str_class);
+be_define_const_str(class, "class", 2872970239u, 57, 5, NULL);
+be_define_const_str(AudioOutput, "AudioOutput", 3257792048u, 0, 11, &be_const_str_Wire);
+be_define_const_str(Wire, "Wire", 1938276536u, 0, 4, NULL);
+be_define_const_str(list, "list", 217798785u, 0, 4, &be_const_str_url_encode);
+be_define_const_str(url_encode, "url_encode", 528392145u, 0, 10, NULL);
+be_define_const_str(isinstance, "isinstance", 3669352738u, 0, 10, NULL);
+be_define_const_str(cos, "cos", 4220379804u, 0, 3, &be_const_str_pin_used);
+be_define_const_str(pin_used, "pin_used", 4033854612u, 0, 8, &be_const_str_def);
+be_define_const_str(def, "def", 3310976652u, 55, 3, NULL);
+be_define_const_str(_rules_idx, "_rules_idx", 343761325u, 0, 10, &be_const_str_sin);
+be_define_const_str(sin, "sin", 3761252941u, 0, 3, NULL);
+be_define_const_str(pin_mode, "pin_mode", 3258314030u, 0, 8, NULL);
+be_define_const_str(remove_driver, "remove_driver", 1030243768u, 0, 13, &be_const_str_str);
+be_define_const_str(str, "str", 3259748752u, 0, 3, &be_const_str_break);
+be_define_const_str(break, "break", 3378807160u, 58, 5, NULL);
+be_define_const_str(exec_tele, "exec_tele", 1020751601u, 0, 9, &be_const_str_get_size);
+be_define_const_str(get_size, "get_size", 2803644713u, 0, 8, &be_const_str_reset_search);
+be_define_const_str(reset_search, "reset_search", 1350414305u, 0, 12, NULL);
+be_define_const_str(assert, "assert", 2774883451u, 0, 6, NULL);
+be_define_const_str(_timers_id, "_timers_id", 1255637444u, 0, 10, NULL);
+be_define_const_str(_ccmd, "_ccmd", 2163421413u, 0, 5, &be_const_str_hs2rgb);
+be_define_const_str(hs2rgb, "hs2rgb", 1040816349u, 0, 6, &be_const_str_module);
+be_define_const_str(module, "module", 3617558685u, 0, 6, &be_const_str_read_bytes);
+be_define_const_str(read_bytes, "read_bytes", 3576733173u, 0, 10, &be_const_str_set_power);
+be_define_const_str(set_power, "set_power", 549820893u, 0, 9, NULL);
+be_define_const_str(sqrt, "sqrt", 2112764879u, 0, 4, NULL);
+be_define_const_str(log10, "log10", 2346846000u, 0, 5, &be_const_str_save);
+be_define_const_str(save, "save", 3439296072u, 0, 4, &be_const_str_false);
+be_define_const_str(false, "false", 184981848u, 62, 5, NULL);
+be_define_const_str(_rules, "_rules", 4266217105u, 0, 6, NULL);
+be_define_const_str(dot_w, ".w", 1255414514u, 0, 2, NULL);
+be_define_const_str(content_flush, "content_flush", 214922475u, 0, 13, &be_const_str_init);
+be_define_const_str(init, "init", 380752755u, 0, 4, &be_const_str_resp_cmnd_done);
+be_define_const_str(resp_cmnd_done, "resp_cmnd_done", 2601874875u, 0, 14, NULL);
+be_define_const_str(AudioFileSourceFS, "AudioFileSourceFS", 1839147653u, 0, 17, NULL);
+be_define_const_str(AudioGenerator, "AudioGenerator", 1839297342u, 0, 14, &be_const_str_seti);
+be_define_const_str(seti, "seti", 1500556254u, 0, 4, NULL);
+be_define_const_str(ceil, "ceil", 1659167240u, 0, 4, &be_const_str_remove_rule);
+be_define_const_str(remove_rule, "remove_rule", 3456211328u, 0, 11, NULL);
+be_define_const_str(SERIAL_8E2, "SERIAL_8E2", 2421454473u, 0, 10, &be_const_str_get_power);
+be_define_const_str(get_power, "get_power", 3009799377u, 0, 9, &be_const_str_tolower);
+be_define_const_str(tolower, "tolower", 1042520049u, 0, 7, NULL);
+be_define_const_str(cmd_res, "cmd_res", 921166762u, 0, 7, NULL);
+be_define_const_str(SERIAL_6E2, "SERIAL_6E2", 317471867u, 0, 10, &be_const_str_add_driver);
+be_define_const_str(add_driver, "add_driver", 1654458371u, 0, 10, &be_const_str_getbits);
+be_define_const_str(getbits, "getbits", 3094168979u, 0, 7, &be_const_str_time_dump);
+be_define_const_str(time_dump, "time_dump", 3330410747u, 0, 9, NULL);
+be_define_const_str(exec_rules, "exec_rules", 1445221092u, 0, 10, &be_const_str_pin);
+be_define_const_str(pin, "pin", 1866532500u, 0, 3, &be_const_str_write8);
+be_define_const_str(write8, "write8", 3133991532u, 0, 6, NULL);
+be_define_const_str(real, "real", 3604983901u, 0, 4, NULL);
+be_define_const_str(SERIAL_8N2, "SERIAL_8N2", 2386074854u, 0, 10, &be_const_str_global);
+be_define_const_str(global, "global", 503252654u, 0, 6, &be_const_str_int);
+be_define_const_str(int, "int", 2515107422u, 0, 3, &be_const_str_name);
+be_define_const_str(name, "name", 2369371622u, 0, 4, NULL);
+be_define_const_str(millis, "millis", 1214679063u, 0, 6, NULL);
+be_define_const_str(dot_len, ".len", 850842136u, 0, 4, &be_const_str_read32);
+be_define_const_str(read32, "read32", 1741276240u, 0, 6, &be_const_str_rtc);
+be_define_const_str(rtc, "rtc", 1070575216u, 0, 3, &be_const_str_web_send);
+be_define_const_str(web_send, "web_send", 2989941448u, 0, 8, NULL);
+be_define_const_str(get_string, "get_string", 4195847969u, 0, 10, &be_const_str_last_modified);
+be_define_const_str(last_modified, "last_modified", 772177145u, 0, 13, NULL);
+be_define_const_str(skip, "skip", 1097563074u, 0, 4, NULL);
+be_define_const_str(dot_p, ".p", 1171526419u, 0, 2, &be_const_str_SERIAL_5E1);
+be_define_const_str(SERIAL_5E1, "SERIAL_5E1", 1163775235u, 0, 10, &be_const_str_tr);
+be_define_const_str(tr, "tr", 1195724803u, 0, 2, NULL);
+be_define_const_str(copy, "copy", 3848464964u, 0, 4, &be_const_str_cosh);
+be_define_const_str(cosh, "cosh", 4099687964u, 0, 4, &be_const_str_get_switch);
+be_define_const_str(get_switch, "get_switch", 164821028u, 0, 10, NULL);
+be_define_const_str(_debug_present, "_debug_present", 4063411725u, 0, 14, &be_const_str_floor);
+be_define_const_str(floor, "floor", 3102149661u, 0, 5, &be_const_str_true);
+be_define_const_str(true, "true", 1303515621u, 61, 4, NULL);
+be_define_const_str(_settings_ptr, "_settings_ptr", 1825772182u, 0, 13, &be_const_str_wire2);
+be_define_const_str(wire2, "wire2", 3229499038u, 0, 5, &be_const_str_try);
+be_define_const_str(try, "try", 2887626766u, 68, 3, NULL);
+be_define_const_str(opt_eq, "==", 2431966415u, 0, 2, &be_const_str_sinh);
 be_define_const_str(sinh, "sinh", 282220607u, 0, 4, NULL);
-be_define_const_str(AudioGeneratorMP3, "AudioGeneratorMP3", 2199818488u, 0, 17, &be_const_str_Wire);
-be_define_const_str(Wire, "Wire", 1938276536u, 0, 4, &be_const_str_get_light);
-be_define_const_str(get_light, "get_light", 381930476u, 0, 9, NULL);
-be_define_const_str(get_option, "get_option", 2123730033u, 0, 10, &be_const_str_list);
-be_define_const_str(list, "list", 217798785u, 0, 4, &be_const_str_stop);
-be_define_const_str(stop, "stop", 3411225317u, 0, 4, &be_const_str_try_rule);
+be_define_const_str(reset, "reset", 1695364032u, 0, 5, &be_const_str_except);
+be_define_const_str(except, "except", 950914032u, 69, 6, NULL);
+be_define_const_str(search, "search", 2150836393u, 0, 6, NULL);
+be_define_const_str(OneWire, "OneWire", 2298990722u, 0, 7, &be_const_str_format);
+be_define_const_str(format, "format", 3114108242u, 0, 6, &be_const_str_hex);
+be_define_const_str(hex, "hex", 4273249610u, 0, 3, &be_const_str_nan);
+be_define_const_str(nan, "nan", 797905850u, 0, 3, &be_const_str_pi);
+be_define_const_str(pi, "pi", 1213090802u, 0, 2, NULL);
+be_define_const_str(cmd, "cmd", 4136785899u, 0, 3, NULL);
+be_define_const_str(SERIAL_5O2, "SERIAL_5O2", 3732325060u, 0, 10, &be_const_str_add_header);
+be_define_const_str(add_header, "add_header", 927130612u, 0, 10, &be_const_str_set_timeouts);
+be_define_const_str(set_timeouts, "set_timeouts", 3732850900u, 0, 12, NULL);
+be_define_const_str(stop, "stop", 3411225317u, 0, 4, &be_const_str_time_reached);
+be_define_const_str(time_reached, "time_reached", 2075136773u, 0, 12, &be_const_str_try_rule);
 be_define_const_str(try_rule, "try_rule", 1986449405u, 0, 8, NULL);
-be_define_const_str(webclient, "webclient", 4076389146u, 0, 9, NULL);
-be_define_const_str(dot_p2, ".p2", 232398067u, 0, 3, &be_const_str_has);
-be_define_const_str(has, "has", 3988721635u, 0, 3, NULL);
-be_define_const_str(_request_from, "_request_from", 3965148604u, 0, 13, &be_const_str_setrange);
+be_define_const_str(dot_p1, ".p1", 249175686u, 0, 3, &be_const_str_begin);
+be_define_const_str(begin, "begin", 1748273790u, 0, 5, &be_const_str_enabled);
+be_define_const_str(enabled, "enabled", 49525662u, 0, 7, &be_const_str_toptr);
+be_define_const_str(toptr, "toptr", 3379847454u, 0, 5, NULL);
+be_define_const_str(add_cmd, "add_cmd", 3361630879u, 0, 7, NULL);
+be_define_const_str(available, "available", 1727918744u, 0, 9, &be_const_str_digital_read);
+be_define_const_str(digital_read, "digital_read", 3585496928u, 0, 12, &be_const_str_listdir);
+be_define_const_str(listdir, "listdir", 2005220720u, 0, 7, &be_const_str_publish);
+be_define_const_str(publish, "publish", 264247304u, 0, 7, &be_const_str_setrange);
 be_define_const_str(setrange, "setrange", 3794019032u, 0, 8, NULL);
-be_define_const_str(I2C_Driver, "I2C_Driver", 1714501658u, 0, 10, NULL);
-be_define_const_str(ceil, "ceil", 1659167240u, 0, 4, &be_const_str_else);
-be_define_const_str(else, "else", 3183434736u, 52, 4, NULL);
-be_define_const_str(concat, "concat", 4124019837u, 0, 6, &be_const_str_set_power);
-be_define_const_str(set_power, "set_power", 549820893u, 0, 9, NULL);
-be_define_const_str(tomap, "tomap", 612167626u, 0, 5, NULL);
-be_define_const_str(resp_cmnd_error, "resp_cmnd_error", 2404088863u, 0, 15, NULL);
-be_define_const_str(add_header, "add_header", 927130612u, 0, 10, &be_const_str_eth);
-be_define_const_str(eth, "eth", 2191266556u, 0, 3, &be_const_str_write_bit);
-be_define_const_str(write_bit, "write_bit", 2660990436u, 0, 9, NULL);
-be_define_const_str(exists, "exists", 1002329533u, 0, 6, &be_const_str_pow);
-be_define_const_str(pow, "pow", 1479764693u, 0, 3, &be_const_str_select);
+be_define_const_str(log, "log", 1062293841u, 0, 3, &be_const_str_map);
+be_define_const_str(map, "map", 3751997361u, 0, 3, NULL);
+be_define_const_str(finish, "finish", 1494643858u, 0, 6, NULL);
+be_define_const_str(__upper__, "__upper__", 3612202883u, 0, 9, &be_const_str_ctypes_bytes_dyn);
+be_define_const_str(ctypes_bytes_dyn, "ctypes_bytes_dyn", 915205307u, 0, 16, &be_const_str_digital_write);
+be_define_const_str(digital_write, "digital_write", 3435877979u, 0, 13, &be_const_str_tag);
+be_define_const_str(tag, "tag", 2516003219u, 0, 3, NULL);
+be_define_const_str(SERIAL_6N2, "SERIAL_6N2", 148562844u, 0, 10, &be_const_str_chars_in_string);
+be_define_const_str(chars_in_string, "chars_in_string", 3148785132u, 0, 15, &be_const_str_publish_result);
+be_define_const_str(publish_result, "publish_result", 2013351252u, 0, 14, NULL);
+be_define_const_str(_available, "_available", 1306196581u, 0, 10, &be_const_str_select);
 be_define_const_str(select, "select", 297952813u, 0, 6, NULL);
-be_define_const_str(allocated, "allocated", 429986098u, 0, 9, &be_const_str_classof);
-be_define_const_str(classof, "classof", 1796577762u, 0, 7, &be_const_str_if);
-be_define_const_str(if, "if", 959999494u, 50, 2, NULL);
-be_define_const_str(SERIAL_5E1, "SERIAL_5E1", 1163775235u, 0, 10, &be_const_str_arg);
-be_define_const_str(arg, "arg", 1047474471u, 0, 3, &be_const_str_cb_dispatch);
-be_define_const_str(cb_dispatch, "cb_dispatch", 1741510499u, 0, 11, &be_const_str_response_append);
-be_define_const_str(response_append, "response_append", 450346371u, 0, 15, NULL);
-be_define_const_str(pin_used, "pin_used", 4033854612u, 0, 8, &be_const_str_write);
-be_define_const_str(write, "write", 3190202204u, 0, 5, &be_const_str_write8);
-be_define_const_str(write8, "write8", 3133991532u, 0, 6, NULL);
-be_define_const_str(SERIAL_6O2, "SERIAL_6O2", 316486129u, 0, 10, &be_const_str_log);
-be_define_const_str(log, "log", 1062293841u, 0, 3, NULL);
-be_define_const_str(pin_mode, "pin_mode", 3258314030u, 0, 8, &be_const_str_read12);
-be_define_const_str(read12, "read12", 4291076970u, 0, 6, &be_const_str_resp_cmnd_str);
-be_define_const_str(resp_cmnd_str, "resp_cmnd_str", 737845590u, 0, 13, NULL);
-be_define_const_str(abs, "abs", 709362235u, 0, 3, &be_const_str_digital_write);
-be_define_const_str(digital_write, "digital_write", 3435877979u, 0, 13, &be_const_str_static);
-be_define_const_str(static, "static", 3532702267u, 71, 6, NULL);
-be_define_const_str(bytes, "bytes", 1706151940u, 0, 5, &be_const_str_find_op);
-be_define_const_str(find_op, "find_op", 3766713376u, 0, 7, NULL);
-be_define_const_str(call, "call", 3018949801u, 0, 4, NULL);
-be_define_const_str(cmd_res, "cmd_res", 921166762u, 0, 7, NULL);
-be_define_const_str(opt_eq, "==", 2431966415u, 0, 2, NULL);
-be_define_const_str(save, "save", 3439296072u, 0, 4, NULL);
+be_define_const_str(__lower__, "__lower__", 123855590u, 0, 9, &be_const_str_find_key_i);
 be_define_const_str(find_key_i, "find_key_i", 850136726u, 0, 10, NULL);
-be_define_const_str(_cb, "_cb", 4043300367u, 0, 3, NULL);
-be_define_const_str(Tasmota, "Tasmota", 4047617668u, 0, 7, &be_const_str_public_key);
-be_define_const_str(public_key, "public_key", 4169142980u, 0, 10, NULL);
-be_define_const_str(as, "as", 1579491469u, 67, 2, NULL);
-be_define_const_str(dot_w, ".w", 1255414514u, 0, 2, &be_const_str_SERIAL_8O1);
-be_define_const_str(SERIAL_8O1, "SERIAL_8O1", 289122742u, 0, 10, &be_const_str_compile);
-be_define_const_str(compile, "compile", 1000265118u, 0, 7, &be_const_str_range);
-be_define_const_str(range, "range", 4208725202u, 0, 5, NULL);
-be_define_const_str(add_rule, "add_rule", 596540743u, 0, 8, NULL);
-be_define_const_str(_ptr, "_ptr", 306235816u, 0, 4, &be_const_str_delay);
-be_define_const_str(delay, "delay", 1322381784u, 0, 5, &be_const_str_pop);
-be_define_const_str(pop, "pop", 1362321360u, 0, 3, &be_const_str_reset);
-be_define_const_str(reset, "reset", 1695364032u, 0, 5, &be_const_str_wire_scan);
+be_define_const_str(atan, "atan", 108579519u, 0, 4, &be_const_str_gen_cb);
+be_define_const_str(gen_cb, "gen_cb", 3245227551u, 0, 6, NULL);
+be_define_const_str(AudioGeneratorMP3, "AudioGeneratorMP3", 2199818488u, 0, 17, &be_const_str_SERIAL_5N1);
+be_define_const_str(SERIAL_5N1, "SERIAL_5N1", 3313031680u, 0, 10, &be_const_str_SERIAL_6O1);
+be_define_const_str(SERIAL_6O1, "SERIAL_6O1", 266153272u, 0, 10, &be_const_str__end_transmission);
+be_define_const_str(_end_transmission, "_end_transmission", 3237480400u, 0, 17, &be_const_str_settings);
+be_define_const_str(settings, "settings", 1745255176u, 0, 8, &be_const_str_wire_scan);
 be_define_const_str(wire_scan, "wire_scan", 2671275880u, 0, 9, NULL);
-be_define_const_str(reset_search, "reset_search", 1350414305u, 0, 12, &be_const_str_tolower);
-be_define_const_str(tolower, "tolower", 1042520049u, 0, 7, NULL);
-be_define_const_str(SERIAL_7O2, "SERIAL_7O2", 1840580294u, 0, 10, &be_const_str_asin);
-be_define_const_str(asin, "asin", 4272848550u, 0, 4, &be_const_str_nan);
-be_define_const_str(nan, "nan", 797905850u, 0, 3, NULL);
-be_define_const_str(deg, "deg", 3327754271u, 0, 3, NULL);
-be_define_const_str(log10, "log10", 2346846000u, 0, 5, NULL);
-be_define_const_str(char, "char", 2823553821u, 0, 4, &be_const_str_get_size);
-be_define_const_str(get_size, "get_size", 2803644713u, 0, 8, NULL);
-be_define_const_str(opt_call, "()", 685372826u, 0, 2, &be_const_str_end);
-be_define_const_str(end, "end", 1787721130u, 56, 3, NULL);
-be_define_const_str(SERIAL_7N2, "SERIAL_7N2", 1874282627u, 0, 10, &be_const_str_time_dump);
-be_define_const_str(time_dump, "time_dump", 3330410747u, 0, 9, NULL);
-be_define_const_str(listdir, "listdir", 2005220720u, 0, 7, &be_const_str_wifi);
-be_define_const_str(wifi, "wifi", 120087624u, 0, 4, NULL);
-be_define_const_str(read_bytes, "read_bytes", 3576733173u, 0, 10, &be_const_str_reverse);
-be_define_const_str(reverse, "reverse", 558918661u, 0, 7, NULL);
-be_define_const_str(SERIAL_6E1, "SERIAL_6E1", 334249486u, 0, 10, NULL);
-be_define_const_str(SERIAL_5O2, "SERIAL_5O2", 3732325060u, 0, 10, &be_const_str_SERIAL_8E1);
-be_define_const_str(SERIAL_8E1, "SERIAL_8E1", 2371121616u, 0, 10, &be_const_str_asstring);
-be_define_const_str(asstring, "asstring", 1298225088u, 0, 8, &be_const_str_deinit);
-be_define_const_str(deinit, "deinit", 2345559592u, 0, 6, NULL);
-be_define_const_str(encrypt, "encrypt", 2194327650u, 0, 7, NULL);
-be_define_const_str(iter, "iter", 3124256359u, 0, 4, &be_const_str_millis);
-be_define_const_str(millis, "millis", 1214679063u, 0, 6, NULL);
-be_define_const_str(AudioOutput, "AudioOutput", 3257792048u, 0, 11, &be_const_str_members);
-be_define_const_str(members, "members", 937576464u, 0, 7, &be_const_str_rtc);
-be_define_const_str(rtc, "rtc", 1070575216u, 0, 3, NULL);
-be_define_const_str(SERIAL_6N1, "SERIAL_6N1", 198895701u, 0, 10, &be_const_str__write);
-be_define_const_str(_write, "_write", 2215462825u, 0, 6, &be_const_str_content_start);
-be_define_const_str(content_start, "content_start", 2937509069u, 0, 13, &be_const_str_module);
-be_define_const_str(module, "module", 3617558685u, 0, 6, NULL);
-be_define_const_str(item, "item", 2671260646u, 0, 4, &be_const_str_remove_cmd);
-be_define_const_str(remove_cmd, "remove_cmd", 3832315702u, 0, 10, NULL);
-be_define_const_str(MD5, "MD5", 1935726387u, 0, 3, &be_const_str_sqrt);
-be_define_const_str(sqrt, "sqrt", 2112764879u, 0, 4, NULL);
-be_define_const_str(SERIAL_5N1, "SERIAL_5N1", 3313031680u, 0, 10, &be_const_str_break);
-be_define_const_str(break, "break", 3378807160u, 58, 5, NULL);
-be_define_const_str(map, "map", 3751997361u, 0, 3, &be_const_str_setmember);
-be_define_const_str(setmember, "setmember", 1432909441u, 0, 9, &be_const_str_tostring);
-be_define_const_str(tostring, "tostring", 2299708645u, 0, 8, NULL);
-be_define_const_str(AudioGenerator, "AudioGenerator", 1839297342u, 0, 14, &be_const_str_while);
-be_define_const_str(while, "while", 231090382u, 53, 5, NULL);
-be_define_const_str(event, "event", 4264611999u, 0, 5, &be_const_str_resp_cmnd_done);
-be_define_const_str(resp_cmnd_done, "resp_cmnd_done", 2601874875u, 0, 14, NULL);
-be_define_const_str(AudioOutputI2S, "AudioOutputI2S", 638031784u, 0, 14, &be_const_str_has_arg);
-be_define_const_str(has_arg, "has_arg", 424878688u, 0, 7, NULL);
-be_define_const_str(bool, "bool", 3365180733u, 0, 4, &be_const_str_floor);
-be_define_const_str(floor, "floor", 3102149661u, 0, 5, &be_const_str_read);
-be_define_const_str(read, "read", 3470762949u, 0, 4, &be_const_str_remove);
-be_define_const_str(remove, "remove", 3683784189u, 0, 6, NULL);
-be_define_const_str(calldepth, "calldepth", 3122364302u, 0, 9, &be_const_str_lower);
-be_define_const_str(lower, "lower", 3038577850u, 0, 5, &be_const_str_path);
-be_define_const_str(path, "path", 2223459638u, 0, 4, NULL);
-be_define_const_str(gamma10, "gamma10", 3472052483u, 0, 7, &be_const_str_get);
-be_define_const_str(get, "get", 1410115415u, 0, 3, &be_const_str_elif);
+be_define_const_str(geti, "geti", 2381006490u, 0, 4, &be_const_str_isnan);
+be_define_const_str(isnan, "isnan", 2981347434u, 0, 5, &be_const_str_resp_cmnd_failed);
+be_define_const_str(resp_cmnd_failed, "resp_cmnd_failed", 2136281562u, 0, 16, NULL);
+be_define_const_str(has, "has", 3988721635u, 0, 3, &be_const_str_static);
+be_define_const_str(static, "static", 3532702267u, 71, 6, NULL);
+be_define_const_str(get_light, "get_light", 381930476u, 0, 9, &be_const_str_time_str);
+be_define_const_str(time_str, "time_str", 2613827612u, 0, 8, &be_const_str_continue);
+be_define_const_str(continue, "continue", 2977070660u, 59, 8, NULL);
+be_define_const_str(bool, "bool", 3365180733u, 0, 4, NULL);
+be_define_const_str(SERIAL_8O1, "SERIAL_8O1", 289122742u, 0, 10, &be_const_str_rand);
+be_define_const_str(rand, "rand", 2711325910u, 0, 4, &be_const_str_wd);
+be_define_const_str(wd, "wd", 1531424278u, 0, 2, &be_const_str_if);
+be_define_const_str(if, "if", 959999494u, 50, 2, NULL);
+be_define_const_str(dump, "dump", 3663001223u, 0, 4, NULL);
+be_define_const_str(pop, "pop", 1362321360u, 0, 3, &be_const_str_print);
+be_define_const_str(print, "print", 372738696u, 0, 5, &be_const_str_scan);
+be_define_const_str(scan, "scan", 3974641896u, 0, 4, &be_const_str_toupper);
+be_define_const_str(toupper, "toupper", 3691983576u, 0, 7, NULL);
+be_define_const_str(_write, "_write", 2215462825u, 0, 6, &be_const_str_target_search);
+be_define_const_str(target_search, "target_search", 1947846553u, 0, 13, NULL);
+be_define_const_str(codedump, "codedump", 1786337906u, 0, 8, &be_const_str_decrypt);
+be_define_const_str(decrypt, "decrypt", 2886974618u, 0, 7, &be_const_str_range);
+be_define_const_str(range, "range", 4208725202u, 0, 5, NULL);
+be_define_const_str(SERIAL_8N1, "SERIAL_8N1", 2369297235u, 0, 10, &be_const_str_depower);
+be_define_const_str(depower, "depower", 3563819571u, 0, 7, NULL);
+be_define_const_str(classname, "classname", 1998589948u, 0, 9, &be_const_str_top);
+be_define_const_str(top, "top", 2802900028u, 0, 3, NULL);
+be_define_const_str(memory, "memory", 2229924270u, 0, 6, &be_const_str_reverse_gamma10);
+be_define_const_str(reverse_gamma10, "reverse_gamma10", 739112262u, 0, 15, NULL);
+be_define_const_str(add_rule, "add_rule", 596540743u, 0, 8, &be_const_str_content_send_style);
+be_define_const_str(content_send_style, "content_send_style", 1087907647u, 0, 18, &be_const_str_content_stop);
+be_define_const_str(content_stop, "content_stop", 658554751u, 0, 12, &be_const_str_resp_cmnd_error);
+be_define_const_str(resp_cmnd_error, "resp_cmnd_error", 2404088863u, 0, 15, &be_const_str_setbits);
+be_define_const_str(setbits, "setbits", 2762408167u, 0, 7, NULL);
+be_define_const_str(_begin_transmission, "_begin_transmission", 2779461176u, 0, 19, &be_const_str__buffer);
+be_define_const_str(_buffer, "_buffer", 2044888568u, 0, 7, &be_const_str_insert);
+be_define_const_str(insert, "insert", 3332609576u, 0, 6, &be_const_str_on);
+be_define_const_str(on, "on", 1630810064u, 0, 2, NULL);
+be_define_const_str(_global_def, "_global_def", 646007001u, 0, 11, NULL);
+be_define_const_str(imax, "imax", 3084515410u, 0, 4, NULL);
+be_define_const_str(wire1, "wire1", 3212721419u, 0, 5, &be_const_str_elif);
 be_define_const_str(elif, "elif", 3232090307u, 51, 4, NULL);
-be_define_const_str(_buffer, "_buffer", 2044888568u, 0, 7, &be_const_str_exec_rules);
-be_define_const_str(exec_rules, "exec_rules", 1445221092u, 0, 10, &be_const_str_pin);
-be_define_const_str(pin, "pin", 1866532500u, 0, 3, NULL);
-be_define_const_str(collect, "collect", 2399039025u, 0, 7, NULL);
-be_define_const_str(enabled, "enabled", 49525662u, 0, 7, &be_const_str_global);
-be_define_const_str(global, "global", 503252654u, 0, 6, NULL);
-be_define_const_str(acos, "acos", 1006755615u, 0, 4, &be_const_str_content_stop);
-be_define_const_str(content_stop, "content_stop", 658554751u, 0, 12, &be_const_str_read8);
-be_define_const_str(read8, "read8", 2802788167u, 0, 5, &be_const_str_wire1);
-be_define_const_str(wire1, "wire1", 3212721419u, 0, 5, NULL);
-be_define_const_str(fromstring, "fromstring", 610302344u, 0, 10, &be_const_str_setitem);
-be_define_const_str(setitem, "setitem", 1554834596u, 0, 7, NULL);
-be_define_const_str(_debug_present, "_debug_present", 4063411725u, 0, 14, &be_const_str_erase);
-be_define_const_str(erase, "erase", 1010949589u, 0, 5, &be_const_str_i2c_enabled);
-be_define_const_str(i2c_enabled, "i2c_enabled", 218388101u, 0, 11, &be_const_str_resize);
-be_define_const_str(resize, "resize", 3514612129u, 0, 6, NULL);
-be_define_const_str(decrypt, "decrypt", 2886974618u, 0, 7, &be_const_str_escape);
-be_define_const_str(escape, "escape", 2652972038u, 0, 6, &be_const_str_isnan);
-be_define_const_str(isnan, "isnan", 2981347434u, 0, 5, &be_const_str_skip);
-be_define_const_str(skip, "skip", 1097563074u, 0, 4, &be_const_str_var);
-be_define_const_str(var, "var", 2317739966u, 64, 3, NULL);
-be_define_const_str(dot_p, ".p", 1171526419u, 0, 2, &be_const_str_write_file);
-be_define_const_str(write_file, "write_file", 3177658879u, 0, 10, NULL);
-be_define_const_str(copy, "copy", 3848464964u, 0, 4, &be_const_str_str);
-be_define_const_str(str, "str", 3259748752u, 0, 3, &be_const_str_super);
+be_define_const_str(count, "count", 967958004u, 0, 5, &be_const_str_kv);
+be_define_const_str(kv, "kv", 1497177492u, 0, 2, &be_const_str_size);
+be_define_const_str(size, "size", 597743964u, 0, 4, &be_const_str_write_bit);
+be_define_const_str(write_bit, "write_bit", 2660990436u, 0, 9, &be_const_str_nil);
+be_define_const_str(nil, "nil", 228849900u, 63, 3, NULL);
+be_define_const_str(reverse, "reverse", 558918661u, 0, 7, &be_const_str_set_timer);
+be_define_const_str(set_timer, "set_timer", 2135414533u, 0, 9, NULL);
+be_define_const_str(_rule_compile, "_rule_compile", 320267774u, 0, 13, &be_const_str_calldepth);
+be_define_const_str(calldepth, "calldepth", 3122364302u, 0, 9, &be_const_str_path);
+be_define_const_str(path, "path", 2223459638u, 0, 4, NULL);
+be_define_const_str(atan2, "atan2", 3173440503u, 0, 5, &be_const_str_issubclass);
+be_define_const_str(issubclass, "issubclass", 4078395519u, 0, 10, NULL);
+be_define_const_str(check_privileged_access, "check_privileged_access", 3692933968u, 0, 23, &be_const_str_has_arg);
+be_define_const_str(has_arg, "has_arg", 424878688u, 0, 7, &be_const_str_rad);
+be_define_const_str(rad, "rad", 1358899048u, 0, 3, &be_const_str_wire);
+be_define_const_str(wire, "wire", 4082753944u, 0, 4, NULL);
+be_define_const_str(fromptr, "fromptr", 666189689u, 0, 7, NULL);
+be_define_const_str(read12, "read12", 4291076970u, 0, 6, &be_const_str_resp_cmnd);
+be_define_const_str(resp_cmnd, "resp_cmnd", 2869459626u, 0, 9, NULL);
+be_define_const_str(dot_p2, ".p2", 232398067u, 0, 3, &be_const_str_member);
+be_define_const_str(member, "member", 719708611u, 0, 6, &be_const_str_set);
+be_define_const_str(set, "set", 3324446467u, 0, 3, NULL);
+be_define_const_str(SERIAL_7E2, "SERIAL_7E2", 97385204u, 0, 10, &be_const_str_setitem);
+be_define_const_str(setitem, "setitem", 1554834596u, 0, 7, &be_const_str_write);
+be_define_const_str(write, "write", 3190202204u, 0, 5, NULL);
+be_define_const_str(opt_connect, "..", 2748622605u, 0, 2, &be_const_str_remove);
+be_define_const_str(remove, "remove", 3683784189u, 0, 6, NULL);
+be_define_const_str(_read, "_read", 346717030u, 0, 5, NULL);
+be_define_const_str(gc, "gc", 1042313471u, 0, 2, NULL);
+be_define_const_str(_global_addr, "_global_addr", 533766721u, 0, 12, &be_const_str_setmember);
+be_define_const_str(setmember, "setmember", 1432909441u, 0, 9, NULL);
+be_define_const_str(MD5, "MD5", 1935726387u, 0, 3, &be_const_str_split);
+be_define_const_str(split, "split", 2276994531u, 0, 5, &be_const_str_raise);
+be_define_const_str(raise, "raise", 1593437475u, 70, 5, NULL);
 be_define_const_str(super, "super", 4152230356u, 0, 5, &be_const_str_update);
 be_define_const_str(update, "update", 672109684u, 0, 6, NULL);
-be_define_const_str(_def, "_def", 1985022181u, 0, 4, &be_const_str__drivers);
-be_define_const_str(_drivers, "_drivers", 3260328985u, 0, 8, NULL);
-be_define_const_str(imax, "imax", 3084515410u, 0, 4, NULL);
-be_define_const_str(add_driver, "add_driver", 1654458371u, 0, 10, NULL);
-be_define_const_str(dot_len, ".len", 850842136u, 0, 4, &be_const_str_SERIAL_6O1);
-be_define_const_str(SERIAL_6O1, "SERIAL_6O1", 266153272u, 0, 10, &be_const_str_attrdump);
-be_define_const_str(attrdump, "attrdump", 1521571304u, 0, 8, &be_const_str_on);
-be_define_const_str(on, "on", 1630810064u, 0, 2, &be_const_str_rad);
-be_define_const_str(rad, "rad", 1358899048u, 0, 3, NULL);
-be_define_const_str(bus, "bus", 1607822841u, 0, 3, NULL);
-be_define_const_str(yield, "yield", 1821831854u, 0, 5, NULL);
-be_define_const_str(top, "top", 2802900028u, 0, 3, NULL);
-be_define_const_str(get_string, "get_string", 4195847969u, 0, 10, &be_const_str_read_sensors);
-be_define_const_str(read_sensors, "read_sensors", 892689201u, 0, 12, NULL);
-be_define_const_str(settings, "settings", 1745255176u, 0, 8, NULL);
-be_define_const_str(_get_cb, "_get_cb", 1448849122u, 0, 7, &be_const_str_int);
-be_define_const_str(int, "int", 2515107422u, 0, 3, NULL);
-be_define_const_str(opt_neq, "!=", 2428715011u, 0, 2, &be_const_str_gen_cb);
-be_define_const_str(gen_cb, "gen_cb", 3245227551u, 0, 6, NULL);
-be_define_const_str(_timers, "_timers", 2600100916u, 0, 7, &be_const_str_continue);
-be_define_const_str(continue, "continue", 2977070660u, 59, 8, NULL);
-be_define_const_str(SERIAL_7E1, "SERIAL_7E1", 147718061u, 0, 10, NULL);
-be_define_const_str(AudioFileSource, "AudioFileSource", 2959980058u, 0, 15, &be_const_str_format);
-be_define_const_str(format, "format", 3114108242u, 0, 6, NULL);
-be_define_const_str(EC_C25519, "EC_C25519", 95492591u, 0, 9, &be_const_str_close);
-be_define_const_str(close, "close", 667630371u, 0, 5, &be_const_str_content_flush);
-be_define_const_str(content_flush, "content_flush", 214922475u, 0, 13, &be_const_str_reduce);
-be_define_const_str(reduce, "reduce", 2002030311u, 0, 6, &be_const_str_tr);
-be_define_const_str(tr, "tr", 1195724803u, 0, 2, NULL);
-be_define_const_str(available, "available", 1727918744u, 0, 9, NULL);
-be_define_const_str(traceback, "traceback", 3385188109u, 0, 9, NULL);
-be_define_const_str(opt_add, "+", 772578730u, 0, 1, &be_const_str_SERIAL_8N2);
-be_define_const_str(SERIAL_8N2, "SERIAL_8N2", 2386074854u, 0, 10, &be_const_str_wd);
-be_define_const_str(wd, "wd", 1531424278u, 0, 2, NULL);
-be_define_const_str(__iterator__, "__iterator__", 3884039703u, 0, 12, &be_const_str_fromb64);
-be_define_const_str(fromb64, "fromb64", 2717019639u, 0, 7, NULL);
-be_define_const_str(number, "number", 467038368u, 0, 6, &be_const_str_print);
-be_define_const_str(print, "print", 372738696u, 0, 5, &be_const_str_set_useragent);
-be_define_const_str(set_useragent, "set_useragent", 612237244u, 0, 13, &be_const_str_tan);
-be_define_const_str(tan, "tan", 2633446552u, 0, 3, &be_const_str_do);
-be_define_const_str(do, "do", 1646057492u, 65, 2, NULL);
-be_define_const_str(, "", 2166136261u, 0, 0, &be_const_str_opt_connect);
-be_define_const_str(opt_connect, "..", 2748622605u, 0, 2, &be_const_str__rules);
-be_define_const_str(_rules, "_rules", 4266217105u, 0, 6, NULL);
-be_define_const_str(dot_p1, ".p1", 249175686u, 0, 3, &be_const_str_find);
-be_define_const_str(find, "find", 3186656602u, 0, 4, &be_const_str_name);
-be_define_const_str(name, "name", 2369371622u, 0, 4, &be_const_str_toptr);
-be_define_const_str(toptr, "toptr", 3379847454u, 0, 5, NULL);
-be_define_const_str(arg_name, "arg_name", 1345046155u, 0, 8, &be_const_str_byte);
-be_define_const_str(byte, "byte", 1683620383u, 0, 4, &be_const_str_gc);
-be_define_const_str(gc, "gc", 1042313471u, 0, 2, NULL);
-be_define_const_str(count, "count", 967958004u, 0, 5, &be_const_str_counters);
+be_define_const_str(push, "push", 2272264157u, 0, 4, NULL);
+be_define_const_str(byte, "byte", 1683620383u, 0, 4, &be_const_str_read8);
+be_define_const_str(read8, "read8", 2802788167u, 0, 5, NULL);
 be_define_const_str(counters, "counters", 4095866864u, 0, 8, &be_const_str_tob64);
 be_define_const_str(tob64, "tob64", 373777640u, 0, 5, NULL);
-be_define_const_str(AudioFileSourceFS, "AudioFileSourceFS", 1839147653u, 0, 17, &be_const_str_get_free_heap);
-be_define_const_str(get_free_heap, "get_free_heap", 625069757u, 0, 13, NULL);
-be_define_const_str(atan2, "atan2", 3173440503u, 0, 5, NULL);
-be_define_const_str(set_timeouts, "set_timeouts", 3732850900u, 0, 12, &be_const_str_toupper);
-be_define_const_str(toupper, "toupper", 3691983576u, 0, 7, NULL);
-be_define_const_str(_ccmd, "_ccmd", 2163421413u, 0, 5, &be_const_str_content_send);
-be_define_const_str(content_send, "content_send", 1673733649u, 0, 12, &be_const_str_flush);
-be_define_const_str(flush, "flush", 3002334877u, 0, 5, &be_const_str_true);
-be_define_const_str(true, "true", 1303515621u, 61, 4, NULL);
-be_define_const_str(detect, "detect", 8884370u, 0, 6, NULL);
-be_define_const_str(SERIAL_8O2, "SERIAL_8O2", 272345123u, 0, 10, &be_const_str_split);
-be_define_const_str(split, "split", 2276994531u, 0, 5, NULL);
+be_define_const_str(arg_size, "arg_size", 3310243257u, 0, 8, &be_const_str_redirect);
+be_define_const_str(redirect, "redirect", 389758641u, 0, 8, NULL);
+be_define_const_str(opt_add, "+", 772578730u, 0, 1, &be_const_str_AudioFileSource);
+be_define_const_str(AudioFileSource, "AudioFileSource", 2959980058u, 0, 15, &be_const_str__get_cb);
+be_define_const_str(_get_cb, "_get_cb", 1448849122u, 0, 7, &be_const_str_lower);
+be_define_const_str(lower, "lower", 3038577850u, 0, 5, &be_const_str_tomap);
+be_define_const_str(tomap, "tomap", 612167626u, 0, 5, NULL);
+be_define_const_str(SERIAL_8O2, "SERIAL_8O2", 272345123u, 0, 10, &be_const_str_cb_dispatch);
+be_define_const_str(cb_dispatch, "cb_dispatch", 1741510499u, 0, 11, NULL);
+be_define_const_str(SERIAL_5O1, "SERIAL_5O1", 3782657917u, 0, 10, &be_const_str_flush);
+be_define_const_str(flush, "flush", 3002334877u, 0, 5, &be_const_str_tostring);
+be_define_const_str(tostring, "tostring", 2299708645u, 0, 8, &be_const_str_as);
+be_define_const_str(as, "as", 1579491469u, 67, 2, NULL);
+be_define_const_str(AES_GCM, "AES_GCM", 3832208678u, 0, 7, NULL);
+be_define_const_str(__iterator__, "__iterator__", 3884039703u, 0, 12, &be_const_str_acos);
+be_define_const_str(acos, "acos", 1006755615u, 0, 4, &be_const_str_fromb64);
+be_define_const_str(fromb64, "fromb64", 2717019639u, 0, 7, NULL);
+be_define_const_str(dot_size, ".size", 1965188224u, 0, 5, &be_const_str_contains);
+be_define_const_str(contains, "contains", 1825239352u, 0, 8, &be_const_str_find_op);
+be_define_const_str(find_op, "find_op", 3766713376u, 0, 7, NULL);
+be_define_const_str(opt_neq, "!=", 2428715011u, 0, 2, NULL);
+be_define_const_str(isrunning, "isrunning", 1688182268u, 0, 9, NULL);
+be_define_const_str(SERIAL_6N1, "SERIAL_6N1", 198895701u, 0, 10, &be_const_str_char);
+be_define_const_str(char, "char", 2823553821u, 0, 4, &be_const_str_resolvecmnd);
+be_define_const_str(resolvecmnd, "resolvecmnd", 993361485u, 0, 11, NULL);
+be_define_const_str(SERIAL_7N1, "SERIAL_7N1", 1891060246u, 0, 10, &be_const_str_item);
+be_define_const_str(item, "item", 2671260646u, 0, 4, &be_const_str_remove_cmd);
+be_define_const_str(remove_cmd, "remove_cmd", 3832315702u, 0, 10, &be_const_str_while);
+be_define_const_str(while, "while", 231090382u, 53, 5, NULL);
+be_define_const_str(content_button, "content_button", 1956476087u, 0, 14, &be_const_str_ctypes_bytes);
+be_define_const_str(ctypes_bytes, "ctypes_bytes", 3879019703u, 0, 12, NULL);
 
 static const bstring* const m_string_table[] = {
-    (const bstring *)&be_const_str_SERIAL_6N2,
-    (const bstring *)&be_const_str_time_reached,
-    (const bstring *)&be_const_str_SERIAL_5E2,
-    (const bstring *)&be_const_str_SERIAL_7O1,
-    (const bstring *)&be_const_str_dot_size,
+    (const bstring *)&be_const_str_imin,
+    (const bstring *)&be_const_str_SERIAL_5N2,
+    (const bstring *)&be_const_str_I2C_Driver,
     NULL,
-    (const bstring *)&be_const_str__cmd,
-    (const bstring *)&be_const_str_assert,
-    (const bstring *)&be_const_str_check_privileged_access,
-    (const bstring *)&be_const_str_load,
-    (const bstring *)&be_const_str_dac_voltage,
-    (const bstring *)&be_const_str_POST,
-    (const bstring *)&be_const_str_classname,
-    (const bstring *)&be_const_str__global_def,
-    (const bstring *)&be_const_str_AES_GCM,
-    (const bstring *)&be_const_str_strftime,
-    (const bstring *)&be_const_str_insert,
-    (const bstring *)&be_const_str_arg_size,
-    (const bstring *)&be_const_str_OneWire,
-    (const bstring *)&be_const_str_return,
-    (const bstring *)&be_const_str_wire,
-    (const bstring *)&be_const_str__global_addr,
-    (const bstring *)&be_const_str_gamma8,
-    (const bstring *)&be_const_str_depower,
-    (const bstring *)&be_const_str__end_transmission,
-    (const bstring *)&be_const_str_hs2rgb,
-    (const bstring *)&be_const_str_SERIAL_7N1,
-    (const bstring *)&be_const_str_ctypes_bytes,
+    (const bstring *)&be_const_str__request_from,
+    (const bstring *)&be_const_str_content_start,
+    (const bstring *)&be_const_str_compile,
+    (const bstring *)&be_const_str_iter,
+    (const bstring *)&be_const_str_AudioGeneratorWAV,
+    (const bstring *)&be_const_str_arch,
+    (const bstring *)&be_const_str_allocated,
+    (const bstring *)&be_const_str_gamma10,
     NULL,
+    (const bstring *)&be_const_str_erase,
+    (const bstring *)&be_const_str_SERIAL_7O2,
+    (const bstring *)&be_const_str__cb,
+    (const bstring *)&be_const_str_tan,
     NULL,
+    (const bstring *)&be_const_str_encrypt,
+    (const bstring *)&be_const_str_arg_name,
+    NULL,
+    (const bstring *)&be_const_str_concat,
+    (const bstring *)&be_const_str_run_rules,
+    (const bstring *)&be_const_str_deg,
+    (const bstring *)&be_const_str_SERIAL_8E1,
+    (const bstring *)&be_const_str__drivers,
+    (const bstring *)&be_const_str_opt_call,
+    (const bstring *)&be_const_str_response_append,
+    (const bstring *)&be_const_str__timer_push,
+    (const bstring *)&be_const_str_SERIAL_7E1,
+    (const bstring *)&be_const_str__cmd,
+    (const bstring *)&be_const_str_exec_cmd,
+    (const bstring *)&be_const_str_exp,
+    (const bstring *)&be_const_str_collect,
+    (const bstring *)&be_const_str_end,
+    (const bstring *)&be_const_str_SERIAL_7N2,
+    (const bstring *)&be_const_str_web_send_decimal,
+    (const bstring *)&be_const_str_,
+    (const bstring *)&be_const_str_escape,
+    (const bstring *)&be_const_str_event,
+    (const bstring *)&be_const_str_AudioOutputI2S,
+    (const bstring *)&be_const_str_srand,
+    (const bstring *)&be_const_str_classof,
+    (const bstring *)&be_const_str__settings_def,
+    (const bstring *)&be_const_str_public_key,
+    (const bstring *)&be_const_str_read,
+    (const bstring *)&be_const_str_SERIAL_6E1,
+    (const bstring *)&be_const_str_EC_C25519,
+    (const bstring *)&be_const_str_asstring,
+    (const bstring *)&be_const_str_call,
+    (const bstring *)&be_const_str_addr,
+    (const bstring *)&be_const_str_SERIAL_7O1,
+    (const bstring *)&be_const_str_Tasmota,
+    (const bstring *)&be_const_str_get_free_heap,
+    (const bstring *)&be_const_str_SERIAL_5E2,
+    (const bstring *)&be_const_str_POST,
+    (const bstring *)&be_const_str_AudioOutput,
+    (const bstring *)&be_const_str_list,
+    (const bstring *)&be_const_str_isinstance,
     NULL,
-    (const bstring *)&be_const_str_GET,
     (const bstring *)&be_const_str_cos,
+    (const bstring *)&be_const_str__rules_idx,
+    (const bstring *)&be_const_str_pin_mode,
     NULL,
-    (const bstring *)&be_const_str__settings_ptr,
-    (const bstring *)&be_const_str_content_send_style,
-    (const bstring *)&be_const_str_SERIAL_7E2,
-    (const bstring *)&be_const_str_get_power,
-    (const bstring *)&be_const_str__read,
-    (const bstring *)&be_const_str_atan,
-    (const bstring *)&be_const_str_contains,
-    (const bstring *)&be_const_str_arch,
-    (const bstring *)&be_const_str_geti,
-    (const bstring *)&be_const_str_add_cmd,
-    (const bstring *)&be_const_str_get_switch,
+    (const bstring *)&be_const_str_remove_driver,
+    (const bstring *)&be_const_str_exec_tele,
     NULL,
-    (const bstring *)&be_const_str_try,
+    (const bstring *)&be_const_str_assert,
+    (const bstring *)&be_const_str__timers_id,
+    (const bstring *)&be_const_str__ccmd,
     NULL,
-    (const bstring *)&be_const_str_web_send,
-    (const bstring *)&be_const_str_SERIAL_5O1,
-    (const bstring *)&be_const_str_codedump,
-    (const bstring *)&be_const_str_dump,
-    (const bstring *)&be_const_str_add,
-    (const bstring *)&be_const_str_set_timer,
-    (const bstring *)&be_const_str_addr,
-    (const bstring *)&be_const_str___upper__,
-    (const bstring *)&be_const_str_AudioGeneratorWAV,
-    (const bstring *)&be_const_str_SERIAL_5N2,
-    (const bstring *)&be_const_str_clear,
-    (const bstring *)&be_const_str_SERIAL_8N1,
-    (const bstring *)&be_const_str_AudioGeneratorMP3,
-    (const bstring *)&be_const_str_get_option,
-    (const bstring *)&be_const_str_webclient,
-    (const bstring *)&be_const_str_dot_p2,
-    (const bstring *)&be_const_str__request_from,
+    (const bstring *)&be_const_str_sqrt,
+    (const bstring *)&be_const_str_log10,
+    (const bstring *)&be_const_str__rules,
+    (const bstring *)&be_const_str_dot_w,
+    (const bstring *)&be_const_str_content_flush,
     NULL,
-    (const bstring *)&be_const_str_I2C_Driver,
+    (const bstring *)&be_const_str_AudioFileSourceFS,
+    (const bstring *)&be_const_str_AudioGenerator,
     NULL,
     (const bstring *)&be_const_str_ceil,
-    (const bstring *)&be_const_str_concat,
-    (const bstring *)&be_const_str_tomap,
-    (const bstring *)&be_const_str_resp_cmnd_error,
-    (const bstring *)&be_const_str_add_header,
-    (const bstring *)&be_const_str_exists,
-    (const bstring *)&be_const_str_allocated,
-    (const bstring *)&be_const_str_SERIAL_5E1,
-    (const bstring *)&be_const_str_pin_used,
-    (const bstring *)&be_const_str_SERIAL_6O2,
-    (const bstring *)&be_const_str_pin_mode,
-    (const bstring *)&be_const_str_abs,
-    (const bstring *)&be_const_str_bytes,
-    (const bstring *)&be_const_str_call,
+    (const bstring *)&be_const_str_SERIAL_8E2,
     (const bstring *)&be_const_str_cmd_res,
+    (const bstring *)&be_const_str_SERIAL_6E2,
+    (const bstring *)&be_const_str_exec_rules,
+    (const bstring *)&be_const_str_real,
+    (const bstring *)&be_const_str_SERIAL_8N2,
+    (const bstring *)&be_const_str_millis,
+    (const bstring *)&be_const_str_dot_len,
+    (const bstring *)&be_const_str_get_string,
+    (const bstring *)&be_const_str_skip,
+    (const bstring *)&be_const_str_dot_p,
+    (const bstring *)&be_const_str_copy,
+    (const bstring *)&be_const_str__debug_present,
+    (const bstring *)&be_const_str__settings_ptr,
     (const bstring *)&be_const_str_opt_eq,
-    (const bstring *)&be_const_str_save,
-    NULL,
-    (const bstring *)&be_const_str_find_key_i,
-    (const bstring *)&be_const_str__cb,
-    (const bstring *)&be_const_str_Tasmota,
-    (const bstring *)&be_const_str_as,
-    (const bstring *)&be_const_str_dot_w,
-    (const bstring *)&be_const_str_add_rule,
-    (const bstring *)&be_const_str__ptr,
-    (const bstring *)&be_const_str_reset_search,
-    (const bstring *)&be_const_str_SERIAL_7O2,
-    (const bstring *)&be_const_str_deg,
-    (const bstring *)&be_const_str_log10,
-    (const bstring *)&be_const_str_char,
-    (const bstring *)&be_const_str_opt_call,
-    (const bstring *)&be_const_str_SERIAL_7N2,
-    (const bstring *)&be_const_str_listdir,
-    (const bstring *)&be_const_str_read_bytes,
-    (const bstring *)&be_const_str_SERIAL_6E1,
-    NULL,
+    (const bstring *)&be_const_str_reset,
+    (const bstring *)&be_const_str_search,
+    (const bstring *)&be_const_str_OneWire,
+    (const bstring *)&be_const_str_cmd,
     (const bstring *)&be_const_str_SERIAL_5O2,
+    (const bstring *)&be_const_str_stop,
+    (const bstring *)&be_const_str_dot_p1,
+    (const bstring *)&be_const_str_add_cmd,
+    (const bstring *)&be_const_str_available,
+    (const bstring *)&be_const_str_log,
+    (const bstring *)&be_const_str_finish,
+    (const bstring *)&be_const_str___upper__,
+    (const bstring *)&be_const_str_SERIAL_6N2,
+    (const bstring *)&be_const_str__available,
+    (const bstring *)&be_const_str___lower__,
+    (const bstring *)&be_const_str_atan,
+    (const bstring *)&be_const_str_AudioGeneratorMP3,
     NULL,
-    (const bstring *)&be_const_str_encrypt,
-    (const bstring *)&be_const_str_iter,
-    (const bstring *)&be_const_str_AudioOutput,
-    (const bstring *)&be_const_str_SERIAL_6N1,
-    (const bstring *)&be_const_str_item,
-    (const bstring *)&be_const_str_MD5,
-    (const bstring *)&be_const_str_SERIAL_5N1,
-    (const bstring *)&be_const_str_map,
-    (const bstring *)&be_const_str_AudioGenerator,
-    (const bstring *)&be_const_str_event,
-    (const bstring *)&be_const_str_AudioOutputI2S,
+    (const bstring *)&be_const_str_geti,
+    (const bstring *)&be_const_str_has,
+    (const bstring *)&be_const_str_get_light,
     (const bstring *)&be_const_str_bool,
-    (const bstring *)&be_const_str_calldepth,
-    (const bstring *)&be_const_str_gamma10,
-    (const bstring *)&be_const_str__buffer,
-    (const bstring *)&be_const_str_collect,
-    (const bstring *)&be_const_str_enabled,
-    (const bstring *)&be_const_str_acos,
-    (const bstring *)&be_const_str_fromstring,
-    (const bstring *)&be_const_str__debug_present,
-    (const bstring *)&be_const_str_decrypt,
-    (const bstring *)&be_const_str_dot_p,
-    (const bstring *)&be_const_str_copy,
-    (const bstring *)&be_const_str__def,
-    (const bstring *)&be_const_str_imax,
-    (const bstring *)&be_const_str_add_driver,
-    (const bstring *)&be_const_str_dot_len,
-    (const bstring *)&be_const_str_bus,
-    (const bstring *)&be_const_str_yield,
+    (const bstring *)&be_const_str_SERIAL_8O1,
+    (const bstring *)&be_const_str_dump,
+    (const bstring *)&be_const_str_pop,
+    (const bstring *)&be_const_str__write,
+    (const bstring *)&be_const_str_codedump,
+    (const bstring *)&be_const_str_SERIAL_8N1,
+    (const bstring *)&be_const_str_classname,
     NULL,
-    (const bstring *)&be_const_str_top,
-    (const bstring *)&be_const_str_get_string,
+    (const bstring *)&be_const_str_memory,
+    (const bstring *)&be_const_str_add_rule,
+    (const bstring *)&be_const_str__begin_transmission,
+    (const bstring *)&be_const_str__global_def,
+    (const bstring *)&be_const_str_imax,
+    (const bstring *)&be_const_str_wire1,
+    (const bstring *)&be_const_str_count,
+    (const bstring *)&be_const_str_reverse,
+    (const bstring *)&be_const_str__rule_compile,
+    (const bstring *)&be_const_str_atan2,
+    (const bstring *)&be_const_str_check_privileged_access,
+    (const bstring *)&be_const_str_fromptr,
+    (const bstring *)&be_const_str_read12,
+    (const bstring *)&be_const_str_dot_p2,
+    (const bstring *)&be_const_str_SERIAL_7E2,
+    (const bstring *)&be_const_str_opt_connect,
+    (const bstring *)&be_const_str__read,
+    (const bstring *)&be_const_str_gc,
     NULL,
+    (const bstring *)&be_const_str__global_addr,
     NULL,
-    (const bstring *)&be_const_str_settings,
+    (const bstring *)&be_const_str_MD5,
+    (const bstring *)&be_const_str_super,
+    (const bstring *)&be_const_str_push,
     NULL,
-    (const bstring *)&be_const_str__get_cb,
-    (const bstring *)&be_const_str_opt_neq,
-    (const bstring *)&be_const_str__timers,
-    (const bstring *)&be_const_str_SERIAL_7E1,
-    (const bstring *)&be_const_str_AudioFileSource,
-    (const bstring *)&be_const_str_EC_C25519,
-    (const bstring *)&be_const_str_available,
-    (const bstring *)&be_const_str_traceback,
+    (const bstring *)&be_const_str_byte,
+    (const bstring *)&be_const_str_counters,
+    (const bstring *)&be_const_str_arg_size,
     (const bstring *)&be_const_str_opt_add,
+    (const bstring *)&be_const_str_SERIAL_8O2,
+    NULL,
+    (const bstring *)&be_const_str_SERIAL_5O1,
+    (const bstring *)&be_const_str_AES_GCM,
     (const bstring *)&be_const_str___iterator__,
-    (const bstring *)&be_const_str_number,
-    (const bstring *)&be_const_str_,
-    (const bstring *)&be_const_str_dot_p1,
-    (const bstring *)&be_const_str_arg_name,
-    (const bstring *)&be_const_str_count,
-    (const bstring *)&be_const_str_AudioFileSourceFS,
+    (const bstring *)&be_const_str_dot_size,
     NULL,
-    (const bstring *)&be_const_str_atan2,
-    (const bstring *)&be_const_str_set_timeouts,
-    (const bstring *)&be_const_str__ccmd,
-    (const bstring *)&be_const_str_detect,
-    (const bstring *)&be_const_str_SERIAL_8O2
+    NULL,
+    (const bstring *)&be_const_str_opt_neq,
+    (const bstring *)&be_const_str_isrunning,
+    (const bstring *)&be_const_str_SERIAL_6N1,
+    (const bstring *)&be_const_str_SERIAL_7N1,
+    (const bstring *)&be_const_str_content_button
 };
 
 static const struct bconststrtab m_const_string_table = {
-    .size = 164,
-    .count = 329,
+    .size = 168,
+    .count = 336,
     .table = m_string_table
 };
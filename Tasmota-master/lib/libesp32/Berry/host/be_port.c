@@ -0,0 +1,138 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+#include "berry.h"
+#include "be_mem.h"
+#include "be_sys.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Port of the Berry library to a desktop host, using the standard
+ * library file API. Only meant to run the scripts and the benchmarks
+ * of the library with `make bench`: the directory functions are not
+ * implemented. */
+
+BERRY_API void be_writebuffer(const char *buffer, size_t length)
+{
+    be_fwrite(stdout, buffer, length);
+}
+
+BERRY_API char* be_readstring(char *buffer, size_t size)
+{
+    return be_fgets(stdin, buffer, (int)size);
+}
+
+void* be_fopen(const char *filename, const char *modes)
+{
+    return fopen(filename, modes);
+}
+
+int be_fclose(void *hfile)
+{
+    return fclose(hfile);
+}
+
+size_t be_fwrite(void *hfile, const void *buffer, size_t length)
+{
+    return fwrite(buffer, 1, length, hfile);
+}
+
+size_t be_fread(void *hfile, void *buffer, size_t length)
+{
+    return fread(buffer, 1, length, hfile);
+}
+
+char* be_fgets(void *hfile, void *buffer, int size)
+{
+    return fgets(buffer, size, hfile);
+}
+
+int be_fseek(void *hfile, long offset)
+{
+    return fseek(hfile, offset, SEEK_SET);
+}
+
+long int be_ftell(void *hfile)
+{
+    return ftell(hfile);
+}
+
+long int be_fflush(void *hfile)
+{
+    return fflush(hfile);
+}
+
+size_t be_fsize(void *hfile)
+{
+    long int size, offset = be_ftell(hfile);
+    fseek(hfile, 0L, SEEK_END);
+    size = ftell(hfile);
+    fseek(hfile, offset, SEEK_SET);
+    return size;
+}
+
+int be_isdir(const char *path)
+{
+    (void)path;
+    return 0;
+}
+
+int be_isfile(const char *path)
+{
+    return be_isexist(path);
+}
+
+int be_isexist(const char *path)
+{
+    void *fp = be_fopen(path, "r");
+    if (fp) {
+        be_fclose(fp);
+        return 1;
+    }
+    return 0;
+}
+
+char* be_getcwd(char *buf, size_t size)
+{
+    (void)buf; (void)size;
+    return NULL;
+}
+
+int be_chdir(const char *path)
+{
+    (void)path;
+    return -1;
+}
+
+int be_mkdir(const char *path)
+{
+    (void)path;
+    return -1;
+}
+
+int be_unlink(const char *filename)
+{
+    return remove(filename);
+}
+
+int be_dirfirst(bdirinfo *info, const char *path)
+{
+    (void)info; (void)path;
+    return 1;
+}
+
+int be_dirnext(bdirinfo *info)
+{
+    (void)info;
+    return 1;
+}
+
+int be_dirclose(bdirinfo *info)
+{
+    (void)info;
+    return 1;
+}
@@ -0,0 +1,45 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+#include "berry.h"
+#include <stdio.h>
+#include <time.h>
+
+/* Minimal host interpreter: runs the script given on the command line.
+ * The Tasmota configuration doesn't include the `time` module, so the
+ * processor time is exposed with the `clock()` global, in seconds. */
+
+static int l_clock(bvm *vm)
+{
+    be_pushreal(vm, (breal)clock() / CLOCKS_PER_SEC);
+    be_return(vm);
+}
+
+int main(int argc, char *argv[])
+{
+    int res;
+    bvm *vm;
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s script.be\n", argv[0]);
+        return 1;
+    }
+    vm = be_vm_new();
+    be_regfunc(vm, "clock", l_clock);
+    res = be_loadfile(vm, argv[1]);
+    if (res == BE_OK) {
+        res = be_pcall(vm, 0);
+    }
+    if (res != BE_OK) {
+        if (res == BE_EXCEPTION || res == BE_SYNTAX_ERROR) {
+            be_dumpexcept(vm);
+        } else {
+            fprintf(stderr, "error: cannot run '%s'\n", argv[1]);
+        }
+    }
+    be_vm_delete(vm);
+    return res == BE_OK ? 0 : 1;
+}
@@ -7,6 +7,7 @@
 ********************************************************************/
 #include "be_bytecode.h"
 #include "be_decoder.h"
+#include "be_code.h"
 #include "be_vector.h"
 #include "be_string.h"
 #include "be_class.h"
@@ -192,7 +193,7 @@ static void save_bytecode(bvm *vm, void *fp, bproto *proto)
     binstruction *code = proto->code, *end;
     save_long(fp, (uint32_t)proto->codesize);
     for (end = code + proto->codesize; code < end; ++code) {
-        save_long(fp, (uint32_t)*code);
+        save_long(fp, (uint32_t)IUNFUSE(*code)); /* superinstructions are not saved */
         if (forbid_gbl) {   /* we are saving only named globals, so make sure we don't save OP_GETGBL or OP_SETGBL */
             if ((uint32_t)*code == OP_GETGBL || (uint32_t)*code == OP_SETGBL) {
                 be_raise(vm, "internal_error", "GETGBL/SETGBL found when saving with named globals");
@@ -475,6 +476,7 @@ static void load_bytecode(bvm *vm, void *fp, bproto *proto, int info)
             }
             *code = ins;
         }
+        be_code_fuse(proto->code, size); /* use superinstructions */
     }
 }
 
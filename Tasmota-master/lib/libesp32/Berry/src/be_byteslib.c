@@ -741,8 +741,10 @@ static int m_fromstring(bvm *vm)
 static int m_add(bvm *vm)
 {
     int argc = be_top(vm);
-    buf_impl attr = bytes_check_data(vm, 4); /* we reserve 4 bytes anyways */
+    buf_impl attr = m_read_attributes(vm, 1);
+    /* check before resizing, the resized buffer would not be written back */
     if (attr.fixed) { be_raise(vm, BYTES_RESIZE_ERROR, BYTES_RESIZE_MESSAGE); }
+    attr = bytes_check_data(vm, 4); /* we reserve 4 bytes anyways */
     if (argc >= 2 && be_isint(vm, 2)) {
         int32_t v = be_toint(vm, 2);
         int vsize = 1;
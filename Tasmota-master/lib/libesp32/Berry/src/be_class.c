@@ -21,6 +21,22 @@
         (c)->members = be_map_new(vm);  \
     }
 
+#if BE_MEMBER_CACHE_SIZE
+#define mbrcache_entry(vm, c, name) \
+    (&(vm)->mbrcache[(((size_t)(c) >> 3) ^ ((size_t)(name) >> 2)) & (BE_MEMBER_CACHE_SIZE - 1)])
+#endif
+
+/* Forget all cached member look-ups, must be called whenever a class
+ * gets a new member or a member changes, and when objects are freed */
+void be_class_cache_clear(bvm *vm)
+{
+#if BE_MEMBER_CACHE_SIZE
+    memset(vm->mbrcache, 0, sizeof(vm->mbrcache));
+#else
+    (void)vm;
+#endif
+}
+
 bclass* be_newclass(bvm *vm, bstring *name, bclass *super)
 {
     bgcobject *gco = be_gcnew(vm, BE_CLASS, bclass);
@@ -63,6 +79,7 @@ void be_member_bind(bvm *vm, bclass *c, bstring *name, bbool var)
     set_fixed(name);
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
+    be_class_cache_clear(vm);
     restore_fixed(name);
     if (var) {
         /* this is an instance variable so we set it as MT_VARIABLE */
@@ -82,6 +99,7 @@ void be_method_bind(bvm *vm, bclass *c, bstring *name, bproto *p, bbool is_stati
     set_fixed(name);
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
+    be_class_cache_clear(vm);
     restore_fixed(name);
     var_setnil(attr);
     cl = be_newclosure(vm, p->nupvals);
@@ -98,6 +116,7 @@ void be_prim_method_bind(bvm *vm, bclass *c, bstring *name, bntvfunc f)
     set_fixed(name);
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
+    be_class_cache_clear(vm);
     restore_fixed(name);
     attr->v.nf = f;
     attr->type = MT_PRIMMETHOD;
@@ -108,6 +127,7 @@ void be_closure_method_bind(bvm *vm, bclass *c, bstring *name, bclosure *cl)
     bvalue *attr;
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
+    be_class_cache_clear(vm);
     attr->v.gc = (bgcobject*) cl;
     attr->type = MT_METHOD;
 }
@@ -132,15 +152,39 @@ int be_class_closure_count(bclass *c)
 static binstance* instance_member(bvm *vm,
     binstance *obj, bstring *name, bvalue *dst)
 {
+#if BE_MEMBER_CACHE_SIZE
+    struct bmbrcache *entry = NULL;
+    bclass *cl = obj ? obj->_class : NULL;
+    int depth = 0;
+    if (obj) {
+        entry = mbrcache_entry(vm, cl, name);
+        if (entry->cl == cl && entry->name == name) {
+            for (depth = entry->depth; depth > 0; --depth) {
+                obj = obj->super;
+            }
+            *dst = entry->value;
+            return obj;
+        }
+    }
+#endif
     for (; obj; obj = obj->super) {
         bmap *members = obj->_class->members;
         if (members) {
             bvalue *v = be_map_findstr(vm, members, name);
             if (v) {
                 *dst = *v;
+#if BE_MEMBER_CACHE_SIZE
+                entry->cl = cl;
+                entry->name = name;
+                entry->value = *v;
+                entry->depth = depth;
+#endif
                 return obj;
             }
         }
+#if BE_MEMBER_CACHE_SIZE
+        ++depth;
+#endif
     }
     var_setnil(dst);
     return NULL;
@@ -353,6 +397,7 @@ bbool be_class_setmember(bvm *vm, bclass *o, bstring *name, bvalue *src)
         bclass * obj = class_member(vm, o, name, &v);
         if (obj && !var_istype(&v, MT_VARIABLE)) {
             be_map_insertstr(vm, obj->members, name, src);
+            be_class_cache_clear(vm);
             return btrue;
         }
     }
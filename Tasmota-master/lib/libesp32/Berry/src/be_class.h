@@ -64,5 +64,6 @@ int be_instance_member(bvm *vm, binstance *obj, bstring *name, bvalue *dst);
 int be_class_member(bvm *vm, bclass *obj, bstring *name, bvalue *dst);
 bbool be_instance_setmember(bvm *vm, binstance *obj, bstring *name, bvalue *src);
 bbool be_class_setmember(bvm *vm, bclass *obj, bstring *name, bvalue *src);
+void be_class_cache_clear(bvm *vm);
 
 #endif
@@ -928,3 +928,17 @@ void be_code_raise(bfuncinfo *finfo, bexpdesc *e1, bexpdesc *e2)
 }
 
 #endif
+
+/* Replace instruction pairs with superinstructions, once the code is final.
+ * The second instruction of a pair is kept in place, so jumps to it still work */
+void be_code_fuse(binstruction *code, int size)
+{
+    binstruction *end = code + size - 1;
+    for (; code < end; ++code) {
+        bopcode op = IGET_OP(code[0]);
+        if (op >= OP_LT && op <= OP_GE && IGET_OP(code[1]) == OP_JMPF
+                && IGET_RA(code[0]) == IGET_RA(code[1])) {
+            code[0] = IFUSE_CMP(code[0]);
+        }
+    }
+}
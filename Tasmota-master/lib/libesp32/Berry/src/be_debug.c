@@ -60,6 +60,8 @@ void be_print_inst(binstruction ins, int pc)
     case OP_GETMBR: case OP_SETMBR:  case OP_GETMET:
     case OP_GETIDX: case OP_SETIDX: case OP_AND:
     case OP_OR: case OP_XOR: case OP_SHL: case OP_SHR:
+    case OP_LTJMPF: case OP_LEJMPF: case OP_EQJMPF:
+    case OP_NEJMPF: case OP_GTJMPF: case OP_GEJMPF:
         logbuf("%s\tR%d\t%c%d\t%c%d", opc2str(op), IGET_RA(ins),
                 isKB(ins) ? 'K' : 'R', IGET_RKB(ins) & KR_MASK,
                 isKC(ins) ? 'K' : 'R', IGET_RKC(ins) & KR_MASK);
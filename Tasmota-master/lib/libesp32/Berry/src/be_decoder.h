@@ -71,4 +71,10 @@ typedef enum {
     #undef OPCODE
 } bopcode;
 
+/* superinstructions fusing a compare (LT to GE) with the JMPF that follows */
+#define isfusedcmp(op)          ((op) >= OP_LTJMPF && (op) <= OP_GEJMPF)
+#define IFUSE_CMP(i)            (((i) & ~IOP_MASK) | ISET_OP(IGET_OP(i) - OP_LT + OP_LTJMPF))
+#define IUNFUSE(i)              (isfusedcmp(IGET_OP(i)) ? \
+                                 ((i) & ~IOP_MASK) | ISET_OP(IGET_OP(i) - OP_LTJMPF + OP_LT) : (i))
+
 #endif
@@ -18,6 +18,7 @@
 #include "be_module.h"
 #include "be_exec.h"
 #include "be_debug.h"
+#include <limits.h>
 
 #define GC_PAUSE    (1 << 0) /* GC will not be executed automatically */
 #define GC_HALT     (1 << 1) /* GC completely stopped */
@@ -85,7 +86,9 @@ bgcobject* be_newgcobj(bvm *vm, int type, size_t size)
     bgcobject *obj = be_malloc(vm, size);
     be_gc_auto(vm);
     var_settype(obj, (bbyte)type); /* mark the object type */
-    obj->marked = GC_WHITE; /* default gc object type is white */
+    /* default gc object type is white, objects created while the destructors
+     * run must survive the sweep that follows, it starts from the list head */
+    obj->marked = vm->gc.phase == GC_PHASE_DESTRUCT ? GC_DARK : GC_WHITE;
     obj->next = vm->gc.list; /* link to the next field */
     vm->gc.list = obj; /* insert to head */
     return obj;
@@ -100,7 +103,9 @@ bgcobject* be_gc_newstr(bvm *vm, size_t size, int islong)
     obj = be_malloc(vm, size);
     be_gc_auto(vm);
     var_settype(obj, BE_STRING); /* mark the object type to BE_STRING */
-    obj->marked = GC_WHITE; /* default string type is white */
+    /* default string type is white, the string table makes it dark
+     * when its slot is still to be swept by the collection in progress */
+    obj->marked = GC_WHITE;
     return obj;
 }
 
@@ -470,31 +475,38 @@ static void destruct_object(bvm *vm, bgcobject *obj)
     }
 }
 
-static void destruct_white(bvm *vm)
+/* call the destructors of unreachable instances, returns the remaining budget */
+static int destruct_white(bvm *vm, int budget)
 {
-    bgcobject *node = vm->gc.list;
+    bgcobject *node = vm->gc.sweep;
     /* since the destructor may allocate objects, we must first suspend the GC */
     vm->gc.status |= GC_HALT; /* mark GC is halt */
-    while (node) {
+    for (; node && budget > 0; --budget) {
         if (gc_iswhite(node)) {
             destruct_object(vm, node);
         }
         node = node->next;
     }
     vm->gc.status &= ~GC_HALT; /* reset GC halt flag */
+    vm->gc.sweep = node;
+    return budget;
 }
 
-static void delete_white(bvm *vm)
+/* free unreachable objects, returns the remaining budget */
+static int delete_white(bvm *vm, int budget)
 {
-    bgcobject *node, *prev, *next;
-    for (node = vm->gc.list, prev = node; node; node = next) {
+    bgcobject *node, *prev = vm->gc.sweepprev, *next;
+    for (node = vm->gc.sweep; node && budget > 0; node = next, --budget) {
         next = node->next;
         if (gc_iswhite(node)) {
-            if (node == vm->gc.list) { /* first node */
-                vm->gc.list = node->next;
-                prev = node->next;
-            } else { /* not first node */
+            if (prev) {
                 prev->next = next;
+            } else { /* nothing kept yet, new objects may have been added before */
+                bgcobject **link = &vm->gc.list;
+                while (*link != node) {
+                    link = &(*link)->next;
+                }
+                *link = next;
             }
             free_object(vm, node);
 #if BE_USE_PERF_COUNTERS
@@ -505,6 +517,9 @@ static void delete_white(bvm *vm)
             prev = node;
         }
     }
+    vm->gc.sweep = node;
+    vm->gc.sweepprev = prev;
+    return budget;
 }
 
 static void reset_fixedlist(bvm *vm)
@@ -517,29 +532,21 @@ static void reset_fixedlist(bvm *vm)
     }
 }
 
-void be_gc_auto(bvm *vm)
+/* tell the observability hook a step starts or ends without
+ * starting or completing the collection */
+static void gc_obs_step(bvm *vm, int event)
 {
-#if BE_USE_DEBUG_GC
-    if (vm->gc.status & GC_PAUSE) { /* force gc each time it's possible */
-        be_gc_collect(vm);
-    }
+#if BE_USE_OBSERVABILITY_HOOK
+    if (vm->obshook != NULL)
+        (*vm->obshook)(vm, event, vm->gc.steps);
 #else
-    if (vm->gc.status & GC_PAUSE && vm->gc.usage > vm->gc.threshold) {
-        be_gc_collect(vm);
-    }
+    (void)vm; (void)event;
 #endif
 }
 
-size_t be_gc_memcount(bvm *vm)
-{
-    return vm->gc.usage;
-}
-
-void be_gc_collect(bvm *vm)
+/* mark all reachable objects, then start destroying the others */
+static void gc_begin(bvm *vm)
 {
-    if (vm->gc.status & GC_HALT) {
-        return; /* the GC cannot run for some reason */
-    }
 #if BE_USE_PERF_COUNTERS
     vm->counter_gc_kept = 0;
     vm->counter_gc_freed = 0;
@@ -556,16 +563,96 @@ void be_gc_collect(bvm *vm)
     premark_fixed(vm); /* fixed objects */
     /* step 2: set unscanned objects to black */
     mark_unscanned(vm);
+    vm->gc.phase = GC_PHASE_DESTRUCT;
+    vm->gc.sweep = vm->gc.list;
+    vm->gc.steps = 0;
+}
+
+/* do the work of the collection in progress, visiting at most
+ * `budget` objects, returns true when the collection is complete */
+static bbool gc_step(bvm *vm, int budget)
+{
+    ++vm->gc.steps;
     /* step 3: destruct and delete unreachable objects */
-    destruct_white(vm);
-    delete_white(vm);
-    be_gcstrtab(vm);
+    if (vm->gc.phase == GC_PHASE_DESTRUCT) {
+        budget = destruct_white(vm, budget);
+        if (vm->gc.sweep == NULL) {
+            vm->gc.phase = GC_PHASE_SWEEP;
+            vm->gc.sweep = vm->gc.list;
+            vm->gc.sweepprev = NULL;
+        }
+    }
+    if (vm->gc.phase == GC_PHASE_SWEEP && budget > 0) {
+        budget = delete_white(vm, budget);
+        if (vm->gc.sweep == NULL) {
+            vm->gc.phase = GC_PHASE_STRTAB;
+            vm->gc.strsweep = 0;
+        }
+    }
+    if (vm->gc.phase == GC_PHASE_STRTAB && vm->gc.strsweep >= 0 && budget > 0) {
+        be_gcstrtab(vm, budget);
+    }
+    if (vm->gc.phase != GC_PHASE_DESTRUCT) {
+        be_class_cache_clear(vm); /* cached classes or names may have been freed */
+    }
+    if (vm->gc.phase != GC_PHASE_STRTAB || vm->gc.strsweep >= 0) {
+        return bfalse;
+    }
     /* step 4: reset the fixed objects */
     reset_fixedlist(vm);
+    be_mempool_trim(vm); /* release the pool chunks left unused */
+    vm->gc.phase = GC_PHASE_IDLE;
     /* step 5: calculate the next GC threshold */
     vm->gc.threshold = next_threshold(vm->gc);
 #if BE_USE_OBSERVABILITY_HOOK
     if (vm->obshook != NULL)
-        (*vm->obshook)(vm, BE_OBS_GC_END, vm->gc.usage, vm->counter_gc_kept, vm->counter_gc_freed);
+        (*vm->obshook)(vm, BE_OBS_GC_END, vm->gc.usage, vm->counter_gc_kept, vm->counter_gc_freed, vm->gc.steps);
 #endif
+    return btrue;
+}
+
+void be_gc_auto(bvm *vm)
+{
+#if BE_USE_DEBUG_GC
+    if (vm->gc.status & GC_PAUSE) { /* force gc each time it's possible */
+        be_gc_collect(vm);
+    }
+#elif BE_GC_STEP_BUDGET
+    if (vm->gc.status & GC_PAUSE && !(vm->gc.status & GC_HALT)) {
+        if (be_gc_incycle(vm)) {
+            gc_obs_step(vm, BE_OBS_GC_STEP_START);
+            if (!gc_step(vm, BE_GC_STEP_BUDGET)) {
+                gc_obs_step(vm, BE_OBS_GC_STEP_END);
+            }
+        } else if (vm->gc.usage > vm->gc.threshold) {
+            gc_begin(vm);
+            if (!gc_step(vm, BE_GC_STEP_BUDGET)) {
+                gc_obs_step(vm, BE_OBS_GC_STEP_END);
+            }
+        }
+    }
+#else
+    if (vm->gc.status & GC_PAUSE && vm->gc.usage > vm->gc.threshold) {
+        be_gc_collect(vm);
+    }
+#endif
+}
+
+size_t be_gc_memcount(bvm *vm)
+{
+    return vm->gc.usage;
+}
+
+void be_gc_collect(bvm *vm)
+{
+    if (vm->gc.status & GC_HALT) {
+        return; /* the GC cannot run for some reason */
+    }
+    /* complete the collection in progress, it only frees what was unreachable before */
+    if (be_gc_incycle(vm)) {
+        gc_obs_step(vm, BE_OBS_GC_STEP_START);
+        while (!gc_step(vm, INT_MAX));
+    }
+    gc_begin(vm);
+    while (!gc_step(vm, INT_MAX));
 }
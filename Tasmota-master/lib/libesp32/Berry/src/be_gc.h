@@ -54,6 +54,17 @@ if (!gc_isconst(o)) { \
 #define set_fixed(s)        bbool _was_fixed = be_gc_fix_set(vm, cast(bgcobject*, (s)), 1)
 #define restore_fixed(s)    be_gc_fix_set(vm, cast(bgcobject*, (s)), _was_fixed);
 
+/* phases of a collection, the objects are marked at once
+ * then destroyed and freed in steps of BE_GC_STEP_BUDGET objects */
+typedef enum {
+    GC_PHASE_IDLE = 0,  /* no collection in progress */
+    GC_PHASE_DESTRUCT,  /* calling the destructor of unreachable instances */
+    GC_PHASE_SWEEP,     /* freeing unreachable objects */
+    GC_PHASE_STRTAB     /* freeing unreachable short strings */
+} bgcphase;
+
+#define be_gc_incycle(vm)   ((vm)->gc.phase != GC_PHASE_IDLE)
+
 /* the GC mark uses bit4:0 of the `object->marked` field,
  * so other bits can be used for special flags (ex-mark). */
 typedef enum {
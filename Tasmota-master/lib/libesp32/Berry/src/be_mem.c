@@ -41,11 +41,205 @@ BERRY_API void* be_os_realloc(void *ptr, size_t size)
     return realloc(ptr, size);
 }
 
-static void* _realloc(void *ptr, size_t old_size, size_t new_size)
+#if BE_USE_MEM_POOL
+#define POOL_ALIGN              8 /* granularity of the size classes */
+#define POOL_CLASSES            ((BE_MEM_POOL_MAX_SIZE + POOL_ALIGN - 1) / POOL_ALIGN)
+#define pool_class(size)        (((size) - 1) / POOL_ALIGN)
+#define pool_issmall(size)      ((size) > 0 && (size) <= BE_MEM_POOL_MAX_SIZE)
+#define pool_header             ((sizeof(void*) + POOL_ALIGN - 1) & ~(size_t)(POOL_ALIGN - 1))
+#define pool_next(p)            (*(void**)(p)) /* chunks and free blocks are linked by their first word */
+
+/* carve a new chunk into blocks of size class `c`, returns NULL if out of memory */
+static void* pool_refill(struct bmempool *pool, int c)
+{
+    size_t bsize = ((size_t)c + 1) * POOL_ALIGN;
+    char *chunk = malloc(BE_MEM_POOL_CHUNK_SIZE), *block, *end;
+    if (chunk == NULL) {
+        return NULL;
+    }
+    pool_next(chunk) = pool->chunks[c];
+    pool->chunks[c] = chunk;
+    pool->size += BE_MEM_POOL_CHUNK_SIZE;
+    end = chunk + BE_MEM_POOL_CHUNK_SIZE - bsize;
+    for (block = chunk + pool_header; block <= end; block += bsize) {
+        pool_next(block) = pool->free[c];
+        pool->free[c] = block;
+    }
+    return pool->free[c];
+}
+
+static void* pool_alloc(struct bmempool *pool, size_t size)
+{
+    int c = pool_class(size);
+    void *block = pool->free[c];
+    if (block == NULL) {
+        block = pool_refill(pool, c);
+        if (block == NULL) {
+            return NULL;
+        }
+    }
+    pool->free[c] = pool_next(block); /* unlink the block */
+    return block;
+}
+
+static void pool_free(struct bmempool *pool, void *ptr, size_t size)
+{
+    int c = pool_class(size);
+#if BE_USE_DEBUG_GC
+    memset(ptr, 0xFF, size); /* fill the structure with invalid pointers */
+#endif
+    /* the link is in the first word, object headers start with
+     * their `next` pointer so the other fields are left untouched */
+    pool_next(ptr) = pool->free[c];
+    pool->free[c] = ptr;
+}
+
+/* allocate, resize or free a block, when one of the sizes is small */
+static void* pool_realloc(struct bmempool *pool, void *ptr, size_t old_size, size_t new_size)
+{
+    void *block = NULL;
+    if (pool_issmall(old_size) && pool_issmall(new_size)
+            && pool_class(old_size) == pool_class(new_size)) {
+        return ptr; /* same size class */
+    }
+    if (new_size) {
+        block = pool_issmall(new_size) ? pool_alloc(pool, new_size) : malloc(new_size);
+        if (block == NULL) {
+            return NULL; /* the old block is kept */
+        }
+        if (ptr) {
+            memcpy(block, ptr, old_size < new_size ? old_size : new_size);
+        }
+    }
+    if (ptr) {
+        if (pool_issmall(old_size)) {
+            pool_free(pool, ptr, old_size);
+        } else {
+            free(ptr);
+        }
+    }
+    return block;
+}
+
+/* sort a list of chunks or free blocks by address (merge sort) */
+static void* pool_sort(void *list)
+{
+    void *half[2] = { NULL, NULL }, *head = NULL, **tail = &head;
+    int i = 0;
+    if (list == NULL || pool_next(list) == NULL) {
+        return list;
+    }
+    while (list) { /* split the list, one item out of two in each half */
+        void *next = pool_next(list);
+        pool_next(list) = half[i];
+        half[i] = list;
+        list = next;
+        i ^= 1;
+    }
+    half[0] = pool_sort(half[0]);
+    half[1] = pool_sort(half[1]);
+    while (half[0] && half[1]) {
+        i = (size_t)half[1] < (size_t)half[0];
+        *tail = half[i];
+        tail = (void**)half[i];
+        half[i] = pool_next(half[i]);
+    }
+    *tail = half[0] ? half[0] : half[1];
+    return head;
+}
+
+/* Release the chunks whose blocks are all free, called at the end of a
+ * collection. The chunks and the free blocks of each size class are
+ * sorted by address, so the blocks of each chunk are found in one pass.
+ * The free blocks left are then given in address order. */
+void be_mempool_trim(bvm *vm)
+{
+    struct bmempool *pool = &vm->mempool;
+    int c;
+    for (c = 0; c < POOL_CLASSES; ++c) {
+        size_t bsize = ((size_t)c + 1) * POOL_ALIGN;
+        size_t nblocks = (BE_MEM_POOL_CHUNK_SIZE - pool_header) / bsize;
+        void **chunk, **block;
+        if (pool->free[c] == NULL) {
+            continue; /* no free block, all the chunks are used */
+        }
+        pool->chunks[c] = pool_sort(pool->chunks[c]);
+        pool->free[c] = pool_sort(pool->free[c]);
+        chunk = &pool->chunks[c];
+        block = &pool->free[c]; /* link to the first free block of the chunk */
+        while (*chunk) {
+            char *start = *chunk, *end = start + BE_MEM_POOL_CHUNK_SIZE;
+            void **link;
+            size_t count = 0;
+            while (*block && (char*)*block < start) { /* not from a chunk, leave it */
+                block = (void**)*block;
+            }
+            link = block;
+            while (*link && (char*)*link < end) { /* free blocks of this chunk */
+                link = (void**)*link;
+                ++count;
+            }
+            if (count == nblocks) { /* unlink its blocks and the chunk */
+                *block = *link;
+                *chunk = pool_next(start);
+                free(start);
+                pool->size -= BE_MEM_POOL_CHUNK_SIZE;
+            } else {
+                block = link;
+                chunk = (void**)start;
+            }
+        }
+    }
+}
+
+size_t be_mempool_size(bvm *vm)
+{
+    return vm->mempool.size;
+}
+
+void be_mempool_deleteall(bvm *vm)
+{
+    int c;
+    for (c = 0; c < POOL_CLASSES; ++c) {
+        void *chunk = vm->mempool.chunks[c];
+        while (chunk) {
+            void *next = pool_next(chunk);
+            free(chunk);
+            chunk = next;
+        }
+    }
+    memset(&vm->mempool, 0, sizeof(vm->mempool));
+}
+#else
+void be_mempool_trim(bvm *vm)
+{
+    (void)vm;
+}
+
+size_t be_mempool_size(bvm *vm)
+{
+    (void)vm;
+    return 0;
+}
+
+void be_mempool_deleteall(bvm *vm)
+{
+    (void)vm;
+}
+#endif
+
+static void* _realloc(bvm *vm, void *ptr, size_t old_size, size_t new_size)
 {
     if (old_size == new_size) { /* the block unchanged */
         return ptr;
     }
+#if BE_USE_MEM_POOL
+    if (pool_issmall(old_size) || pool_issmall(new_size)) {
+        return pool_realloc(&vm->mempool, ptr, old_size, new_size);
+    }
+#else
+    (void)vm;
+#endif
     if (ptr && new_size) { /* realloc block */
         return realloc(ptr, new_size);
     }
@@ -64,12 +258,12 @@ static void* _realloc(void *ptr, size_t old_size, size_t new_size)
 
 BERRY_API void* be_realloc(bvm *vm, void *ptr, size_t old_size, size_t new_size)
 {
-    void *block = _realloc(ptr, old_size, new_size);
+    void *block = _realloc(vm, ptr, old_size, new_size);
     if (!block && new_size) { /* allocation failure */
         vm->gc.status |= GC_ALLOC;
         be_gc_collect(vm); /* try to allocate again after GC */
         vm->gc.status &= ~GC_ALLOC;
-        block = _realloc(ptr, old_size, new_size);
+        block = _realloc(vm, ptr, old_size, new_size);
         if (!block) { /* lack of heap space */
             be_throw(vm, BE_MALLOC_FAIL);
         }
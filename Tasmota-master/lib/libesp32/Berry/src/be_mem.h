@@ -21,6 +21,9 @@ BERRY_API void* be_os_malloc(size_t size);
 BERRY_API void be_os_free(void *ptr);
 BERRY_API void* be_os_realloc(void *ptr, size_t size);
 BERRY_API void* be_realloc(bvm *vm, void *ptr, size_t old_size, size_t new_size);
+void be_mempool_trim(bvm *vm);
+size_t be_mempool_size(bvm *vm);
+void be_mempool_deleteall(bvm *vm);
 
 #ifdef __cplusplus
 }
@@ -54,4 +54,11 @@ OPCODE(CATCH),      /*  A, B, C  |   ... */
 OPCODE(RAISE),      /*  A, B, C  |   RAISE(B,C) B is code, C is description. A==0 only B provided, A==1 B and C are provided, A==2 rethrow with both parameters already on stack */
 OPCODE(CLASS),      /*  Bx       |   init class in K[Bx] */
 OPCODE(GETNGBL),    /*  A, B     |   R(A) <- GLOBAL[RK(B)] by name */
-OPCODE(SETNGBL)     /*  A, B     |   R(A) -> GLOBAL[RK(B)] by name */
+OPCODE(SETNGBL),    /*  A, B     |   R(A) -> GLOBAL[RK(B)] by name */
+/* superinstructions, in memory only: saved bytecode and solidified code use the original pair */
+OPCODE(LTJMPF),     /*  A, B, C  |   LT A, B, C then the next instruction JMPF A, sBx */
+OPCODE(LEJMPF),     /*  A, B, C  |   LE A, B, C then the next instruction JMPF A, sBx */
+OPCODE(EQJMPF),     /*  A, B, C  |   EQ A, B, C then the next instruction JMPF A, sBx */
+OPCODE(NEJMPF),     /*  A, B, C  |   NE A, B, C then the next instruction JMPF A, sBx */
+OPCODE(GTJMPF),     /*  A, B, C  |   GT A, B, C then the next instruction JMPF A, sBx */
+OPCODE(GEJMPF)      /*  A, B, C  |   GE A, B, C then the next instruction JMPF A, sBx */
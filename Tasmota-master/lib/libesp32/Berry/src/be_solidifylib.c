@@ -258,7 +258,7 @@ static void m_solidify_proto(bvm *vm, bproto *pr, const char * func_name, int bu
 
     logfmt("%*s( &(const binstruction[%2d]) {  /* code */\n", indent, "", pr->codesize);
     for (int pc = 0; pc < pr->codesize; pc++) {
-        uint32_t ins = pr->code[pc];
+        uint32_t ins = IUNFUSE(pr->code[pc]);  /* superinstructions are not solidified */
         logfmt("%*s  0x%08X,  //", indent, "", ins);
         be_print_inst(ins, pc);
         bopcode op = IGET_OP(ins);
@@ -175,6 +175,14 @@ static bstring* find_conststr(const char *str, size_t len)
 }
 #endif
 
+/* true if the collection in progress has still to sweep this slot of the string table:
+ * a string in it must be dark to be kept, it is made white again by the sweep */
+static bbool unswept_slot(bvm *vm, bstring **list)
+{
+    return be_gc_incycle(vm) && (vm->gc.phase != GC_PHASE_STRTAB
+        || list - vm->strtab.table >= vm->gc.strsweep);
+}
+
 static bstring* newshortstr(bvm *vm, const char *str, size_t len)
 {
     bstring *s;
@@ -184,11 +192,20 @@ static bstring* newshortstr(bvm *vm, const char *str, size_t len)
 
     for (s = *list; s != NULL; s = next(s)) {
         if (len == s->slen && !strncmp(str, sstr(s), len)) {
+            if (gc_iswhite(s) && unswept_slot(vm, list)) {
+                gc_setmark(s, GC_DARK); /* reached again before being swept */
+            }
             return s;
         }
     }
     s = createstrobj(vm, len, 0);
     if (s) {
+        /* the allocation may have run a GC step which resized the table */
+        size = vm->strtab.size;
+        list = vm->strtab.table + (hash & (size - 1));
+        if (unswept_slot(vm, list)) {
+            gc_setmark(s, GC_DARK); /* created after the mark, keep it until swept */
+        }
         memcpy(cast(char *, sstr(s)), str, len);
         s->extra = 0;
         s->next = cast(void*, *list);
@@ -197,7 +214,8 @@ static bstring* newshortstr(bvm *vm, const char *str, size_t len)
 #endif
         *list = s;
         vm->strtab.count++;
-        if (vm->strtab.count > size << 2) {
+        /* the slots must not move while the table is being swept */
+        if (vm->strtab.count > size << 2 && vm->gc.phase != GC_PHASE_STRTAB) {
             resize(vm, size << 1);
         }
     }
@@ -236,15 +254,19 @@ bstring *be_newstrn(bvm *vm, const char *str, size_t len)
     return be_newlongstr(vm, str, len); /* long string */
 }
 
-void be_gcstrtab(bvm *vm)
+/* Free the unreachable short strings, starting at slot `vm->gc.strsweep`
+ * and stopping after the slot where `budget` strings have been visited.
+ * Returns the remaining budget, `vm->gc.strsweep` is -1 once all done */
+int be_gcstrtab(bvm *vm, int budget)
 {
     struct bstringtable *tab = &vm->strtab;
     int size = tab->size, i;
-    for (i = 0; i < size; ++i) {
+    for (i = vm->gc.strsweep; i < size && budget > 0; ++i) {
         bstring **list = tab->table + i;
         bstring *prev = NULL, *node, *next;
         for (node = *list; node; node = next) {
             next = next(node);
+            --budget;
             if (!gc_isfixed(node) && gc_iswhite(node)) {
                 free_sstring(vm, node);
                 tab->count--;
@@ -259,9 +281,15 @@ void be_gcstrtab(bvm *vm)
             }
         }
     }
+    if (i < size) {
+        vm->gc.strsweep = i;
+        return budget;
+    }
+    vm->gc.strsweep = -1; /* done, before resizing in case it collects */
     if (tab->count < size >> 2 && size > 8) {
         resize(vm, size >> 1);
     }
+    return budget;
 }
 
 uint32_t be_strhash(const bstring *s)
@@ -49,7 +49,7 @@ int be_eqstr(bstring *s1, bstring *s2);
 bstring* be_newstr(bvm *vm, const char *str);
 bstring* be_newstrn(bvm *vm, const char *str, size_t len);
 bstring* be_newlongstr(bvm *vm, const char *str, size_t len);
-void be_gcstrtab(bvm *vm);
+int be_gcstrtab(bvm *vm, int budget);
 uint32_t be_strhash(const bstring *s);
 const char* be_str2cstr(const bstring *s);
 void be_str_setextra(bstring *s, int extra);
@@ -65,12 +65,20 @@
   #define VM_HEARTBEAT()
 #endif
 
-#define vm_exec_loop() \
+#if BE_USE_COMPUTED_GOTO && defined(__GNUC__)
+  #define vm_exec_loop() \
+        DEBUG_HOOK(); \
+        COUNTER_HOOK(); \
+        VM_HEARTBEAT(); \
+        switch (IGET_OP(ins = *vm->ip++))
+#else
+  #define vm_exec_loop() \
     loop: \
         DEBUG_HOOK(); \
         COUNTER_HOOK(); \
         VM_HEARTBEAT(); \
         switch (IGET_OP(ins = *vm->ip++))
+#endif
 
 #if BE_USE_SINGLE_FLOAT
   #define mathfunc(func)    func##f
@@ -78,8 +86,37 @@
   #define mathfunc(func)    func
 #endif
 
-#define opcase(opcode)      case OP_##opcode
-#define dispatch()          goto loop
+#if BE_USE_COMPUTED_GOTO && defined(__GNUC__)
+  /* threaded dispatch: each handler jumps directly to the next handler,
+   * the switch statement is only used to enter a new frame */
+  #define opcase(opcode)    case OP_##opcode: L_##opcode
+  #define dispatch()        do { \
+        DEBUG_HOOK(); \
+        COUNTER_HOOK(); \
+        VM_HEARTBEAT(); \
+        __extension__ ({ goto *dispatch_table[IGET_OP(ins = *vm->ip++)]; }); \
+    } while (0)
+#else
+  #define opcase(opcode)    case OP_##opcode
+  #define dispatch()        goto loop
+#endif
+
+/* compare and JMPF superinstruction, `cmp` is used when not both integers */
+#define cmpjmpf_block(op, cmp) \
+    bvalue *a = RKB(), *b = RKC(); \
+    bbool res; \
+    if (var_isint(a) && var_isint(b)) { \
+        res = ibinop(op, a, b); \
+    } else { \
+        res = cmp(vm, a, b); \
+        reg = vm->reg; \
+    } \
+    var_setbool(RA(), res); \
+    ins = *vm->ip++; /* the JMPF instruction following the compare */ \
+    COUNTER_HOOK(); \
+    if (!res) { \
+        vm->ip += IGET_sBx(ins); \
+    }
 
 #define equal_rule(op, iseq) \
     bbool res; \
@@ -493,6 +530,7 @@ BERRY_API void be_vm_delete(bvm *vm)
     if (var_istype(&vm->hook, BE_COMPTR))
         be_free(vm, var_toobj(&vm->hook), sizeof(struct bhookblock));
 #endif
+    be_mempool_deleteall(vm);
     /* free VM structure */
     be_os_free(vm);
 }
@@ -502,6 +540,13 @@ static void vm_exec(bvm *vm)
     bclosure *clos;
     bvalue *ktab, *reg;
     binstruction ins;
+#if BE_USE_COMPUTED_GOTO && defined(__GNUC__)
+    static const void *const dispatch_table[] = {
+        #define OPCODE(opc) __extension__ &&L_##opc
+        #include "be_opcodes.h"
+        #undef OPCODE
+    };
+#endif
     vm->cf->status |= BASE_FRAME;
 newframe: /* a new call frame */
     be_assert(var_isclosure(vm->cf->func));
@@ -723,6 +768,30 @@ newframe: /* a new call frame */
             var_setbool(dst, res);
             dispatch();
         }
+        opcase(LTJMPF): {
+            cmpjmpf_block(<, be_vm_islt)
+            dispatch();
+        }
+        opcase(LEJMPF): {
+            cmpjmpf_block(<=, be_vm_isle)
+            dispatch();
+        }
+        opcase(EQJMPF): {
+            cmpjmpf_block(==, be_vm_iseq)
+            dispatch();
+        }
+        opcase(NEJMPF): {
+            cmpjmpf_block(!=, be_vm_isneq)
+            dispatch();
+        }
+        opcase(GTJMPF): {
+            cmpjmpf_block(>, be_vm_isgt)
+            dispatch();
+        }
+        opcase(GEJMPF): {
+            cmpjmpf_block(>=, be_vm_isge)
+            dispatch();
+        }
         opcase(CONNECT): {
             bvalue *a = RKB(), *b = RKC();
             if (var_isint(a) && var_isint(b)) {
@@ -54,8 +54,22 @@ struct bgc {
     size_t threshold; /* he threshold of allocation for the next GC */
     bbyte steprate; /* the rate of increase in the distribution between two GCs (percentage) */
     bbyte status;
+    bbyte phase; /* phase of the collection in progress */
+    bgcobject *sweep; /* next object of `list` to destroy or sweep */
+    bgcobject *sweepprev; /* last object kept by the sweep, NULL if none yet */
+    int strsweep; /* next string table slot to sweep */
+    int steps; /* steps done by the collection in progress */
 };
 
+#if BE_USE_MEM_POOL
+/* free lists of the memory pool, one per size class of 8 bytes */
+struct bmempool {
+    void *free[(BE_MEM_POOL_MAX_SIZE + 7) / 8]; /* free blocks of each size class */
+    void *chunks[(BE_MEM_POOL_MAX_SIZE + 7) / 8]; /* chunks the blocks of each size class are carved from */
+    size_t size; /* bytes of all the chunks, used or not */
+};
+#endif
+
 struct bstringtable {
     bstring **table;
     int count; /* string count */
@@ -72,6 +86,18 @@ typedef struct {
     binstruction *ip;
 } bcallsnapshot;
 
+#if BE_MEMBER_CACHE_SIZE
+#if BE_MEMBER_CACHE_SIZE & (BE_MEMBER_CACHE_SIZE - 1)
+  #error "BE_MEMBER_CACHE_SIZE must be a power of 2"
+#endif
+struct bmbrcache {
+    bclass *cl; /* class of the instance, NULL if the entry is empty */
+    bstring *name; /* member name */
+    bvalue value; /* member found, the index for instance variables */
+    int depth; /* number of super instances up to the one holding the member */
+};
+#endif
+
 struct bupval {
     bvalue* value;
     union {
@@ -119,6 +145,12 @@ struct bvm {
     bvalue hook;
     bbyte hookmask;
 #endif
+#if BE_MEMBER_CACHE_SIZE
+    struct bmbrcache mbrcache[BE_MEMBER_CACHE_SIZE]; /* instance member look-up cache */
+#endif
+#if BE_USE_MEM_POOL
+    struct bmempool mempool; /* small blocks allocator */
+#endif
 };
 
 #define NONE_FLAG           0
@@ -403,9 +403,11 @@ typedef void(*bntvhook)(bvm *vm, bhookinfo *info);
 typedef void(*bobshook)(bvm *vm, int event, ...);
 enum beobshookevents {
   BE_OBS_GC_START,        /* start of GC, arg = allocated size */
-  BE_OBS_GC_END,          /* end of GC, arg = allocated size */
+  BE_OBS_GC_END,          /* end of GC, arg = allocated size, objects kept, objects freed, steps */
   BE_OBS_VM_HEARTBEAT,    /* VM heartbeat called every million instructions */
   BE_OBS_STACK_RESIZE_START,    /* Berry stack resized */
+  BE_OBS_GC_STEP_START,   /* a step of the GC in progress starts, arg = steps done */
+  BE_OBS_GC_STEP_END,     /* a step ends before the end of GC, arg = steps done */
 };
 
 /* FFI functions */
@@ -0,0 +1,50 @@
+/////////////////////////////////////////////////////////////////////
+// compressed by tools/unishox/compress-html-uncompressed.py
+/////////////////////////////////////////////////////////////////////
+
+const size_t HTTP_SCRIPT_CONSOL_SIZE = 1272;
+const char HTTP_SCRIPT_CONSOL_COMPRESSED[] PROGMEM = "\x33\xBF\xAF\x71\xF0\xE3\x3A\x8B\x44\x3E\x1C\x67\x51\x18\xA3\xA8\x2A\x2B\x1A\x7C"
+                             "\x3E\x84\x3A\x9F\x8E\xA6\x60\xF8\x71\x9E\x08\xC0\xBE\x0E\xB7\x39\x04\x77\x46\x1D"
+                             "\xE3\xDA\x67\x7F\x41\x9D\x58\x7C\x3E\xCF\xB3\xC0\x61\x3B\xF9\x56\x8D\x78\x2E\x8E"
+                             "\xE8\x54\x77\x81\x26\x69\x8A\x3B\xC7\x8A\x3E\x31\xC7\x74\xFB\xA3\x90\xFB\x3B\xC7"
+                             "\x82\xD3\x07\x74\x61\xF0\xF8\x72\x1D\xE3\xDA\x41\x9F\x18\xE3\xBA\x7D\x86\x72\x1F"
+                             "\x67\x78\xF0\x58\x7C\x3E\xCF\xD0\x67\x21\xF0\xFB\x3B\x64\xF8\x3C\x11\x90\xB2\xF9"
+                             "\x69\x07\x83\x46\x67\x3E\xA3\xBA\x19\xD0\xCE\xC2\x16\xCE\xF1\xE0\x10\xA2\x9F\x0F"
+                             "\xB3\xEC\xF1\x47\x4F\x07\xFC\x08\x22\xAC\x18\x7C\x38\x88\xDE\x80\x78\xF7\x1F\x01"
+                             "\x1A\x89\xE0\xF7\x30\xBC\xD6\x98\x3B\xAF\xC7\x78\xF6\xFD\xD0\xBF\xF2\x31\x61\x79"
+                             "\x9E\x0F\x76\x98\x3B\xA0\x8D\x83\x1F\x87\xCF\x71\xFE\x3F\xCF\xC7\x78\xF6\xE9\x83"
+                             "\xBA\x6C\x3F\x87\xCE\x16\x10\x47\x78\xF6\x9B\x0E\x96\x3B\x3F\x47\x74\xEF\x1E\x0F"
+                             "\x71\xB0\xF9\xCC\x7D\x11\xB0\x86\x90\x44\x2A\x2B\xA8\x61\x7D\x9A\x85\xBF\x51\xDD"
+                             "\x3B\xC7\x83\x61\xD3\x3B\xEE\xC4\x32\xF5\x5D\x30\xC5\x5F\x0F\x33\xE0\x21\xF0\xFA"
+                             "\x77\x41\x07\x2A\x2B\x3A\x7D\xD8\x86\x45\xEA\xBA\x67\xC3\xE1\xCC\x3F\x47\xE8\x8D"
+                             "\x87\x4F\x55\xD0\xBF\x1F\x0F\x87\x29\xB3\xBC\x7B\x48\x13\x38\x81\x04\x8E\x02\xCF"
+                             "\x07\xB8\xCE\xFE\x8D\xA7\x50\x87\x81\x0F\x86\xC3\xA7\xDF\x86\x67\x79\x95\x33\x65"
+                             "\x1D\x3C\x30\x2D\xA3\xBA\x76\x1E\xE3\x90\xEC\x3B\xC7\x82\xD1\x0F\x82\x1D\x3C\x2B"
+                             "\x4C\x51\xDD\x3B\xC7\x8D\x30\x77\x41\x12\x49\xF0\xF8\x71\x9D\xE3\xDA\x54\x08\xBC"
+                             "\x47\x9E\xE3\x68\x24\xE0\xA6\xD3\xA0\x4F\x87\xA8\x51\xF8\x08\xB8\x19\xDB\x3E\x1B"
+                             "\x4F\x07\xB8\x17\x38\xB7\xD3\x07\x75\x98\x3D\x0E\x59\xFA\x3F\x45\x46\x43\x1E\x18"
+                             "\x3B\xA4\xCC\xDF\x51\x7B\x05\xFC\x36\x77\x8F\xE1\xF0\xFB\x17\xC2\x33\x1B\xCC\x43"
+                             "\xEC\xEF\x1E\xD7\xE3\xE7\x31\xF4\x08\xD7\x8E\xE9\xF6\xCC\xCE\xD0\x67\x28\xF8\x7D"
+                             "\x9D\xB2\xD1\x0E\xF1\xE1\xF8\xE9\x9C\x35\xFB\xD6\x08\xFC\x4C\xB3\xBC\x7B\x74\x43"
+                             "\xE3\x3A\x05\x7E\xA2\x66\x6F\xA8\xB4\x43\xC1\x9D\xFD\x0E\x04\x7D\x8C\xFC\x3E\x7B"
+                             "\x8F\x2A\x01\x89\xC0\xA3\x3A\x09\x75\x67\x8D\x30\x77\x47\x1D\xE3\xDA\x0B\xBC\xBC"
+                             "\x9E\xE0\x41\xD5\x9F\xFF\x9F\x04\x7E\x44\x5F\x8E\x81\x85\x9E\x67\x74\xEF\x1E\x1F"
+                             "\x8F\x9C\x2C\x20\x8F\x0C\xC1\xDB\x3B\x67\x80\xA8\xF9\xE7\x40\x89\xD0\x3D\x3A\x82"
+                             "\xA1\xA7\x78\xF0\x7B\x81\x07\x9C\x13\xDA\x0A\x36\x4F\x71\xEE\x3C\x1B\x0E\x98\x31"
+                             "\xF1\xDD\x3E\xC8\x78\x99\x51\xF6\x75\x1F\x61\xF8\x10\xF8\x54\x3B\x78\x75\x57\xC5"
+                             "\xB3\xBC\x78\x36\x1D\x3C\xF8\x43\xBA\x77\x8F\x06\x01\x2B\x1F\x39\x4D\xB6\x77\x88"
+                             "\x16\x33\xC0\x49\xE8\x18\x0F\x84\x77\x42\x3B\xC7\x83\x3B\xFA\x14\x19\xF0\xF7\x8F"
+                             "\x7C\xEA\x0F\x81\x1F\xA2\x16\x28\xEE\x9D\xE3\xDA\x08\x7D\x0C\x73\xA5\x88\x21\x33"
+                             "\x37\xD4\x41\x6F\xA9\xF3\xF9\xDD\x3E\xCD\x19\x90\x98\x3F\xC7\xD9\xD4\x08\xFC\x6F"
+                             "\x02\x0F\x19\xA0\x87\x89\x1D\x41\x9F\x19\xD0\xD1\x99\x10\x78\x23\x3C\x69\x83\xBA"
+                             "\x72\xFE\x7C\x3E\x10\x67\xF8\xFF\x1C\xC6\x7C\x3E\x10\x67\x78\xF6\x8E\x3A\x58\xBA"
+                             "\xC0\xF0\x68\xC0\x9D\x33\xE1\xF7\x86\x0C\x1F\x67\x83\xDC\x72\xFE\x7C\x3E\x10\x67"
+                             "\x68\xEE\x9D\xB3\xB6\x1F\x1F\x82\x83\x04\x2E\x72\x8F\xD1\xFA\x3B\xA1\xF1\xF0\x11"
+                             "\x25\x9D\xE3\xA8\x70\x21\x73\xFC\x28\x33\xDE\x0F\x8E\xB3\x90\xF7\xCF\xF1\xFE\x3E"
+                             "\xCF\xB3\xBC\x79\xE3\x3E\x1F\x08\x33\xB4\x77\x4E\x33\xF0\xEB\x3A\xC8\x3E\x04\x1C"
+                             "\x40\xE3\x20\x53\xC2\x0E\x4B\x3E\x1F\x08\x33\xF4\x7E\x8E\xE8\x22\x66\x27\xE1\xC8"
+                             "\x8F\xD1\xFA\x21\x41\x9D\x06\x60\xC3\xBA\x77\x8E\xA1\x41\x9D\x05\xF0\x20\xF4\x15"
+                             "\x01\x0B\x1C\x3B\xC7\x50\x7C\x7C\x38\xCE\xF1\xEE\x3B\xC7\x83\xDC\x43\xE1\x1D\xD1"
+                             "\x47\x78\xF0";
+
+#define  HTTP_SCRIPT_CONSOL       Decompress(HTTP_SCRIPT_CONSOL_COMPRESSED,HTTP_SCRIPT_CONSOL_SIZE).c_str()
\ No newline at end of file
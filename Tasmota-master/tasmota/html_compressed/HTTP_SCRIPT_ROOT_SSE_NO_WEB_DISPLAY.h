@@ -2,23 +2,32 @@
 // compressed by tools/unishox/compress-html-uncompressed.py
 /////////////////////////////////////////////////////////////////////
 
-const size_t HTTP_SCRIPT_ROOT_SIZE = 444;
-const char HTTP_SCRIPT_ROOT_COMPRESSED[] PROGMEM = "\x30\x2F\x83\xAD\xCE\x41\x59\xDD\x18\x77\x8F\x6E\x98\x3B\xB4\x64\x31\xE1\x83\xBA"
-                             "\x4C\xCD\xF5\x17\xB0\x5F\xC3\x67\x78\xFE\x1F\x0F\x87\xB0\x5F\x08\xCC\x6F\x31\x0F"
-                             "\x61\xDE\x3D\xA6\x77\xF4\xCF\x9C\xC7\xD0\x23\x60\x47\x74\xFB\x3B\x43\x4F\x87\x21"
-                             "\xF6\x77\x8F\x04\xCE\x99\xC3\x5F\xBD\x63\xCC\xF8\x08\x79\xD9\xDD\x66\x6F\xA8\xEF"
-                             "\x1E\xD6\x38\xEE\x9F\x61\x1C\x87\xD9\xDE\x3A\x16\xF7\x3F\x90\xA2\xA2\x1A\x41\x1F"
-                             "\x19\x9B\xEA\x3A\x09\x75\x67\x4F\xB1\x81\x58\x6C\xEE\x9D\x87\xB6\x8F\x71\xD8\x3C"
-                             "\x75\x1E\xC3\xD2\xAC\x70\x4D\x7A\x8C\x82\x67\xC3\xEC\x7F\x44\xA1\x47\x99\xC8\xD9"
-                             "\xF4\x7D\x1F\x67\xE1\xEC\x3B\xC4\x08\xD8\x57\x81\x0B\x0A\xF9\xF8\x7A\x50\xA0\x49"
-                             "\xAE\x34\x10\x6B\x9D\x94\x28\xFC\x3D\x28\x40\x49\xC9\xCE\x53\x21\x86\xC3\xC0\xF8"
-                             "\xAD\xA6\x75\xF8\x65\x86\xCF\x3E\xC1\xFF\xD8\xC0\x4A\xCE\x58\x21\xE3\xC2\x1F\x87"
-                             "\xA1\xD9\x5F\x3F\x0F\x61\xDE\x3C\x1E\xE3\xDD\x67\xC1\x87\xF8\xFF\x1F\x67\xD9\xE0"
-                             "\x30\x9D\xFC\xAB\x46\xBC\x17\x47\x74\x2A\x2B\x3B\xC7\x8D\x30\x77\x4D\x87\xF0\xF9"
-                             "\xC2\xC2\x08\xEF\x1E\xD3\x61\xD2\xC7\x67\xE8\xEE\x9D\xE3\xDC\x6C\x3E\x73\x1F\x44"
-                             "\x6C\x21\xA4\x11\x0A\xAA\x18\x5F\x66\xA1\x6F\xD4\x77\x4E\xF1\xE0\xD8\x74\xC1\x8F"
-                             "\x8E\xE9\xF6\x43\xC4\xCA\x8F\xB3\xA8\xFB\x3A\x1D\xA1\xA7\xC3\x90\xFB\x3B\x65\x67"
-                             "\x55\x7C\x5B\x3B\xC7\x83\x61\xD3\xCF\x84\x3B\xA7\x78\xF0\x15\x1F\x3C\xE8\x11\x34"
-                             "\x1B\x3A\x8E\x53\x6D\x9D\xE3\xC1\xEE";
+const size_t HTTP_SCRIPT_ROOT_SIZE = 741;
+const char HTTP_SCRIPT_ROOT_COMPRESSED[] PROGMEM = "\x33\xBF\xA3\x14\x75\x3F\x1D\x4C\xC1\xF0\xE3\x3C\x11\x81\x7C\x1D\x6E\x72\x0B\xC7"
+                             "\x77\xC7\x78\xF6\xB1\xC7\x74\xFB\x08\xE4\x3E\xCE\xF1\xD0\xB7\xB9\xFC\x85\x15\x10"
+                             "\xD2\x08\xF9\xE3\xA7\xD8\xC0\xAC\x36\x77\x4E\xC3\xDB\x47\xB8\xEC\x1E\x3A\x8F\x61"
+                             "\xE9\x56\x38\x26\xBD\x46\x41\x33\xE1\xF6\x3F\xA2\x50\xA3\xCC\xE4\x6C\xFA\x3E\x8F"
+                             "\xB3\xF0\xF6\x1D\xE2\x04\x6C\x2B\xC0\x85\x85\x7C\xFC\x3D\x28\x50\x24\xD7\x1A\x08"
+                             "\x35\xCE\xCA\x14\x7E\x1E\x94\x20\x24\xE4\xE7\x29\x90\xC3\x61\xE0\x7C\x56\xD3\x3A"
+                             "\xFC\x32\xC3\x67\x9F\x60\xFF\xEC\x60\x25\x67\x2C\x10\xF1\xE1\x0F\xC3\xD0\xEC\xAF"
+                             "\x9F\x87\xB0\xEF\x1E\x0F\x70\x22\xF0\x53\x67\x74\x61\xDE\x3D\xB6\x7C\x18\x7F\x8F"
+                             "\xF1\xF6\x7D\x9E\x34\xC1\xDD\x7E\x3F\x47\xEA\xCF\x87\xC3\xEC\xFB\x3B\xC7\xB7\xEE"
+                             "\x85\xFF\x8F\x07\xB8\x30\x9D\xFC\xAB\x46\xBC\x17\x47\x74\xC5\x1D\xE3\xC0\x24\x4D"
+                             "\x0A\x8E\xF1\xE3\x4C\x1D\xD3\x61\xFC\x3E\x70\xB0\x82\x3B\xC7\xB4\xD8\x74\xB1\xD9"
+                             "\xFA\x3B\xA7\x78\xF7\x1B\x0F\x9C\xC7\xD1\x1B\x08\x69\x04\x42\xAA\x86\x17\xD9\xA8"
+                             "\x5B\xF5\x1D\xD3\xBC\x78\x36\x1D\x33\xBE\xEC\x43\x2F\x55\xD3\x0C\x55\xF0\xF3\x3E"
+                             "\x02\x1E\xDA\x77\x4E\xF1\xED\xD3\x07\x74\xD8\x74\xFB\xB1\x0C\x8B\xD5\x74\xCF\x87"
+                             "\xC3\x98\x7E\x8F\xD1\x1B\x0E\x9E\xAB\xA1\x7E\x3E\x1F\x0E\x53\x67\x78\xF6\x90\x5E"
+                             "\x3B\xA6\xC3\xA7\xDF\x86\x67\x79\x95\x33\x60\x25\xEE\x2A\x01\xA7\xC0\x09\xFC\x7E"
+                             "\x3F\x47\xE9\x98\x3D\x0E\x59\xFA\x3F\x45\x46\x43\x1E\x18\x3B\xA4\xCC\xDF\x51\x7B"
+                             "\x05\xFC\x36\x77\x8F\xE1\xF0\xFB\x17\xC2\x33\x1B\xCC\x43\xEC\xEF\x1E\xD7\xE3\xE7"
+                             "\x31\xF4\x08\xD7\x8E\xE9\xF6\xCC\xCF\xB3\xBC\x78\x7E\x3A\x67\x0D\x7E\xF5\x82\x3F"
+                             "\x02\xAC\xEF\x1E\xD0\xBC\x77\x59\xD0\x4B\xAB\x3B\xC7\x83\xDC\x08\x38\x13\xFF\xF3"
+                             "\xE0\x8F\xC1\xCB\xF1\xD0\x30\xB3\xCC\xEE\x9D\xE3\xC3\xF1\xF3\x85\x84\x11\xE1\x98"
+                             "\x3B\x67\x6C\xF0\x15\x1F\x3C\xE8\x11\x38\x0B\xB3\xA8\xFA\x10\xEF\x1E\x0F\x71\xE0"
+                             "\xF7\x02\x0F\x02\x27\x78\xF6\x82\x8D\xC3\xDC\x7B\x8F\x06\xC3\xA6\x0C\x7C\x77\x4F"
+                             "\xB2\x1E\x26\x54\x7D\x9D\x47\xD9\xD0\xED\x0D\x3E\x1C\x87\xD9\xDB\x2B\x3A\xAB\xE2"
+                             "\xD9\xDE\x3C\x1B\x0E\x9E\x7C\x21\xDD\x3B\xC7\x83\x2A\x01\x97\x8D\x9C\xA6\xDB\x3B"
+                             "\xC7\x83\xDC";
 
 #define  HTTP_SCRIPT_ROOT       Decompress(HTTP_SCRIPT_ROOT_COMPRESSED,HTTP_SCRIPT_ROOT_SIZE).c_str()
\ No newline at end of file
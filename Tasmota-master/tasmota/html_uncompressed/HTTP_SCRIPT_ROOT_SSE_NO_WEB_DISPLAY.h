@@ -1,20 +1,31 @@
 const char HTTP_SCRIPT_ROOT[] PROGMEM =
+  "var ft,es,ef=0;"                       // EventSource and its number of failures
+  "function ls(s){"
+    "eb('l1').innerHTML=s.replace(/{t}/g,\"<table style='width:100%%'>\")"
+                        ".replace(/{s}/g,\"<tr><th>\")"
+//                        ".replace(/{m}/g,\"</th><td>\")"
+                        ".replace(/{m}/g,\"</th><td style='width:20px;white-space:nowrap'>\")"  // I want a right justified column with left justified text
+                        ".replace(/{e}/g,\"</td></tr>\");"
+  "}"
   "function la(p){"
-    "if(typeof(EventSource)!==\"undefined\"){"
-      "var e=new EventSource('?m=1');"
-      "e.onmessage=function(event){"
-        "eb('l1').innerHTML=event.data.replace(/{t}/g,\"<table style='width:100%%'>\")"
-                                     ".replace(/{s}/g,\"<tr><th>\")"
-    //                                 ".replace(/{m}/g,\"</th><td>\")"
-                                     ".replace(/{m}/g,\"</th><td style='width:20px;white-space:nowrap'>\")"  // I want a right justified column with left justified text
-                                     ".replace(/{e}/g,\"</td></tr>\");"
-      "}"
-    "}"
     "a=p||'';"
-    "clearTimeout(lt);"
-    "if(x!=null){x.abort()}"             // Abort if no response within 2 seconds (happens on restart 1)
+    "if(es&&a==''){return;}"              // Status is pushed, only poll to send actions
+    "clearTimeout(ft);clearTimeout(lt);"
+    "if(x!=null){x.abort()}"              // Abort if no response within 2 seconds (happens on restart 1)
     "x=new XMLHttpRequest();"
-    "x.open('GET','.?m=1'+a,true);"      // ?m related to Webserver->hasArg("m")
+    "x.onreadystatechange=function(){"
+      "if(x.readyState==4&&x.status==200){"
+        "ls(x.responseText);"
+        "clearTimeout(ft);clearTimeout(lt);"
+        "if(!es&&ef<3&&typeof(EventSource)!='undefined'){"
+          "es=new EventSource('ev');"     // Related to HandleEvents()
+          "es.onmessage=function(e){ls(e.data);};"
+          "es.onerror=function(){es.close();es=null;ef++;lt=setTimeout(la,%d);};"  // Fall back to polling, Settings.web_refresh
+        "}"
+        "if(!es){lt=setTimeout(la,%d);}"  // Settings.web_refresh
+      "}"
+    "};"
+    "x.open('GET','.?m=1'+a,true);"       // ?m related to Webserver->hasArg("m")
     "x.send();"
-    "lt=setTimeout(la,20000);"           // 20s failure timeout
+    "ft=setTimeout(la,20000);"            // 20s failure timeout
   "}";
@@ -391,6 +391,9 @@
 // -- Wifi Config tools ---------------------------
 #define WIFI_SOFT_AP_CHANNEL   1                 // Soft Access Point Channel number between 1 and 13 as used by Wi-Fi Manager web GUI
 
+// -- Commands ------------------------------------
+#define USE_COMMAND_INDEX                        // Find command names using a hash index per command table instead of a linear scan (+0k6 code, +1k5 mem)
+
 // -- ESP-NOW -------------------------------------
 //#define USE_TASMESH                              // Enable Tasmota Mesh using ESP-NOW (+11k code)
 
@@ -465,6 +468,7 @@
 //  #define USE_JAVASCRIPT_ES6                     // Enable ECMAScript6 syntax using less JavaScript code bytes (fails on IE11)
   #define USE_ENHANCED_GUI_WIFI_SCAN             // Enable Wi-Fi scan output with BSSID (+0k5 code)
 //  #define USE_WEBSEND_RESPONSE                   // Enable command WebSend response message (+1k code)
+//  #define USE_WEB_SSE                            // Enable server push of main page status and console log instead of polling (+2k code)
 //  #define USE_WEBGETCONFIG                       // Enable restoring config from external webserver (+0k6)
   #define USE_EMULATION_HUE                      // Enable Hue Bridge emulation for Alexa (+14k code, +2k mem common)
   #define USE_EMULATION_WEMO                     // Enable Belkin WeMo emulation for Alexa (+6k code, +2k mem common)
@@ -765,6 +769,8 @@
 #define USE_ENERGY_SENSOR                        // Add support for Energy Monitors (+14k code)
 #define USE_ENERGY_MARGIN_DETECTION              // Add support for Energy Margin detection (+1k6 code)
   #define USE_ENERGY_POWER_LIMIT                 // Add additional support for Energy Power Limit detection (+1k2 code)
+//#define USE_ENERGY_HISTORY                       // Add compressed per minute energy history with command EnergyHistory and web /eh (+3k code, ENERGY_HISTORY_SIZE RAM)
+//  #define ENERGY_HISTORY_SIZE  16384             // History size in bytes, around 1.5 days of samples
 #define USE_ENERGY_DUMMY                         // Add support for dummy Energy monitor allowing user values (+0k7 code)
 #define USE_HLW8012                              // Add support for HLW8012, BL0937 or HJL-01 Energy Monitor for Sonoff Pow and WolfBlitz
 #define USE_CSE7766                              // Add support for CSE7766 Energy Monitor for Sonoff S31 and Pow R2
@@ -1070,6 +1076,7 @@
 //#define PROFILE_THRESHOLD            70          // Minimum duration in milliseconds to start logging
 //#define USE_PROFILE_DRIVER                       // Enable driver profiling
 //#define USE_PROFILE_FUNCTION                     // Enable driver function profiling
+//#define USE_PROFILE_STATS                        // Enable continuous per driver function statistics in microseconds (Status 14, /pr) (+3k code, +4k mem)
 
 /*********************************************************************************************\
  * Optional firmware configurations
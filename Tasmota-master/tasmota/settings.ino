@@ -452,6 +452,9 @@ bool SettingsConfigRestore(void) {
     SettingsDefaultSet2();
     memcpy((char*)Settings +16, settings_buffer +16, config_len -16);
     Settings->version = buffer_version;  // Restore version and auto upgrade after restart
+#if defined(USE_RULES) && !defined(USE_SCRIPT)
+    RulesSettingsChanged();
+#endif
   }
 
   SettingsBufferFree();
@@ -714,6 +717,9 @@ void SettingsLoad(void) {
   }
   settings_crc32 = GetSettingsCrc32();
 #endif  // FIRMWARE_MINIMAL
+#if defined(USE_RULES) && !defined(USE_SCRIPT)
+  RulesSettingsChanged();
+#endif
 
   RtcSettingsLoad(1);
 }
@@ -790,6 +796,9 @@ void SettingsDefault(void) {
   SettingsDefaultSet1();
   SettingsDefaultSet2();
   SettingsDefaultSet3();
+#if defined(USE_RULES) && !defined(USE_SCRIPT)
+  RulesSettingsChanged();
+#endif
   SettingsSave(2);
 }
 
@@ -1474,6 +1483,9 @@ void SettingsDelta(void) {
 
     Settings->version = VERSION;
     SettingsSave(1);
+#if defined(USE_RULES) && !defined(USE_SCRIPT)
+    RulesSettingsChanged();
+#endif
   }
 
 }
@@ -902,10 +902,160 @@ char* GetTextIndexed(char* destination, size_t destination_size, uint32_t index,
   return destination;
 }
 
+#ifdef USE_COMMAND_INDEX
+/*********************************************************************************************\
+ * Command index
+ *
+ * Each '|' separated haystack passed to GetCommandCode gets, on first use, an index made of
+ * the 16-bit case insensitive hash of every token sorted by hash. A lookup is then a binary
+ * search followed by a single strcasecmp of the candidate token instead of copying and
+ * comparing every token. Indexes are found back by haystack address in an open addressed
+ * table so haystacks must be constant, as all PROGMEM command tables are.
+\*********************************************************************************************/
+
+#define COMMAND_INDEX_MIN_SIZE       32       // Initial number of haystack slots, doubled when half full
+
+typedef struct {
+  const char* haystack;
+  uint8_t count;                              // Number of tokens, 0 if too many to be indexed
+  uint8_t length;                             // Longest token
+  uint8_t *code;                              // Token number, sorted by hash
+  uint16_t hash[];                            // Token hash, sorted
+} CommandIndexTable_t;
+
+struct COMMANDINDEX {
+  CommandIndexTable_t **tables = nullptr;
+  uint16_t size = 0;
+  uint16_t used = 0;
+} CommandIndex;
+
+// Hash a token up to '|' or end of string, returns the token length in length
+uint32_t CommandIndexHash(const char* name, bool progmem, uint32_t *length) {
+  uint32_t hash = 2166136261;                 // FNV-1a
+  uint32_t len = 0;
+  while (len <= 255) {
+    char ch = (progmem) ? pgm_read_byte(name + len) : name[len];
+    if (!ch || ('|' == ch)) { break; }
+    hash = (hash ^ (uint8_t)tolower(ch)) * 16777619;
+    len++;
+  }
+  *length = len;
+  return (hash >> 16) ^ (hash & 0xFFFF);
+}
+
+uint32_t CommandIndexSlot(const char* haystack, uint32_t size) {
+  return (((uint32_t)haystack >> 2) * 0x9E3779B1) >> (32 - __builtin_ctz(size));
+}
+
+CommandIndexTable_t* CommandIndexBuild(const char* haystack) {
+  uint32_t count = 1;
+  for (const char* read = haystack; pgm_read_byte(read); read++) {
+    if ('|' == pgm_read_byte(read)) { count++; }
+  }
+  if (count > 255) { count = 0; }             // Keep using the linear scan
+
+  CommandIndexTable_t *table = (CommandIndexTable_t*)malloc(sizeof(CommandIndexTable_t) + count * (sizeof(uint16_t) + sizeof(uint8_t)));
+  if (!table) { return nullptr; }
+  table->haystack = haystack;
+  table->count = count;
+  table->length = 0;
+  table->code = (uint8_t*)&table->hash[count];
+
+  const char* read = haystack;
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t length;
+    uint32_t hash = CommandIndexHash(read, true, &length);
+    if (length > 255) {                       // Silly long token, keep using the linear scan
+      table->count = 0;
+      break;
+    }
+    if (length > table->length) { table->length = length; }
+    read += length +1;                        // Skip token and '|'
+    uint32_t j = i;                           // Insertion sort on hash, keeps duplicates in token order
+    for (; (j > 0) && (table->hash[j -1] > hash); j--) {
+      table->hash[j] = table->hash[j -1];
+      table->code[j] = table->code[j -1];
+    }
+    table->hash[j] = hash;
+    table->code[j] = i;
+  }
+  return table;
+}
+
+CommandIndexTable_t* CommandIndexGet(const char* haystack) {
+  if (CommandIndex.size) {
+    uint32_t slot = CommandIndexSlot(haystack, CommandIndex.size);
+    while (CommandIndex.tables[slot]) {
+      if (CommandIndex.tables[slot]->haystack == haystack) {
+        return CommandIndex.tables[slot];
+      }
+      slot = (slot +1) & (CommandIndex.size -1);
+    }
+  }
+
+  if (2 * (CommandIndex.used +1) > CommandIndex.size) {
+    uint32_t size = (CommandIndex.size) ? 2 * CommandIndex.size : COMMAND_INDEX_MIN_SIZE;
+    CommandIndexTable_t **tables = (CommandIndexTable_t**)calloc(size, sizeof(CommandIndexTable_t*));
+    if (!tables) { return nullptr; }
+    for (uint32_t i = 0; i < CommandIndex.size; i++) {
+      if (CommandIndex.tables[i]) {
+        uint32_t slot = CommandIndexSlot(CommandIndex.tables[i]->haystack, size);
+        while (tables[slot]) { slot = (slot +1) & (size -1); }
+        tables[slot] = CommandIndex.tables[i];
+      }
+    }
+    free(CommandIndex.tables);
+    CommandIndex.tables = tables;
+    CommandIndex.size = size;
+  }
+
+  CommandIndexTable_t *table = CommandIndexBuild(haystack);
+  if (table) {
+    uint32_t slot = CommandIndexSlot(haystack, CommandIndex.size);
+    while (CommandIndex.tables[slot]) { slot = (slot +1) & (CommandIndex.size -1); }
+    CommandIndex.tables[slot] = table;
+    CommandIndex.used++;
+  }
+  return table;
+}
+
+int CommandIndexFind(CommandIndexTable_t *table, char* destination, size_t destination_size, const char* needle) {
+  *destination = '\0';
+  uint32_t length;
+  uint32_t hash = CommandIndexHash(needle, false, &length);
+  if (length > table->length) { return -1; }  // Longer than any token, also stops hashing long payloads early
+
+  uint32_t low = 0;
+  uint32_t high = table->count;
+  while (low < high) {                        // First entry with this hash
+    uint32_t mid = (low + high) / 2;
+    if (table->hash[mid] < hash) {
+      low = mid +1;
+    } else {
+      high = mid;
+    }
+  }
+  for (; (low < table->count) && (table->hash[low] == hash); low++) {
+    GetTextIndexed(destination, destination_size, table->code[low], table->haystack);
+    if (!strcasecmp(needle, destination)) {
+      return table->code[low];
+    }
+  }
+  return -1;
+}
+#endif  // USE_COMMAND_INDEX
+
 int GetCommandCode(char* destination, size_t destination_size, const char* needle, const char* haystack)
 {
   // Returns -1 of not found
   // Returns index and command if found
+#ifdef USE_COMMAND_INDEX
+  CommandIndexTable_t *table = CommandIndexGet(haystack);
+  if (table && table->count) {
+    return CommandIndexFind(table, destination, destination_size, needle);
+  }
+#endif  // USE_COMMAND_INDEX
+
   int result = -1;
   const char* read = haystack;
   char* write = destination;
@@ -2418,6 +2568,67 @@ void SyslogAsync(bool refresh) {
   }
 }
 
+/*********************************************************************************************\
+ * Log buffer
+ *
+ * Ring buffer of log lines. Each line is stored contiguous as
+ *   [loglevel][length lsb][length msb][log data]['\0']
+ * with length including the terminating '\0'. A line not fitting at the end of the buffer is
+ * stored at the start and log_buffer_end marks the end of the lines before it.
+ * Lines are numbered with a running index, 0 meaning "dump all". The offsets of the last
+ * LOG_BUFFER_LINES lines are kept by index so readers get any line without scanning.
+\*********************************************************************************************/
+
+uint32_t LogBufferNextIndex(uint32_t index) {
+  index++;
+  return (index) ? index : 1;              // Skip 0 as it is not allowed
+}
+
+uint32_t LogBufferLines(void) {
+  return TasmotaGlobal.log_buffer_pointer - TasmotaGlobal.log_buffer_oldest;
+}
+
+uint32_t LogBufferUsed(void) {
+  if (TasmotaGlobal.log_buffer_end) {      // Wrapped
+    return TasmotaGlobal.log_buffer_end - TasmotaGlobal.log_buffer_tail + TasmotaGlobal.log_buffer_head;
+  }
+  return TasmotaGlobal.log_buffer_head - TasmotaGlobal.log_buffer_tail;
+}
+
+void LogBufferRemoveOldest(void) {
+  char* line = TasmotaGlobal.log_buffer + TasmotaGlobal.log_buffer_tail;
+  TasmotaGlobal.log_buffer_tail += 3 + (uint8_t)line[1] + ((uint8_t)line[2] << 8);
+  if (TasmotaGlobal.log_buffer_tail == TasmotaGlobal.log_buffer_end) {  // Next oldest line is at the start
+    TasmotaGlobal.log_buffer_tail = 0;
+    TasmotaGlobal.log_buffer_end = 0;
+  }
+  TasmotaGlobal.log_buffer_oldest = LogBufferNextIndex(TasmotaGlobal.log_buffer_oldest);
+}
+
+// Reserve size contiguous bytes at log_buffer_head, removing the oldest lines as needed
+void LogBufferReserve(uint32_t size) {
+  while (true) {
+    if (!LogBufferLines()) {
+      TasmotaGlobal.log_buffer_head = 0;
+      TasmotaGlobal.log_buffer_tail = 0;
+      TasmotaGlobal.log_buffer_end = 0;
+    }
+    if (LogBufferLines() < LOG_BUFFER_LINES) {
+      if (TasmotaGlobal.log_buffer_end) {  // Wrapped, free space is up to the oldest line
+        if (TasmotaGlobal.log_buffer_head + size <= TasmotaGlobal.log_buffer_tail) { return; }
+      } else {
+        if (TasmotaGlobal.log_buffer_head + size <= LOG_BUFFER_SIZE) { return; }
+        if (size <= TasmotaGlobal.log_buffer_tail) {  // Wrap to the start
+          TasmotaGlobal.log_buffer_end = TasmotaGlobal.log_buffer_head;
+          TasmotaGlobal.log_buffer_head = 0;
+          return;
+        }
+      }
+    }
+    LogBufferRemoveOldest();
+  }
+}
+
 bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
   if (!TasmotaGlobal.log_buffer) { return false; }  // Leave now if there is no buffer available
 
@@ -2428,12 +2639,16 @@ bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
 #endif  // ESP32
 
   // Skip initial buffer fill
-  if (strlen(TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 2) { return false; }
+  if (LogBufferUsed() < LOG_BUFFER_SIZE / 2) { return false; }
 
   char* line;
   size_t len;
   if (!GetLog(req_loglevel, &index, &line, &len)) { return false; }
-  return ((line - TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 4);
+  // Refresh if the next line is amongst the oldest ones, soon to be removed
+  uint32_t offset = line - 3 - TasmotaGlobal.log_buffer;
+  uint32_t age = (offset >= TasmotaGlobal.log_buffer_tail) ? offset - TasmotaGlobal.log_buffer_tail :
+                 TasmotaGlobal.log_buffer_end - TasmotaGlobal.log_buffer_tail + offset;
+  return (age < LOG_BUFFER_SIZE / 4);
 }
 
 bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* len_p) {
@@ -2449,39 +2664,21 @@ bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* l
   TasAutoMutex mutex((SemaphoreHandle_t *)&TasmotaGlobal.log_buffer_mutex);
 #endif  // ESP32
 
-  if (!index) {                            // Dump all
-    index = TasmotaGlobal.log_buffer[0];
+  if ((index - TasmotaGlobal.log_buffer_oldest) >= LogBufferLines()) {  // Dump all or requested line already removed
+    index = TasmotaGlobal.log_buffer_oldest;
   }
-
-  do {
-    size_t len = 0;
-    uint32_t loglevel = 0;
-    char* entry_p = TasmotaGlobal.log_buffer;
-    do {
-      uint32_t cur_idx = *entry_p;
-      entry_p++;
-      size_t tmp = strchrspn(entry_p, '\1');
-      tmp++;                               // Skip terminating '\1'
-      if (cur_idx == index) {              // Found the requested entry
-        loglevel = *entry_p - '0';
-        entry_p++;                         // Skip loglevel
-        len = tmp -1;
-        break;
-      }
-      entry_p += tmp;
-    } while (entry_p < TasmotaGlobal.log_buffer + LOG_BUFFER_SIZE && *entry_p != '\0');
-    index++;
-    if (index > 255) { index = 1; }        // Skip 0 as it is not allowed
-    *index_p = index;
-    if ((len > 0) &&
-        (loglevel <= req_loglevel) &&
+  while (index != TasmotaGlobal.log_buffer_pointer) {
+    char* line = TasmotaGlobal.log_buffer + TasmotaGlobal.log_buffer_line[index % LOG_BUFFER_LINES];
+    index = LogBufferNextIndex(index);
+    if ((line[0] <= req_loglevel) &&
         (TasmotaGlobal.masterlog_level <= req_loglevel)) {
-      *entry_pp = entry_p;
-      *len_p = len;
+      *index_p = index;
+      *entry_pp = line +3;
+      *len_p = (uint8_t)line[1] + ((uint8_t)line[2] << 8);
       return true;
     }
-    delay(0);
-  } while (index != TasmotaGlobal.log_buffer_pointer);
+  }
+  *index_p = index;
   return false;
 }
 
@@ -2529,9 +2726,6 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
 
   if ((loglevel <= highest_loglevel) &&    // Log only when needed
       (TasmotaGlobal.masterlog_level <= highest_loglevel)) {
-    // Delimited, zero-terminated buffer of log lines.
-    // Each entry has this format: [index][loglevel][log data]['\1']
-
     // Truncate log messages longer than MAX_LOGSZ which is the log buffer size minus 64 spare
     uint32_t log_data_len = strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained);
     char too_long[TOPSZ];
@@ -2543,25 +2737,30 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
       log_data_retained = empty;
     }
 
-    TasmotaGlobal.log_buffer_pointer &= 0xFF;
-    if (!TasmotaGlobal.log_buffer_pointer) {
-      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
+    if (!TasmotaGlobal.log_buffer_pointer) {  // First line
+      TasmotaGlobal.log_buffer_pointer = 1;
+      TasmotaGlobal.log_buffer_oldest = 1;
     }
-    while (TasmotaGlobal.log_buffer_pointer == TasmotaGlobal.log_buffer[0] ||  // If log already holds the next index, remove it
-           strlen(TasmotaGlobal.log_buffer) + strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained) + strlen(mxtime) + 4 > LOG_BUFFER_SIZE)  // 4 = log_buffer_pointer + '\1' + '\0'
-    {
-      char* it = TasmotaGlobal.log_buffer;
-      it++;                                // Skip log_buffer_pointer
-      it += strchrspn(it, '\1');           // Skip log line
-      it++;                                // Skip delimiting "\1"
-      memmove(TasmotaGlobal.log_buffer, it, LOG_BUFFER_SIZE -(it-TasmotaGlobal.log_buffer));  // Move buffer forward to remove oldest log line
+    const char* parts[4] = { mxtime, log_data, log_data_payload, log_data_retained };
+    uint32_t part_len[4];
+    uint32_t len = 1;                      // Terminating '\0'
+    for (uint32_t i = 0; i < 4; i++) {
+      part_len[i] = strlen(parts[i]);
+      len += part_len[i];
     }
-    snprintf_P(TasmotaGlobal.log_buffer, LOG_BUFFER_SIZE, PSTR("%s%c%c%s%s%s%s\1"),
-      TasmotaGlobal.log_buffer, TasmotaGlobal.log_buffer_pointer++, '0'+loglevel, mxtime, log_data, log_data_payload, log_data_retained);
-    TasmotaGlobal.log_buffer_pointer &= 0xFF;
-    if (!TasmotaGlobal.log_buffer_pointer) {
-      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
+    LogBufferReserve(len +3);
+    char* line = TasmotaGlobal.log_buffer + TasmotaGlobal.log_buffer_head;
+    TasmotaGlobal.log_buffer_line[TasmotaGlobal.log_buffer_pointer % LOG_BUFFER_LINES] = TasmotaGlobal.log_buffer_head;
+    TasmotaGlobal.log_buffer_head += len +3;
+    *line++ = loglevel;
+    *line++ = len;
+    *line++ = len >> 8;
+    for (uint32_t i = 0; i < 4; i++) {
+      memcpy(line, parts[i], part_len[i]);
+      line += part_len[i];
     }
+    *line = '\0';
+    TasmotaGlobal.log_buffer_pointer = LogBufferNextIndex(TasmotaGlobal.log_buffer_pointer);
   }
 }
 
@@ -458,6 +458,9 @@ void CmndStatus(void)
   if (!TasmotaGlobal.energy_driver && (9 == payload)) { return; }
   if (!CrashFlag() && (12 == payload)) { return; }
   if (!Settings->flag3.shutter_mode && (13 == payload)) { return; }
+#ifndef USE_PROFILE_STATS
+  if (14 == payload) { return; }
+#endif
 
   char stemp[200];
   char stemp2[TOPSZ];
@@ -664,6 +667,13 @@ void CmndStatus(void)
   }
 #endif
 
+#ifdef USE_PROFILE_STATS
+  if (14 == payload) {                       // Not part of status0 as it can take several messages
+    ProfileStatsStatus();
+    CmndStatusResponse(14);
+  }
+#endif  // USE_PROFILE_STATS
+
   CmndStatusResponse(99);
 
   ResponseClear();
@@ -2292,6 +2302,9 @@ void CmndInfo(void) {
 void CmndCpuFrequency(void) {
   if ((80 == XdrvMailbox.payload) || (160 == XdrvMailbox.payload) || (240 == XdrvMailbox.payload)) {
     setCpuFrequencyMhz(XdrvMailbox.payload);
+#ifdef USE_PROFILE_STATS
+    ProfileStatsScale();
+#endif  // USE_PROFILE_STATS
   }
   ResponseCmndNumber(getCpuFrequencyMhz());
 }
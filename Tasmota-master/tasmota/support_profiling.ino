@@ -26,6 +26,7 @@
 //#define PROFILE_THRESHOLD            70          // Minimum duration in milliseconds to start logging
 //#define USE_PROFILE_DRIVER                       // Enable driver profiling
 //#define USE_PROFILE_FUNCTION                     // Enable driver function profiling
+//#define USE_PROFILE_STATS                        // Enable continuous per driver function statistics (Status 14, /pr)
 
 /*
 // Moved to tasmota_globals.h fixing compile warnings
@@ -50,11 +51,7 @@
  * Profiling services
 \*********************************************************************************************/
 
-#ifdef USE_PROFILING
-
-#ifndef PROFILE_THRESHOLD
-#define PROFILE_THRESHOLD            70       // Minimum duration in milliseconds to start logging
-#endif
+#if defined(USE_PROFILING) || defined(USE_PROFILE_STATS)
 
 // Below needs to be inline with enum XsnsFunctions
 const char kXSnsFunctions[] PROGMEM = "SETTINGS_OVERRIDE|PIN_STATE|MODULE_INIT|PRE_INIT|INIT|"
@@ -64,11 +61,19 @@ const char kXSnsFunctions[] PROGMEM = "SETTINGS_OVERRIDE|PIN_STATE|MODULE_INIT|P
                                       "MQTT_SUBSCRIBE|MQTT_INIT|MQTT_DATA|"
                                       "SET_POWER|SET_DEVICE_POWER|SHOW_SENSOR|ANY_KEY|"
                                       "ENERGY_EVERY_SECOND|ENERGY_RESET|"
-                                      "RULES_PROCESS|TELEPERIOD_RULES_PROCESS|SERIAL|FREE_MEM|BUTTON_PRESSED|"
+                                      "RULES_PROCESS|TELEPERIOD_RULES_PROCESS|SERIAL|FREE_MEM|BUTTON_PRESSED|BUTTON_MULTI_PRESSED|"
                                       "WEB_ADD_BUTTON|WEB_ADD_CONSOLE_BUTTON|WEB_ADD_MANAGEMENT_BUTTON|WEB_ADD_MAIN_BUTTON|"
                                       "WEB_ADD_HANDLER|SET_CHANNELS|SET_SCHEME|HOTPLUG_SCAN|"
                                       "DEVICE_GROUP_ITEM";
 
+#endif  // USE_PROFILING or USE_PROFILE_STATS
+
+#ifdef USE_PROFILING
+
+#ifndef PROFILE_THRESHOLD
+#define PROFILE_THRESHOLD            70       // Minimum duration in milliseconds to start logging
+#endif
+
 #ifdef USE_PROFILE_DRIVER
 void AddLogDriver(const char *driver, uint8_t function, uint32_t start) {
   uint32_t profile_millis = millis() - start;
@@ -90,3 +95,182 @@ void AddLogFunction(const char *driver, uint8_t index, uint8_t function, uint32_
 #endif  // USE_PROFILE_DRIVER
 
 #endif  // USE_PROFILING
+
+/*********************************************************************************************\
+ * Continuous profiling statistics
+ *
+ * Every driver function call done by XdrvCall, XsnsCall, XnrgCall and XlgtCall is timed with
+ * the cpu cycle counter and accounted per driver and function: number of calls, total, maximum
+ * and a log2 histogram of the duration in microseconds. Bucket n holds calls lasting from
+ * 2^n up to 2^(n+1) microseconds, the last bucket holds all longer calls.
+ *
+ * Times are inclusive: a driver calling XdrvCall itself also accounts the nested calls.
+ * Energy and light drivers are identified by their position in the compiled driver list.
+ *
+ * Status 14 - publish statistics sorted by total time
+ * /pr       - statistics as JSON, /pr?reset clears them
+\*********************************************************************************************/
+
+#ifdef USE_PROFILE_STATS
+
+#ifndef PROFILE_STATS_BITS
+#ifdef ESP8266
+#define PROFILE_STATS_BITS           6        // 64 driver functions
+#else
+#define PROFILE_STATS_BITS           7        // 128 driver functions
+#endif
+#endif
+#define PROFILE_STATS_ENTRIES        (1 << PROFILE_STATS_BITS)
+#define PROFILE_STATS_PROBES         16       // Bound the lookup time once the table gets full
+#define PROFILE_STATS_BUCKETS        16       // Last bucket holds calls of 32 ms and longer
+#define PROFILE_STATS_EMPTY          0xFFFF   // Function number never reaches 63
+
+const char kProfileStatsClasses[] PROGMEM = "drv|sns|nrg|lgt";
+
+typedef struct {
+  uint64_t total;                             // Microseconds
+  uint32_t calls;
+  uint32_t max;                               // Microseconds
+  uint16_t key;                               // Class (2 bits), driver position (8 bits), function (6 bits)
+  uint16_t hist[PROFILE_STATS_BUCKETS];
+} ProfileStat_t;
+
+struct PROFILESTATS {
+  ProfileStat_t *stats = nullptr;
+  uint32_t since = 0;                         // Uptime of last reset
+  uint32_t scale = 0;                         // (1 << 20) / cpu MHz to convert cycles to microseconds
+  uint32_t missed = 0;                        // Calls not accounted as the table is full
+  bool failed = false;                        // Out of memory
+} ProfileStats;
+
+void ProfileStatsScale(void) {
+  ProfileStats.scale = (1 << 20) / ESP.getCpuFreqMHz();
+}
+
+void ProfileStatsReset(void) {
+  if (!ProfileStats.stats) { return; }
+  for (uint32_t i = 0; i < PROFILE_STATS_ENTRIES; i++) {
+    ProfileStats.stats[i].key = PROFILE_STATS_EMPTY;
+  }
+  ProfileStats.missed = 0;
+  ProfileStats.since = UpTime();
+  ProfileStatsScale();
+}
+
+bool ProfileStatsInit(void) {
+  if (ProfileStats.failed) { return false; }
+  ProfileStats.stats = (ProfileStat_t*)malloc(PROFILE_STATS_ENTRIES * sizeof(ProfileStat_t));
+  if (!ProfileStats.stats) {
+    ProfileStats.failed = true;
+    return false;
+  }
+  ProfileStatsReset();
+  return true;
+}
+
+void ProfileStatsAdd(uint32_t cls, uint32_t position, uint32_t function, uint32_t start) {
+  uint32_t cycles = ESP.getCycleCount() - start;
+  if (!ProfileStats.stats && !ProfileStatsInit()) { return; }
+
+  uint32_t key = (cls << 14) | (position << 6) | function;
+  uint32_t slot = (key * 0x9E3779B1) >> (32 - PROFILE_STATS_BITS);  // Fibonacci hashing
+  ProfileStat_t *stat = nullptr;
+  for (uint32_t probe = 0; probe < PROFILE_STATS_PROBES; probe++) {
+    stat = &ProfileStats.stats[slot];
+    if (stat->key == key) { break; }
+    if (PROFILE_STATS_EMPTY == stat->key) {
+      memset(stat, 0, sizeof(ProfileStat_t));
+      stat->key = key;
+      break;
+    }
+    slot = (slot +1) & (PROFILE_STATS_ENTRIES -1);
+    stat = nullptr;
+  }
+  if (!stat) {
+    ProfileStats.missed++;
+    return;
+  }
+
+  uint32_t us = ((uint64_t)cycles * ProfileStats.scale) >> 20;
+  stat->calls++;
+  stat->total += us;
+  if (us > stat->max) { stat->max = us; }
+  uint32_t bucket = 31 - __builtin_clz(us | 1);
+  if (bucket >= PROFILE_STATS_BUCKETS) { bucket = PROFILE_STATS_BUCKETS -1; }
+  if (0xFFFF == ++stat->hist[bucket]) {       // Halve all buckets keeping the shape of the histogram
+    for (uint32_t i = 0; i < PROFILE_STATS_BUCKETS; i++) {
+      stat->hist[i] >>= 1;
+    }
+  }
+}
+
+// Fill order with the used entries sorted by descending total time, returns their number
+uint32_t ProfileStatsSort(uint8_t *order) {
+  uint32_t count = 0;
+  if (!ProfileStats.stats) { return count; }
+  for (uint32_t i = 0; i < PROFILE_STATS_ENTRIES; i++) {
+    if (PROFILE_STATS_EMPTY == ProfileStats.stats[i].key) { continue; }
+    uint32_t j = count++;
+    for (; (j > 0) && (ProfileStats.stats[order[j -1]].total < ProfileStats.stats[i].total); j--) {
+      order[j] = order[j -1];
+    }
+    order[j] = i;
+  }
+  return count;
+}
+
+uint32_t ProfileStatsHeader(char *buf, uint32_t size) {
+  ProfileStatsScale();                        // Cpu frequency may have changed
+  return snprintf_P(buf, size, PSTR("\"" D_JSON_UPTIME "\":%u,\"CpuMHz\":%u,\"Missed\":%u,\"Stats\":["),
+    UpTime() - ProfileStats.since, ESP.getCpuFreqMHz(), ProfileStats.missed);
+}
+
+// Format one entry as JSON object, prefixed with a comma if not the first one
+uint32_t ProfileStatsFormat(char *buf, uint32_t size, uint32_t index, bool first) {
+  ProfileStat_t *stat = &ProfileStats.stats[index];
+  uint32_t cls = stat->key >> 14;
+  uint32_t position = (stat->key >> 6) & 0xFF;
+  uint32_t function = stat->key & 0x3F;
+  uint32_t driver = (0 == cls) ? XdrvDriverId(position) : (1 == cls) ? XsnsDriverId(position) : position;
+  uint32_t buckets = PROFILE_STATS_BUCKETS;
+  while ((buckets > 1) && !stat->hist[buckets -1]) { buckets--; }
+
+  char sclass[4];
+  char sfunction[28];
+  uint32_t len = snprintf_P(buf, size, PSTR("%s{\"Driver\":\"x%s_%02d\",\"Function\":\"%s\",\"Calls\":%u,\"TotalMs\":%u,\"AvgUs\":%u,\"MaxUs\":%u,\"Hist\":["),
+    (first) ? "" : ",", GetTextIndexed(sclass, sizeof(sclass), cls, kProfileStatsClasses), driver,
+    GetTextIndexed(sfunction, sizeof(sfunction), function, kXSnsFunctions),
+    stat->calls, (uint32_t)(stat->total / 1000), (uint32_t)(stat->total / stat->calls), stat->max);
+  for (uint32_t i = 0; (i < buckets) && (len < size); i++) {
+    len += snprintf_P(buf + len, size - len, PSTR("%s%u"), (i) ? "," : "", stat->hist[i]);
+  }
+  if (len < size) {
+    len += snprintf_P(buf + len, size - len, PSTR("]}"));
+  }
+  return (len < size) ? len : size -1;
+}
+
+// Status 14 - publish as many messages as needed
+void ProfileStatsStatus(void) {
+  char line[240];
+  uint8_t order[PROFILE_STATS_ENTRIES];
+  uint32_t count = ProfileStatsSort(order);
+
+  ProfileStatsHeader(line, sizeof(line));
+  Response_P(PSTR("{\"" D_CMND_STATUS D_STATUS14_PROFILE "\":{%s"), line);
+  bool first = true;
+  for (uint32_t i = 0; i < count; i++) {
+    ProfileStatsFormat(line, sizeof(line), order[i], first);
+    if (ResponseLength() + strlen(line) + 4 > ResponseSize()) {
+      ResponseAppend_P(PSTR("]}}"));
+      MqttPublishPrefixTopicRulesProcess_P(STAT, PSTR(D_CMND_STATUS "14"));
+      Response_P(PSTR("{\"" D_CMND_STATUS D_STATUS14_PROFILE "\":{\"Stats\":["));
+      ProfileStatsFormat(line, sizeof(line), order[i], true);
+    }
+    ResponseAppend_P(PSTR("%s"), line);
+    first = false;
+  }
+  ResponseAppend_P(PSTR("]}}"));
+}
+
+#endif  // USE_PROFILE_STATS
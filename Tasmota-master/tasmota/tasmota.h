@@ -189,6 +189,8 @@ const uint16_t LOG_BUFFER_SIZE = 4096;      // Max number of characters in logbu
 const uint16_t LOG_BUFFER_SIZE = 6096;      // Max number of characters in logbuffer used by weblog, syslog and mqttlog
 #endif  // ESP8266
 
+const uint16_t LOG_BUFFER_LINES = 128;      // Max number of lines in logbuffer (power of 2)
+
 #ifdef MQTT_DATA_STRING
 const uint16_t MAX_LOGSZ = LOG_BUFFER_SIZE -96;  // Max number of characters in log line - may be overruled which will truncate log entry
 #else
@@ -204,7 +206,7 @@ const uint32_t SOFT_BAUDRATE = 9600;        // Default software serial baudrate
 const uint32_t APP_BAUDRATE = 115200;       // Default serial baudrate
 const uint32_t SERIAL_POLLING = 100;        // Serial receive polling in ms
 const uint32_t ZIGBEE_POLLING = 100;        // Serial receive polling in ms
-const uint8_t MAX_STATUS = 13;              // Max number of status lines
+const uint8_t MAX_STATUS = 14;              // Max number of status lines
 
 const uint32_t START_VALID_TIME = 1451602800;  // Time is synced and after 2016-01-01
 
@@ -346,6 +348,19 @@ enum XsnsFunctions {FUNC_SETTINGS_OVERRIDE, FUNC_PIN_STATE, FUNC_MODULE_INIT, FU
                     FUNC_WEB_ADD_HANDLER, FUNC_SET_CHANNELS, FUNC_SET_SCHEME, FUNC_HOTPLUG_SCAN,
                     FUNC_DEVICE_GROUP_ITEM };
 
+// Periodic functions a driver handles, declared with XDRV_xx_FUNCS or XSNS_xx_FUNCS next to its XDRV_xx or XSNS_xx
+// Drivers without declaration are called for all of them
+#define XFUNC_LOOP             0x01     // FUNC_LOOP
+#define XFUNC_50MS             0x02     // FUNC_EVERY_50_MSECOND
+#define XFUNC_100MS            0x04     // FUNC_EVERY_100_MSECOND
+#define XFUNC_200MS            0x08     // FUNC_EVERY_200_MSECOND
+#define XFUNC_250MS            0x10     // FUNC_EVERY_250_MSECOND
+#define XFUNC_SECOND           0x20     // FUNC_EVERY_SECOND
+#define XFUNC_ALL              0x3F
+#define XFUNC_PERIODIC         6        // Number of periodic functions from FUNC_LOOP to FUNC_EVERY_SECOND
+
+enum ProfileStatsClasses { PRF_DRV, PRF_SNS, PRF_NRG, PRF_LGT };     // Driver interfaces accounted by USE_PROFILE_STATS
+
 enum AddressConfigSteps { ADDR_IDLE, ADDR_RECEIVE, ADDR_SEND };
 
 enum SettingsTextIndex { SET_OTAURL,
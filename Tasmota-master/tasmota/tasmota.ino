@@ -101,7 +101,8 @@ struct TasmotaGlobal_t {
   uint32_t blink_timer;                     // Power cycle timer
   uint32_t backlog_timer;                   // Timer for next command in backlog
   uint32_t loop_load_avg;                   // Indicative loop load average
-  uint32_t log_buffer_pointer;              // Index in log buffer
+  uint32_t log_buffer_pointer;              // Index of next line in log buffer
+  uint32_t log_buffer_oldest;               // Index of oldest line in log buffer
   uint32_t uptime;                          // Counting every second until 4294967295 = 130 year
   uint32_t zc_time;                         // Zero-cross moment (microseconds)
   uint32_t zc_offset;                       // Zero cross moment offset due to monitoring chip processing (microseconds)
@@ -109,6 +110,10 @@ struct TasmotaGlobal_t {
   uint32_t zc_interval;                     // Zero cross interval around 8333 (60Hz) or 10000 (50Hz) (microseconds)
   GpioOptionABits gpio_optiona;             // GPIO Option_A flags
   void *log_buffer_mutex;                   // Control access to log buffer
+  uint16_t log_buffer_head;                 // Log buffer offset of next line
+  uint16_t log_buffer_tail;                 // Log buffer offset of oldest line
+  uint16_t log_buffer_end;                  // Log buffer end of lines before wrapping to the start, 0 if not wrapped
+  uint16_t log_buffer_line[LOG_BUFFER_LINES];  // Log buffer offset of last lines by index
 
   power_t power;                            // Current copy of Settings->power
   power_t rel_inverted;                     // Relay inverted flag (1 = (0 = On, 1 = Off))
@@ -795,6 +795,7 @@
 #undef USE_UNISHOX_COMPRESSION                   // Disable support for string compression in Rules or Scripts
 #undef USE_RULES                                 // Disable support for rules
 #undef USE_SCRIPT                                // Disable support for script
+#undef USE_COMMAND_INDEX                         // Disable command name hash index
 
 // -- Optional modules ----------------------------
 #undef ROTARY_V1                                 // Disable support for MI Desk Lamp
@@ -512,6 +512,14 @@ bool first_device_group_is_local = true;
 #define PROFILE_FUNCTION(DRIVER, INDEX, FUNCTION, START)
 #endif  // USE_PROFILE_DRIVER
 
+#ifdef USE_PROFILE_STATS
+#define PROFILE_STATS_START(START) uint32_t START = ESP.getCycleCount()
+#define PROFILE_STATS(CLASS, POSITION, FUNCTION, START) ProfileStatsAdd(CLASS, POSITION, FUNCTION, START)
+#else
+#define PROFILE_STATS_START(START)
+#define PROFILE_STATS(CLASS, POSITION, FUNCTION, START)
+#endif  // USE_PROFILE_STATS
+
 /*********************************************************************************************\
  * Macro for SetOption synonyms
  *
@@ -27,9 +27,6 @@
 
 #define XDRV_01                                   1
 
-// Enable below demo feature only if defines USE_UNISHOX_COMPRESSION and USE_SCRIPT_WEB_DISPLAY are disabled
-//#define USE_WEB_SSE
-
 #ifndef WIFI_SOFT_AP_CHANNEL
 #define WIFI_SOFT_AP_CHANNEL                      1      // Soft Access Point Channel number between 1 and 11 as used by WifiManager web GUI
 #endif
@@ -90,7 +87,11 @@ const char HTTP_SCRIPT_COUNTER[] PROGMEM =
   #ifdef USE_SCRIPT_WEB_DISPLAY
     #include "./html_compressed/HTTP_SCRIPT_ROOT_WEB_DISPLAY.h"
   #else
-    #include "./html_compressed/HTTP_SCRIPT_ROOT_NO_WEB_DISPLAY.h"
+    #ifdef USE_WEB_SSE
+      #include "./html_compressed/HTTP_SCRIPT_ROOT_SSE_NO_WEB_DISPLAY.h"
+    #else
+      #include "./html_compressed/HTTP_SCRIPT_ROOT_NO_WEB_DISPLAY.h"
+    #endif  // USE_WEB_SSE
   #endif
   #include "./html_compressed/HTTP_SCRIPT_ROOT_PART2.h"
 #else
@@ -127,9 +128,17 @@ const char HTTP_SCRIPT_RELOAD_TIME[] PROGMEM =
   "setTimeout(function(){location.href='.';},%d);";
 
 #ifdef USE_UNISHOX_COMPRESSION
-  #include "./html_compressed/HTTP_SCRIPT_CONSOL.h"
+  #ifdef USE_WEB_SSE
+    #include "./html_compressed/HTTP_SCRIPT_CONSOL_SSE.h"
+  #else
+    #include "./html_compressed/HTTP_SCRIPT_CONSOL.h"
+  #endif  // USE_WEB_SSE
 #else
-  #include "./html_uncompressed/HTTP_SCRIPT_CONSOL.h"
+  #ifdef USE_WEB_SSE
+    #include "./html_uncompressed/HTTP_SCRIPT_CONSOL_SSE.h"
+  #else
+    #include "./html_uncompressed/HTTP_SCRIPT_CONSOL.h"
+  #endif  // USE_WEB_SSE
 #endif
 
 const char HTTP_MODULE_TEMPLATE_REPLACE_INDEX[] PROGMEM =
@@ -440,6 +449,10 @@ struct WEB {
   uint16_t save_data_counter = 0;
   uint8_t old_wificonfig = MAX_WIFI_OPTION; // means "nothing yet saved here"
   bool wifi_test_AP_TIMEOUT = false;
+#ifdef USE_WEB_SSE
+  bool sse_capture = false;                         // Collect content in sse_content instead of sending it
+  String sse_content = "";
+#endif  // USE_WEB_SSE
 } Web;
 
 // Helper function to avoid code duplication (saves 4k Flash)
@@ -547,6 +560,12 @@ const WebServerDispatch_t WebServerDispatch[] PROGMEM = {
   { "rt", HTTP_ANY, HandleResetConfiguration },
   { "in", HTTP_ANY, HandleInformation },
 #endif  // Not FIRMWARE_MINIMAL
+#ifdef USE_WEB_SSE
+  { "ev", HTTP_GET, HandleEvents },
+#endif  // USE_WEB_SSE
+#ifdef USE_PROFILE_STATS
+  { "pr", HTTP_GET, HandleProfileStats },
+#endif  // USE_PROFILE_STATS
 };
 
 void WebServer_on(const char * prefix, void (*func)(void), uint8_t method = HTTP_ANY) {
@@ -741,6 +760,15 @@ void WSContentBegin(int code, int ctype) {
 }
 
 void _WSContentSend(const char* content, size_t size) {  // Lowest level sendContent for all core versions
+#ifdef USE_WEB_SSE
+  if (Web.sse_capture) {
+    Web.sse_content.reserve(Web.sse_content.length() + size);
+    for (uint32_t i = 0; i < size; i++) {
+      Web.sse_content += content[i];
+    }
+    return;
+  }
+#endif  // USE_WEB_SSE
   Webserver->sendContent(content, size);
 
   SHOW_FREE_MEM(PSTR("WSContentSend"));
@@ -748,6 +776,12 @@ void _WSContentSend(const char* content, size_t size) {  // Lowest level sendCon
 }
 
 void _WSContentSend(const String& content) {       // Low level sendContent for all core versions
+#ifdef USE_WEB_SSE
+  if (Web.sse_capture) {
+    Web.sse_content += content;
+    return;
+  }
+#endif  // USE_WEB_SSE
   _WSContentSend(content.c_str(), content.length());
 }
 
@@ -1106,7 +1140,7 @@ void HandleRoot(void)
   char stemp[33];
 
   WSContentStart_P(PSTR(D_MAIN_MENU));
-#ifdef USE_SCRIPT_WEB_DISPLAY
+#if defined(USE_SCRIPT_WEB_DISPLAY) || defined(USE_WEB_SSE)
   WSContentSend_P(HTTP_SCRIPT_ROOT, Settings->web_refresh, Settings->web_refresh);
 #else
   WSContentSend_P(HTTP_SCRIPT_ROOT, Settings->web_refresh);
@@ -1425,12 +1459,18 @@ bool HandleRootStatusRefresh(void)
   }
 #endif // USE_ZIGBEE
 
-#ifdef USE_WEB_SSE
-  WSContentBegin(200, CT_STREAM);
-  WSContentSend_P(PSTR("data: "));
-#else
   WSContentBegin(200, CT_HTML);
-#endif  // USE_WEB_SSE
+  WSContentSendRootStatus();
+  WSContentEnd();
+
+  return true;
+}
+
+// Sensors and power state part of the main page, also pushed by USE_WEB_SSE
+void WSContentSendRootStatus(void)
+{
+  char svalue[32];
+
   WSContentSend_P(PSTR("{t}"));
   XsnsCall(FUNC_WEB_SENSOR);
   XdrvCall(FUNC_WEB_SENSOR);
@@ -1461,10 +1501,6 @@ bool HandleRootStatusRefresh(void)
 
     WSContentSend_P(PSTR("</tr></table>"));
   }
-  WSContentSend_P(PSTR("\n\n"));  // Prep for SSE
-  WSContentEnd();
-
-  return true;
 }
 
 #ifdef USE_SHUTTER
@@ -2944,6 +2980,31 @@ void HandleHttpCommand(void)
 
 /*-------------------------------------------------------------------------------------------*/
 
+#ifdef USE_PROFILE_STATS
+// /pr returns driver function statistics, /pr?reset clears them
+void HandleProfileStats(void)
+{
+  if (!HttpCheckPriviledgedAccess()) { return; }
+
+  if (Webserver->hasArg(F("reset"))) { ProfileStatsReset(); }
+
+  char line[240];
+  uint8_t order[PROFILE_STATS_ENTRIES];
+  uint32_t count = ProfileStatsSort(order);
+
+  WSContentBegin(200, CT_APP_JSON);
+  WSContentSend_P(PSTR("{\"" D_CMND_STATUS D_STATUS14_PROFILE "\":{"));
+  WSContentSend(line, ProfileStatsHeader(line, sizeof(line)));
+  for (uint32_t i = 0; i < count; i++) {
+    WSContentSend(line, ProfileStatsFormat(line, sizeof(line), order[i], (0 == i)));
+  }
+  WSContentSend_P(PSTR("]}}"));
+  WSContentEnd();
+}
+#endif  // USE_PROFILE_STATS
+
+/*-------------------------------------------------------------------------------------------*/
+
 void HandleManagement(void)
 {
   if (!HttpCheckPriviledgedAccess()) { return; }
@@ -2993,13 +3054,13 @@ void HandleConsoleRefresh(void)
     ExecuteWebCommand((char*)svalue.c_str(), SRC_WEBCONSOLE);
   }
 
-  char stmp[8];
+  char stmp[12];                     // log index is a 32 bits counter, up to 10 digits
   WebGetArg(PSTR("c2"), stmp, sizeof(stmp));
   uint32_t index = 0;                // Initial start, dump all
-  if (strlen(stmp)) { index = atoi(stmp); }
+  if (strlen(stmp)) { index = strtoul(stmp, nullptr, 10); }
 
   WSContentBegin(200, CT_PLAIN);
-  WSContentSend_P(PSTR("%d}1%d}1"), TasmotaGlobal.log_buffer_pointer, Web.reset_web_log_flag);
+  WSContentSend_P(PSTR("%u}1%d}1"), TasmotaGlobal.log_buffer_pointer, Web.reset_web_log_flag);
   if (!Web.reset_web_log_flag) {
     index = 0;
     Web.reset_web_log_flag = true;
@@ -3016,6 +3077,174 @@ void HandleConsoleRefresh(void)
   WSContentEnd();
 }
 
+/*********************************************************************************************\
+ * Server-Sent Events
+ *
+ * Browsers supporting EventSource keep a connection open on /ev (main page) or /ev?c2=<index>
+ * (console) instead of polling /?m=1 and /cs. The main page status is rendered once per web
+ * refresh period for all main page clients and only sent when it changed, the console gets
+ * only new log lines. Without a free client slot the request fails and the page keeps polling.
+\*********************************************************************************************/
+
+#ifdef USE_WEB_SSE
+
+#ifndef WEB_SSE_CLIENTS
+#ifdef ESP8266
+#define WEB_SSE_CLIENTS              2
+#else
+#define WEB_SSE_CLIENTS              4
+#endif
+#endif
+#define WEB_SSE_INTERVAL             250      // Milliseconds between console updates
+#define WEB_SSE_KEEPALIVE            15000    // Milliseconds before sending a comment to detect lost clients
+
+enum WebSseTypes { WEB_SSE_NONE, WEB_SSE_ROOT, WEB_SSE_CONSOLE };
+
+typedef struct {
+  WiFiClient client;
+  uint32_t value;                             // Root: hash of last sent status, Console: next log index
+  uint32_t sent;                              // Time of last message
+  uint8_t type;
+} WebSseClient_t;
+
+struct WEBSSE {
+  WebSseClient_t clients[WEB_SSE_CLIENTS];
+  uint32_t timer = 0;
+  uint32_t root_timer = 0;
+  uint8_t active = 0;
+} WebSse;
+
+void WebSseDrop(WebSseClient_t *sse) {
+  sse->client.stop();
+  sse->type = WEB_SSE_NONE;
+  WebSse.active--;
+}
+
+bool WebSseSend(WebSseClient_t *sse, const String &message) {
+  if (sse->client.write((const uint8_t*)message.c_str(), message.length()) != message.length()) {
+    WebSseDrop(sse);                          // Slow or gone, the browser falls back to polling
+    return false;
+  }
+  sse->sent = millis();
+  return true;
+}
+
+// Append data as one or more "data:" lines, an event field can not hold a newline
+void WebSseData(String &message, const char *data, size_t len) {
+  message += F("data: ");
+  for (uint32_t i = 0; i < len; i++) {
+    if ('\n' == data[i]) {
+      message += F("\ndata: ");
+    } else if (data[i] != '\r') {
+      message += data[i];
+    }
+  }
+  message += '\n';
+}
+
+void HandleEvents(void)
+{
+  bool console = Webserver->hasArg(F("c2"));
+  if (console) {
+    if (!HttpCheckPriviledgedAccess()) { return; }
+  } else if (!WebAuthenticate()) {
+    Webserver->requestAuthentication();
+    return;
+  }
+
+  uint32_t slot = 0;
+  for (; slot < WEB_SSE_CLIENTS; slot++) {
+    if (WEB_SSE_NONE == WebSse.clients[slot].type) { break; }
+  }
+  if (WEB_SSE_CLIENTS == slot) {
+    WSSend(503, CT_PLAIN, "");
+    return;
+  }
+
+  WebSseClient_t *sse = &WebSse.clients[slot];
+  sse->client = Webserver->client();          // Keep the connection after the web server is done with it
+  sse->client.setNoDelay(true);
+  char ct[25];
+  char header[120];
+  snprintf_P(header, sizeof(header), PSTR("HTTP/1.1 200 OK\r\nContent-Type: %s\r\nCache-Control: no-cache\r\nConnection: keep-alive\r\n\r\n"),
+    GetTextIndexed(ct, sizeof(ct), CT_STREAM, kContentTypes));
+  sse->client.print(header);
+  sse->sent = millis();
+  sse->value = 0;
+  if (console) {
+    char stmp[12];
+    WebGetArg(PSTR("c2"), stmp, sizeof(stmp));
+    sse->value = strtoul(stmp, nullptr, 10);
+    sse->type = WEB_SSE_CONSOLE;
+  } else {
+    sse->type = WEB_SSE_ROOT;
+    WebSse.root_timer = millis();             // Send status now
+  }
+  WebSse.active++;
+}
+
+void WebSseLoop(void)
+{
+  if (!WebSse.active || !TimeReached(WebSse.timer)) { return; }
+  SetNextTimeInterval(WebSse.timer, WEB_SSE_INTERVAL);
+
+  bool root_due = TimeReached(WebSse.root_timer);
+  if (root_due) {
+    SetNextTimeInterval(WebSse.root_timer, Settings->web_refresh);
+  }
+  String status;
+  uint32_t status_hash = 0;
+
+  for (uint32_t i = 0; i < WEB_SSE_CLIENTS; i++) {
+    WebSseClient_t *sse = &WebSse.clients[i];
+    if (WEB_SSE_NONE == sse->type) { continue; }
+    if (!sse->client.connected()) {
+      WebSseDrop(sse);
+      continue;
+    }
+
+    String message;
+    if ((WEB_SSE_ROOT == sse->type) && root_due) {
+      if (!status.length()) {                 // Render once for all clients
+        Web.sse_capture = true;
+        WSContentSendRootStatus();
+        WSContentFlush();
+        Web.sse_capture = false;
+        WebSseData(status, Web.sse_content.c_str(), Web.sse_content.length());
+        Web.sse_content = "";
+        status += '\n';
+        status_hash = 2166136261;             // FNV-1a
+        for (uint32_t j = 0; j < status.length(); j++) {
+          status_hash = (status_hash ^ (uint8_t)status[j]) * 16777619;
+        }
+      }
+      if (sse->value != status_hash) {
+        if (!WebSseSend(sse, status)) { continue; }
+        sse->value = status_hash;
+      }
+    }
+    else if (WEB_SSE_CONSOLE == sse->type) {
+      uint32_t index = sse->value;
+      char* line;
+      size_t len;
+      while (GetLog(Settings->weblog_level, &index, &line, &len)) {
+        WebSseData(message, line, len -1);
+      }
+      if (message.length()) {
+        message = String(F("id: ")) + String(index) + F("\ndata:\n") + message + '\n';  // Empty data line starts the event with a newline
+        if (!WebSseSend(sse, message)) { continue; }
+      }
+      sse->value = index;
+    }
+
+    if (millis() - sse->sent > WEB_SSE_KEEPALIVE) {
+      WebSseSend(sse, F(":\n\n"));
+    }
+  }
+}
+
+#endif  // USE_WEB_SSE
+
 /********************************************************************************************/
 
 void HandleNotFound(void)
@@ -3519,6 +3748,9 @@ bool Xdrv01(uint8_t function)
   switch (function) {
     case FUNC_LOOP:
       PollDnsWebserver();
+#ifdef USE_WEB_SSE
+      WebSseLoop();
+#endif  // USE_WEB_SSE
 #ifdef USE_EMULATION
       if (Settings->flag2.emulation) { PollUdp(); }
 #endif  // USE_EMULATION
@@ -18,6 +18,7 @@
 */
 
 #define XDRV_02                    2
+#define XDRV_02_FUNCS              XFUNC_50MS
 
 #define USE_MQTT_NEW_PUBSUBCLIENT
 
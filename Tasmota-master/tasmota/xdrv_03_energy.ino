@@ -23,7 +23,9 @@
 \*********************************************************************************************/
 
 #define XDRV_03                3
+#define XDRV_03_FUNCS          (XFUNC_LOOP | XFUNC_250MS | XFUNC_SECOND)
 #define XSNS_03                3
+#define XSNS_03_FUNCS          XFUNC_SECOND
 
 //#define USE_ENERGY_MARGIN_DETECTION
 //  #define USE_ENERGY_POWER_LIMIT
@@ -40,6 +42,7 @@
 #define D_CMND_FREQUENCYCAL "FrequencyCal"
 #define D_CMND_TARIFF "Tariff"
 #define D_CMND_MODULEADDRESS "ModuleAddress"
+#define D_CMND_ENERGYHISTORY "EnergyHistory"
 
 enum EnergyCommands {
   CMND_POWERCAL, CMND_VOLTAGECAL, CMND_CURRENTCAL, CMND_FREQUENCYCAL,
@@ -56,7 +59,11 @@ const char kEnergyCommands[] PROGMEM = "|"  // No prefix
   D_CMND_SAFEPOWER "|" D_CMND_SAFEPOWERHOLD "|"  D_CMND_SAFEPOWERWINDOW "|"
 #endif  // USE_ENERGY_POWER_LIMIT
 #endif  // USE_ENERGY_MARGIN_DETECTION
-  D_CMND_ENERGYTODAY "|" D_CMND_ENERGYYESTERDAY "|" D_CMND_ENERGYTOTAL "|" D_CMND_ENERGYUSAGE "|" D_CMND_ENERGYEXPORT "|" D_CMND_TARIFF;
+  D_CMND_ENERGYTODAY "|" D_CMND_ENERGYYESTERDAY "|" D_CMND_ENERGYTOTAL "|" D_CMND_ENERGYUSAGE "|" D_CMND_ENERGYEXPORT "|" D_CMND_TARIFF
+#ifdef USE_ENERGY_HISTORY
+  "|" D_CMND_ENERGYHISTORY
+#endif  // USE_ENERGY_HISTORY
+  ;
 
 void (* const EnergyCommand[])(void) PROGMEM = {
   &CmndPowerCal, &CmndVoltageCal, &CmndCurrentCal, &CmndFrequencyCal,
@@ -69,7 +76,11 @@ void (* const EnergyCommand[])(void) PROGMEM = {
   &CmndSafePower, &CmndSafePowerHold, &CmndSafePowerWindow,
 #endif  // USE_ENERGY_POWER_LIMIT
 #endif  // USE_ENERGY_MARGIN_DETECTION
-  &CmndEnergyToday, &CmndEnergyYesterday, &CmndEnergyTotal, &CmndEnergyUsage, &CmndEnergyExport, &CmndTariff};
+  &CmndEnergyToday, &CmndEnergyYesterday, &CmndEnergyTotal, &CmndEnergyUsage, &CmndEnergyExport, &CmndTariff,
+#ifdef USE_ENERGY_HISTORY
+  &CmndEnergyHistory,
+#endif  // USE_ENERGY_HISTORY
+  };
 
 const char kEnergyPhases[] PROGMEM = "|%*_f / %*_f|%*_f / %*_f / %*_f||[%*_f,%*_f]|[%*_f,%*_f,%*_f]";
 
@@ -578,8 +589,177 @@ void EnergyEverySecond(void)
 #ifdef USE_ENERGY_MARGIN_DETECTION
   EnergyMarginCheck();
 #endif  // USE_ENERGY_MARGIN_DETECTION
+
+#ifdef USE_ENERGY_HISTORY
+  EnergyHistoryEverySecond();
+#endif  // USE_ENERGY_HISTORY
+}
+
+#ifdef USE_ENERGY_HISTORY
+/*********************************************************************************************\
+ * Energy history
+ *
+ * Per minute averages of power, voltage and current plus the total energy counter, kept
+ * compressed in RAM (see lib TasmotaTimeSeries) and saved to the filesystem if available
+\*********************************************************************************************/
+
+#include <TasmotaTimeSeries.h>
+
+#ifndef ENERGY_HISTORY_SIZE
+#ifdef ESP8266
+#define ENERGY_HISTORY_SIZE    4096     // Around 8 hours of samples depending on how noisy the meter is
+#else
+#define ENERGY_HISTORY_SIZE    16384    // Around 1.5 days of samples depending on how noisy the meter is
+#endif
+#endif
+#ifndef ENERGY_HISTORY_SAVE
+#define ENERGY_HISTORY_SAVE    60       // Minutes between saves to the filesystem
+#endif
+#define ENERGY_HISTORY_FILE    "/energy.tsd"
+
+enum EnergyHistoryChannels { ENERGY_HIST_POWER, ENERGY_HIST_VOLTAGE, ENERGY_HIST_CURRENT, ENERGY_HIST_TOTAL, ENERGY_HIST_MAX };
+
+const char kEnergyHistoryJson[] PROGMEM = "%s[%u,%*_f,%*_f,%*_f,%*_f]";
+const char kEnergyHistoryCsv[] PROGMEM = "%s%u,%*_f,%*_f,%*_f,%*_f\n";
+#define ENERGY_HISTORY_FIELDS  "\"" D_JSON_TIME "\",\"" D_JSON_POWERUSAGE "\",\"" D_JSON_VOLTAGE "\",\"" D_JSON_CURRENT "\",\"" D_JSON_TOTAL "\""
+
+struct ENERGY_HISTORY {
+  TimeSeries *store;
+  float sum[ENERGY_HIST_TOTAL];         // Sums over the current minute of power, voltage and current
+  uint16_t samples;                     // Number of seconds summed
+  uint16_t save_minutes;
+} EnergyHistory;
+
+typedef struct {
+  uint32_t count;
+  bool csv;
+} EnergyHistoryCtx_t;
+
+void EnergyHistoryInit(void) {
+  EnergyHistory.store = new TimeSeries(ENERGY_HIST_MAX);
+  if (!EnergyHistory.store->begin(ENERGY_HISTORY_SIZE)) {
+    delete EnergyHistory.store;
+    EnergyHistory.store = nullptr;
+    AddLog(LOG_LEVEL_INFO, PSTR("NRG: Not enough memory for history"));
+    return;
+  }
+#ifdef USE_UFILESYS
+  if (TfsLoadFile(PSTR(ENERGY_HISTORY_FILE), EnergyHistory.store->buffer(), EnergyHistory.store->bufferSize())) {
+    if (EnergyHistory.store->restore()) {
+      AddLog(LOG_LEVEL_DEBUG, PSTR("NRG: History restored with %d samples"), EnergyHistory.store->count());
+    } else {
+      AddLog(LOG_LEVEL_INFO, PSTR("NRG: History file discarded"));
+    }
+  }
+#endif  // USE_UFILESYS
+}
+
+void EnergyHistorySave(void) {
+#ifdef USE_UFILESYS
+  if (EnergyHistory.store && EnergyHistory.store->count()) {
+    TfsSaveFile(PSTR(ENERGY_HISTORY_FILE), EnergyHistory.store->buffer(), EnergyHistory.store->bufferSize());
+  }
+  EnergyHistory.save_minutes = 0;
+#endif  // USE_UFILESYS
+}
+
+void EnergyHistoryEverySecond(void) {
+  if (!EnergyHistory.store) { return; }
+
+  float power = 0;
+  float current = 0;
+  for (uint32_t i = 0; i < Energy.phase_count; i++) {
+    power += Energy.active_power[i];
+    current += Energy.current[i];
+  }
+  EnergyHistory.sum[ENERGY_HIST_POWER] += power;
+  EnergyHistory.sum[ENERGY_HIST_VOLTAGE] += Energy.voltage[0];
+  EnergyHistory.sum[ENERGY_HIST_CURRENT] += current;
+  EnergyHistory.samples++;
+
+  if (!RtcTime.valid || (RtcTime.second != 0)) { return; }
+
+  float values[ENERGY_HIST_MAX];
+  for (uint32_t i = 0; i < ENERGY_HIST_TOTAL; i++) {
+    values[i] = EnergyHistory.sum[i] / EnergyHistory.samples;
+    EnergyHistory.sum[i] = 0;
+  }
+  values[ENERGY_HIST_TOTAL] = Energy.total_sum;
+  EnergyHistory.samples = 0;
+  EnergyHistory.store->add(UtcTime(), values);
+
+  EnergyHistory.save_minutes++;
+  if (EnergyHistory.save_minutes >= ENERGY_HISTORY_SAVE) {
+    EnergyHistorySave();
+  }
+}
+
+// Format one sample as JSON array or CSV line, prefixed with a comma if not the first one
+uint32_t EnergyHistoryFormat(char *buf, uint32_t size, EnergyHistoryCtx_t *ctx, uint32_t time, const float *values) {
+  return ext_snprintf_P(buf, size, (ctx->csv) ? kEnergyHistoryCsv : kEnergyHistoryJson,
+    (ctx->count && !ctx->csv) ? "," : "", time,
+    Settings->flag2.wattage_resolution, &values[ENERGY_HIST_POWER],
+    Settings->flag2.voltage_resolution, &values[ENERGY_HIST_VOLTAGE],
+    Settings->flag2.current_resolution, &values[ENERGY_HIST_CURRENT],
+    Settings->flag2.energy_resolution, &values[ENERGY_HIST_TOTAL]);
+}
+
+// Append a sample to the command response, publishing the response each time it is full
+bool EnergyHistoryResponse(void *context, uint32_t time, const float *values) {
+  EnergyHistoryCtx_t *ctx = (EnergyHistoryCtx_t*)context;
+  if (ResponseLength() + 80 > ResponseSize()) {
+    ResponseAppend_P(PSTR("]}}"));
+    MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_STAT, XdrvMailbox.command);
+    Response_P(PSTR("{\"%s\":{\"Data\":["), XdrvMailbox.command);
+    ctx->count = 0;
+  }
+  char sample[80];
+  EnergyHistoryFormat(sample, sizeof(sample), ctx, time, values);
+  ResponseAppend_P(PSTR("%s"), sample);
+  ctx->count++;
+  return true;
+}
+
+#ifdef USE_WEBSERVER
+bool EnergyHistoryWeb(void *context, uint32_t time, const float *values) {
+  EnergyHistoryCtx_t *ctx = (EnergyHistoryCtx_t*)context;
+  char sample[80];
+  uint32_t len = EnergyHistoryFormat(sample, sizeof(sample), ctx, time, values);
+  WSContentSend(sample, len);
+  ctx->count++;
+  return true;
 }
 
+// /eh?from=<epoch>&to=<epoch>&f=csv
+void HandleEnergyHistory(void) {
+  if (!HttpCheckPriviledgedAccess()) { return; }
+
+  char tmp[16];
+  WebGetArg(PSTR("from"), tmp, sizeof(tmp));
+  uint32_t from = strtoul(tmp, nullptr, 10);
+  WebGetArg(PSTR("to"), tmp, sizeof(tmp));
+  uint32_t to = (strlen(tmp)) ? strtoul(tmp, nullptr, 10) : 0xFFFFFFFF;
+  WebGetArg(PSTR("f"), tmp, sizeof(tmp));
+  EnergyHistoryCtx_t ctx = { 0, !strcasecmp_P(tmp, PSTR("csv")) };
+
+  WSContentBegin(200, (ctx.csv) ? CT_PLAIN : CT_APP_JSON);
+  if (ctx.csv) {
+    WSContentSend_P(PSTR(ENERGY_HISTORY_FIELDS "\n"));
+  } else {
+    WSContentSend_P(PSTR("{\"" D_CMND_ENERGYHISTORY "\":{\"Fields\":[" ENERGY_HISTORY_FIELDS "],\"Data\":["));
+  }
+  if (EnergyHistory.store) {
+    EnergyHistory.store->query(from, to, EnergyHistoryWeb, &ctx);
+  }
+  if (!ctx.csv) {
+    WSContentSend_P(PSTR("]}}"));
+  }
+  WSContentEnd();
+}
+#endif  // USE_WEBSERVER
+
+#endif  // USE_ENERGY_HISTORY
+
 /*********************************************************************************************\
  * Commands
 \*********************************************************************************************/
@@ -753,6 +933,37 @@ void CmndTariff(void) {
     GetStateText(Settings->flag3.energy_weekend));             // CMND_TARIFF
 }
 
+#ifdef USE_ENERGY_HISTORY
+void CmndEnergyHistory(void) {
+  // EnergyHistory              - Show history status
+  // EnergyHistory 60           - Show samples of the last 60 minutes
+  // EnergyHistory <from>,<to>  - Show samples between UTC epoch times <from> and <to>
+  if (!EnergyHistory.store) {
+    ResponseCmndFailed();
+    return;
+  }
+  uint32_t values[2] = { 0 };
+  uint32_t params = ParseParameters(2, values);
+  if (0 == params) {
+    Response_P(PSTR("{\"%s\":{\"Samples\":%d,\"First\":%u,\"Last\":%u,\"Used\":%d,\"Size\":%d}}"),
+      XdrvMailbox.command, EnergyHistory.store->count(), EnergyHistory.store->firstTime(), EnergyHistory.store->lastTime(),
+      EnergyHistory.store->used(), EnergyHistory.store->bufferSize());
+    return;
+  }
+  uint32_t from = values[0];
+  uint32_t to = values[1];
+  if (1 == params) {
+    from = (values[0] * 60 < UtcTime()) ? UtcTime() - values[0] * 60 : 0;
+    to = 0xFFFFFFFF;
+  }
+  // Long ranges are published in several messages, only the first one holds the field names
+  EnergyHistoryCtx_t ctx = { 0, false };
+  Response_P(PSTR("{\"%s\":{\"Fields\":[" ENERGY_HISTORY_FIELDS "],\"Data\":["), XdrvMailbox.command);
+  EnergyHistory.store->query(from, to, EnergyHistoryResponse, &ctx);
+  ResponseAppend_P(PSTR("]}}"));
+}
+#endif  // USE_ENERGY_HISTORY
+
 void CmndPowerCal(void) {
   Energy.command_code = CMND_POWERCAL;
   if (XnrgCall(FUNC_COMMAND)) {  // microseconds
@@ -1001,6 +1212,9 @@ void EnergySnsInit(void)
     }
     EnergyUpdateToday();
     ticker_energy.attach_ms(200, Energy200ms);
+#ifdef USE_ENERGY_HISTORY
+    EnergyHistoryInit();
+#endif  // USE_ENERGY_HISTORY
   }
 }
 
@@ -1273,6 +1487,11 @@ bool Xdrv03(uint8_t function)
       case FUNC_COMMAND:
         result = DecodeCommand(kEnergyCommands, EnergyCommand);
         break;
+#if defined(USE_ENERGY_HISTORY) && defined(USE_WEBSERVER)
+      case FUNC_WEB_ADD_HANDLER:
+        WebServer_on(PSTR("/eh"), HandleEnergyHistory);
+        break;
+#endif  // USE_ENERGY_HISTORY && USE_WEBSERVER
     }
   }
   return result;
@@ -1297,6 +1516,9 @@ bool Xsns03(uint8_t function)
 #endif  // USE_WEBSERVER
       case FUNC_SAVE_BEFORE_RESTART:
         EnergySaveState();
+#ifdef USE_ENERGY_HISTORY
+        EnergyHistorySave();
+#endif  // USE_ENERGY_HISTORY
         break;
       case FUNC_INIT:
         EnergySnsInit();
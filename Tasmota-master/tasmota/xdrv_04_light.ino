@@ -122,6 +122,7 @@
 \*********************************************************************************************/
 
 #define XDRV_04              4
+#define XDRV_04_FUNCS        (XFUNC_LOOP | XFUNC_50MS)
 // #define DEBUG_LIGHT
 
 enum LightSchemes { LS_POWER, LS_WAKEUP, LS_CYCLEUP, LS_CYCLEDN, LS_RANDOM, LS_MAX };
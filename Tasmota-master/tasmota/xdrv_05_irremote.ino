@@ -58,6 +58,7 @@ def ir_expand(ir_compact):
 \*********************************************************************************************/
 
 #define XDRV_05             5
+#define XDRV_05_FUNCS       (XFUNC_LOOP | XFUNC_50MS)
 
 #include <IRremoteESP8266.h>
 #include <IRutils.h>
@@ -68,6 +69,12 @@ def ir_expand(ir_compact):
 #define IR_RCV_WHILE_SENDING  0
 #endif
 
+// Simple remotes (NEC, Samsung, Panasonic, JVC, Sony) are reported as soon as their message
+// has arrived in full, rather than when the capture times out. `#define IR_RCV_INCREMENTAL 0` to disable
+#ifndef IR_RCV_INCREMENTAL
+#define IR_RCV_INCREMENTAL  1
+#endif
+
 enum IrErrors { IE_NO_ERROR, IE_INVALID_RAWDATA, IE_INVALID_JSON, IE_SYNTAX_IRSEND, IE_PROTO_UNSUPPORTED };
 
 const char kIrRemoteCommands[] PROGMEM = "|" D_CMND_IRSEND ;
@@ -200,6 +207,9 @@ void IrReceiveInit(void)
   // an IR led is at GPIO_IRRECV
   irrecv = new IRrecv(Pin(GPIO_IRRECV), IR_RCV_BUFFER_SIZE, IR_RCV_TIMEOUT, IR_RCV_SAVE_BUFFER);
   irrecv->setUnknownThreshold(Settings->param[P_IR_UNKNOW_THRESHOLD]);
+#if ENABLE_INCREMENTAL_DECODE
+  irrecv->enableIncrementalDecode(IR_RCV_INCREMENTAL);
+#endif  // ENABLE_INCREMENTAL_DECODE
   irrecv->enableIRIn();                  // Start the receiver
 
   //  AddLog(LOG_LEVEL_DEBUG, PSTR("IrReceive initialized"));
@@ -421,7 +431,11 @@ bool Xdrv05(uint8_t function)
         }
 #endif  // USE_IR_RECEIVE
         break;
+#if IR_RCV_INCREMENTAL && ENABLE_INCREMENTAL_DECODE
+      case FUNC_LOOP:                    // poll often so early-ended messages aren't kept waiting
+#else
       case FUNC_EVERY_50_MSECOND:
+#endif
 #ifdef USE_IR_RECEIVE
         if (PinUsed(GPIO_IRRECV)) {
           IrReceiveCheck();  // check if there's anything on IR side
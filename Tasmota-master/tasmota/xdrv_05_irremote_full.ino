@@ -58,6 +58,7 @@ def ir_expand(ir_compact):
 \*********************************************************************************************/
 
 #define XDRV_05             5
+#define XDRV_05_FUNCS       (XFUNC_LOOP | XFUNC_50MS)
 
 #include <IRremoteESP8266.h>
 #include <IRsend.h>
@@ -71,6 +72,12 @@ def ir_expand(ir_compact):
 #define IR_RCV_WHILE_SENDING  0
 #endif
 
+// Simple remotes (NEC, Samsung, Panasonic, JVC, Sony) are reported as soon as their message
+// has arrived in full, rather than when the capture times out. `#define IR_RCV_INCREMENTAL 0` to disable
+#ifndef IR_RCV_INCREMENTAL
+#define IR_RCV_INCREMENTAL  1
+#endif
+
 enum IrErrors { IE_RESPONSE_PROVIDED, IE_NO_ERROR, IE_INVALID_RAWDATA, IE_INVALID_JSON, IE_SYNTAX_IRSEND, IE_SYNTAX_IRHVAC,
                 IE_UNSUPPORTED_HVAC, IE_UNSUPPORTED_PROTOCOL, IE_MEMORY };
 
@@ -198,53 +205,65 @@ void IrReceiveInit(void)
   // an IR led is at GPIO_IRRECV
   irrecv = new IRrecv(Pin(GPIO_IRRECV), IR_FULL_BUFFER_SIZE, IR__FULL_RCV_TIMEOUT, IR_FULL_RCV_SAVE_BUFFER);
   irrecv->setUnknownThreshold(Settings->param[P_IR_UNKNOW_THRESHOLD]);
+#if ENABLE_INCREMENTAL_DECODE
+  irrecv->enableIncrementalDecode(IR_RCV_INCREMENTAL);
+#endif  // ENABLE_INCREMENTAL_DECODE
   irrecv->enableIRIn();                  // Start the receiver
 }
 
-String sendACJsonState(const stdAc::state_t &state) {
-  JsonGeneratorObject json;
-  json.add(PSTR(D_JSON_IRHVAC_VENDOR), typeToString(state.protocol));
-  json.add(PSTR(D_JSON_IRHVAC_MODEL), state.model);
+// Append a boolean A/C setting to the response, in the library's locale
+void ResponseAppendIrBool(const char* key, bool value) {
+  char text[16];
+  IRac::boolToString(value, text, sizeof(text));
+  ResponseAppend_P(PSTR(",\"%s\":\"%s\""), key, text);
+}
+
+// Append the A/C state as a JSON object to the response
+// All text is written to stack buffers to avoid fragmenting the heap on bursts of IR messages
+void sendACJsonState(const stdAc::state_t &state) {
+  char text[32];                        // Longest protocol name or A/C setting
+
+  typeToString(state.protocol, text, sizeof(text));
+  ResponseAppend_P(PSTR("{\"" D_JSON_IRHVAC_VENDOR "\":\"%s\",\"" D_JSON_IRHVAC_MODEL "\":%d"), text, state.model);
 
-  json.add(PSTR(D_JSON_IRHVAC_MODE), IRac::opmodeToString(state.mode));
+  IRac::opmodeToString(state.mode, text, sizeof(text));
+  ResponseAppend_P(PSTR(",\"" D_JSON_IRHVAC_MODE "\":\"%s\""), text);
   // Home Assistant wants power to be off if mode is also off.
-  if (state.mode == stdAc::opmode_t::kOff) {
-    json.add(PSTR(D_JSON_IRHVAC_POWER),  IRac::boolToString(false));
-  } else {
-    json.add(PSTR(D_JSON_IRHVAC_POWER), IRac::boolToString(state.power));
-  }
-  json.add(PSTR(D_JSON_IRHVAC_CELSIUS), IRac::boolToString(state.celsius));
+  ResponseAppendIrBool(PSTR(D_JSON_IRHVAC_POWER), (state.mode != stdAc::opmode_t::kOff) && state.power);
+  ResponseAppendIrBool(PSTR(D_JSON_IRHVAC_CELSIUS), state.celsius);
   if (floorf(state.degrees) == state.degrees) {
-    json.add(PSTR(D_JSON_IRHVAC_TEMP), (int32_t) floorf(state.degrees));       // integer
+    ResponseAppend_P(PSTR(",\"" D_JSON_IRHVAC_TEMP "\":%d"), (int32_t) floorf(state.degrees));      // integer
   } else {
-    // TODO can do better here
-    json.addStrRaw(PSTR(D_JSON_IRHVAC_TEMP), String(state.degrees, 1).c_str());   // non-integer, limit to only 1 sub-digit
+    ResponseAppend_P(PSTR(",\"" D_JSON_IRHVAC_TEMP "\":%1_f"), &state.degrees);                     // non-integer, limit to only 1 sub-digit
   }
 
-  json.add(PSTR(D_JSON_IRHVAC_FANSPEED), IRac::fanspeedToString(state.fanspeed));
-  json.add(PSTR(D_JSON_IRHVAC_SWINGV), IRac::swingvToString(state.swingv));
-  json.add(PSTR(D_JSON_IRHVAC_SWINGH), IRac::swinghToString(state.swingh));
-  json.add(PSTR(D_JSON_IRHVAC_QUIET), IRac::boolToString(state.quiet));
-  json.add(PSTR(D_JSON_IRHVAC_TURBO), IRac::boolToString(state.turbo));
-  json.add(PSTR(D_JSON_IRHVAC_ECONO), IRac::boolToString(state.econo));
-  json.add(PSTR(D_JSON_IRHVAC_LIGHT), IRac::boolToString(state.light));
-  json.add(PSTR(D_JSON_IRHVAC_FILTER), IRac::boolToString(state.filter));
-  json.add(PSTR(D_JSON_IRHVAC_CLEAN), IRac::boolToString(state.clean));
-  json.add(PSTR(D_JSON_IRHVAC_BEEP), IRac::boolToString(state.beep));
-  json.add(PSTR(D_JSON_IRHVAC_SLEEP), state.sleep);
-
-  String payload = json.toString(); // copy string before returning, the original is on the stack
-  return payload;
+  IRac::fanspeedToString(state.fanspeed, text, sizeof(text));
+  ResponseAppend_P(PSTR(",\"" D_JSON_IRHVAC_FANSPEED "\":\"%s\""), text);
+  IRac::swingvToString(state.swingv, text, sizeof(text));
+  ResponseAppend_P(PSTR(",\"" D_JSON_IRHVAC_SWINGV "\":\"%s\""), text);
+  IRac::swinghToString(state.swingh, text, sizeof(text));
+  ResponseAppend_P(PSTR(",\"" D_JSON_IRHVAC_SWINGH "\":\"%s\""), text);
+  ResponseAppendIrBool(PSTR(D_JSON_IRHVAC_QUIET), state.quiet);
+  ResponseAppendIrBool(PSTR(D_JSON_IRHVAC_TURBO), state.turbo);
+  ResponseAppendIrBool(PSTR(D_JSON_IRHVAC_ECONO), state.econo);
+  ResponseAppendIrBool(PSTR(D_JSON_IRHVAC_LIGHT), state.light);
+  ResponseAppendIrBool(PSTR(D_JSON_IRHVAC_FILTER), state.filter);
+  ResponseAppendIrBool(PSTR(D_JSON_IRHVAC_CLEAN), state.clean);
+  ResponseAppendIrBool(PSTR(D_JSON_IRHVAC_BEEP), state.beep);
+  ResponseAppend_P(PSTR(",\"" D_JSON_IRHVAC_SLEEP "\":%d}"), state.sleep);
 }
 
 void sendIRJsonState(const struct decode_results &results) {
+  char text[2 * kStateSizeMax + 3];     // "0x" + the largest A/C state, also holds the protocol name
+
+  typeToString(results.decode_type, text, sizeof(text));
   ResponseAppend_P(PSTR("\"" D_JSON_IR_PROTOCOL "\":\"%s\",\"" D_JSON_IR_BITS "\":%d"),
-                  typeToString(results.decode_type).c_str(),
+                  text,
                   results.bits);
 
   if (hasACState(results.decode_type)) {
-    ResponseAppend_P(PSTR(",\"" D_JSON_IR_DATA "\":\"%s\""),
-                          resultToHexidecimal(&results).c_str());
+    resultToHexidecimal(&results, text, sizeof(text));
+    ResponseAppend_P(PSTR(",\"" D_JSON_IR_DATA "\":\"%s\""), text);
   } else {
     ResponseAppend_P(PSTR(",\"%s\":"), UNKNOWN != results.decode_type ? PSTR(D_JSON_IR_DATA) : PSTR(D_JSON_IR_HASH));
     if (Settings->flag.ir_receive_decimal) {  // SetOption29 - IR receive data format
@@ -264,7 +283,8 @@ void sendIRJsonState(const struct decode_results &results) {
   stdAc::state_t new_state;
   if (IRAcUtils::decodeToState(&results, &new_state, irhvac_stateful && irac_prev_state.protocol == results.decode_type ? &irac_prev_state : nullptr)) {
     // we have a decoded state
-    ResponseAppend_P(PSTR(",\"" D_CMND_IRHVAC "\":%s"), sendACJsonState(new_state).c_str());
+    ResponseAppend_P(PSTR(",\"" D_CMND_IRHVAC "\":"));
+    sendACJsonState(new_state);
     irac_prev_state = new_state; // store for next time
   }
 }
@@ -382,7 +402,9 @@ uint32_t IrRemoteCmndIrHvacJson(void)
   stdAc::state_t state;
 
   //AddLog(LOG_LEVEL_DEBUG, PSTR("IRHVAC: Received %s"), XdrvMailbox.data);
-  JsonParser parser(XdrvMailbox.data);
+  jsmntok_t tokens[48];   // enough for all the IRHVAC attributes, spills to heap if needed
+  JsonParser parser(XdrvMailbox.data, tokens, ARRAY_SIZE(tokens));
+  parser.buildKeyIndex();   // we look up about 20 keys
   JsonParserObject root = parser.getRootObject();
   if (!root) { return IE_INVALID_JSON; }
 
@@ -461,7 +483,9 @@ uint32_t IrRemoteCmndIrHvacJson(void)
   }
   if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->enableIRIn(); }
 
-  Response_P(PSTR("{\"" D_CMND_IRHVAC "\":%s}"), sendACJsonState(state).c_str());
+  Response_P(PSTR("{\"" D_CMND_IRHVAC "\":"));
+  sendACJsonState(state);
+  ResponseJsonEnd();
   return IE_RESPONSE_PROVIDED;
 }
 
@@ -823,7 +847,11 @@ bool Xdrv05(uint8_t function)
           IrReceiveInit();
         }
         break;
+#if IR_RCV_INCREMENTAL && ENABLE_INCREMENTAL_DECODE
+      case FUNC_LOOP:                    // poll often so early-ended messages aren't kept waiting
+#else
       case FUNC_EVERY_50_MSECOND:
+#endif
         if (PinUsed(GPIO_IRRECV)) {
           IrReceiveCheck();  // check if there's anything on IR side
         }
@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_06                   6
+#define XDRV_06_FUNCS             0
 
 const uint32_t SFB_TIME_AVOID_DUPLICATE = 2000;  // Milliseconds
 
@@ -20,6 +20,7 @@
 #ifdef USE_DOMOTICZ
 
 #define XDRV_07             7
+#define XDRV_07_FUNCS       XFUNC_SECOND
 
 //#define D_PRFX_DOMOTICZ "Domoticz"
 #define D_PRFX_DOMOTICZ "Dz"
@@ -66,6 +66,7 @@
 \*********************************************************************************************/
 
 #define XDRV_10             10
+#define XDRV_10_FUNCS       (XFUNC_LOOP | XFUNC_50MS | XFUNC_100MS | XFUNC_SECOND)
 
 //#define DEBUG_RULES
 
@@ -161,8 +162,86 @@ void (* const RulesCommand[])(void) PROGMEM = {
   LinkedList<MQTT_Subscription> subscriptions;
 #endif  // SUPPORT_MQTT_EVENT
 
+/*******************************************************************************************\
+ * Compiled rules
+ *
+ * A rule set is compiled once into a table of triggers, so events don't need to decompress,
+ * uppercase and re-scan the rule text. Each trigger keeps its JSON keys, compare operator
+ * and value pre-split, and its commands with the position of the %VAR1% style variables.
+ * The event is parsed once, and a trigger is only evaluated if its first JSON key is a
+ * top-level key of the event.
+ *
+ * A rule set is compiled on first use after SetRule() or a settings load, restore or
+ * upgrade changed it.
+\*******************************************************************************************/
+
+#define RULES_MAX_KEYS         12        // JSON levels in a trigger, deeper triggers never match
+#define RULES_MAX_EVENT_KEYS   16        // Top-level event keys indexed, don't filter triggers above
+
+#define RULE_FLAG_TELE         0x01      // Trigger starts with TELE-
+#define RULE_FLAG_BREAK        0x02      // Ends with BREAK instead of ENDON
+#define RULE_FLAG_BACKLOG      0x04      // Commands need an implicit Backlog
+#define RULE_FLAG_ANY_KEY      0x08      // First JSON key is the ? wildcard
+
+#define RULE_VAR_VAR           0x40      // %VARx%, x-1 in low bits
+#define RULE_VAR_MEM           0x80      // %MEMx%, x-1 in low bits
+
+const char kRulesVars[] PROGMEM = "VALUE|TIME|UTCTIME|UPTIME|TIMESTAMP|TOPIC|DEVICEID|MACADDR"
+#if defined(USE_TIMERS) && defined(USE_SUNRISE)
+  "|SUNRISE|SUNSET"
+#endif  // USE_TIMERS and USE_SUNRISE
+#ifdef USE_ZIGBEE
+  "|ZBDEVICE|ZBGROUP|ZBCLUSTER|ZBENDPOINT"
+#endif  // USE_ZIGBEE
+  ;
+
+enum RulesVars { RULE_VAR_VALUE, RULE_VAR_TIME, RULE_VAR_UTCTIME, RULE_VAR_UPTIME, RULE_VAR_TIMESTAMP, RULE_VAR_TOPIC,
+                 RULE_VAR_DEVICEID, RULE_VAR_MACADDR,
+#if defined(USE_TIMERS) && defined(USE_SUNRISE)
+                 RULE_VAR_SUNRISE, RULE_VAR_SUNSET,
+#endif  // USE_TIMERS and USE_SUNRISE
+#ifdef USE_ZIGBEE
+                 RULE_VAR_ZBDEVICE, RULE_VAR_ZBGROUP, RULE_VAR_ZBCLUSTER, RULE_VAR_ZBENDPOINT,
+#endif  // USE_ZIGBEE
+               };
+
+typedef struct RuleVarSlot {
+  uint16_t pos;                          // Offset in commands
+  uint8_t len;                           // Length including both %
+  uint8_t var;                           // RULE_VAR_xxx
+} RuleVarSlot;
+
+typedef struct RuleTrigger {
+  uint32_t key_hash;                     // GetHash() of the first JSON key
+  uint16_t trigger;                      // Text offset of "INA219#CURRENT>0.100"
+  uint16_t keys;                         // Text offset of JSON keys "INA219\0CURRENT\0"
+  uint16_t param;                        // Text offset of compare value "0.100" or "%VAR1%"
+  uint16_t commands;                     // Text offset of commands "Backlog Dimmer 10;Color 100000"
+  uint16_t slot;                         // First variable slot
+  uint8_t slot_count;                    // Number of variable slots
+  uint8_t key_count;                     // Number of JSON keys
+  uint8_t index;                         // Array index of "CURRENT[2]" or 0
+  int8_t compare;                        // COMPARE_OPERATOR_xxx
+  uint8_t flags;                         // RULE_FLAG_xxx
+} RuleTrigger;
+
+typedef struct RuleSetCompiled {
+  char *text;                            // NULL separated strings
+  RuleTrigger *triggers;
+  RuleVarSlot *slots;
+  uint16_t count;                        // Number of triggers
+  uint16_t slot_count;
+} RuleSetCompiled;
+
+typedef struct RulesEvent {
+  JsonParser *parser;
+  uint32_t key_hash[RULES_MAX_EVENT_KEYS];  // GetHash() of the top-level keys
+  uint8_t key_count;                     // 0xFF if too many keys to filter
+} RulesEvent;
+
 struct RULES {
   String event_value;
+  RuleSetCompiled *compiled[MAX_RULE_SETS] = { nullptr };
   unsigned long timer[MAX_RULE_TIMERS] = { 0 };
   uint32_t triggers[MAX_RULE_SETS] = { 0 };
   uint8_t trigger_count[MAX_RULE_SETS] = { 0 };
@@ -177,6 +256,7 @@ struct RULES {
   bool teleperiod = false;
   bool busy = false;
   bool no_execute = false;   // Don't actually execute rule commands
+  uint8_t recompile = 0;     // Bitmask of rule sets changed since compiled
 
   char event_data[100];
 } Rules;
@@ -324,11 +404,20 @@ int32_t SetRule_compress(uint32_t idx, const char *in, size_t in_len, char *out,
 }
 #endif // USE_UNISHOX_COMPRESSION
 
+// Rules text was replaced without SetRule() (settings load, restore, reset or upgrade)
+void RulesSettingsChanged(void) {
+  for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+    k_rules[i] = (const char*) nullptr;       // Drop the uncompressed copy
+  }
+  Rules.recompile = (1 << MAX_RULE_SETS) -1;  // compiled rule sets are freed on next use, one may be running
+}
+
 // Returns:
 //   >= 0 : the actual stored size
 //   <0 : not enough space
 int32_t SetRule(uint32_t idx, const char *content, bool append = false) {
   if (nullptr == content) { content = ""; }   // if nullptr, use empty string
+  bitSet(Rules.recompile, idx);               // compiled rule set is freed on next use, it may be running
   size_t len_in = strlen(content);
   bool needsCompress = false;
   size_t offset = 0;
@@ -410,84 +499,94 @@ int32_t SetRule(uint32_t idx, const char *content, bool append = false) {
 
 /*******************************************************************************************/
 
-bool RulesRuleMatch(uint8_t rule_set, String &event, String &rule, bool stop_all_rules)
+bool RulesRuleMatch(uint8_t rule_set, const struct RuleSetCompiled *set, const struct RuleTrigger &trigger, struct RulesEvent &event, bool stop_all_rules)
 {
   // event = {"INA219":{"Voltage":4.494,"Current":0.020,"Power":0.089}}
   // event = {"System":{"Boot":1}}
-  // rule = "INA219#CURRENT>0.100"
+  // trigger = "INA219#CURRENT>0.100"
 
   bool match = false;
-  char stemp[10];
 
-  // Step1: Analyse rule
-  String rule_expr = rule;                             // "TELE-INA219#CURRENT>0.100"
-  if (Rules.teleperiod) {
-    int ppos = rule_expr.indexOf(F("TELE-"));          // "TELE-INA219#CURRENT>0.100" or "INA219#CURRENT>0.100"
-    if (ppos == -1) { return false; }                  // No pre-amble in rule
-    rule_expr = rule.substring(5);                     // "INA219#CURRENT>0.100" or "SYSTEM#BOOT"
+  // Step1: Skip triggers not matching the event
+  // A TELE- trigger, like "TELE-INA219#CURRENT>0.100", only matches teleperiod events and
+  // other triggers only match other events.
+  if (Rules.teleperiod != (0 != (trigger.flags & RULE_FLAG_TELE))) { return false; }
+  if (!(trigger.flags & RULE_FLAG_ANY_KEY) && (event.key_count != 0xFF)) {
+    uint32_t i;
+    for (i = 0; i < event.key_count; i++) {
+      if (event.key_hash[i] == trigger.key_hash) { break; }
+    }
+    if (i == event.key_count) { return false; }        // First key not in event
+  }
+  if (trigger.key_count > RULES_MAX_KEYS) { return false; }  // Abandon possible loop
+
+  // Step2: Search keys "INA219" then "CURRENT"
+  event.parser->setCurrent();                          // Commands of previous triggers may have used another parser
+  JsonParserObject obj = event.parser->getRootObject();
+  const char* key = set->text + trigger.keys;
+  for (uint32_t i = 1; i < trigger.key_count; i++) {
+    obj = obj[key].getObject();
+    if (!obj) { return false; }                        // not found
+    key += strlen(key) +1;
   }
 
-  String rule_name, rule_param;
-  int8_t compareOperator = parseCompareExpression(rule_expr, rule_name, rule_param);  // Parse the compare expression.Return operator and the left, right part of expression
-
-  // rule_name  = "INA219#CURRENT"
-  // rule_param = "0.100" or "%VAR1%"
-
-#ifdef DEBUG_RULES
-  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM1: Teleperiod %d, Expr %s, Name %s, Param %s"), Rules.teleperiod, rule_expr.c_str(), rule_name.c_str(), rule_param.c_str());
-#endif
+  JsonParserToken val = obj[key];
+  if (!val) { return false; }                          // last level not found
+  const char* str_value;
+  if (trigger.index) {
+    if (val.isArray()) {
+      str_value = (val.getArray())[trigger.index -1].getStr();
+    } else {
+      str_value = val.getStr();
+    }
+  } else {
+    str_value = val.getStr();                          // "CURRENT"
+  }
 
+  // Step3: Get compare value "0.100" or "%VAR1%"
   char rule_svalue[80] = { 0 };
   float rule_value = 0;
-  if (compareOperator != COMPARE_OPERATOR_NONE) {
-    for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
-      snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
-      if (rule_param.startsWith(stemp)) {
-        rule_param = rules_vars[i];
-        break;
+  if (trigger.compare != COMPARE_OPERATOR_NONE) {
+    const char* param = set->text + trigger.param;
+    if ('%' == param[0]) {
+      String rule_param = param;
+      char stemp[10];
+      for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
+        snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
+        if (rule_param.startsWith(stemp)) {
+          rule_param = rules_vars[i];
+          break;
+        }
       }
-    }
-    for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
-      snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
-      if (rule_param.startsWith(stemp)) {
-        rule_param = SettingsText(SET_MEM1 + i);
-        break;
+      for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
+        snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
+        if (rule_param.startsWith(stemp)) {
+          rule_param = SettingsText(SET_MEM1 + i);
+          break;
+        }
+      }
+      if (rule_param.startsWith(F("%TIME%"))) {
+        rule_param = String(MinutesPastMidnight());
+      }
+      if (rule_param.startsWith(F("%UPTIME%"))) {
+        rule_param = String(MinutesUptime());
+      }
+      if (rule_param.startsWith(F("%TIMESTAMP%"))) {
+        rule_param = GetDateAndTime(DT_LOCAL).c_str();
       }
-    }
-    if (rule_param.startsWith(F("%TIME%"))) {
-      rule_param = String(MinutesPastMidnight());
-    }
-    if (rule_param.startsWith(F("%UPTIME%"))) {
-      rule_param = String(MinutesUptime());
-    }
-    if (rule_param.startsWith(F("%TIMESTAMP%"))) {
-      rule_param = GetDateAndTime(DT_LOCAL).c_str();
-    }
 #if defined(USE_TIMERS) && defined(USE_SUNRISE)
-    if (rule_param.startsWith(F("%SUNRISE%"))) {
-      rule_param = String(SunMinutes(0));
-    }
-    if (rule_param.startsWith(F("%SUNSET%"))) {
-      rule_param = String(SunMinutes(1));
-    }
+      if (rule_param.startsWith(F("%SUNRISE%"))) {
+        rule_param = String(SunMinutes(0));
+      }
+      if (rule_param.startsWith(F("%SUNSET%"))) {
+        rule_param = String(SunMinutes(1));
+      }
 #endif  // USE_TIMERS and USE_SUNRISE
-// #ifdef USE_ZIGBEE
-//     if (rule_param.startsWith(F("%ZBDEVICE%"))) {
-//       snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
-//       rule_param = String(stemp);
-//     }
-//     if (rule_param.startsWith(F("%ZBGROUP%"))) {
-//       rule_param = String(Z_GetLastGroup());
-//     }
-//     if (rule_param.startsWith(F("%ZBCLUSTER%"))) {
-//       rule_param = String(Z_GetLastCluster());
-//     }
-//     if (rule_param.startsWith(F("%ZBENDPOINT%"))) {
-//       rule_param = String(Z_GetLastEndpoint());
-//     }
-// #endif
-    rule_param.toUpperCase();
-    strlcpy(rule_svalue, rule_param.c_str(), sizeof(rule_svalue));
+      rule_param.toUpperCase();
+      strlcpy(rule_svalue, rule_param.c_str(), sizeof(rule_svalue));
+    } else {
+      strlcpy(rule_svalue, param, sizeof(rule_svalue));  // Already uppercase
+    }
 
     int temp_value = GetStateNumber(rule_svalue);
     if (temp_value > -1) {
@@ -497,73 +596,22 @@ bool RulesRuleMatch(uint8_t rule_set, String &event, String &rule, bool stop_all
     }
   }
 
-  // Step2: Search rule_name
-  int pos;
-  int rule_name_idx = 0;
-  if ((pos = rule_name.indexOf(F("["))) > 0) {         // "SUBTYPE1#CURRENT[1]"
-    rule_name_idx = rule_name.substring(pos +1).toInt();
-    if ((rule_name_idx < 1) || (rule_name_idx > 6)) {  // Allow indexes 1 to 6
-      rule_name_idx = 1;
-    }
-    rule_name = rule_name.substring(0, pos);           // "SUBTYPE1#CURRENT"
-  }
-
-  String buf = event;                                  // Copy the string into a new buffer that will be modified
-
-// Do not do below replace as it will replace escaped quote too.
-//  buf.replace("\\"," ");                               // "Disable" any escaped control character
-
-//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM2: RulesRuleMatch |%s|"), buf.c_str());
-
-  JsonParser parser((char*)buf.c_str());
-  JsonParserObject obj = parser.getRootObject();
-  if (!obj) {
-//    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event too long (%d)"), event.length());
-    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: No valid JSON (%s)"), buf.c_str());
-    return false; // No valid JSON data
-  }
-  String subtype;
-  uint32_t i = 0;
-  while ((pos = rule_name.indexOf(F("#"))) > 0) {      // "SUBTYPE1#SUBTYPE2#CURRENT"
-    subtype = rule_name.substring(0, pos);
-    obj = obj[subtype.c_str()].getObject();
-    if (!obj) { return false; }                        // not found
-
-    rule_name = rule_name.substring(pos +1);
-    if (i++ > 10) { return false; }                    // Abandon possible loop
-
-    yield();
-  }
-
-  JsonParserToken val = obj[rule_name.c_str()];
-  if (!val) { return false; }                          // last level not found
-  const char* str_value;
-  if (rule_name_idx) {
-    if (val.isArray()) {
-      str_value = (val.getArray())[rule_name_idx -1].getStr();
-    } else {
-      str_value = val.getStr();
-    }
-  } else {
-    str_value = val.getStr();                          // "CURRENT"
-  }
-
 #ifdef DEBUG_RULES
-  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM3: Name %s, Value |%s|, TrigCnt %d, TrigSt %d, Source %s, Json |%s|"),
-    rule_name.c_str(), rule_svalue, Rules.trigger_count[rule_set], bitRead(Rules.triggers[rule_set],
-    Rules.trigger_count[rule_set]), event.c_str(), (str_value[0] != '\0') ? str_value : "none");
+  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM3: Trigger %s, Value |%s|, TrigCnt %d, TrigSt %d, Found |%s|"),
+    set->text + trigger.trigger, rule_svalue, Rules.trigger_count[rule_set], bitRead(Rules.triggers[rule_set],
+    Rules.trigger_count[rule_set]), (str_value[0] != '\0') ? str_value : "none");
 #endif
 
   Rules.event_value = str_value;                       // Prepare %value%
 
-  // Step 3: Compare rule (value)
+  // Step 4: Compare rule (value)
   float value = 0;
   if (str_value) {
     value = CharToFloat((char*)str_value);
     int int_value = int(value);
     int int_rule_value = int(rule_value);
     String str_str_value = String(str_value);
-    switch (compareOperator) {
+    switch (trigger.compare) {
       case COMPARE_OPERATOR_EXACT_DIVISION:
         match = (int_rule_value && (int_value % int_rule_value) == 0);
         break;
@@ -664,126 +712,292 @@ int8_t parseCompareExpression(String &expr, String &leftExpr, String &rightExpr)
   return compare;
 }
 
-void RulesVarReplace(String &commands, const String &sfind, const String &replace)
+void RulesFreeCompiled(uint32_t rule_set)
 {
-//  String ufind = sfind;
-//  ufind.toUpperCase();
-//  char *find = (char*)ufind.c_str();
-  char *find = (char*)sfind.c_str();
-  uint32_t flen = strlen(find);
-
-  String ucommand = commands;
-  ucommand.toUpperCase();
-  char *read_from = (char*)ucommand.c_str();
-  char *write_to = (char*)commands.c_str();
-  char *found_at;
-  while ((found_at = strstr(read_from, find)) != nullptr) {
-    write_to += (found_at - read_from);
-    memmove_P(write_to, find, flen);                      // Make variable Uppercase
-    write_to += flen;
-    read_from = found_at + flen;
-  }
-
-  commands.replace(find, replace);
+  RuleSetCompiled *set = Rules.compiled[rule_set];
+  if (set) {
+    free(set->text);
+    free(set->triggers);
+    free(set->slots);
+    free(set);
+    Rules.compiled[rule_set] = nullptr;
+  }
 }
 
-/*******************************************************************************************/
-
-bool RuleSetProcess(uint8_t rule_set, String &event_saved)
+// Returns the RULE_VAR_xxx of variable `name` (without the %), or -1 if unknown
+int32_t RulesVarCode(const char *name)
 {
-  bool serviced = false;
-  char stemp[10];
+  char dummy[2];
+  int32_t code = GetCommandCode(dummy, sizeof(dummy), name, kRulesVars);
+  if (code >= 0) { return code; }
+
+  uint32_t max_index;
+  if (!strncasecmp_P(name, PSTR("VAR"), 3)) {
+    code = RULE_VAR_VAR;
+    max_index = MAX_RULE_VARS;
+  }
+  else if (!strncasecmp_P(name, PSTR("MEM"), 3)) {
+    code = RULE_VAR_MEM;
+    max_index = MAX_RULE_MEMS;
+  }
+  else { return -1; }
+  name += 3;
+  if ((name[0] < '1') || (name[0] > '9')) { return -1; }  // No digit or leading zero
+  uint32_t index = 0;
+  while (*name) {
+    if (!isdigit(*name)) { return -1; }
+    index = index * 10 + (*name++ - '0');
+    if (index > max_index) { return -1; }
+  }
+  return code | (index -1);
+}
 
-  delay(0);                                               // Prohibit possible loop software watchdog
+void RulesCompile(uint32_t rule_set)
+{
+  RulesFreeCompiled(rule_set);
+  bitClear(Rules.recompile, rule_set);
 
-#ifdef DEBUG_RULES
-  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP1: Event = %s, Rule = %s"), event_saved.c_str(), Settings->rules[rule_set]);
-#endif
+  RuleSetCompiled *set = (RuleSetCompiled*)calloc(1, sizeof(RuleSetCompiled));
+  if (!set) { return; }
+  Rules.compiled[rule_set] = set;
 
   String rules = GetRule(rule_set);
+  // Each trigger stores its trigger, JSON keys, compare value and commands, never more than twice the rule text
+  uint32_t text_size = 2 * rules.length() + rules.length() / 2 + 8;
+  set->text = (char*)malloc(text_size);
+  if (!set->text) { return; }
+  uint32_t text_len = 0;
 
-  Rules.trigger_count[rule_set] = 0;
   int plen = 0;
   int plen2 = 0;
-  bool stop_all_rules = false;
   while (true) {
     rules = rules.substring(plen);                        // Select relative to last rule
     rules.trim();
-    if (!rules.length()) { return serviced; }             // No more rules
+    if (!rules.length()) { break; }                       // No more rules
 
     String rule = rules;
     rule.toUpperCase();                                   // "ON INA219#CURRENT>0.100 DO BACKLOG DIMMER 10;COLOR 100000 ENDON"
-    if (!rule.startsWith(F("ON "))) { return serviced; }     // Bad syntax - Nothing to start on
+    if (!rule.startsWith(F("ON "))) { break; }            // Bad syntax - Nothing to start on
 
     int pevt = rule.indexOf(F(" DO "));
-    if (pevt == -1) { return serviced; }                  // Bad syntax - Nothing to do
+    if (pevt == -1) { break; }                            // Bad syntax - Nothing to do
     String event_trigger = rule.substring(3, pevt);       // "INA219#CURRENT>0.100"
     event_trigger.trim();
 
     plen = rule.indexOf(F(" ENDON"));
     plen2 = rule.indexOf(F(" BREAK"));
-    if ((plen == -1) && (plen2 == -1)) { return serviced; } // Bad syntax - No ENDON neither BREAK
+    if ((plen == -1) && (plen2 == -1)) { break; }         // Bad syntax - No ENDON neither BREAK
 
     if (plen == -1) { plen = 9999; }
     if (plen2 == -1) { plen2 = 9999; }
     plen = tmin(plen, plen2);
 
     String commands = rules.substring(pevt +4, plen);     // "Backlog Dimmer 10;Color 100000"
-    Rules.event_value = "";
-    String event = event_saved;
+    commands.trim();
 
-#ifdef DEBUG_RULES
-    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP2: Event |%s|, Rule |%s|, Command(s) |%s|"), event.c_str(), event_trigger.c_str(), commands.c_str());
-#endif
+    RuleTrigger *triggers = (RuleTrigger*)realloc(set->triggers, (set->count +1) * sizeof(RuleTrigger));
+    if (!triggers) { break; }
+    set->triggers = triggers;
+    RuleTrigger &trigger = triggers[set->count];
+    memset(&trigger, 0, sizeof(trigger));
 
-    if (RulesRuleMatch(rule_set, event, event_trigger, stop_all_rules)) {
-      if (Rules.no_execute) return true;
-      if (plen == plen2) { stop_all_rules = true; }       // If BREAK was used on a triggered rule, Stop execution of this rule set
-      commands.trim();
-      String ucommand = commands;
-      ucommand.toUpperCase();
-
-//      if (!ucommand.startsWith("BACKLOG")) { commands = "backlog " + commands; }  // Always use Backlog to prevent power race exception
-      // Use Backlog with event to prevent rule event loop exception unless IF is used which uses an implicit backlog
-      if ((ucommand.indexOf(F("IF ")) == -1) &&
-          (ucommand.indexOf(F("EVENT ")) != -1) &&
-          (ucommand.indexOf(F("BACKLOG ")) == -1)) {
-        commands = String(F("backlog ")) + commands;
-      }
+    if (plen == plen2) { trigger.flags |= RULE_FLAG_BREAK; }  // BREAK stops execution of this rule set when triggered
+    plen += 6;
 
-      RulesVarReplace(commands, F("%VALUE%"), Rules.event_value);
-      for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
-        snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
-        RulesVarReplace(commands, stemp, rules_vars[i]);
+    String rule_expr = event_trigger;                     // "TELE-INA219#CURRENT>0.100"
+    if (event_trigger.indexOf(F("TELE-")) != -1) {
+      trigger.flags |= RULE_FLAG_TELE;
+      rule_expr = event_trigger.substring(5);             // "INA219#CURRENT>0.100" or "SYSTEM#BOOT"
+    }
+    String rule_name, rule_param;
+    trigger.compare = parseCompareExpression(rule_expr, rule_name, rule_param);
+    // rule_name  = "INA219#CURRENT"
+    // rule_param = "0.100" or "%VAR1%"
+
+    int pos;
+    if ((pos = rule_name.indexOf(F("["))) > 0) {          // "SUBTYPE1#CURRENT[1]"
+      int rule_name_idx = rule_name.substring(pos +1).toInt();
+      if ((rule_name_idx < 1) || (rule_name_idx > 6)) {   // Allow indexes 1 to 6
+        rule_name_idx = 1;
       }
-      for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
-        snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
-        RulesVarReplace(commands, stemp, SettingsText(SET_MEM1 +i));
+      trigger.index = rule_name_idx;
+      rule_name = rule_name.substring(0, pos);            // "SUBTYPE1#CURRENT"
+    }
+
+    // Keep strings NULL separated in text
+    trigger.trigger = text_len;
+    strlcpy(set->text + text_len, event_trigger.c_str(), text_size - text_len);
+    text_len += event_trigger.length() +1;
+
+    trigger.keys = text_len;
+    while ((pos = rule_name.indexOf(F("#"))) > 0) {       // "SUBTYPE1#SUBTYPE2#CURRENT"
+      strlcpy(set->text + text_len, rule_name.c_str(), pos +1);
+      text_len += pos +1;
+      trigger.key_count++;
+      rule_name = rule_name.substring(pos +1);
+      if (trigger.key_count > RULES_MAX_KEYS) { break; }
+    }
+    strlcpy(set->text + text_len, rule_name.c_str(), text_size - text_len);
+    text_len += rule_name.length() +1;
+    trigger.key_count++;
+    const char *first_key = set->text + trigger.keys;
+    trigger.key_hash = GetHash(first_key, strlen(first_key));
+    if (!strcmp_P(first_key, PSTR("?"))) { trigger.flags |= RULE_FLAG_ANY_KEY; }
+
+    trigger.param = text_len;
+    strlcpy(set->text + text_len, rule_param.c_str(), text_size - text_len);
+    text_len += rule_param.length() +1;
+
+    trigger.commands = text_len;
+    strlcpy(set->text + text_len, commands.c_str(), text_size - text_len);
+    text_len += commands.length() +1;
+
+    String ucommand = commands;
+    ucommand.toUpperCase();
+    // Use Backlog with event to prevent rule event loop exception unless IF is used which uses an implicit backlog
+    if ((ucommand.indexOf(F("IF ")) == -1) &&
+        (ucommand.indexOf(F("EVENT ")) != -1) &&
+        (ucommand.indexOf(F("BACKLOG ")) == -1)) {
+      trigger.flags |= RULE_FLAG_BACKLOG;
+    }
+
+    // Locate variables like %VALUE% or %VAR1% in the commands
+    trigger.slot = set->slot_count;
+    const char *cmd = set->text + trigger.commands;
+    const char *start;
+    while ((start = strchr(cmd, '%')) != nullptr) {
+      const char *end = strchr(start +1, '%');
+      if (!end) { break; }
+      char name[12];
+      uint32_t name_len = end - start -1;
+      int32_t var = -1;
+      if ((name_len > 0) && (name_len < sizeof(name))) {
+        strlcpy(name, start +1, name_len +1);
+        var = RulesVarCode(name);
       }
-      RulesVarReplace(commands, F("%TIME%"), String(MinutesPastMidnight()));
-      RulesVarReplace(commands, F("%UTCTIME%"), String(UtcTime()));
-      RulesVarReplace(commands, F("%UPTIME%"), String(MinutesUptime()));
-      RulesVarReplace(commands, F("%TIMESTAMP%"), GetDateAndTime(DT_LOCAL));
-      RulesVarReplace(commands, F("%TOPIC%"), TasmotaGlobal.mqtt_topic);
-      snprintf_P(stemp, sizeof(stemp), PSTR("%06X"), ESP_getChipId());
-      RulesVarReplace(commands, F("%DEVICEID%"), stemp);
-      RulesVarReplace(commands, F("%MACADDR%"), NetworkUniqueId());
+      if ((var < 0) || (trigger.slot_count == 255)) {
+        cmd = end;                                        // Closing % may open the next variable
+        continue;
+      }
+      RuleVarSlot *slots = (RuleVarSlot*)realloc(set->slots, (set->slot_count +1) * sizeof(RuleVarSlot));
+      if (!slots) { break; }
+      set->slots = slots;
+      slots[set->slot_count].pos = start - (set->text + trigger.commands);
+      slots[set->slot_count].len = name_len +2;
+      slots[set->slot_count].var = var;
+      set->slot_count++;
+      trigger.slot_count++;
+      cmd = end +1;
+    }
+
+#ifdef DEBUG_RULES
+    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RC1: Trigger |%s|, Keys %d, Param |%s|, Command(s) |%s|, Vars %d"),
+      set->text + trigger.trigger, trigger.key_count, set->text + trigger.param, set->text + trigger.commands, trigger.slot_count);
+#endif
+
+    set->count++;
+  }
+
+  char *text = (char*)realloc(set->text, text_len +1);   // Release unused text
+  if (text) { set->text = text; }
+}
+
+// Returns the commands of `trigger` with its variables replaced by their current value
+String RulesExpandCommands(const struct RuleSetCompiled *set, const struct RuleTrigger &trigger)
+{
+  const char *cmd = set->text + trigger.commands;
+  String commands;
+  commands.reserve(strlen(cmd) + 16);
+  if (trigger.flags & RULE_FLAG_BACKLOG) {
+    commands = F("backlog ");
+  }
+
+  char stemp[10];
+  uint32_t done = 0;
+  for (uint32_t i = 0; i < trigger.slot_count; i++) {
+    const RuleVarSlot &slot = set->slots[trigger.slot + i];
+    while (done < slot.pos) { commands += cmd[done++]; }  // String::concat(ptr, len) is not available on ESP32
+    done += slot.len;
+
+    if (slot.var & RULE_VAR_VAR) {
+      commands += rules_vars[slot.var & 0x3F];
+    }
+    else if (slot.var & RULE_VAR_MEM) {
+      commands += SettingsText(SET_MEM1 + (slot.var & 0x3F));
+    }
+    else {
+      switch (slot.var) {
+        case RULE_VAR_VALUE:     commands += Rules.event_value; break;
+        case RULE_VAR_TIME:      commands += String(MinutesPastMidnight()); break;
+        case RULE_VAR_UTCTIME:   commands += String(UtcTime()); break;
+        case RULE_VAR_UPTIME:    commands += String(MinutesUptime()); break;
+        case RULE_VAR_TIMESTAMP: commands += GetDateAndTime(DT_LOCAL); break;
+        case RULE_VAR_TOPIC:     commands += TasmotaGlobal.mqtt_topic; break;
+        case RULE_VAR_DEVICEID:
+          snprintf_P(stemp, sizeof(stemp), PSTR("%06X"), ESP_getChipId());
+          commands += stemp;
+          break;
+        case RULE_VAR_MACADDR:   commands += NetworkUniqueId(); break;
 #if defined(USE_TIMERS) && defined(USE_SUNRISE)
-      RulesVarReplace(commands, F("%SUNRISE%"), String(SunMinutes(0)));
-      RulesVarReplace(commands, F("%SUNSET%"), String(SunMinutes(1)));
+        case RULE_VAR_SUNRISE:   commands += String(SunMinutes(0)); break;
+        case RULE_VAR_SUNSET:    commands += String(SunMinutes(1)); break;
 #endif  // USE_TIMERS and USE_SUNRISE
 #ifdef USE_ZIGBEE
-      snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
-      RulesVarReplace(commands, F("%ZBDEVICE%"), String(stemp));
-      RulesVarReplace(commands, F("%ZBGROUP%"), String(Z_GetLastGroup()));
-      RulesVarReplace(commands, F("%ZBCLUSTER%"), String(Z_GetLastCluster()));
-      RulesVarReplace(commands, F("%ZBENDPOINT%"), String(Z_GetLastEndpoint()));
+        case RULE_VAR_ZBDEVICE:
+          snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
+          commands += stemp;
+          break;
+        case RULE_VAR_ZBGROUP:   commands += String(Z_GetLastGroup()); break;
+        case RULE_VAR_ZBCLUSTER: commands += String(Z_GetLastCluster()); break;
+        case RULE_VAR_ZBENDPOINT: commands += String(Z_GetLastEndpoint()); break;
+#endif  // USE_ZIGBEE
+      }
+    }
+  }
+  commands += cmd + done;
+  return commands;
+}
+
+/*******************************************************************************************/
+
+bool RuleSetProcess(uint8_t rule_set, struct RulesEvent &event)
+{
+  bool serviced = false;
+
+  delay(0);                                               // Prohibit possible loop software watchdog
+
+#ifdef DEBUG_RULES
+  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP1: Rule = %s"), Settings->rules[rule_set]);
 #endif
 
+  if (bitRead(Rules.recompile, rule_set) || !Rules.compiled[rule_set]) {
+    RulesCompile(rule_set);
+  }
+  const RuleSetCompiled *set = Rules.compiled[rule_set];
+  if (!set || !set->text) { return serviced; }
+
+  Rules.trigger_count[rule_set] = 0;
+  bool stop_all_rules = false;
+  for (uint32_t i = 0; i < set->count; i++) {
+    const RuleTrigger &trigger = set->triggers[i];
+    Rules.event_value = "";
+
+#ifdef DEBUG_RULES
+    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP2: Rule |%s|, Command(s) |%s|"), set->text + trigger.trigger, set->text + trigger.commands);
+#endif
+
+    if (RulesRuleMatch(rule_set, set, trigger, event, stop_all_rules)) {
+      if (Rules.no_execute) {
+        serviced = true;
+        break;
+      }
+      if (trigger.flags & RULE_FLAG_BREAK) { stop_all_rules = true; }  // If BREAK was used on a triggered rule, Stop execution of this rule set
+
+      String commands = RulesExpandCommands(set, trigger);
       char command[commands.length() +1];
       strlcpy(command, commands.c_str(), sizeof(command));
 
-      AddLog(LOG_LEVEL_INFO, PSTR("RUL: %s performs \"%s\""), event_trigger.c_str(), command);
+      AddLog(LOG_LEVEL_INFO, PSTR("RUL: %s performs \"%s\""), set->text + trigger.trigger, command);
 
 //      Response_P(S_JSON_COMMAND_SVALUE, D_CMND_RULE, D_JSON_INITIATED);
 //      MqttPublishPrefixTopic_P(RESULT_OR_STAT, PSTR(D_CMND_RULE));
@@ -794,9 +1008,12 @@ bool RuleSetProcess(uint8_t rule_set, String &event_saved)
       ExecuteCommand(command, SRC_RULE);
       serviced = true;
     }
-    plen += 6;
     Rules.trigger_count[rule_set]++;
   }
+
+  if (Settings->flag4.compress_rules_cpu) {               // SetOption94 - Trade CPU for RAM, don't keep compiled rules
+    RulesFreeCompiled(rule_set);
+  }
   return serviced;
 }
 
@@ -820,6 +1037,18 @@ bool RulesProcessEvent(const char *json_event)
   AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: ProcessEvent |%s|"), json_event);
 #endif
 
+  bool enabled = false;                                   // Skip parsing if no rule set can run
+  for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+    if (GetRuleLen(i) && bitRead(Settings->rule_enabled, i)) {
+      enabled = true;
+      break;
+    }
+  }
+  if (!enabled) {
+    Rules.busy = false;
+    return serviced;
+  }
+
   String event_saved = json_event;
   // json_event = {"INA219":{"Voltage":4.494,"Current":0.020,"Power":0.089}}
   // json_event = {"System":{"Boot":1}}
@@ -836,9 +1065,29 @@ bool RulesProcessEvent(const char *json_event)
   AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event |%s|"), event_saved.c_str());
 #endif
 
-  for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
-    if (GetRuleLen(i) && bitRead(Settings->rule_enabled, i)) {
-      if (RuleSetProcess(i, event_saved)) { serviced = true; }
+  // Parse the event once for all rule sets
+  JsonParser parser((char*)event_saved.c_str());
+  JsonParserObject root = parser.getRootObject();
+  if (!root) {
+    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: No valid JSON (%s)"), json_event);
+  } else {
+    RulesEvent event;
+    event.parser = &parser;
+    event.key_count = 0;
+    for (auto key : root) {
+      if (event.key_count >= RULES_MAX_EVENT_KEYS) {
+        event.key_count = 0xFF;                           // Too many keys, evaluate all triggers
+        break;
+      }
+      const char *name = key.getStr();
+      event.key_hash[event.key_count++] = GetHash(name, strlen(name));
+    }
+
+    for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+      // Checked for each rule set as an earlier one may enable or disable it (Rule2 0)
+      if (GetRuleLen(i) && bitRead(Settings->rule_enabled, i)) {
+        if (RuleSetProcess(i, event)) { serviced = true; }
+      }
     }
   }
 
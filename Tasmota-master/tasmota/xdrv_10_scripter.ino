@@ -41,6 +41,7 @@ keywords if then else endif, or, and are better readable for beginners (others m
 \*********************************************************************************************/
 
 #define XDRV_10             10
+#define XDRV_10_FUNCS       (XFUNC_LOOP | XFUNC_50MS | XFUNC_100MS | XFUNC_SECOND)
 
 #define SCRIPT_DEBUG 0
 
@@ -368,6 +369,28 @@ struct GVARS {
 };
 
 
+enum {SCRIPT_LINE_TEXT,SCRIPT_LINE_SET,SCRIPT_LINE_COND};
+enum {SCRIPT_TOK_END,SCRIPT_TOK_CONST,SCRIPT_TOK_VAR,SCRIPT_TOK_NVAR,SCRIPT_TOK_GROUP};
+
+// operand of a section line lowered by Script_Compile_Lines()
+struct SCRIPT_TOKEN {
+  float value;      // constant
+  uint8_t kind;     // SCRIPT_TOK_..
+  uint8_t op;       // operator applied to the value so far, OPER_EQU for the first operand
+  uint8_t index;    // fvars index of a variable
+};
+
+// section line lowered by Script_Compile_Lines(), sorted by offset
+struct SCRIPT_LINE {
+  uint16_t offset;  // start of the line from scriptptr_bu
+  uint16_t jump;    // line closing the branch opened here, 0 = walk the branch
+  uint16_t code;    // first token of the line in line_code
+  uint8_t kind;     // SCRIPT_LINE_..
+  uint8_t var;      // destination variable of an assignment
+  uint8_t op;       // assignment or compare operator
+  uint8_t tail;     // the text goes on here after the lowered part, from the line start
+};
+
 #define NUM_RES 0xfe
 #define STR_RES 0xfd
 #define VAR_NV 0xff
@@ -393,9 +416,16 @@ struct SCRIPT_MEM {
     uint8_t *vnp_offset;
 #endif
     char *glob_snp; // string vars pointer
+    uint8_t *vname_hash; // open addressing hash of var names, 0xff = empty
+    uint16_t vname_hash_mask;
     char *scriptptr;
     char *section_ptr;
     char *scriptptr_bu;
+    uint16_t *section_offset; // offsets of section lines from scriptptr_bu
+    uint16_t num_sections;
+    struct SCRIPT_LINE *lines; // lowered section lines
+    struct SCRIPT_TOKEN *line_code;
+    uint16_t num_lines;
     char *script_ram;
     uint16_t script_size;
     uint8_t *script_pram;
@@ -478,6 +508,7 @@ void f2char(float num, uint32_t dprec, uint32_t lzeros, char *nbuff) {
 char *GetNumericArgument(char *lp,uint8_t lastop,float *fp, struct GVARS *gv);
 char *GetStringArgument(char *lp,uint8_t lastop,char *cp, struct GVARS *gv);
 char *ForceStringVar(char *lp,char *dstr);
+void Script_Compile_Lines(void);
 void send_download(void);
 uint8_t UfsReject(char *name);
 
@@ -538,6 +569,101 @@ void SetChanged(uint32_t index) {
 
 float *Get_MFAddr(uint8_t index, uint16_t *len, uint16_t *ipos);
 
+#define SCRIPT_VNHASH_EMPTY 0xff
+
+uint32_t Script_VarHash(const char *name, uint32_t len) {
+  uint32_t hash = 2166136261;   // FNV-1a
+  while (len--) {
+    hash ^= (uint8_t)*name++;
+    hash *= 16777619;
+  }
+  return hash;
+}
+
+// returns the index of variable `name` with `len` chars, first declared wins, or -1
+int16_t Script_FindVar(const char *name, uint32_t len) {
+  uint8_t *table = glob_script_mem.vname_hash;
+  if (!table) return -1;
+  uint32_t mask = glob_script_mem.vname_hash_mask;
+  for (uint32_t slot = Script_VarHash(name, len) & mask; ; slot = (slot + 1) & mask) {
+    uint8_t index = table[slot];
+    if (index == SCRIPT_VNHASH_EMPTY) return -1;
+    char *cp = glob_script_mem.glob_vnp + glob_script_mem.vnp_offset[index];
+    if (!strncmp(cp, name, len) && !cp[len]) return index;
+  }
+}
+
+// size of the var name hash, at most half full
+uint32_t Script_VarHashSize(uint32_t vars) {
+  uint32_t size = 4;
+  while (size < vars * 2) size <<= 1;
+  return size;
+}
+
+void Script_Hash_Vars(uint8_t *table, uint32_t size) {
+  memset(table, SCRIPT_VNHASH_EMPTY, size);
+  glob_script_mem.vname_hash = table;
+  glob_script_mem.vname_hash_mask = size - 1;
+  for (uint32_t count = 0; count < glob_script_mem.numvars; count++) {
+    char *cp = glob_script_mem.glob_vnp + glob_script_mem.vnp_offset[count];
+    uint32_t len = strlen(cp);
+    if (Script_FindVar(cp, len) >= 0) continue;     // duplicate, keep the first
+    uint32_t slot = Script_VarHash(cp, len) & (size - 1);
+    while (table[slot] != SCRIPT_VNHASH_EMPTY) slot = (slot + 1) & (size - 1);
+    table[slot] = count;
+  }
+}
+
+void Script_Free_Lines(void) {
+  if (glob_script_mem.lines) {
+    free(glob_script_mem.lines);
+    glob_script_mem.lines = 0;
+  }
+  if (glob_script_mem.line_code) {
+    free(glob_script_mem.line_code);
+    glob_script_mem.line_code = 0;
+  }
+  glob_script_mem.num_lines = 0;
+}
+
+// drop the section index and the lowered lines, they must not outlive the script text they point into
+void Script_Free_Sections(void) {
+  if (glob_script_mem.section_offset) {
+    free(glob_script_mem.section_offset);
+    glob_script_mem.section_offset = 0;
+  }
+  glob_script_mem.num_sections = 0;
+  Script_Free_Lines();
+}
+
+// index all lines starting with > or #, the only lines a section search can match
+void Script_Index_Sections(void) {
+  Script_Free_Sections();
+  char *script = glob_script_mem.scriptptr;
+  if (!script) return;
+
+  // first pass counts, second pass stores
+  for (uint32_t pass = 0; pass < 2; pass++) {
+    uint16_t count = 0;
+    char *lp = script;
+    while (lp) {
+      SCRIPT_SKIP_SPACES
+      if (*lp=='>' || *lp=='#') {
+        if (pass) glob_script_mem.section_offset[count] = lp - script;
+        count++;
+      }
+      lp = strchr(lp, SCRIPT_EOL);
+      if (lp) lp++;
+    }
+    if (!pass) {
+      if (!count) return;
+      glob_script_mem.section_offset = (uint16_t*)malloc(count * sizeof(uint16_t));
+      if (!glob_script_mem.section_offset) return;
+    }
+    glob_script_mem.num_sections = count;
+  }
+}
+
 // allocates all variables and presets them
 int16_t Init_Scripter(void) {
 char *script;
@@ -609,6 +735,7 @@ char *script;
 
     glob_script_mem.max_ssize = SCRIPT_SVARSIZE;
     glob_script_mem.scriptptr = 0;
+    Script_Free_Sections();
 
     char init = 0;
     while (1) {
@@ -787,6 +914,8 @@ char *script;
     (glob_script_mem.max_ssize*svars) +
     // type array
     (sizeof(struct T_INDEX)*vars) +
+    // var name hash
+    Script_VarHashSize(vars) +
     fsize;
 
     script_mem_size += 16;
@@ -852,6 +981,10 @@ char *script;
     //memcpy(script_mem,strings,size);
     script_mem += size;
 
+    // var name hash, filled when the names are set up
+    uint8_t *vname_hash = script_mem;
+    script_mem += Script_VarHashSize(vars);
+
     // now must recalc memory offsets
     uint16_t index = 0;
 #ifdef SCRIPT_LARGE_VNBUFF
@@ -900,6 +1033,7 @@ char *script;
     }
 
     glob_script_mem.numvars = vars;
+    Script_Hash_Vars(vname_hash, Script_VarHashSize(vars));
     glob_script_mem.script_dprec = SCRIPT_FLOAT_PRECISION;
     glob_script_mem.script_lzero = 0;
     glob_script_mem.script_loglevel = LOG_LEVEL_INFO;
@@ -960,6 +1094,8 @@ char *script;
     // store start of actual program here
     glob_script_mem.scriptptr = lp - 1;
     glob_script_mem.scriptptr_bu = glob_script_mem.scriptptr;
+    Script_Index_Sections();
+    Script_Compile_Lines();
 
 #ifdef USE_SCRIPT_GLOBVARS
     if (glob_script_mem.udp_flags.udp_used) {
@@ -1416,32 +1552,24 @@ uint32_t MeasurePulseTime(int32_t in) {
 
 #ifdef USE_SCRIPT_GLOBVARS
 uint32_t match_vars(char *dvnam, float **fp, char **sp, uint32_t *ind) {
-  uint16_t olen = strlen(dvnam);
+  int16_t count = Script_FindVar(dvnam, strlen(dvnam));
+  if (count < 0) return 0;
   struct T_INDEX *vtp = glob_script_mem.type;
-  for (uint32_t count = 0; count<glob_script_mem.numvars; count++) {
-    char *cp = glob_script_mem.glob_vnp + glob_script_mem.vnp_offset[count];
-    uint8_t slen = strlen(cp);
-    if (slen==olen && *cp==dvnam[0]) {
-      if (!strncmp(cp, dvnam, olen)) {
-        uint8_t index = vtp[count].index;
-        if (vtp[count].bits.is_string==0) {
-          if (vtp[count].bits.is_filter) {
-            // error
-            return 0;
-          } else {
-            *fp = &glob_script_mem.fvars[index];
-            *ind = count;
-            return NUM_RES;
-          }
-        } else {
-          *sp = glob_script_mem.glob_snp + (index * glob_script_mem.max_ssize);
-          *ind = count;
-          return STR_RES;
-        }
-      }
+  uint8_t index = vtp[count].index;
+  if (vtp[count].bits.is_string==0) {
+    if (vtp[count].bits.is_filter) {
+      // error
+      return 0;
+    } else {
+      *fp = &glob_script_mem.fvars[index];
+      *ind = count;
+      return NUM_RES;
     }
+  } else {
+    *sp = glob_script_mem.glob_snp + (index * glob_script_mem.max_ssize);
+    *ind = count;
+    return STR_RES;
   }
-  return 0;
 }
 #endif //USE_SCRIPT_GLOBVARS
 
@@ -1625,7 +1753,9 @@ char *isvar(char *lp, uint8_t *vtype, struct T_INDEX *tind, float *fp, char *sp,
       ja++;
       olen = strlen(dvnam);
     }
-    for (count = 0; count<glob_script_mem.numvars; count++) {
+    // start at the first var with this name, continue linearly for arrays sharing the name of a number
+    int16_t vindex = Script_FindVar(dvnam, olen);
+    for (count = (vindex < 0) ? glob_script_mem.numvars : vindex; count<glob_script_mem.numvars; count++) {
         char *cp = glob_script_mem.glob_vnp + glob_script_mem.vnp_offset[count];
         uint8_t slen = strlen(cp);
         if (slen==olen && *cp==dvnam[0]) {
@@ -3787,6 +3917,99 @@ char *getop(char *lp, uint8_t *operand) {
     return lp;
 }
 
+// applies an arithmetic operator of an expression
+float Script_Calc(float fvar, uint8_t operand, float fvar1) {
+    switch (operand) {
+        case OPER_EQU:
+            return fvar1;
+        case OPER_PLS:
+            return fvar + fvar1;
+        case OPER_MIN:
+            return fvar - fvar1;
+        case OPER_MUL:
+            return fvar * fvar1;
+        case OPER_DIV:
+            return fvar / fvar1;
+        case OPER_PERC:
+            return fmodf(fvar, fvar1);
+        case OPER_XOR:
+            return (uint32_t)fvar ^ (uint32_t)fvar1;
+        case OPER_AND:
+            return (uint32_t)fvar & (uint32_t)fvar1;
+        case OPER_OR:
+            return (uint32_t)fvar | (uint32_t)fvar1;
+        case OPER_SHL:
+            return (uint32_t)fvar << (uint32_t)fvar1;
+        case OPER_SHR:
+            return (uint32_t)fvar >> (uint32_t)fvar1;
+        default:
+            return fvar;
+    }
+}
+
+// applies a compare operator of a condition
+uint8_t Script_Compare(float fvar, uint8_t operand, float fvar1) {
+    switch (operand) {
+        case OPER_EQUEQU:
+            return fvar==fvar1;
+        case OPER_NOTEQU:
+            return fvar!=fvar1;
+        case OPER_LOW:
+            return fvar<fvar1;
+        case OPER_LOWEQU:
+            return fvar<=fvar1;
+        case OPER_GRT:
+            return fvar>fvar1;
+        case OPER_GRTEQU:
+            return fvar>=fvar1;
+        default:
+            // error
+            return 0;
+    }
+}
+
+// applies an assignment operator to a number variable
+void Script_Assign(float *dfvar, uint8_t operand, float fvar) {
+    switch (operand) {
+        case OPER_EQU:
+            *dfvar = fvar;
+            break;
+        case OPER_PLSEQU:
+            *dfvar += fvar;
+            break;
+        case OPER_MINEQU:
+            *dfvar -= fvar;
+            break;
+        case OPER_MULEQU:
+            *dfvar *= fvar;
+            break;
+        case OPER_DIVEQU:
+            *dfvar /= fvar;
+            break;
+        case OPER_PERCEQU:
+            *dfvar = fmodf(*dfvar, fvar);
+            break;
+        case OPER_ANDEQU:
+            *dfvar = (uint32_t)*dfvar & (uint32_t)fvar;
+            break;
+        case OPER_OREQU:
+            *dfvar = (uint32_t)*dfvar | (uint32_t)fvar;
+            break;
+        case OPER_XOREQU:
+            *dfvar = (uint32_t)*dfvar ^ (uint32_t)fvar;
+            break;
+        case OPER_SHLEQU:
+            *dfvar = (uint32_t)*dfvar << (uint32_t)fvar;
+            break;
+        case OPER_SHREQU:
+            *dfvar = (uint32_t)*dfvar >> (uint32_t)fvar;
+            break;
+        default:
+            // error
+            break;
+    }
+}
+
 
 #ifdef ESP8266
 extern "C" {
@@ -3870,44 +4093,7 @@ struct T_INDEX ind;
               glob_script_mem.glob_error = 1;
             }
         }
-        switch (lastop) {
-            case OPER_EQU:
-                fvar = fvar1;
-                break;
-            case OPER_PLS:
-                fvar += fvar1;
-                break;
-            case OPER_MIN:
-                fvar -= fvar1;
-                break;
-            case OPER_MUL:
-                fvar *= fvar1;
-                break;
-            case OPER_DIV:
-                fvar /= fvar1;
-                break;
-            case OPER_PERC:
-                fvar = fmodf(fvar, fvar1);
-                break;
-            case OPER_XOR:
-                fvar = (uint32_t)fvar ^ (uint32_t)fvar1;
-                break;
-            case OPER_AND:
-                fvar = (uint32_t)fvar & (uint32_t)fvar1;
-                break;
-            case OPER_OR:
-                fvar = (uint32_t)fvar | (uint32_t)fvar1;
-                break;
-            case OPER_SHL:
-                fvar = (uint32_t)fvar << (uint32_t)fvar1;
-                break;
-            case OPER_SHR:
-                fvar = (uint32_t)fvar >> (uint32_t)fvar1;
-                break;
-            default:
-                break;
-
-        }
+        fvar = Script_Calc(fvar, lastop, fvar1);
         slp = lp;
         lp = getop(lp, &operand);
         switch (operand) {
@@ -4247,29 +4433,7 @@ exit0:
     // evaluate operand
     lp = getop(lp, &lastop);
     lp = GetNumericArgument(lp, OPER_EQU, &fvar1, gv);
-    switch (lastop) {
-      case OPER_EQUEQU:
-          res = (*dfvar==fvar1);
-          break;
-      case OPER_NOTEQU:
-          res = (*dfvar!=fvar1);
-          break;
-      case OPER_LOW:
-          res = (*dfvar<fvar1);
-          break;
-      case OPER_LOWEQU:
-          res = (*dfvar<=fvar1);
-          break;
-      case OPER_GRT:
-          res = (*dfvar>fvar1);
-          break;
-      case OPER_GRTEQU:
-          res = (*dfvar>=fvar1);
-          break;
-      default:
-          // error
-          break;
-    }
+    res = Script_Compare(*dfvar, lastop, fvar1);
 
 exit:
     if (!and_or) {
@@ -4394,6 +4558,389 @@ char *scripter_sub(char *lp, uint8_t fromscriptcmd) {
 int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv);
 
 #define IF_NEST 8
+
+// keywords Run_script_sub() checks before it takes a line as an assignment or a condition
+const char kScriptLineKeys[] PROGMEM =
+  "if|then|else|endif|or|and|for|next|switch|case|ends|break|dp|dt|delay(|spinm(|spin(|svars|gvr|"
+  "ws2812(|beep(|pwm|wcs|rapp|mail|=>|->|+>|print|=#|=(";
+
+bool Script_Line_Keyword(const char *lp) {
+  char keyword[8];
+  for (uint32_t index = 0; *GetTextIndexed(keyword, sizeof(keyword), index, kScriptLineKeys); index++) {
+    if (!strncmp(lp, keyword, strlen(keyword))) return true;
+  }
+  return (*lp=='{' || *lp=='}');
+}
+
+// type index of the plain number variable named at lp, or -1, the name ends like in isvar()
+int16_t Script_Compile_Var(char *lp, uint32_t *len) {
+  const char *term = "\n\r ])=+-/*%><!^&|}{";
+  uint32_t count = 0;
+  while (lp[count] && !strchr(term, lp[count])) count++;
+  *len = count;
+  if (!count || count>=32 || memchr(lp, '[', count)) return -1;
+  int16_t index = Script_FindVar(lp, count);
+  if (index<0) return -1;
+  if (glob_script_mem.type[index].bits.is_string || glob_script_mem.type[index].bits.is_filter) return -1;
+  return index;
+}
+
+// lowers a numeric expression the way GetNumericArgument() reads it, constants and plain number variables only
+// returns the end of the expression, or 0 if the text interpreter has to evaluate it
+char *Script_Compile_Expr(char *lp, struct SCRIPT_TOKEN *code, uint16_t *ntok) {
+  uint8_t operand = OPER_EQU;
+  while (1) {
+    struct SCRIPT_TOKEN tok;
+    tok.value = 0;
+    tok.op = operand;
+    tok.index = 0;
+    if (*lp=='(') {
+      tok.kind = SCRIPT_TOK_GROUP;
+      if (code) code[*ntok] = tok;
+      (*ntok)++;
+      lp = Script_Compile_Expr(lp + 1, code, ntok);
+      if (!lp || *lp!=')') return 0;
+      lp++;
+    } else {
+      if (isdigit(*lp) || (*lp=='-' && isdigit(*(lp + 1))) || *lp=='.') {
+        uint8_t vtype;
+        struct T_INDEX ind;
+        tok.kind = SCRIPT_TOK_CONST;
+        lp = isvar(lp, &vtype, &ind, &tok.value, 0, 0);
+      } else {
+        tok.kind = SCRIPT_TOK_VAR;
+        if (*lp=='-') {
+          tok.kind = SCRIPT_TOK_NVAR;
+          lp++;
+        }
+        uint32_t len;
+        int16_t index = Script_Compile_Var(lp, &len);
+        if (index<0) return 0;
+        tok.index = glob_script_mem.type[index].index;
+        lp += len;
+      }
+      if (code) code[*ntok] = tok;
+      (*ntok)++;
+    }
+    char *slp = lp;
+    lp = getop(lp, &operand);
+    switch (operand) {
+      case 0:
+      case OPER_EQUEQU:
+      case OPER_NOTEQU:
+      case OPER_LOW:
+      case OPER_LOWEQU:
+      case OPER_GRT:
+      case OPER_GRTEQU:
+        tok.kind = SCRIPT_TOK_END;
+        if (code) code[*ntok] = tok;
+        (*ntok)++;
+        return slp;
+      case OPER_PLS:
+      case OPER_MIN:
+      case OPER_MUL:
+      case OPER_DIV:
+      case OPER_PERC:
+      case OPER_XOR:
+      case OPER_AND:
+      case OPER_OR:
+      case OPER_SHL:
+      case OPER_SHR:
+        break;
+      default:
+        return 0;
+    }
+  }
+}
+
+#define SCRIPT_SKIP_SPACES_CP while (*cp==' ' || *cp=='\t') cp++;
+
+// nothing but spaces up to the end of the line
+bool Script_Line_End(char *cp) {
+  SCRIPT_SKIP_SPACES_CP
+  return (!*cp || *cp==SCRIPT_EOL || *cp=='\r');
+}
+
+// lowers an assignment to a number variable or an if, and, or condition
+// returns SCRIPT_LINE_TEXT if the text interpreter has to run the line
+uint8_t Script_Compile_Line(char *line, struct SCRIPT_LINE *cline, struct SCRIPT_TOKEN *code, uint16_t *ntok) {
+  uint16_t start = *ntok;
+  uint8_t kind = SCRIPT_LINE_COND;
+  char *lp = line;
+  if (!strncmp(lp, "if", 2) && (lp[2]==' ' || lp[2]=='\t')) {
+    lp += 2;
+  } else if (!strncmp(lp, "and", 3) && (lp[3]==' ' || lp[3]=='\t')) {
+    lp += 3;
+  } else if (!strncmp(lp, "or", 2) && (lp[2]==' ' || lp[2]=='\t')) {
+    lp += 2;
+  } else {
+    kind = SCRIPT_LINE_SET;
+  }
+
+  if (kind==SCRIPT_LINE_COND) {
+    SCRIPT_SKIP_SPACES
+    // a ( starts an and/or group in Evaluate_expression()
+    if (*lp=='(' || Script_Line_Keyword(lp)) return SCRIPT_LINE_TEXT;
+    lp = Script_Compile_Expr(lp, code, ntok);
+    if (lp) {
+      lp = getop(lp, &cline->op);
+      if (cline->op<OPER_EQUEQU || cline->op>OPER_LOW) lp = 0;
+    }
+    if (lp) lp = Script_Compile_Expr(lp, code, ntok);
+  } else {
+    if (Script_Line_Keyword(lp)) return SCRIPT_LINE_TEXT;
+    uint32_t len;
+    int16_t index = Script_Compile_Var(lp, &len);
+#ifdef USE_SCRIPT_GLOBVARS
+    // global variables are sent by udp on change
+    if (index>=0 && glob_script_mem.type[index].bits.global) index = -1;
+#endif //USE_SCRIPT_GLOBVARS
+    if (index<0) return SCRIPT_LINE_TEXT;
+    cline->var = index;
+    lp = getop(lp + len, &cline->op);
+    switch (cline->op) {
+      case OPER_EQU:
+      case OPER_PLSEQU:
+      case OPER_MINEQU:
+      case OPER_MULEQU:
+      case OPER_DIVEQU:
+      case OPER_PERCEQU:
+      case OPER_ANDEQU:
+      case OPER_OREQU:
+      case OPER_XOREQU:
+      case OPER_SHLEQU:
+      case OPER_SHREQU:
+        lp = Script_Compile_Expr(lp, code, ntok);
+        break;
+      default:
+        lp = 0;
+        break;
+    }
+  }
+
+  if (!lp || (lp - line)>255) {
+    *ntok = start;
+    return SCRIPT_LINE_TEXT;
+  }
+  cline->code = start;
+  cline->tail = lp - line;
+  return kind;
+}
+
+// lowers the lines of all sections when the script is loaded:
+// - assignments to number variables and if, and, or conditions become tokens with resolved constants and variables
+// - then, else, { and } else lines get the line closing their branch, a branch not taken is not walked
+// everything else stays with the text interpreter
+void Script_Compile_Lines(void) {
+  Script_Free_Lines();
+  char *script = glob_script_mem.scriptptr;
+  if (!script) return;
+
+  // first pass counts, second pass stores
+  for (uint32_t pass = 0; pass < 2; pass++) {
+    struct SCRIPT_LINE *lines = glob_script_mem.lines;
+    uint16_t nlines = 0, ntok = 0;
+    // if levels like in Run_script_sub(), open = line to patch with the end of the current branch or -1
+    uint8_t if_state[IF_NEST];
+    int16_t open[IF_NEST];
+    int8_t ifstck = -1;  // not in a section yet
+    uint8_t nojump = 0, inswitch = 0;
+    char *lp = script;
+    while (lp) {
+      // start the line like Run_script_sub(), the spaces after an empty line stay
+      SCRIPT_SKIP_SPACES
+      SCRIPT_SKIP_EOL
+      if (!*lp) break;
+      char *line = lp;
+      lp = strchr(lp, SCRIPT_EOL);
+      if (lp) lp++;
+
+      if (*line=='>' || *line=='#') {
+        ifstck = 0;
+        if_state[0] = 0;
+        open[0] = -1;
+        nojump = 0;
+        inswitch = 0;
+        continue;
+      }
+      if (ifstck<0 || *line==';') continue;
+
+      struct SCRIPT_LINE cline;
+      memset(&cline, 0, sizeof(cline));
+      cline.offset = line - glob_script_mem.scriptptr_bu;
+      cline.kind = Script_Compile_Line(line, &cline, 0, &ntok);
+      if (lines && cline.kind!=SCRIPT_LINE_TEXT) {
+        // store the tokens of lines that lower only, a line that fails half way would write past the counted ones
+        ntok = cline.code;
+        Script_Compile_Line(line, &cline, glob_script_mem.line_code, &ntok);
+      }
+
+      // follow the if state of the interpreter
+      // a jump is only kept if the interpreter takes the same if states on every line it skips
+      uint8_t opens = 0, closes = 0, uncertain = 0;
+      if (!strncmp(line, "if", 2)) {
+        if (ifstck<IF_NEST-1) {
+          ifstck++;
+          if_state[ifstck] = 1;
+          open[ifstck] = -1;
+        } else {
+          nojump = 1;
+        }
+      } else if (!strncmp(line, "then", 4) && if_state[ifstck]==1) {
+        if_state[ifstck] = 2;
+        opens = Script_Line_End(line + 4);
+      } else if (!strncmp(line, "else", 4) && if_state[ifstck]==2) {
+        if_state[ifstck] = 3;
+        closes = 1;
+        opens = Script_Line_End(line + 4);
+      } else if (!strncmp(line, "endif", 5) && if_state[ifstck]>=2) {
+        closes = 1;
+      } else if (*line=='{' && if_state[ifstck]==1) {
+        if_state[ifstck] = 2;
+        opens = Script_Line_End(line + 1);
+      } else if (*line=='}' && if_state[ifstck]>=2) {
+        closes = 1;
+        for (char *cp = line + 1; cp < line + 9 && *cp && *cp!='}'; cp++) {
+          if (!strncmp(cp, "else", 4)) {
+            if_state[ifstck] = 3;
+            cp += 4;
+            SCRIPT_SKIP_SPACES_CP
+            if (*cp=='{') cp++;
+            opens = Script_Line_End(cp);
+            break;
+          }
+        }
+      } else if (!strncmp(line, "for", 3) || !strncmp(line, "next", 4) ||
+                 !strncmp(line, "switch", 6) || !strncmp(line, "case", 4) || !strncmp(line, "ends", 4)) {
+        // loop and switch state would be lost
+        uncertain = 1;
+      }
+      if (!strncmp(line, "switch", 6)) {
+        inswitch = 1;
+      } else if (!strncmp(line, "ends", 4)) {
+        inswitch = 0;
+      }
+      if (!opens && !closes && if_state[ifstck]==1) {
+        // a condition line, a { after the condition starts the branch
+        char *cp = line;
+        if (cline.kind==SCRIPT_LINE_COND) {
+          cp += cline.tail;
+          SCRIPT_SKIP_SPACES_CP
+          opens = (*cp=='{');
+        } else {
+          // only Evaluate_expression() knows where the condition ends
+          while (*cp && *cp!=SCRIPT_EOL && *cp!='{') cp++;
+          if (*cp=='{') nojump = 1;
+        }
+        // a case that does not match skips the condition
+        if (opens && inswitch) nojump = 1;
+        if (opens) if_state[ifstck] = 2;
+      }
+      // then} and else} are not followed
+      if (!strncmp(line, "then}", 5) || !strncmp(line, "else}", 5)) nojump = 1;
+      if (uncertain) {
+        // no jump across this line
+        for (int32_t level = 0; level<=ifstck; level++) open[level] = -1;
+      }
+
+      if (closes) {
+        if (lines && !nojump && open[ifstck]>=0) lines[open[ifstck]].jump = cline.offset;
+        open[ifstck] = -1;
+        if (!opens && ifstck>0) {
+          if_state[ifstck] = 0;
+          ifstck--;
+        }
+      }
+      if (opens) open[ifstck] = nlines;
+      if (opens || cline.kind!=SCRIPT_LINE_TEXT) {
+        if (lines) lines[nlines] = cline;
+        nlines++;
+      }
+    }
+    if (!pass) {
+      if (!nlines) return;
+      glob_script_mem.lines = (struct SCRIPT_LINE*)malloc(nlines * sizeof(struct SCRIPT_LINE));
+      if (ntok) glob_script_mem.line_code = (struct SCRIPT_TOKEN*)malloc(ntok * sizeof(struct SCRIPT_TOKEN));
+      if (!glob_script_mem.lines || (ntok && !glob_script_mem.line_code)) {
+        Script_Free_Lines();
+        return;
+      }
+    }
+    glob_script_mem.num_lines = nlines;
+  }
+}
+
+// the lowered form of the line at lp, or 0
+struct SCRIPT_LINE *Script_Find_Line(char *lp) {
+  uint32_t offset = lp - glob_script_mem.scriptptr_bu;
+  uint32_t low = 0, high = glob_script_mem.num_lines;
+  while (low<high) {
+    uint32_t mid = (low + high) / 2;
+    if (glob_script_mem.lines[mid].offset<offset) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low<glob_script_mem.num_lines && glob_script_mem.lines[low].offset==offset) return &glob_script_mem.lines[low];
+  return 0;
+}
+
+// evaluates lowered tokens up to their end token, like GetNumericArgument()
+float Script_Eval_Code(struct SCRIPT_TOKEN **code) {
+  float fvar = 0, fvar1;
+  while (1) {
+    struct SCRIPT_TOKEN *tok = (*code)++;
+    switch (tok->kind) {
+      case SCRIPT_TOK_CONST:
+        fvar1 = tok->value;
+        break;
+      case SCRIPT_TOK_VAR:
+        fvar1 = glob_script_mem.fvars[tok->index];
+        break;
+      case SCRIPT_TOK_NVAR:
+        fvar1 = -glob_script_mem.fvars[tok->index];
+        break;
+      case SCRIPT_TOK_GROUP:
+        fvar1 = Script_Eval_Code(code);
+        break;
+      default:
+        return fvar;
+    }
+    fvar = Script_Calc(fvar, tok->op, fvar1);
+  }
+}
+
+// runs a lowered if, and, or condition like Evaluate_expression()
+char *Script_Run_Cond(struct SCRIPT_LINE *cline, uint8_t and_or, uint8_t *result) {
+  struct SCRIPT_TOKEN *code = glob_script_mem.line_code + cline->code;
+  glob_script_mem.glob_error = 0;
+  float fvar = Script_Eval_Code(&code);
+  float fvar1 = Script_Eval_Code(&code);
+  uint8_t res = Script_Compare(fvar, cline->op, fvar1);
+  if (!and_or) {
+    *result = res;
+  } else if (and_or==1) {
+    *result |= res;
+  } else {
+    *result &= res;
+  }
+  return glob_script_mem.scriptptr_bu + cline->offset + cline->tail;
+}
+
+// runs a lowered assignment to a number variable
+char *Script_Run_Set(struct SCRIPT_LINE *cline) {
+  struct SCRIPT_TOKEN *code = glob_script_mem.line_code + cline->code;
+  glob_script_mem.glob_error = 0;
+  float fvar = Script_Eval_Code(&code);
+  Script_Assign(&glob_script_mem.fvars[glob_script_mem.type[cline->var].index], cline->op, fvar);
+  SetChanged(cline->var);
+  return glob_script_mem.scriptptr_bu + cline->offset + cline->tail;
+}
+
+// skip a branch not taken, go on at the line closing it
+#define SCRIPT_SKIP_BRANCH if (!if_exe[ifstck] && cline && cline->jump) { lp = glob_script_mem.scriptptr_bu + cline->jump; goto startline; }
+
 // execute section of scripter
 int16_t Run_Scripter(const char *type, int8_t tlen, const char *js) {
 int16_t retval;
@@ -4445,6 +4992,16 @@ int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv) {
 
     char *lp = glob_script_mem.scriptptr;
 
+    // search the section via the section index, unless running a command line
+    uint16_t *sect_ptr = 0, *sect_end = 0;
+    if (lp == glob_script_mem.scriptptr_bu && glob_script_mem.section_offset) {
+      sect_ptr = glob_script_mem.section_offset;
+      sect_end = sect_ptr + glob_script_mem.num_sections;
+    }
+    // the lowered form of the current line
+    struct SCRIPT_LINE *cline = 0;
+    uint8_t lowered = (lp == glob_script_mem.scriptptr_bu && glob_script_mem.num_lines);
+
     while (1) {
         // check line
         // skip leading spaces
@@ -4465,6 +5022,7 @@ int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv) {
                 return 0;
             }
             glob_script_mem.var_not_found = 0;
+            if (lowered) cline = Script_Find_Line(lp);
 
 //#if SCRIPT_DEBUG>0
 #ifdef IFTHEN_DEBUG
@@ -4488,10 +5046,12 @@ int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv) {
                 lp += 4;
                 if_state[ifstck] = 2;
                 if (if_exe[ifstck - 1]) if_exe[ifstck] = if_result[ifstck];
+                SCRIPT_SKIP_BRANCH
             } else if (!strncmp(lp, "else", 4) && if_state[ifstck]==2) {
                 lp += 4;
                 if_state[ifstck] = 3;
                 if (if_exe[ifstck - 1]) if_exe[ifstck] = !if_result[ifstck];
+                SCRIPT_SKIP_BRANCH
             } else if (!strncmp(lp, "endif", 5) && if_state[ifstck]>=2) {
                 lp += 5;
                 if (ifstck>0) {
@@ -4511,6 +5071,7 @@ int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv) {
               lp += 1; // then
               if_state[ifstck] = 2;
               if (if_exe[ifstck - 1]) if_exe[ifstck]=if_result[ifstck];
+              SCRIPT_SKIP_BRANCH
             } else if (*lp=='{' && if_state[ifstck]==3) {
               lp += 1; // after else
               //if_state[ifstck]=3;
@@ -4531,6 +5092,7 @@ int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv) {
                   iselse = 1;
                   SCRIPT_SKIP_SPACES
                   if (*lp=='{') lp++;
+                  SCRIPT_SKIP_BRANCH
                   break;
                 }
                 lp++;
@@ -4929,14 +5491,23 @@ int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv) {
             // check for variable result
             if (if_state[ifstck]==1) {
               // evaluate exxpression
-              lp = Evaluate_expression(lp, and_or, &if_result[ifstck], gv);
+              if (cline && cline->kind==SCRIPT_LINE_COND) {
+                lp = Script_Run_Cond(cline, and_or, &if_result[ifstck]);
+              } else {
+                lp = Evaluate_expression(lp, and_or, &if_result[ifstck], gv);
+              }
               SCRIPT_SKIP_SPACES
               if (*lp=='{' && if_state[ifstck]==1) {
                 lp += 1; // then
                 if_state[ifstck] = 2;
                 if (if_exe[ifstck - 1]) if_exe[ifstck] = if_result[ifstck];
+                SCRIPT_SKIP_BRANCH
               }
               goto next_line;
+            } else if (cline && cline->kind==SCRIPT_LINE_SET && lp==glob_script_mem.scriptptr_bu + cline->offset) {
+              // lowered assignment to a number variable
+              lp = Script_Run_Set(cline);
+              goto next_line;
             } else {
               char *vnp = lp;
               lp = isvar(lp, &vtype, &ind, &sysvar, 0, gv);
@@ -4977,48 +5548,11 @@ int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv) {
                         lp = isvar(slp, &vtype, &ind, 0, cmpstr, gv);
                         fvar = CharToFloat(cmpstr);
                       }
-                      switch (lastop) {
-                          case OPER_EQU:
-                              if (glob_script_mem.var_not_found) {
-                                if (!gv || !gv->jo) toLogEOL("var not found: ",lp);
-                                goto next_line;
-                              }
-                              *dfvar = fvar;
-                              break;
-                          case OPER_PLSEQU:
-                              *dfvar += fvar;
-                              break;
-                          case OPER_MINEQU:
-                              *dfvar -= fvar;
-                              break;
-                          case OPER_MULEQU:
-                              *dfvar *= fvar;
-                              break;
-                          case OPER_DIVEQU:
-                              *dfvar /= fvar;
-                              break;
-                          case OPER_PERCEQU:
-                              *dfvar = fmodf(*dfvar, fvar);
-                              break;
-                          case OPER_ANDEQU:
-                              *dfvar = (uint32_t)*dfvar & (uint32_t)fvar;
-                              break;
-                          case OPER_OREQU:
-                              *dfvar = (uint32_t)*dfvar | (uint32_t)fvar;
-                              break;
-                          case OPER_XOREQU:
-                              *dfvar = (uint32_t)*dfvar ^ (uint32_t)fvar;
-                              break;
-                          case OPER_SHLEQU:
-                              *dfvar = (uint32_t)*dfvar << (uint32_t)fvar;
-                              break;
-                          case OPER_SHREQU:
-                              *dfvar = (uint32_t)*dfvar >> (uint32_t)fvar;
-                              break;
-                          default:
-                              // error
-                              break;
+                      if (lastop==OPER_EQU && glob_script_mem.var_not_found) {
+                        if (!gv || !gv->jo) toLogEOL("var not found: ",lp);
+                        goto next_line;
                       }
+                      Script_Assign(dfvar, lastop, fvar);
                       // var was changed
                       SetChanged(globvindex);
 #ifdef USE_SCRIPT_GLOBVARS
@@ -5189,6 +5723,13 @@ int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv) {
         }
         // next line
     next_line:
+        if (!section && sect_ptr) {
+          // skip to the next section line
+          while (sect_ptr < sect_end && glob_script_mem.scriptptr_bu + *sect_ptr <= lp) sect_ptr++;
+          if (sect_ptr >= sect_end) return -1;
+          lp = glob_script_mem.scriptptr_bu + *sect_ptr++;
+          continue;
+        }
         if (*lp==SCRIPT_EOL) {
           lp++;
         } else {
@@ -5437,6 +5978,7 @@ void script_upload_start(void) {
 
     sc_state = bitRead(Settings->rule_enabled, 0);
     bitWrite(Settings->rule_enabled, 0, 0);
+    Script_Free_Sections();               // the script text is overwritten in place
 
   } else if(upload.status == UPLOAD_FILE_WRITE) {
     //AddLog(LOG_LEVEL_INFO, PSTR("HTP: upload write"));
@@ -5698,7 +6240,9 @@ void SaveScriptEnd(void) {
     free(glob_script_mem.script_mem);
     glob_script_mem.script_mem = 0;
     glob_script_mem.script_mem_size = 0;
+    glob_script_mem.vname_hash = 0;
   }
+  Script_Free_Sections();                 // the script text was replaced, Init_Scripter() indexes it again
 
   if (bitRead(Settings->rule_enabled, 0)) {
 
@@ -49,6 +49,7 @@ uint8_t       Settings->knx_CB_param[MAX_KNX_CB]     Type of Output (set relay,
 \*********************************************************************************************/
 
 #define XDRV_11  11
+#define XDRV_11_FUNCS (XFUNC_LOOP | XFUNC_50MS)
 
 #include <esp-knx-ip.h>         // KNX Library
 
@@ -32,6 +32,7 @@
 \*********************************************************************************************/
 
 #define XDRV_12     12
+#define XDRV_12_FUNCS XFUNC_SECOND
 
 void TasDiscoverMessage(void) {
   Response_P(PSTR("{\"ip\":\"%_I\","                           // IP Address
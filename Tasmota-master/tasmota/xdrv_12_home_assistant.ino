@@ -17,6 +17,7 @@
 #undef USE_TASMOTA_DISCOVERY
 
 #define XDRV_12 12
+#define XDRV_12_FUNCS XFUNC_SECOND
 
 // List of sensors ready for discovery
 const char kHAssJsonSensorTypes[] PROGMEM =
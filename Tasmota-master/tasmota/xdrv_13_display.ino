@@ -20,6 +20,7 @@
 #ifdef USE_DISPLAY
 
 #define XDRV_13       13
+#define XDRV_13_FUNCS (XFUNC_50MS | XFUNC_SECOND)
 
 #include <renderer.h>
 
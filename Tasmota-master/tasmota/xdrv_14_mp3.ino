@@ -76,6 +76,7 @@
 \*********************************************************************************************/
 
 #define XDRV_14             14
+#define XDRV_14_FUNCS       0
 
 #include <TasmotaSerial.h>
 
@@ -27,6 +27,7 @@
 \*********************************************************************************************/
 
 #define XDRV_18                18
+#define XDRV_18_FUNCS          (XFUNC_LOOP | XFUNC_SECOND)
 
 #include <TasmotaSerial.h>
 
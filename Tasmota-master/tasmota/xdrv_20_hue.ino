@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XDRV_20           20
+#define XDRV_20_FUNCS     0
 
 #include "UnishoxStrings.h"
 
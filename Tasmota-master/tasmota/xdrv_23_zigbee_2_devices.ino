@@ -891,7 +891,7 @@ typedef struct Z_Deferred {
 // - shortaddr and longaddr cannot be both null
 class Z_Devices {
 public:
-  Z_Devices() : _deferred() {};
+  Z_Devices() {};
 
   // Probe the existence of device keys
   // Results:
@@ -962,9 +962,12 @@ public:
   // Iterator
   inline const LList<Z_Device> & getDevices(void) const { return _devices; }
   size_t devicesSize(void) const {
+    if (indexBuild()) { return _idx_len; }
     return _devices.length();
   }
   Z_Device & devicesAt(size_t i) const;
+  // must be called whenever a device is added or removed, or its shortaddr, longaddr or friendlyName changes
+  inline void indexInvalidate(void) { _idx_valid = false; }
 
   // Remove device from list
   void clearDeviceRouterInfo(void);           // reset all router flags, done just before ZbMap
@@ -981,11 +984,32 @@ public:
 
 private:
   LList<Z_Device>           _devices;     // list of devices
-  LList<Z_Deferred>         _deferred;    // list of deferred calls
+  Z_Deferred *              _deferred = nullptr;  // heap of deferred calls, the first to fire is at index 0
+  uint16_t                  _deferred_len = 0;
+  uint16_t                  _deferred_size = 0;   // allocated entries
   uint32_t                  _saveTimer = 0;
   uint8_t                   _seqNumber = 0;     // global seqNumber if device is unknown
 
-  //int32_t findShortAddrIdx(uint16_t shortaddr) const;
+  // Index over _devices, rebuilt on first look-up after indexInvalidate()
+  // _idx_dev holds the devices in list order
+  // _idx_slots holds 3 open addressing tables of (_idx_mask + 1) slots: by shortaddr, by longaddr and by friendlyName
+  // a slot contains the position in _idx_dev plus 1, or 0 if empty
+  mutable Z_Device **       _idx_dev = nullptr;
+  mutable uint16_t *        _idx_slots = nullptr;
+  mutable uint16_t          _idx_len = 0;
+  mutable uint16_t          _idx_cap = 0;       // allocated entries in _idx_dev
+  mutable uint16_t          _idx_mask = 0;
+  mutable bool              _idx_valid = false;
+
+  bool indexBuild(void) const;    // returns false if the index could not be allocated, use linear scans
+  int32_t indexFindShortAddr(uint16_t shortaddr) const;
+  int32_t indexFindLongAddr(uint64_t longaddr) const;
+  int32_t indexFindFriendlyName(const char * name) const;
+
+  void deferredPush(const Z_Deferred & deferred);
+  void deferredRemoveTop(void);
+  void deferredSiftDown(uint32_t i);
+
   // Create a new entry in the devices list - must be called if it is sure it does not already exist
   Z_Device & createDeviceEntry(uint16_t shortaddr, uint64_t longaddr = 0);
   void freeDeviceEntry(Z_Device *device);
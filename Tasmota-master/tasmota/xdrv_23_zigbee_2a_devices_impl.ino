@@ -24,6 +24,9 @@
 \*********************************************************************************************/
 
 Z_Device & Z_Devices::devicesAt(size_t i) const {
+  if (indexBuild()) {
+    return (i < _idx_len) ? *_idx_dev[i] : device_unk;
+  }
   Z_Device * devp = (Z_Device*) _devices.at(i);
   if (devp) {
     return *devp;
@@ -42,6 +45,7 @@ Z_Device & Z_Devices::createDeviceEntry(uint16_t shortaddr, uint64_t longaddr) {
   device.shortaddr = shortaddr;
   device.longaddr = longaddr;
 
+  indexInvalidate();
   dirty();
   return device;
 }
@@ -53,8 +57,121 @@ void Z_Devices::freeDeviceEntry(Z_Device *device) {
   free(device);
 }
 
+/*********************************************************************************************\
+ * Device index
+ *
+ * Every received frame looks up its device several times, so look-ups by shortaddr, longaddr
+ * and friendlyName go through open addressing hash tables instead of walking the list.
+ * The index is rebuilt in one pass after any change, which only happens when devices
+ * are added, removed, change address or are renamed.
+\*********************************************************************************************/
+static uint32_t Z_hashMix(uint32_t h) {
+  h ^= h >> 16;
+  h *= 0x7FEB352D;
+  h ^= h >> 15;
+  h *= 0x846CA68B;
+  h ^= h >> 16;
+  return h;
+}
+
+static uint32_t Z_hashName(const char * name) {
+  uint32_t h = 2166136261;              // FNV-1a, case insensitive to match strcasecmp()
+  while (*name) {
+    h ^= (uint8_t) tolower(*name++);
+    h *= 16777619;
+  }
+  return h;
+}
+
+static inline uint32_t Z_hashShortAddr(uint16_t shortaddr) { return Z_hashMix(shortaddr); }
+static inline uint32_t Z_hashLongAddr(uint64_t longaddr) { return Z_hashMix((uint32_t)longaddr ^ Z_hashMix(longaddr >> 32)); }
+
+bool Z_Devices::indexBuild(void) const {
+  if (_idx_valid) { return true; }
+  size_t len = _devices.length();
+  if (len > 0x7FFF) { return false; }   // positions are stored in 16 bits
+  uint32_t slots = 16;
+  while (slots < len * 2) { slots <<= 1; }   // keep load factor under 50%
+
+  if ((len > _idx_cap) || (slots != _idx_mask + 1U)) {
+    free(_idx_dev);
+    free(_idx_slots);
+    _idx_cap = (len + 8) & ~7;
+    _idx_dev = (Z_Device**) malloc(_idx_cap * sizeof(Z_Device*));
+    _idx_slots = (uint16_t*) malloc(3 * slots * sizeof(uint16_t));
+    if (!_idx_dev || !_idx_slots) {
+      free(_idx_dev);
+      free(_idx_slots);
+      _idx_dev = nullptr;
+      _idx_slots = nullptr;
+      _idx_cap = 0;
+      _idx_mask = 0;
+      return false;
+    }
+    _idx_mask = slots - 1;
+  }
+  memset(_idx_slots, 0, 3 * slots * sizeof(uint16_t));
+
+  // insert in list order, and keep the first device for any duplicate key like a linear scan would
+  uint16_t * by_short = _idx_slots;
+  uint16_t * by_long  = _idx_slots + slots;
+  uint16_t * by_name  = _idx_slots + 2 * slots;
+  _idx_len = 0;
+  _idx_valid = true;      // allow the indexFind functions to run during the build
+  for (auto & elem : (LList<Z_Device>&) _devices) {
+    uint32_t pos = _idx_len++;
+    _idx_dev[pos] = &elem;
+    if (indexFindShortAddr(elem.shortaddr) < 0) {
+      uint32_t slot = Z_hashShortAddr(elem.shortaddr) & _idx_mask;
+      while (by_short[slot]) { slot = (slot + 1) & _idx_mask; }
+      by_short[slot] = pos + 1;
+    }
+    if (elem.longaddr && (indexFindLongAddr(elem.longaddr) < 0)) {
+      uint32_t slot = Z_hashLongAddr(elem.longaddr) & _idx_mask;
+      while (by_long[slot]) { slot = (slot + 1) & _idx_mask; }
+      by_long[slot] = pos + 1;
+    }
+    if (elem.friendlyName && elem.friendlyName[0] && (indexFindFriendlyName(elem.friendlyName) < 0)) {
+      uint32_t slot = Z_hashName(elem.friendlyName) & _idx_mask;
+      while (by_name[slot]) { slot = (slot + 1) & _idx_mask; }
+      by_name[slot] = pos + 1;
+    }
+  }
+  return true;
+}
+
+// Index look-ups, only valid after indexBuild() returned true
+// Out:
+//    position in _devices of entry, -1 if not found
+int32_t Z_Devices::indexFindShortAddr(uint16_t shortaddr) const {
+  const uint16_t * by_short = _idx_slots;
+  for (uint32_t slot = Z_hashShortAddr(shortaddr) & _idx_mask; by_short[slot]; slot = (slot + 1) & _idx_mask) {
+    uint32_t pos = by_short[slot] - 1;
+    if (_idx_dev[pos]->shortaddr == shortaddr) { return pos; }
+  }
+  return -1;
+}
+
+int32_t Z_Devices::indexFindLongAddr(uint64_t longaddr) const {
+  const uint16_t * by_long = _idx_slots + _idx_mask + 1;
+  for (uint32_t slot = Z_hashLongAddr(longaddr) & _idx_mask; by_long[slot]; slot = (slot + 1) & _idx_mask) {
+    uint32_t pos = by_long[slot] - 1;
+    if (_idx_dev[pos]->longaddr == longaddr) { return pos; }
+  }
+  return -1;
+}
+
+int32_t Z_Devices::indexFindFriendlyName(const char * name) const {
+  const uint16_t * by_name = _idx_slots + 2 * (_idx_mask + 1);
+  for (uint32_t slot = Z_hashName(name) & _idx_mask; by_name[slot]; slot = (slot + 1) & _idx_mask) {
+    uint32_t pos = by_name[slot] - 1;
+    if (strcasecmp(_idx_dev[pos]->friendlyName, name) == 0) { return pos; }
+  }
+  return -1;
+}
+
 //
-// Scan all devices to find a corresponding shortaddr
+// Find the device with a corresponding shortaddr
 // Looks info device.shortaddr entry
 // In:
 //    shortaddr (not BAD_SHORTADDR)
@@ -62,41 +179,42 @@ void Z_Devices::freeDeviceEntry(Z_Device *device) {
 //    reference to device, or to device_unk if not found
 //    (use foundDevice() to check if found)
 Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) {
-  for (auto & elem : _devices) {
-    if (elem.shortaddr == shortaddr) { return elem; }
-  }
-  return device_unk;
+  return (Z_Device &) ((const Z_Devices*)this)->findShortAddr(shortaddr);
 }
 const Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) const {
+  if (indexBuild()) {
+    int32_t pos = indexFindShortAddr(shortaddr);
+    return (pos >= 0) ? *_idx_dev[pos] : device_unk;
+  }
   for (const auto & elem : _devices) {
     if (elem.shortaddr == shortaddr) { return elem; }
   }
   return device_unk;
 }
 //
-// Scan all devices to find a corresponding longaddr
+// Find the device with a corresponding longaddr
 // Looks info device.longaddr entry
 // In:
 //    longaddr (non null)
 // Out:
-//    index in _devices of entry, -1 if not found
+//    reference to device, or to device_unk if not found
 //
 Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) {
-  if (!longaddr) { return device_unk; }
-  for (auto &elem : _devices) {
-    if (elem.longaddr == longaddr) { return elem; }
-  }
-  return device_unk;
+  return (Z_Device &) ((const Z_Devices*)this)->findLongAddr(longaddr);
 }
 const Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) const {
   if (!longaddr) { return device_unk; }
+  if (indexBuild()) {
+    int32_t pos = indexFindLongAddr(longaddr);
+    return (pos >= 0) ? *_idx_dev[pos] : device_unk;
+  }
   for (const auto &elem : _devices) {
     if (elem.longaddr == longaddr) { return elem; }
   }
   return device_unk;
 }
 //
-// Scan all devices to find a corresponding friendlyNme
+// Find the device with a corresponding friendlyNme
 // Looks info device.friendlyName entry
 // In:
 //    friendlyName (null terminated, should not be empty)
@@ -108,6 +226,9 @@ int32_t Z_Devices::findFriendlyName(const char * name) const {
   size_t name_len = strlen(name);
   int32_t found = 0;
   if (name_len) {
+    if (indexBuild()) {
+      return indexFindFriendlyName(name);
+    }
     for (auto &elem : _devices) {
       if (elem.friendlyName) {
         if (strcasecmp(elem.friendlyName, name) == 0) { return found; }
@@ -171,6 +292,7 @@ bool Z_Devices::removeDevice(uint16_t shortaddr) {
   Z_Device & device = findShortAddr(shortaddr);
   if (foundDevice(device)) {
     _devices.remove(&device);
+    indexInvalidate();
     dirty();
     return true;
   }
@@ -194,6 +316,7 @@ Z_Device & Z_Devices::updateDevice(uint16_t shortaddr, uint64_t longaddr) {
       // erase the previous shortaddr
       freeDeviceEntry(s_found);
       _devices.remove(s_found);
+      indexInvalidate();
       dirty();
       return *l_found;
     }
@@ -201,11 +324,13 @@ Z_Device & Z_Devices::updateDevice(uint16_t shortaddr, uint64_t longaddr) {
     // shortaddr already exists but longaddr not
     // add the longaddr to the entry
     s_found->longaddr = longaddr;
+    indexInvalidate();
     dirty();
     return *s_found;
   } else if (foundDevice(*l_found)) {
     // longaddr entry exists, update shortaddr
     l_found->shortaddr = shortaddr;
+    indexInvalidate();
     dirty();
     return *l_found;
   } else {
@@ -318,6 +443,7 @@ void Z_Device::setModelId(const char * str) {
 
 void Z_Device::setFriendlyName(const char * str) {
   setStringAttribute(friendlyName, str);
+  zigbee_devices.indexInvalidate();
 }
 
 void Z_Device::setLastSeenNow(void) {
@@ -401,20 +527,73 @@ bool Z_Devices::isHueBulbHidden(uint16_t shortaddr) const {
   return true;      // Fallback - Device is considered as hidden
 }
 
-// Deferred actions
+// Deferred actions are kept in a binary heap ordered by timer, so that runTimer() only
+// needs to look at the first one. Timers are compared by difference to survive millis() wrapping.
+static inline bool Z_DeferredBefore(const Z_Deferred & a, const Z_Deferred & b) {
+  return (int32_t)(a.timer - b.timer) < 0;
+}
+
+void Z_Devices::deferredSiftDown(uint32_t i) {
+  Z_Deferred elt = _deferred[i];
+  while (true) {
+    uint32_t child = 2 * i + 1;
+    if (child >= _deferred_len) { break; }
+    if ((child + 1 < _deferred_len) && Z_DeferredBefore(_deferred[child + 1], _deferred[child])) { child++; }
+    if (!Z_DeferredBefore(_deferred[child], elt)) { break; }
+    _deferred[i] = _deferred[child];
+    i = child;
+  }
+  _deferred[i] = elt;
+}
+
+void Z_Devices::deferredPush(const Z_Deferred & deferred) {
+  if (_deferred_len >= _deferred_size) {
+    uint32_t new_size = _deferred_size ? _deferred_size * 2 : 8;
+    if (new_size > 0xFFFF) { return; }
+    Z_Deferred * new_deferred = (Z_Deferred*) realloc(_deferred, new_size * sizeof(Z_Deferred));
+    if (!new_deferred) { return; }    // out of memory, drop the timer
+    _deferred = new_deferred;
+    _deferred_size = new_size;
+  }
+  uint32_t i = _deferred_len++;
+  while (i > 0) {
+    uint32_t parent = (i - 1) / 2;
+    if (!Z_DeferredBefore(deferred, _deferred[parent])) { break; }
+    _deferred[i] = _deferred[parent];
+    i = parent;
+  }
+  _deferred[i] = deferred;
+}
+
+void Z_Devices::deferredRemoveTop(void) {
+  if (0 == _deferred_len) { return; }
+  _deferred_len--;
+  if (_deferred_len > 0) {
+    _deferred[0] = _deferred[_deferred_len];
+    deferredSiftDown(0);
+  }
+}
+
 // Parse for a specific category, of all deferred for a device if category == 0xFF
 // Only with specific cluster number or for all clusters if cluster == 0xFFFF
 void Z_Devices::resetTimersForDevice(uint16_t shortaddr, uint16_t groupaddr, uint8_t category, uint16_t cluster, uint8_t endpoint) {
-  // iterate the list of deferred, and remove any linked to the shortaddr
-  for (auto & defer : _deferred) {
-    if ((defer.shortaddr == shortaddr) && (defer.groupaddr == groupaddr)) {
-      if ((0xFF == category) || (defer.category == category)) {
-        if ((0xFFFF == cluster) || (defer.cluster == cluster)) {
-          if ((0xFF == endpoint) || (defer.endpoint == endpoint)) {
-            _deferred.remove(&defer);
-          }
-        }
-      }
+  // compact the heap to remove any deferred linked to the shortaddr, then restore the heap order
+  uint32_t kept = 0;
+  for (uint32_t i = 0; i < _deferred_len; i++) {
+    const Z_Deferred & defer = _deferred[i];
+    if ((defer.shortaddr == shortaddr) && (defer.groupaddr == groupaddr) &&
+        ((0xFF == category) || (defer.category == category)) &&
+        ((0xFFFF == cluster) || (defer.cluster == cluster)) &&
+        ((0xFF == endpoint) || (defer.endpoint == endpoint))) {
+      continue;     // remove
+    }
+    if (kept != i) { _deferred[kept] = defer; }
+    kept++;
+  }
+  if (kept != _deferred_len) {
+    _deferred_len = kept;
+    for (int32_t i = (int32_t)_deferred_len / 2 - 1; i >= 0; i--) {
+      deferredSiftDown(i);
     }
   }
 }
@@ -427,8 +606,7 @@ void Z_Devices::setTimer(uint16_t shortaddr, uint16_t groupaddr, uint32_t wait_m
   }
 
   // Now create the new timer
-  Z_Deferred & deferred = _deferred.addHead();
-  deferred = { wait_ms + millis(),   // timer
+  Z_Deferred deferred = { wait_ms + millis(),   // timer
                           shortaddr,
                           groupaddr,
                           cluster,
@@ -436,6 +614,7 @@ void Z_Devices::setTimer(uint16_t shortaddr, uint16_t groupaddr, uint32_t wait_m
                           category,
                           value,
                           func };
+  deferredPush(deferred);
 }
 
 // Set timer after the already queued events
@@ -454,15 +633,14 @@ void Z_Devices::queueTimer(uint16_t shortaddr, uint16_t groupaddr, uint32_t wait
 }
 
 // Run timer at each tick
-// WARNING: don't set a new timer within a running timer, this causes memory corruption
+// Timers are removed before being called, so a timer can safely set or reset other timers
 void Z_Devices::runTimer(void) {
-  // visit all timers
-  for (auto & defer : _deferred) {
-    uint32_t timer = defer.timer;
-    if (TimeReached(timer)) {
-      (*defer.func)(defer.shortaddr, defer.groupaddr, defer.cluster, defer.endpoint, defer.value);
-      _deferred.remove(&defer);
-    }
+  // fire due timers in order, but no more than were pending so that a timer re-arming itself can't loop forever
+  uint32_t count = _deferred_len;
+  while ((count-- > 0) && (_deferred_len > 0) && TimeReached(_deferred[0].timer)) {
+    Z_Deferred defer = _deferred[0];
+    deferredRemoveTop();
+    (*defer.func)(defer.shortaddr, defer.groupaddr, defer.cluster, defer.endpoint, defer.value);
   }
 
   // check if we need to save to Flash
@@ -666,6 +666,122 @@ const Z_AttributeConverter Z_PostProcess[] PROGMEM = {
 };
 #pragma GCC diagnostic pop
 
+//
+// Indexes over Z_PostProcess
+//
+// Both are arrays of indices into Z_PostProcess, built once at first use:
+// - Z_PostProcess_by_id is sorted by cluster then attribute
+// - Z_PostProcess_by_name is sorted by case insensitive name, entries without name are left out
+// Ties are kept in table order, so the first match is the same as a linear scan.
+uint16_t * Z_PostProcess_by_id = nullptr;
+uint16_t * Z_PostProcess_by_name = nullptr;
+uint16_t   Z_PostProcess_by_name_len = 0;
+
+uint32_t Z_converterKey(uint32_t i) {
+  const Z_AttributeConverter *converter = &Z_PostProcess[i];
+  return ((uint32_t)CxToCluster(pgm_read_byte(&converter->cluster_short)) << 16) | pgm_read_word(&converter->attribute);
+}
+
+const char * Z_converterName(uint32_t i) {
+  return Z_strings + pgm_read_word(&Z_PostProcess[i].name_offset);
+}
+
+int Z_converterCompareId(const void * a, const void * b) {
+  uint16_t ia = *(const uint16_t*)a;
+  uint16_t ib = *(const uint16_t*)b;
+  uint32_t ka = Z_converterKey(ia);
+  uint32_t kb = Z_converterKey(ib);
+  if (ka != kb) { return (ka < kb) ? -1 : 1; }
+  return (int)ia - (int)ib;
+}
+
+int Z_converterCompareName(const void * a, const void * b) {
+  uint16_t ia = *(const uint16_t*)a;
+  uint16_t ib = *(const uint16_t*)b;
+  char name_a[48];
+  strncpy_P(name_a, Z_converterName(ia), sizeof(name_a));
+  name_a[sizeof(name_a) - 1] = 0;
+  int r = strcasecmp_P(name_a, Z_converterName(ib));
+  if (r != 0) { return r; }
+  return (int)ia - (int)ib;
+}
+
+bool Z_converterIndexInit(void) {
+  if (Z_PostProcess_by_id) { return true; }
+  uint16_t * by_id = (uint16_t*) malloc(nitems(Z_PostProcess) * sizeof(uint16_t));
+  uint16_t * by_name = (uint16_t*) malloc(nitems(Z_PostProcess) * sizeof(uint16_t));
+  if (!by_id || !by_name) {
+    free(by_id);
+    free(by_name);
+    return false;
+  }
+  uint32_t name_len = 0;
+  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+    by_id[i] = i;
+    if (pgm_read_word(&Z_PostProcess[i].name_offset)) { by_name[name_len++] = i; }
+  }
+  qsort(by_id, nitems(Z_PostProcess), sizeof(uint16_t), Z_converterCompareId);
+  qsort(by_name, name_len, sizeof(uint16_t), Z_converterCompareName);
+  Z_PostProcess_by_id = by_id;
+  Z_PostProcess_by_name = by_name;
+  Z_PostProcess_by_name_len = name_len;
+  return true;
+}
+
+// Find the first converter (in table order) for cluster/attr_id
+// Returns the index in Z_PostProcess or -1 if not found
+int32_t Z_findConverterById(uint16_t cluster, uint16_t attr_id) {
+  if (!Z_converterIndexInit()) {
+    // no memory for the index, fall back to a linear scan
+    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+      if (Z_converterKey(i) == (((uint32_t)cluster << 16) | attr_id)) { return i; }
+    }
+    return -1;
+  }
+  uint32_t key = ((uint32_t)cluster << 16) | attr_id;
+  uint32_t lo = 0, hi = nitems(Z_PostProcess);    // lower bound
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (Z_converterKey(Z_PostProcess_by_id[mid]) < key) { lo = mid + 1; }
+    else                                                { hi = mid; }
+  }
+  if ((lo < nitems(Z_PostProcess)) && (Z_converterKey(Z_PostProcess_by_id[lo]) == key)) {
+    return Z_PostProcess_by_id[lo];
+  }
+  return -1;
+}
+
+// Find the first converter (in table order) named `name` (case insensitive)
+// If `preferred_cluster` is not 0xFFFF, only converters for this cluster match
+// Returns the index in Z_PostProcess or -1 if not found
+int32_t Z_findConverterByName(const char * name, uint16_t preferred_cluster = 0xFFFF) {
+  if (!Z_converterIndexInit()) {
+    // no memory for the index, fall back to a linear scan
+    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+      if (0 == pgm_read_word(&Z_PostProcess[i].name_offset)) { continue; }
+      if ((0 == strcasecmp_P(name, Z_converterName(i))) &&
+          ((preferred_cluster == 0xFFFF) || ((Z_converterKey(i) >> 16) == preferred_cluster))) {
+        return i;
+      }
+    }
+    return -1;
+  }
+  uint32_t lo = 0, hi = Z_PostProcess_by_name_len;  // lower bound
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (strcasecmp_P(name, Z_converterName(Z_PostProcess_by_name[mid])) > 0) { lo = mid + 1; }
+    else                                                                     { hi = mid; }
+  }
+  for (; lo < Z_PostProcess_by_name_len; lo++) {
+    uint32_t i = Z_PostProcess_by_name[lo];
+    if (0 != strcasecmp_P(name, Z_converterName(i))) { break; }
+    if ((preferred_cluster == 0xFFFF) || ((Z_converterKey(i) >> 16) == preferred_cluster)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
 typedef union ZCLHeaderFrameControl_t {
   struct {
     uint8_t frame_type : 2;           // 00 = across entire profile, 01 = cluster specific
@@ -683,19 +799,17 @@ typedef union ZCLHeaderFrameControl_t {
 const __FlashStringHelper* zigbeeFindAttributeByName(const char *command,
                                     uint16_t *cluster, uint16_t *attribute, int8_t *multiplier,
                                     uint8_t *zigbee_type = nullptr, Z_Data_Type *data_type = nullptr, uint8_t *map_offset = nullptr) {
-  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-    const Z_AttributeConverter *converter = &Z_PostProcess[i];
-    if (0 == pgm_read_word(&converter->name_offset)) { continue; }         // avoid strcasecmp_P() from crashing
-    if (0 == strcasecmp_P(command, Z_strings + pgm_read_word(&converter->name_offset))) {
-      if (cluster)      { *cluster    = CxToCluster(pgm_read_byte(&converter->cluster_short)); }
-      if (attribute)    { *attribute  = pgm_read_word(&converter->attribute); }
-      if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
-      if (zigbee_type)  { *zigbee_type = pgm_read_byte(&converter->type); }
-      uint8_t conv_mapping = pgm_read_byte(&converter->mapping);
-      if (data_type)    { *data_type = (Z_Data_Type) ((conv_mapping & 0xF0)>>4); }
-      if (map_offset)   { *map_offset = (conv_mapping & 0x0F); }
-      return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
-    }
+  int32_t idx = Z_findConverterByName(command);
+  if (idx >= 0) {
+    const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+    if (cluster)      { *cluster    = CxToCluster(pgm_read_byte(&converter->cluster_short)); }
+    if (attribute)    { *attribute  = pgm_read_word(&converter->attribute); }
+    if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
+    if (zigbee_type)  { *zigbee_type = pgm_read_byte(&converter->type); }
+    uint8_t conv_mapping = pgm_read_byte(&converter->mapping);
+    if (data_type)    { *data_type = (Z_Data_Type) ((conv_mapping & 0xF0)>>4); }
+    if (map_offset)   { *map_offset = (conv_mapping & 0x0F); }
+    return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
   }
   return nullptr;
 }
@@ -705,16 +819,12 @@ const __FlashStringHelper* zigbeeFindAttributeByName(const char *command,
 //
 const __FlashStringHelper* zigbeeFindAttributeById(uint16_t cluster, uint16_t attr_id,
                                       uint8_t *attr_type, int8_t *multiplier) {
-  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-    const Z_AttributeConverter *converter = &Z_PostProcess[i];
-    uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-    uint16_t conv_attr_id = pgm_read_word(&converter->attribute);
-
-    if ((conv_cluster == cluster) && (conv_attr_id == attr_id)) {
-      if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
-      if (attr_type)    { *attr_type  = pgm_read_byte(&converter->type); }
-      return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
-    }
+  int32_t idx = Z_findConverterById(cluster, attr_id);
+  if (idx >= 0) {
+    const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+    if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
+    if (attr_type)    { *attr_type  = pgm_read_byte(&converter->type); }
+    return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
   }
   return nullptr;
 }
@@ -1474,15 +1584,9 @@ void ZCLFrame::parseReadAttributes(Z_attribute_list& attr_list) {
     read_attr_ids[i/2] = attrid;
 
     // find the attribute name
-    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-      const Z_AttributeConverter *converter = &Z_PostProcess[i];
-      uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-      uint16_t conv_attribute = pgm_read_word(&converter->attribute);
-
-      if ((conv_cluster == _cluster_id) && (conv_attribute == attrid)) {
-        attr_names.addAttribute(Z_strings + pgm_read_word(&converter->name_offset), true).setBool(true);
-        break;
-      }
+    int32_t idx = Z_findConverterById(_cluster_id, attrid);
+    if (idx >= 0) {
+      attr_names.addAttribute(Z_converterName(idx), true).setBool(true);
     }
     i += 2;
   }
@@ -1543,17 +1647,11 @@ void ZCLFrame::parseReadConfigAttributes(Z_attribute_list& attr_list) {
 
     // find the attribute name
     int8_t multiplier = 1;
-    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-      const Z_AttributeConverter *converter = &Z_PostProcess[i];
-      uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-      uint16_t conv_attribute = pgm_read_word(&converter->attribute);
-
-      if ((conv_cluster == _cluster_id) && (conv_attribute == attrid)) {
-        const char * attr_name = Z_strings + pgm_read_word(&converter->name_offset);
-        attr_2.addAttribute(attr_name, true).setBool(true);
-        multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
-        break;
-      }
+    int32_t idx = Z_findConverterById(_cluster_id, attrid);
+    if (idx >= 0) {
+      const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+      attr_2.addAttribute(Z_converterName(idx), true).setBool(true);
+      multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
     }
     i += 4;
     if (0 != status) {
@@ -2017,22 +2115,19 @@ void Z_postProcessAttributes(uint16_t shortaddr, uint16_t src_ep, class Z_attrib
       uint8_t map_offset = 0;
       uint8_t zigbee_type = Znodata;
       int8_t conv_multiplier;
-      for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-        const Z_AttributeConverter *converter = &Z_PostProcess[i];
-        uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-        uint16_t conv_attribute = pgm_read_word(&converter->attribute);
-
-        if ((conv_cluster == cluster) &&
-            ((conv_attribute == attribute) || (conv_attribute == 0xFFFF)) ) {
-          conv_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
-          zigbee_type = pgm_read_byte(&converter->type);
-          uint8_t mapping = pgm_read_byte(&converter->mapping);
-          map_type = (Z_Data_Type) ((mapping & 0xF0)>>4);
-          map_offset = (mapping & 0x0F);
-          conv_name = Z_strings + pgm_read_word(&converter->name_offset);
-          found = true;
-          break;
-        }
+      // an exact match or a wildcard 0xFFFF attribute, whichever comes first in the table
+      int32_t idx = Z_findConverterById(cluster, attribute);
+      int32_t idx_any = Z_findConverterById(cluster, 0xFFFF);
+      if ((idx < 0) || ((idx_any >= 0) && (idx_any < idx))) { idx = idx_any; }
+      if (idx >= 0) {
+        const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+        conv_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
+        zigbee_type = pgm_read_byte(&converter->type);
+        uint8_t mapping = pgm_read_byte(&converter->mapping);
+        map_type = (Z_Data_Type) ((mapping & 0xF0)>>4);
+        map_offset = (mapping & 0x0F);
+        conv_name = Z_converterName(idx);
+        found = true;
       }
 
       float    fval   = attr.getFloat();
@@ -2107,33 +2202,19 @@ void Z_postProcessAttributes(uint16_t shortaddr, uint16_t src_ep, class Z_attrib
 
 // Internal search function
 void Z_parseAttributeKey_inner(class Z_attribute & attr, uint16_t preferred_cluster) {
-  // scan attributes to find by name, and retrieve type
-  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-    const Z_AttributeConverter *converter = &Z_PostProcess[i];
-    uint16_t local_attr_id = pgm_read_word(&converter->attribute);
-    uint16_t local_cluster_id = CxToCluster(pgm_read_byte(&converter->cluster_short));
-    uint8_t  local_type_id = pgm_read_byte(&converter->type);
-    int8_t   local_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
-    // AddLog(LOG_LEVEL_DEBUG, PSTR("Try cluster = 0x%04X, attr = 0x%04X, type_id = 0x%02X"), local_cluster_id, local_attr_id, local_type_id);
-
-    if (!attr.key_is_str) {
-      if ((attr.key.id.cluster == local_cluster_id) && (attr.key.id.attr_id == local_attr_id)) {
-        attr.attr_type = local_type_id;
-        break;
-      }
-    } else if (pgm_read_word(&converter->name_offset)) {
-      const char * key = attr.key.key;
-      // AddLog(LOG_LEVEL_DEBUG, PSTR("Comparing '%s' with '%s'"), attr_name, converter->name);
-      if (0 == strcasecmp_P(key, Z_strings + pgm_read_word(&converter->name_offset))) {
-        if ((preferred_cluster == 0xFFFF) ||    // any cluster
-            (local_cluster_id == preferred_cluster)) {
-          // match
-          attr.setKeyId(local_cluster_id, local_attr_id);
-          attr.attr_type = local_type_id;
-          attr.attr_multiplier = local_multiplier;
-          break;
-        }
-      }
+  // find by id or by name, and retrieve type
+  if (!attr.key_is_str) {
+    int32_t idx = Z_findConverterById(attr.key.id.cluster, attr.key.id.attr_id);
+    if (idx >= 0) {
+      attr.attr_type = pgm_read_byte(&Z_PostProcess[idx].type);
+    }
+  } else {
+    int32_t idx = Z_findConverterByName(attr.key.key, preferred_cluster);
+    if (idx >= 0) {
+      const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+      attr.setKeyId(CxToCluster(pgm_read_byte(&converter->cluster_short)), pgm_read_word(&converter->attribute));
+      attr.attr_type = pgm_read_byte(&converter->type);
+      attr.attr_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
     }
   }
 }
@@ -71,11 +71,111 @@ bool Z_LedStatusSet(bool onoff) {
 #include <TasmotaSerial.h>
 TasmotaSerial *ZigbeeSerial = nullptr;
 
+// Max number of frames processed in a single call to ZigbeeInputLoop(), to bound the time spent
+// when the MCU sends a burst (network join, OTA)
+const uint32_t ZIGBEE_MAX_FRAMES_PER_LOOP = 8;
+
+// Can the batch continue with the next frame?
+// If the last frame made the state machine move on, it needs to run before the next frame is
+// processed, since the next frame may be the response it is going to wait for
+bool ZigbeeInputBatchContinue(uint32_t frames) {
+  if (frames >= ZIGBEE_MAX_FRAMES_PER_LOOP) { return false; }
+  return !(zigbee.state_machine && !zigbee.state_waiting);
+}
+
+#ifdef USE_ZIGBEE_ZNP
+//
+// A full ZNP frame (or a timed-out partial frame) is in zigbee_buffer, check and process it
+//
+void ZigbeeZNPFrameReceived(uint32_t frame_len, uint8_t fcs) {
+  // AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_ZIGBEE "Bytes follow_read_metric = %0d"), ZigbeeSerial->getLoopReadMetric());
+  // buffer received, now check integrity
+  if (zigbee_buffer->len() != frame_len) {
+    // Len is not correct, log and reject frame
+    AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEEZNPRECEIVED ": received frame of wrong size %_B, len %d, expected %d"), zigbee_buffer, zigbee_buffer->len(), frame_len);
+  } else if (0x00 != fcs) {
+    // FCS is wrong, packet is corrupt, log and reject frame
+    AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEEZNPRECEIVED ": received bad FCS frame %_B, %d"), zigbee_buffer, fcs);
+  } else {
+    // frame is correct
+    SBuffer znp_buffer = zigbee_buffer->subBuffer(2, frame_len - 3);	// remove SOF, LEN and FCS
+
+    // only format the payload in hex if it is published, AddLog() doesn't format if the level is not logged
+    if (Settings->flag3.tuya_serial_mqtt_publish) {
+      Response_P(PSTR("{\"" D_JSON_ZIGBEEZNPRECEIVED "\":\"%_B\"}"), &znp_buffer);
+      MqttPublishPrefixTopicRulesProcess_P(TELE, PSTR(D_RSLT_SENSOR));
+    } else {
+      AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "{\"" D_JSON_ZIGBEEZNPRECEIVED "\":\"%_B\"}"), &znp_buffer);
+    }
+    // now process the message
+    ZigbeeProcessInput(znp_buffer);
+  }
+  zigbee_buffer->setLen(0);		// empty buffer
+}
+#endif // USE_ZIGBEE_ZNP
+
+#ifdef USE_ZIGBEE_EZSP
+//
+// A full EZSP frame (without EOF) or a timed-out partial frame is in zigbee_buffer, check and process it
+//
+void ZigbeeEZSPFrameReceived(bool frame_complete) {
+  uint32_t frame_len = zigbee_buffer->len();
+  // AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_ZIGBEE "Bytes follow_read_metric = %0d"), ZigbeeSerial->getLoopReadMetric());
+  if ((frame_complete) && (frame_len >= 3)) {
+    // frame received and has at least 3 bytes (without EOF), checking CRC
+    // AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEE_EZSP_RECEIVED ": received raw frame %s"), hex_char);
+    uint16_t crc = 0xFFFF;                 // frame CRC
+    // compute CRC
+    for (uint32_t i=0; i<frame_len-2; i++) {
+      crc = crc ^ ((uint16_t)zigbee_buffer->get8(i) << 8);
+      for (uint32_t i=0; i<8; i++) {
+        if (crc & 0x8000) {
+          crc = (crc << 1) ^ 0x1021;          // polynom is x^16 + x^12 + x^5 + 1, CCITT standard
+        } else {
+          crc <<= 1;
+        }
+      }
+    }
+
+    uint16_t crc_received = zigbee_buffer->get8(frame_len - 2) << 8 | zigbee_buffer->get8(frame_len - 1);
+    // remove 2 last bytes
+
+    if (crc_received != crc) {
+      AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEE_EZSP_RECEIVED ": bad crc (received 0x%04X, computed 0x%04X) %_B"), crc_received, crc, zigbee_buffer);
+    } else {
+      // copy buffer
+      SBuffer ezsp_buffer = zigbee_buffer->subBuffer(0, frame_len - 2);	// CRC
+
+      // CRC is correct, apply de-stuffing if DATA frame
+      if (0 == (ezsp_buffer.get8(0) & 0x80)) {
+        // DATA frame
+        uint8_t rand = 0x42;
+        for (uint32_t i=1; i<ezsp_buffer.len(); i++) {
+          ezsp_buffer.set8(i, ezsp_buffer.get8(i) ^ rand);
+          if (rand & 1) { rand = (rand >> 1) ^ 0xB8; }
+          else          { rand = (rand >> 1); }
+        }
+      }
+
+      AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_ZIGBEE "{\"" D_JSON_ZIGBEE_EZSP_RECEIVED "2\":\"%_B\"}"), &ezsp_buffer);
+      // now process the message
+      ZigbeeProcessInputRaw(ezsp_buffer);
+    }
+  } else {
+    // the buffer timed-out, print error and discard
+    AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEE_EZSP_RECEIVED ": time-out, discarding %_B"), zigbee_buffer);
+  }
+  zigbee_buffer->setLen(0);		// empty buffer
+}
+#endif // USE_ZIGBEE_EZSP
+
 /********************************************************************************************/
 //
 // Called at event loop, checks for incoming data from the CC2530
+// All complete frames available are processed in one pass, see ZigbeeInputBatchContinue()
 //
 void ZigbeeInputLoop(void) {
+  uint32_t frames = 0;                          // frames processed in this call
 
 #ifdef USE_ZIGBEE_ZNP
 	static uint32_t zigbee_polling_window = 0;    // number of milliseconds since first byte
@@ -119,8 +219,11 @@ void ZigbeeInputLoop(void) {
     }
 
 		if (zigbee_buffer->len() >= zigbee_frame_len) {
-      zigbee_polling_window = 0;                                      // Publish now
-      break;
+      // frame complete, process it now and continue with the next one
+      ZigbeeZNPFrameReceived(zigbee_frame_len, fcs);
+      zigbee_polling_window = 0;
+      if (!ZigbeeInputBatchContinue(++frames)) { break; }
+      continue;
     }
 
     // recalculate frame length
@@ -134,37 +237,14 @@ void ZigbeeInputLoop(void) {
   }
 
   if (zigbee_buffer->len() && (millis() > (zigbee_polling_window + ZIGBEE_POLLING))) {
-    // AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_ZIGBEE "Bytes follow_read_metric = %0d"), ZigbeeSerial->getLoopReadMetric());
-		// buffer received, now check integrity
-		if (zigbee_buffer->len() != zigbee_frame_len) {
-			// Len is not correct, log and reject frame
-      AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEEZNPRECEIVED ": received frame of wrong size %_B, len %d, expected %d"), zigbee_buffer, zigbee_buffer->len(), zigbee_frame_len);
-		} else if (0x00 != fcs) {
-			// FCS is wrong, packet is corrupt, log and reject frame
-      AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEEZNPRECEIVED ": received bad FCS frame %_B, %d"), zigbee_buffer, fcs);
-		} else {
-			// frame is correct
-			//AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_JSON_ZIGBEEZNPRECEIVED ": received correct frame %s"), hex_char);
-
-			SBuffer znp_buffer = zigbee_buffer->subBuffer(2, zigbee_frame_len - 3);	// remove SOF, LEN and FCS
-
-      Response_P(PSTR("{\"" D_JSON_ZIGBEEZNPRECEIVED "\":\"%_B\"}"), &znp_buffer);
-      if (Settings->flag3.tuya_serial_mqtt_publish) {
-        MqttPublishPrefixTopicRulesProcess_P(TELE, PSTR(D_RSLT_SENSOR));
-      } else {
-        AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "%s"), ResponseData());
-      }
-			// now process the message
-      ZigbeeProcessInput(znp_buffer);
-		}
-		zigbee_buffer->setLen(0);		// empty buffer
+    // partial frame timed-out
+    ZigbeeZNPFrameReceived(zigbee_frame_len, fcs);
   }
 #endif // USE_ZIGBEE_ZNP
 
 #ifdef USE_ZIGBEE_EZSP
 	static uint32_t zigbee_polling_window = 0;    // number of milliseconds since first byte
   static bool escape = false;                          // was the previous byte an escape?
-  bool frame_complete = false;                  // frame is ready and complete
   // Receive only valid EZSP frames:
   // 1A - Cancel - cancel all previous bytes
   // 7D - Escape byte - following byte is escaped
@@ -198,14 +278,15 @@ void ZigbeeInputLoop(void) {
       // AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("ZIG: ZbInput byte=0x1A, cancel byte received, discarding %d bytes"), zigbee_buffer->len());
       zigbee_buffer->setLen(0);		// empty buffer
       escape = false;
-      frame_complete = false;
       continue;                   // re-loop
     }
 
     if (ZIGBEE_EZSP_EOF == zigbee_in_byte) {
-      // end of frame
-      frame_complete = true;
-      break;
+      // end of frame, process it now and continue with the next one
+      ZigbeeEZSPFrameReceived(true);
+      escape = false;
+      if (!ZigbeeInputBatchContinue(++frames)) { break; }
+      continue;
     }
 
     if (zigbee_buffer->len() < ZIGBEE_BUFFER_SIZE) {
@@ -220,56 +301,10 @@ void ZigbeeInputLoop(void) {
     }   // adding bytes
   }     // while (ZigbeeSerial->available())
 
-  uint32_t frame_len = zigbee_buffer->len();
-  if (frame_complete || (frame_len && (millis() > (zigbee_polling_window + ZIGBEE_POLLING)))) {
-    // AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_ZIGBEE "Bytes follow_read_metric = %0d"), ZigbeeSerial->getLoopReadMetric());
-    if ((frame_complete) && (frame_len >= 3)) {
-      // frame received and has at least 3 bytes (without EOF), checking CRC
-      // AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEE_EZSP_RECEIVED ": received raw frame %s"), hex_char);
-      uint16_t crc = 0xFFFF;                 // frame CRC
-			// compute CRC
-      for (uint32_t i=0; i<frame_len-2; i++) {
-        crc = crc ^ ((uint16_t)zigbee_buffer->get8(i) << 8);
-        for (uint32_t i=0; i<8; i++) {
-          if (crc & 0x8000) {
-            crc = (crc << 1) ^ 0x1021;          // polynom is x^16 + x^12 + x^5 + 1, CCITT standard
-          } else {
-            crc <<= 1;
-          }
-        }
-      }
-
-      uint16_t crc_received = zigbee_buffer->get8(frame_len - 2) << 8 | zigbee_buffer->get8(frame_len - 1);
-      // remove 2 last bytes
-
-      if (crc_received != crc) {
-        AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEE_EZSP_RECEIVED ": bad crc (received 0x%04X, computed 0x%04X) %_B"), crc_received, crc, zigbee_buffer);
-      } else {
-        // copy buffer
-    	  SBuffer ezsp_buffer = zigbee_buffer->subBuffer(0, frame_len - 2);	// CRC
-
-        // CRC is correct, apply de-stuffing if DATA frame
-        if (0 == (ezsp_buffer.get8(0) & 0x80)) {
-          // DATA frame
-          uint8_t rand = 0x42;
-          for (uint32_t i=1; i<ezsp_buffer.len(); i++) {
-            ezsp_buffer.set8(i, ezsp_buffer.get8(i) ^ rand);
-            if (rand & 1) { rand = (rand >> 1) ^ 0xB8; }
-            else          { rand = (rand >> 1); }
-          }
-        }
-
-        AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_ZIGBEE "{\"" D_JSON_ZIGBEE_EZSP_RECEIVED "2\":\"%_B\"}"), &ezsp_buffer);
-        // now process the message
-        ZigbeeProcessInputRaw(ezsp_buffer);
-      }
-    } else {
-      // the buffer timed-out, print error and discard
-      AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEE_EZSP_RECEIVED ": time-out, discarding %_B"), zigbee_buffer);
-    }
-    zigbee_buffer->setLen(0);		// empty buffer
+  if (zigbee_buffer->len() && (millis() > (zigbee_polling_window + ZIGBEE_POLLING))) {
+    // partial frame timed-out
+    ZigbeeEZSPFrameReceived(false);
     escape = false;
-    frame_complete = false;
   }
 
 #endif // USE_ZIGBEE_EZSP
@@ -20,6 +20,7 @@
 #ifdef USE_ZIGBEE
 
 #define XDRV_23                    23
+#define XDRV_23_FUNCS              (XFUNC_LOOP | XFUNC_50MS)
 
 #include "UnishoxStrings.h"
 
@@ -619,35 +620,33 @@ void ZbSendRead(JsonParserToken val_attr, ZCLMessage & zcl) {
       JsonParserToken value = key.getValue();
 
       bool found = false;
-      // scan attributes to find by name, and retrieve type
-      for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-        const Z_AttributeConverter *converter = &Z_PostProcess[i];
+      // find attribute by name, and retrieve type
+      int32_t idx = Z_findConverterByName(key.getStr());
+      if (idx >= 0) {
+        const Z_AttributeConverter *converter = &Z_PostProcess[idx];
         uint16_t local_attr_id = pgm_read_word(&converter->attribute);
         uint16_t local_cluster_id = CxToCluster(pgm_read_byte(&converter->cluster_short));
         // uint8_t  local_type_id = pgm_read_byte(&converter->type);
 
-        if ((pgm_read_word(&converter->name_offset)) && (0 == strcasecmp_P(key.getStr(), Z_strings + pgm_read_word(&converter->name_offset)))) {
-          // match name
-          // check if there is a conflict with cluster
-          // TODO
-          if (!(value.getBool()) && attr_item_offset) {
-            // If value is false (non-default) then set direction to 1 (for ReadConfig)
-            attrs[actual_attr_len] = 0x01;
-          }
-          actual_attr_len += attr_item_offset;
-          attrs[actual_attr_len++] = local_attr_id & 0xFF;
-          attrs[actual_attr_len++] = local_attr_id >> 8;
-          actual_attr_len += attr_item_len - 2 - attr_item_offset;    // normally 0
-          found = true;
-          // check cluster
-          if (!zcl.validCluster()) {
-            zcl.cluster = local_cluster_id;
-          } else if (zcl.cluster != local_cluster_id) {
-            ResponseCmndChar_P(PSTR(D_ZIGBEE_TOO_MANY_CLUSTERS));
-            if (attrs) { free(attrs); }
-            return;
-          }
-          break;    // found, exit loop
+        // match name
+        // check if there is a conflict with cluster
+        // TODO
+        if (!(value.getBool()) && attr_item_offset) {
+          // If value is false (non-default) then set direction to 1 (for ReadConfig)
+          attrs[actual_attr_len] = 0x01;
+        }
+        actual_attr_len += attr_item_offset;
+        attrs[actual_attr_len++] = local_attr_id & 0xFF;
+        attrs[actual_attr_len++] = local_attr_id >> 8;
+        actual_attr_len += attr_item_len - 2 - attr_item_offset;    // normally 0
+        found = true;
+        // check cluster
+        if (!zcl.validCluster()) {
+          zcl.cluster = local_cluster_id;
+        } else if (zcl.cluster != local_cluster_id) {
+          ResponseCmndChar_P(PSTR(D_ZIGBEE_TOO_MANY_CLUSTERS));
+          if (attrs) { free(attrs); }
+          return;
         }
       }
       if (!found) {
@@ -706,7 +705,8 @@ void CmndZbSend(void) {
   // ZbSend { "device":"0x1234", "endpoint":"0x03", "send":{"Color":"1,2"} }
   // ZbSend { "device":"0x1234", "endpoint":"0x03", "send":{"Color":"0x1122,0xFFEE"} }
   if (zigbee.init_phase) { ResponseCmndChar_P(PSTR(D_ZIGBEE_NOT_STARTED)); return; }
-  JsonParser parser(XdrvMailbox.data);
+  jsmntok_t tokens[32];   // single pass parsing, spills to heap for large payloads
+  JsonParser parser(XdrvMailbox.data, tokens, ARRAY_SIZE(tokens));
   JsonParserObject root = parser.getRootObject();
   if (!root) { ResponseCmndChar_P(PSTR(D_JSON_INVALID_JSON)); return; }
 
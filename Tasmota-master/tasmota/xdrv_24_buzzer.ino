@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_24                    24
+#define XDRV_24_FUNCS              XFUNC_100MS
 
 struct BUZZER {
   uint32_t tune = 0;
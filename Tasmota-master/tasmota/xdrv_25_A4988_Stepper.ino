@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XDRV_25                    25
+#define XDRV_25_FUNCS              0
 
 #include <A4988_Stepper.h>
 
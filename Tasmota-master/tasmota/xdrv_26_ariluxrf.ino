@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XDRV_26              26
+#define XDRV_26_FUNCS        (XFUNC_50MS | XFUNC_SECOND)
 
 const uint32_t ARILUX_RF_TIME_AVOID_DUPLICATE = 1000;  // Milliseconds
 
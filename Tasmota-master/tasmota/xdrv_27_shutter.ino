@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_27            27
+#define XDRV_27_FUNCS      (XFUNC_50MS | XFUNC_250MS | XFUNC_SECOND)
 #ifndef SHUTTER_STEPPER
   #define SHUTTER_STEPPER
 #endif
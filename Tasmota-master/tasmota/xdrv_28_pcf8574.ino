@@ -27,6 +27,7 @@
 \*********************************************************************************************/
 
 #define XDRV_28           28
+#define XDRV_28_FUNCS     XFUNC_50MS
 #define XI2C_02           2     // See I2CDEVICES.md
 
 #define PCF8574_ADDR1     0x20  // PCF8574
@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XDRV_29                29
+#define XDRV_29_FUNCS          XFUNC_SECOND
 
 #define D_PRFX_DEEPSLEEP "DeepSleep"
 #define D_CMND_DEEPSLEEP_TIME "Time"
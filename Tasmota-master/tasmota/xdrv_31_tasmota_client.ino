@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_31                         31
+#define XDRV_31_FUNCS                   (XFUNC_100MS | XFUNC_SECOND)
 
 #ifndef USE_TASMOTA_CLIENT_FLASH_SPEED
 #define USE_TASMOTA_CLIENT_FLASH_SPEED  57600     // Usually 57600 for 3.3V variants and 115200 for 5V variants
@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XDRV_32              32
+#define XDRV_32_FUNCS        XFUNC_SECOND
 
 const uint32_t HOTPLUG_MAX = 254;  // 0 and 0xFF is OFF
 
@@ -32,6 +32,7 @@
 \*********************************************************************************************/
 
 #define XDRV_35             35
+#define XDRV_35_FUNCS       XFUNC_SECOND
 #define MAX_PWM_DIMMER_KEYS 3
 
 const char kPWMDimmerCommands[] PROGMEM = "|"  // No prefix
@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XDRV_36 36
+#define XDRV_36_FUNCS 0
 
 #include "cc1101.h"
 #include <KeeloqLib.h>
@@ -33,6 +33,7 @@
 \*********************************************************************************************/
 
 #define XDRV_37                   37
+#define XDRV_37_FUNCS             0
 
 struct SONOFFD1 {
   uint8_t receive_len = 0;
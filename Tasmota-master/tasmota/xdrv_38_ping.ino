@@ -20,6 +20,7 @@
 #ifdef USE_PING
 
 #define XDRV_38                    38
+#define XDRV_38_FUNCS              XFUNC_250MS
 
 #include "lwip/icmp.h"
 #include "lwip/inet_chksum.h"
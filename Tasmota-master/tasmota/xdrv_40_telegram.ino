@@ -39,6 +39,7 @@
 \*********************************************************************************************/
 
 #define XDRV_40                    40
+#define XDRV_40_FUNCS              XFUNC_SECOND
 
 #ifndef TELEGRAM_LOOP_WAIT
 #define TELEGRAM_LOOP_WAIT         10   // Seconds
@@ -20,6 +20,7 @@
 #ifdef USE_TCP_BRIDGE
 
 #define XDRV_41                    41
+#define XDRV_41_FUNCS              XFUNC_LOOP
 
 #ifndef TCP_BRIDGE_CONNECTIONS
 #define TCP_BRIDGE_CONNECTIONS 2    // number of maximum parallel connections
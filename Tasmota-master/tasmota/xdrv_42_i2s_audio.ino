@@ -31,6 +31,7 @@
 \*********************************************************************************************/
 
 #define XDRV_42           42
+#define XDRV_42_FUNCS     0
 
 #define USE_I2S_EXTERNAL_DAC   1
 //#define USE_I2S_NO_DAC                         // Add support for transistor-based output without DAC
@@ -34,6 +34,7 @@
 \*********************************************************************************************/
 
 #define XDRV_43             43
+#define XDRV_43_FUNCS       XFUNC_100MS
 #define XI2C_53             53 // See I2CDEVICES.md
 #include <MLX90640_API.h>
 
@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_44			44
+#define XDRV_44_FUNCS (XFUNC_LOOP | XFUNC_50MS | XFUNC_100MS | XFUNC_200MS | XFUNC_250MS | XFUNC_SECOND)
 
 #define nitems(_a)		(sizeof((_a)) / sizeof((_a)[0]))
 
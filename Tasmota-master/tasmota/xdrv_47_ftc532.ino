@@ -80,6 +80,7 @@
 \*********************************************************************************************/
 
 #define XDRV_47                   47
+#define XDRV_47_FUNCS             XFUNC_50MS
 
 #define FTC532_DEBOUNCE           0     // no. of cycles, < 2 disables the code
 #define FTC532_KEYS               4     // number of key pins on chip
@@ -223,6 +223,7 @@ bool TimepropCommand()
 \*********************************************************************************************/
 
 #define XDRV_48       48
+#define XDRV_48_FUNCS XFUNC_SECOND
 
 bool Xdrv48(byte function) {
   bool result = false;
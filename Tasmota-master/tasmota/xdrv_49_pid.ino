@@ -419,6 +419,7 @@ void PIDRun(void) {
 \*********************************************************************************************/
 
 #define XDRV_49       49
+#define XDRV_49_FUNCS XFUNC_SECOND
 
 bool Xdrv49(byte function) {
   bool result = false;
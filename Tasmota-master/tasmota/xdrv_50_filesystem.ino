@@ -40,6 +40,7 @@ ufsfree   free size in kB
 \*********************************************************************************************/
 
 #define XDRV_50           50
+#define XDRV_50_FUNCS     XFUNC_LOOP
 
 #ifndef SDCARD_CS_PIN
 #define SDCARD_CS_PIN     4
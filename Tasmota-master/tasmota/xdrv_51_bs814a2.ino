@@ -61,6 +61,7 @@
 \*********************************************************************************************/
 
 #define XDRV_51                   51
+#define XDRV_51_FUNCS             XFUNC_50MS
 
 #define BS814_KEYS_MAX            4         // no. of keys supported
 
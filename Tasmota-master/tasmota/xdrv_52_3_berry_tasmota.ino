@@ -579,6 +579,299 @@ extern "C" {
   }
 }
 
+/*********************************************************************************************\
+ * Native rule matching
+ *
+ * tasmota._rule_compile(pattern:string) -> bytes
+ * tasmota._rules_match(ev_json:string, tele:bool) -> list or nil
+ *
+ * `add_rule()` compiles the pattern once, `Sensor#Temperature>20` is stored as
+ * `[op:1] "Sensor#Temperature" 00 "20" 00`
+ *
+ * `_rules_idx` maps the uppercase first key of each rule to the list of rule indices,
+ * it is rebuilt at the next event when set to nil by `add_rule()` or `remove_rule()`.
+ *
+ * Events are matched on the JSON tokens, only rules indexed under a key of the event
+ * (or `?`) are tried, and no Berry map is built unless a rule matches. When the result
+ * depends on the order of the keys in the Berry map, or `json.load()` rejects the event,
+ * the rules are matched on the decoded event like before.
+\*********************************************************************************************/
+enum BerryRuleOp { BR_OP_NONE = 0, BR_OP_STR_EQ, BR_OP_STR_NE, BR_OP_EQ, BR_OP_NE, BR_OP_GT, BR_OP_GE, BR_OP_LT, BR_OP_LE };
+enum BerryRuleWalk { BR_WALK_NONE = 0, BR_WALK_FOUND, BR_WALK_UNSURE };
+
+const uint32_t BERRY_RULE_KEY_MAX = 32;     // max length of keys in `_rules_idx`, longer keys are truncated
+
+// returns the position of the first operator char in `s`, or of the first non operator char if `inv`; -1 if none
+int32_t BrRuleFindChars(const char * s, bool inv) {
+  for (int32_t i = 0; s[i]; i++) {
+    if ((nullptr != strchr("=<>!", s[i])) != inv) { return i; }
+  }
+  return -1;
+}
+
+uint8_t BrRuleOp(const char * op, size_t len) {
+  static const char * const ops[] = { "==", "!==", "=", "!=", ">", ">=", "<", "<=" };
+  for (uint32_t i = 0; i < ARRAY_SIZE(ops); i++) {
+    if ((strlen(ops[i]) == len) && (0 == strncmp(ops[i], op, len))) { return BR_OP_STR_EQ + i; }
+  }
+  return BR_OP_NONE;    // unknown operators never prevented the rule from triggering
+}
+
+// copy the first key of `trigger` in uppercase, it is the key of the rule in `_rules_idx`
+void BrRuleIndexKey(char * key, const char * trigger, size_t len) {
+  size_t i = 0;
+  while ((i < len) && (i < BERRY_RULE_KEY_MAX) && (trigger[i]) && ('#' != trigger[i])) {
+    key[i] = toupper(trigger[i]);
+    i++;
+  }
+  key[i] = 0;
+}
+
+// compare a JSON value to the operand, the same way Berry compares `str()` or `real()` of the event value
+bool BrRuleTest(const JsonParserToken & val, uint8_t op, const char * operand) {
+  if (BR_OP_NONE == op) { return true; }
+  if ((BR_OP_STR_EQ == op) || (BR_OP_STR_NE == op)) {
+    char num[16];
+    const char * s = nullptr;
+    if (val.isFloat()) {
+      snprintf(num, sizeof(num), "%g", strtof(val.getStr(), nullptr));
+      s = num;
+    } else if (val.isNull()) {
+      s = "nil";
+    } else if (val.isSingleToken()) {
+      s = val.getStr();
+    }
+    bool equal = s && (0 == strcmp(s, operand));
+    return (BR_OP_STR_EQ == op) ? equal : !equal;
+  }
+  if (!val.isStr() && !val.isNum()) {     // `real()` is nil
+    return (BR_OP_NE == op);
+  }
+  float v = strtof(val.getStr(), nullptr);
+  float r = strtof(operand, nullptr);
+  switch (op) {
+    case BR_OP_EQ: return v == r;
+    case BR_OP_NE: return v != r;
+    case BR_OP_GT: return v > r;
+    case BR_OP_GE: return v >= r;
+    case BR_OP_LT: return v < r;
+    case BR_OP_LE: return v <= r;
+  }
+  return false;
+}
+
+// walk the keys of `trigger` in the JSON event, keys are case insensitive
+// `val` is the root of the event, and the value found when returning BR_WALK_FOUND
+// if `vm` is not null, the actual keys are pushed to the list on top of the stack
+//
+// The decoded event is a Berry map: the first of duplicate keys wins, and `find_key_i()` returns
+// the first key in the map order when several keys match (`?`, or keys differing by case).
+// The map order can't be known from the JSON, BR_WALK_UNSURE tells to match on the decoded event.
+uint8_t BrRuleWalk(bvm * vm, JsonParserToken & val, const char * trigger, bool tele) {
+  const char * key = trigger;
+  while (true) {
+    const char * end = strchr(key, '#');
+    size_t len = end ? end - key : strlen(key);
+    bool any = (1 == len) && ('?' == key[0]);
+    const char * found = nullptr;
+    if (tele) {                     // the event is wrapped as `{"Tele": event}`
+      if (any || ((4 == len) && (0 == strncasecmp(key, "Tele", 4)))) { found = "Tele"; }
+      tele = false;
+    } else if (val.isObject()) {
+      JsonParserToken next;
+      for (const auto k : val.getObject()) {
+        const char * name = k.getStr();
+        if (any || ((strlen(name) == len) && (0 == strncasecmp(name, key, len)))) {
+          if (nullptr == found) {
+            found = name;
+            next = k.getValue();
+          } else if (strcmp(found, name)) {
+            return BR_WALK_UNSURE;
+          }                         // duplicate keys, keep the first one
+        }
+      }
+      if (found) { val = next; }
+    }
+    if (nullptr == found) { return BR_WALK_NONE; }
+    if (vm) {
+      be_pushstring(vm, found);
+      be_data_push(vm, -2);
+      be_pop(vm, 1);
+    }
+    if (nullptr == end) { return BR_WALK_FOUND; }
+    key = end + 1;
+  }
+}
+
+// build the `_rules_idx` map from the list of rules, and push it
+void BrRulesIndex(bvm * vm, int32_t rules) {
+  be_newobject(vm, "map");          // stack: map, map.p
+  int32_t map = be_absindex(vm, -1);
+  int32_t count = be_data_size(vm, rules);
+  for (int32_t i = 0; i < count; i++) {
+    char key[BERRY_RULE_KEY_MAX + 1];
+    size_t len;
+    be_pushint(vm, i);
+    be_getindex(vm, rules);         // stack: i, kv
+    be_getmember(vm, -1, "c");      // stack: i, kv, c
+    const char * c = (const char *) be_tobytes(vm, -1, &len);
+    BrRuleIndexKey(key, c + 1, len - 1);
+    be_pop(vm, 3);
+
+    be_pushstring(vm, key);
+    if (!be_getindex(vm, map)) {    // stack: key, list or nil
+      be_pop(vm, 1);
+      be_newobject(vm, "list");
+      be_pop(vm, 1);                // stack: key, list
+      be_data_insert(vm, map);
+    }
+    be_getmember(vm, -1, ".p");     // stack: key, list, list.p
+    be_pushint(vm, i);
+    be_data_push(vm, -2);
+    be_pop(vm, 4);
+  }
+  be_pop(vm, 1);                    // stack: map
+}
+
+// flag the rules indexed under `key`
+void BrRulesSelect(bvm * vm, int32_t index, const char * key, uint8_t * selected, int32_t count) {
+  char key_up[BERRY_RULE_KEY_MAX + 1];
+  BrRuleIndexKey(key_up, key, strlen(key));
+  be_pushstring(vm, key_up);
+  if (be_getindex(vm, index)) {     // stack: key, list
+    be_getmember(vm, -1, ".p");     // stack: key, list, list.p
+    int32_t size = be_data_size(vm, -1);
+    for (int32_t i = 0; i < size; i++) {
+      be_pushint(vm, i);
+      be_getindex(vm, -2);
+      int32_t rule = be_toint(vm, -1);
+      if (rule < count) { selected[rule / 8] |= 1 << (rule % 8); }
+      be_pop(vm, 2);
+    }
+    be_pop(vm, 1);
+  }
+  be_pop(vm, 2);
+}
+
+extern "C" {
+  // Berry: `tasmota._rule_compile(pattern:string) -> bytes`
+  //
+  // split the pattern in trigger, operator and operand, like `find_op()`
+  int32_t l_rule_compile(struct bvm *vm);
+  int32_t l_rule_compile(struct bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top == 2 && be_isstring(vm, 2)) {
+      const char * pattern = be_tostring(vm, 2);
+      size_t len = strlen(pattern);
+      size_t trigger_len = len;
+      uint8_t op = BR_OP_NONE;
+      const char * operand = "";
+      int32_t op_pos = BrRuleFindChars(pattern, false);
+      if (op_pos >= 0) {
+        int32_t op_len = BrRuleFindChars(pattern + op_pos, true);
+        if (op_len >= 0) {      // an operator without operand is part of the trigger
+          op = BrRuleOp(pattern + op_pos, op_len);
+          operand = pattern + op_pos + op_len;
+          trigger_len = op_pos;
+        }
+      }
+      size_t operand_len = strlen(operand);
+      uint8_t * c = (uint8_t *) be_pushbytes(vm, nullptr, 1 + trigger_len + 1 + operand_len + 1);
+      c[0] = op;
+      memcpy(c + 1, pattern, trigger_len);
+      c[1 + trigger_len] = 0;
+      memcpy(c + 1 + trigger_len + 1, operand, operand_len);
+      c[1 + trigger_len + 1 + operand_len] = 0;
+      be_return(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+
+  // Berry: `tasmota._rules_match(ev_json:string, tele:bool) -> list or nil`
+  //
+  // returns `[f, trigger, key1, key2...]` for each rule matching the event, in the order of `_rules`
+  // or nil if the JSON could not be parsed or a rule depends on the order of the keys in the decoded
+  // event, and rules are matched on the decoded event
+  int32_t l_rules_match(struct bvm *vm);
+  int32_t l_rules_match(struct bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top >= 2 && be_isstring(vm, 2)) {
+      bool tele = (top >= 3) && be_tobool(vm, 3);
+      char * json = strdup(be_tostring(vm, 2));   // parsing is in-place
+      JsonParser parser(json);
+      if (!parser) {
+        free(json);
+        be_return_nil(vm);
+      }
+      JsonParserToken root = parser.getRoot();
+
+      be_getmember(vm, 1, "_rules");
+      be_getmember(vm, -1, ".p");
+      int32_t rules = be_absindex(vm, -1);
+      int32_t count = be_data_size(vm, rules);
+      be_getmember(vm, 1, "_rules_idx");
+      if (be_isnil(vm, -1)) {
+        be_pop(vm, 1);
+        BrRulesIndex(vm, rules);
+        be_setmember(vm, 1, "_rules_idx");
+      }
+      be_getmember(vm, -1, ".p");
+      int32_t index = be_absindex(vm, -1);
+
+      uint8_t * selected = (uint8_t *) calloc((count + 7) / 8, 1);
+      BrRulesSelect(vm, index, "?", selected, count);
+      if (tele) {
+        BrRulesSelect(vm, index, "Tele", selected, count);
+      } else if (root.isObject()) {
+        for (const auto key : root.getObject()) {
+          BrRulesSelect(vm, index, key.getStr(), selected, count);
+        }
+      }
+
+      be_newobject(vm, "list");     // stack: ret, ret.p
+      int32_t ret = be_absindex(vm, -1);
+      for (int32_t i = 0; i < count; i++) {
+        if (0 == (selected[i / 8] & (1 << (i % 8)))) { continue; }
+        size_t len;
+        be_pushint(vm, i);
+        be_getindex(vm, rules);       // stack: i, kv
+        be_getmember(vm, -1, "c");    // stack: i, kv, c
+        const char * c = (const char *) be_tobytes(vm, -1, &len);
+        const char * trigger = c + 1;
+        const char * operand = trigger + strlen(trigger) + 1;
+        JsonParserToken val = root;
+        uint8_t walk = BrRuleWalk(nullptr, val, trigger, tele);
+        if (BR_WALK_UNSURE == walk) {   // let Berry match all rules on the decoded event
+          free(selected);
+          free(json);
+          be_return_nil(vm);
+        }
+        if ((BR_WALK_FOUND == walk) && BrRuleTest(val, c[0], operand)) {
+          // walk again to record the actual keys
+          val = root;
+          be_newobject(vm, "list");   // stack: i, kv, c, m, m.p
+          be_getmember(vm, -4, "v");
+          be_data_push(vm, -2);
+          be_pop(vm, 1);
+          be_pushstring(vm, trigger);
+          be_data_push(vm, -2);
+          be_pop(vm, 1);
+          BrRuleWalk(vm, val, trigger, tele);
+          be_pop(vm, 1);
+          be_data_push(vm, ret);
+          be_pop(vm, 1);
+        }
+        be_pop(vm, 3);
+      }
+      free(selected);
+      free(json);
+      be_pop(vm, 1);                // stack: ret
+      be_return(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+}
+
 /*********************************************************************************************\
  * Logging functions
  *
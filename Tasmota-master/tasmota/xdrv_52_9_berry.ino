@@ -21,9 +21,11 @@
 #ifdef USE_BERRY
 
 #define XDRV_52             52
+#define XDRV_52_FUNCS       (XFUNC_LOOP | XFUNC_50MS | XFUNC_100MS | XFUNC_SECOND)
 
 #include <berry.h>
 #include "be_vm.h"
+#include "be_mem.h"
 #include "ZipReadFS.h"
 
 extern "C" {
@@ -241,6 +243,49 @@ int32_t callBerryEventDispatcher(const char *type, const char *cmd, int32_t idx,
   return ret;
 }
 
+// run Berry timers from the main loop as soon as the first one is due,
+// so that delays shorter than 50ms don't wait for the next `every_50ms` event
+void callBerryTimers(void) {
+  bvm *vm = berry.vm;
+
+  if (nullptr == vm) { return; }
+  checkBeTop();
+  be_getglobal(vm, PSTR("tasmota"));
+  if (!be_isnil(vm, -1)) {
+    bool due = false;
+    be_getmember(vm, -1, PSTR("_timers"));    // binary heap, the first timer is the next one due
+    if (be_isinstance(vm, -1)) {
+      be_getmember(vm, -1, PSTR(".p"));
+      if (be_data_size(vm, -1) > 0) {
+        be_pushint(vm, 0);
+        be_getindex(vm, -2);
+        be_getmember(vm, -1, PSTR("due"));
+        due = TimeReached(be_toint(vm, -1));
+        be_pop(vm, 3);
+      }
+      be_pop(vm, 1);
+    }
+    be_pop(vm, 1);
+    if (due) {
+      be_getmethod(vm, -1, PSTR("run_deferred"));
+      if (!be_isnil(vm, -1)) {
+        be_pushvalue(vm, -2); // add instance as first arg
+        BrTimeoutStart();
+        int32_t ret = be_pcall(vm, 1);
+        BrTimeoutReset();
+        if (ret != 0) {
+          BerryDumpErrorAndClear(vm, false);  // log in Tasmota console only
+          return;
+        }
+        be_pop(vm, 1);
+      }
+      be_pop(vm, 1);  // remove method
+    }
+  }
+  be_pop(vm, 1);  // remove instance object
+  checkBeTop();
+}
+
 /*********************************************************************************************\
  * VM Observability
 \*********************************************************************************************/
@@ -250,22 +295,38 @@ void BerryObservability(bvm *vm, int event...) {
   va_start(param, event);
   static int32_t vm_usage = 0;
   static uint32_t gc_time = 0;
+  static uint32_t gc_step_time = 0;     // start of the current GC step, in us
+  static uint32_t gc_step_max = 0;      // longest GC step, i.e. longest pause, in us
 
   switch (event)  {
     case BE_OBS_GC_START:
       {
         gc_time = millis();
+        gc_step_time = micros();
+        gc_step_max = 0;
         vm_usage = va_arg(param, int32_t);
       }
       break;
+    case BE_OBS_GC_STEP_START:
+      gc_step_time = micros();
+      break;
+    case BE_OBS_GC_STEP_END:
+      {
+        uint32_t gc_step = micros() - gc_step_time;
+        if (gc_step > gc_step_max) { gc_step_max = gc_step; }
+      }
+      break;
     case BE_OBS_GC_END:
       {
         int32_t vm_usage2 = va_arg(param, int32_t);
-        uint32_t gc_elapsed = millis() - gc_time;
+        uint32_t gc_step = micros() - gc_step_time;
+        if (gc_step > gc_step_max) { gc_step_max = gc_step; }
+        uint32_t gc_elapsed = millis() - gc_time;   // whole collection, including the Berry code run between the steps
         uint32_t vm_scanned = va_arg(param, uint32_t);
         uint32_t vm_freed = va_arg(param, uint32_t);
-        AddLog(LOG_LEVEL_DEBUG, D_LOG_BERRY "GC from %i to %i bytes, objects freed %i/%i (in %d ms)",
-                                vm_usage, vm_usage2, vm_freed, vm_scanned, gc_elapsed);
+        int32_t gc_steps = va_arg(param, int32_t);    // collection spread over steps of BE_GC_STEP_BUDGET objects
+        AddLog(LOG_LEVEL_DEBUG, D_LOG_BERRY "GC from %i to %i bytes, objects freed %i/%i (%i steps over %d ms, longest step %d us)",
+                                vm_usage, vm_usage2, vm_freed, vm_scanned, gc_steps, gc_elapsed, gc_step_max);
         // make new threshold tighter when we reach high memory usage
         if (!UsePSRAM() && vm->gc.threshold > 20*1024) {
           vm->gc.threshold = vm->gc.usage + 10*1024;    // increase by only 10 KB
@@ -302,8 +363,9 @@ void BrShowState(void);
 void BrShowState(void) {
   // trigger a gc first
   be_gc_collect(berry.vm);
-  ResponseAppend_P(PSTR(",\"Berry\":{\"HeapUsed\":%u,\"Objects\":%u}"),
-    berry.vm->gc.usage / 1024, berry.vm->counter_gc_kept);
+  // HeapPool is the memory of the chunks of the small blocks pool, HeapUsed only counts the blocks in use
+  ResponseAppend_P(PSTR(",\"Berry\":{\"HeapUsed\":%u,\"Objects\":%u,\"HeapPool\":%u}"),
+    berry.vm->gc.usage / 1024, berry.vm->counter_gc_kept, be_mempool_size(berry.vm) / 1024);
 }
 
 /*********************************************************************************************\
@@ -782,6 +844,7 @@ bool Xdrv52(uint8_t function)
         BrLoad("autoexec.be");   // run autoexec.be at first tick, so we know all modules are initialized
         berry.autoexec_done = true;
       }
+      callBerryTimers();
       break;
 
     // Berry wide commands and events
@@ -25,6 +25,7 @@
 #include "tasmota_lvgl_assets.h"    // force compilation of assets
 
 #define XDRV_54             54
+#define XDRV_54_FUNCS       (XFUNC_LOOP | XFUNC_50MS | XFUNC_100MS | XFUNC_SECOND)
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
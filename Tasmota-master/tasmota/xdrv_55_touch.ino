@@ -28,6 +28,7 @@
 #include <renderer.h>
 
 #define XDRV_55             55
+#define XDRV_55_FUNCS       XFUNC_100MS
 
 bool FT5206_found = false;
 bool XPT2046_found = false;
@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XDRV_56             56
+#define XDRV_56_FUNCS       XFUNC_SECOND
 #define XI2C_59             59  // See I2CDEVICES.md
 
 #include "BM8563.h"
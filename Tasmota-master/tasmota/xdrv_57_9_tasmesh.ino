@@ -37,6 +37,7 @@
 \*********************************************************************************************/
 
 #define XDRV_57             57
+#define XDRV_57_FUNCS       (XFUNC_LOOP | XFUNC_SECOND)
 
 /*********************************************************************************************\
  * Callbacks
@@ -48,6 +48,7 @@
 \*********************************************************************************************/
 
 #define XDRV_59            59
+#define XDRV_59_FUNCS      XFUNC_SECOND
 
 #define INFLUXDB_INITIAL   7             // Initial number of seconds after wifi connect keeping in mind sensor initialization
 
@@ -139,6 +139,7 @@ i.e. the Bluetooth of the ESP can be shared without conflict.
 //#define BLE_ESP32_DEBUG
 
 #define XDRV_79                    79
+#define XDRV_79_FUNCS              (XFUNC_50MS | XFUNC_250MS | XFUNC_SECOND)
 
 #include <vector>
 #include <deque>
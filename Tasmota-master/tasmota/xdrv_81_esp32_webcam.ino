@@ -77,6 +77,7 @@
 /*********************************************************************************************/
 
 #define XDRV_81           81
+#define XDRV_81_FUNCS     XFUNC_LOOP
 
 #include "esp_camera.h"
 #include "sensor.h"
@@ -39,6 +39,7 @@
 \*********************************************************************************************/
 
 #define XDRV_84          84
+#define XDRV_84_FUNCS    (XFUNC_LOOP | XFUNC_SECOND)
 
 #include <Esp.h>
 #include <sys/time.h>
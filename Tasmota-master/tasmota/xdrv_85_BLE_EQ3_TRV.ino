@@ -133,6 +133,7 @@ print("".join(pin))
 #ifdef USE_BLE_ESP32
 
 #define XDRV_85                    85
+#define XDRV_85_FUNCS              (XFUNC_50MS | XFUNC_SECOND)
 #define D_CMND_EQ3 "trv"
 
 // uncomment for more debug messages
@@ -104,6 +104,7 @@
 \*********************************************************************************************/
 
 #define XDRV_86                      86
+#define XDRV_86_FUNCS                (XFUNC_LOOP | XFUNC_100MS)
 
 #define SSPM_MAX_MODULES             7       // Currently supports up to 7 SPM-4RELAY units for a total of 28 relays restricted by power_t size
 #define SSPM_SERIAL_BUFFER_SIZE      512     // Needs to accomodate Energy total history for six months (408 bytes)
@@ -31,6 +31,7 @@
 #warning **** USE_DRV_FILE_DEMO is enabled ****
 
 #define XDRV_98             98
+#define XDRV_98_FUNCS       0
 
 #define DRV98_MAX_DRV_TEXT  16
 
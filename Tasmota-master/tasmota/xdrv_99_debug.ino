@@ -33,6 +33,7 @@
 \*********************************************************************************************/
 
 #define XDRV_99             99
+#define XDRV_99_FUNCS       XFUNC_LOOP
 
 #ifndef CPU_LOAD_CHECK
 #define CPU_LOAD_CHECK      1                 // Seconds between each CPU_LOAD log
@@ -1061,8 +1061,1053 @@ const uint8_t kXdrvList[] = {
 #endif
 };
 
+/*********************************************************************************************\
+ * Xdrv periodic functions
+\*********************************************************************************************/
+
+#ifdef XFUNC_PTR_IN_ROM
+const uint8_t kXdrvFuncs[] PROGMEM = {
+#else
+const uint8_t kXdrvFuncs[] = {
+#endif
+
+#ifdef XDRV_01
+#ifdef XDRV_01_FUNCS
+  XDRV_01_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_02
+#ifdef XDRV_02_FUNCS
+  XDRV_02_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_03
+#ifdef XDRV_03_FUNCS
+  XDRV_03_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_04
+#ifdef XDRV_04_FUNCS
+  XDRV_04_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_05
+#ifdef XDRV_05_FUNCS
+  XDRV_05_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_06
+#ifdef XDRV_06_FUNCS
+  XDRV_06_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_07
+#ifdef XDRV_07_FUNCS
+  XDRV_07_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_08
+#ifdef XDRV_08_FUNCS
+  XDRV_08_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_09
+#ifdef XDRV_09_FUNCS
+  XDRV_09_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_10
+#ifdef XDRV_10_FUNCS
+  XDRV_10_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_11
+#ifdef XDRV_11_FUNCS
+  XDRV_11_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_12
+#ifdef XDRV_12_FUNCS
+  XDRV_12_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_13
+#ifdef XDRV_13_FUNCS
+  XDRV_13_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_14
+#ifdef XDRV_14_FUNCS
+  XDRV_14_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_15
+#ifdef XDRV_15_FUNCS
+  XDRV_15_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_16
+#ifdef XDRV_16_FUNCS
+  XDRV_16_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_17
+#ifdef XDRV_17_FUNCS
+  XDRV_17_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_18
+#ifdef XDRV_18_FUNCS
+  XDRV_18_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_19
+#ifdef XDRV_19_FUNCS
+  XDRV_19_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_20
+#ifdef XDRV_20_FUNCS
+  XDRV_20_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_21
+#ifdef XDRV_21_FUNCS
+  XDRV_21_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_22
+#ifdef XDRV_22_FUNCS
+  XDRV_22_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_23
+#ifdef XDRV_23_FUNCS
+  XDRV_23_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_24
+#ifdef XDRV_24_FUNCS
+  XDRV_24_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_25
+#ifdef XDRV_25_FUNCS
+  XDRV_25_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_26
+#ifdef XDRV_26_FUNCS
+  XDRV_26_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_27
+#ifdef XDRV_27_FUNCS
+  XDRV_27_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_28
+#ifdef XDRV_28_FUNCS
+  XDRV_28_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_29
+#ifdef XDRV_29_FUNCS
+  XDRV_29_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_30
+#ifdef XDRV_30_FUNCS
+  XDRV_30_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_31
+#ifdef XDRV_31_FUNCS
+  XDRV_31_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_32
+#ifdef XDRV_32_FUNCS
+  XDRV_32_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_33
+#ifdef XDRV_33_FUNCS
+  XDRV_33_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_34
+#ifdef XDRV_34_FUNCS
+  XDRV_34_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_35
+#ifdef XDRV_35_FUNCS
+  XDRV_35_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_36
+#ifdef XDRV_36_FUNCS
+  XDRV_36_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_37
+#ifdef XDRV_37_FUNCS
+  XDRV_37_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_38
+#ifdef XDRV_38_FUNCS
+  XDRV_38_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_39
+#ifdef XDRV_39_FUNCS
+  XDRV_39_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_40
+#ifdef XDRV_40_FUNCS
+  XDRV_40_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_41
+#ifdef XDRV_41_FUNCS
+  XDRV_41_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_42
+#ifdef XDRV_42_FUNCS
+  XDRV_42_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_43
+#ifdef XDRV_43_FUNCS
+  XDRV_43_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_44
+#ifdef XDRV_44_FUNCS
+  XDRV_44_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_45
+#ifdef XDRV_45_FUNCS
+  XDRV_45_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_46
+#ifdef XDRV_46_FUNCS
+  XDRV_46_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_47
+#ifdef XDRV_47_FUNCS
+  XDRV_47_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_48
+#ifdef XDRV_48_FUNCS
+  XDRV_48_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_49
+#ifdef XDRV_49_FUNCS
+  XDRV_49_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_50
+#ifdef XDRV_50_FUNCS
+  XDRV_50_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_51
+#ifdef XDRV_51_FUNCS
+  XDRV_51_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_52
+#ifdef XDRV_52_FUNCS
+  XDRV_52_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_53
+#ifdef XDRV_53_FUNCS
+  XDRV_53_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_54
+#ifdef XDRV_54_FUNCS
+  XDRV_54_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_55
+#ifdef XDRV_55_FUNCS
+  XDRV_55_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_56
+#ifdef XDRV_56_FUNCS
+  XDRV_56_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_57
+#ifdef XDRV_57_FUNCS
+  XDRV_57_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_58
+#ifdef XDRV_58_FUNCS
+  XDRV_58_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_59
+#ifdef XDRV_59_FUNCS
+  XDRV_59_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_60
+#ifdef XDRV_60_FUNCS
+  XDRV_60_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_61
+#ifdef XDRV_61_FUNCS
+  XDRV_61_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_62
+#ifdef XDRV_62_FUNCS
+  XDRV_62_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_63
+#ifdef XDRV_63_FUNCS
+  XDRV_63_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_64
+#ifdef XDRV_64_FUNCS
+  XDRV_64_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_65
+#ifdef XDRV_65_FUNCS
+  XDRV_65_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_66
+#ifdef XDRV_66_FUNCS
+  XDRV_66_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_67
+#ifdef XDRV_67_FUNCS
+  XDRV_67_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_68
+#ifdef XDRV_68_FUNCS
+  XDRV_68_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_69
+#ifdef XDRV_69_FUNCS
+  XDRV_69_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_70
+#ifdef XDRV_70_FUNCS
+  XDRV_70_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_71
+#ifdef XDRV_71_FUNCS
+  XDRV_71_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_72
+#ifdef XDRV_72_FUNCS
+  XDRV_72_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_73
+#ifdef XDRV_73_FUNCS
+  XDRV_73_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_74
+#ifdef XDRV_74_FUNCS
+  XDRV_74_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_75
+#ifdef XDRV_75_FUNCS
+  XDRV_75_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_76
+#ifdef XDRV_76_FUNCS
+  XDRV_76_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_77
+#ifdef XDRV_77_FUNCS
+  XDRV_77_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_78
+#ifdef XDRV_78_FUNCS
+  XDRV_78_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_79
+#ifdef XDRV_79_FUNCS
+  XDRV_79_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_80
+#ifdef XDRV_80_FUNCS
+  XDRV_80_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_81
+#ifdef XDRV_81_FUNCS
+  XDRV_81_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_82
+#ifdef XDRV_82_FUNCS
+  XDRV_82_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_83
+#ifdef XDRV_83_FUNCS
+  XDRV_83_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_84
+#ifdef XDRV_84_FUNCS
+  XDRV_84_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_85
+#ifdef XDRV_85_FUNCS
+  XDRV_85_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_86
+#ifdef XDRV_86_FUNCS
+  XDRV_86_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_87
+#ifdef XDRV_87_FUNCS
+  XDRV_87_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_88
+#ifdef XDRV_88_FUNCS
+  XDRV_88_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_89
+#ifdef XDRV_89_FUNCS
+  XDRV_89_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_90
+#ifdef XDRV_90_FUNCS
+  XDRV_90_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_91
+#ifdef XDRV_91_FUNCS
+  XDRV_91_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_92
+#ifdef XDRV_92_FUNCS
+  XDRV_92_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_93
+#ifdef XDRV_93_FUNCS
+  XDRV_93_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_94
+#ifdef XDRV_94_FUNCS
+  XDRV_94_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_95
+#ifdef XDRV_95_FUNCS
+  XDRV_95_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_96
+#ifdef XDRV_96_FUNCS
+  XDRV_96_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_97
+#ifdef XDRV_97_FUNCS
+  XDRV_97_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_98
+#ifdef XDRV_98_FUNCS
+  XDRV_98_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_99
+#ifdef XDRV_99_FUNCS
+  XDRV_99_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_100
+#ifdef XDRV_100_FUNCS
+  XDRV_100_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_101
+#ifdef XDRV_101_FUNCS
+  XDRV_101_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_102
+#ifdef XDRV_102_FUNCS
+  XDRV_102_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_103
+#ifdef XDRV_103_FUNCS
+  XDRV_103_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_104
+#ifdef XDRV_104_FUNCS
+  XDRV_104_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_105
+#ifdef XDRV_105_FUNCS
+  XDRV_105_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_106
+#ifdef XDRV_106_FUNCS
+  XDRV_106_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_107
+#ifdef XDRV_107_FUNCS
+  XDRV_107_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_108
+#ifdef XDRV_108_FUNCS
+  XDRV_108_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_109
+#ifdef XDRV_109_FUNCS
+  XDRV_109_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_110
+#ifdef XDRV_110_FUNCS
+  XDRV_110_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_111
+#ifdef XDRV_111_FUNCS
+  XDRV_111_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_112
+#ifdef XDRV_112_FUNCS
+  XDRV_112_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_113
+#ifdef XDRV_113_FUNCS
+  XDRV_113_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_114
+#ifdef XDRV_114_FUNCS
+  XDRV_114_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_115
+#ifdef XDRV_115_FUNCS
+  XDRV_115_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_116
+#ifdef XDRV_116_FUNCS
+  XDRV_116_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_117
+#ifdef XDRV_117_FUNCS
+  XDRV_117_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_118
+#ifdef XDRV_118_FUNCS
+  XDRV_118_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_119
+#ifdef XDRV_119_FUNCS
+  XDRV_119_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_120
+#ifdef XDRV_120_FUNCS
+  XDRV_120_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_121
+#ifdef XDRV_121_FUNCS
+  XDRV_121_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_122
+#ifdef XDRV_122_FUNCS
+  XDRV_122_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_123
+#ifdef XDRV_123_FUNCS
+  XDRV_123_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_124
+#ifdef XDRV_124_FUNCS
+  XDRV_124_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_125
+#ifdef XDRV_125_FUNCS
+  XDRV_125_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_126
+#ifdef XDRV_126_FUNCS
+  XDRV_126_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_127
+#ifdef XDRV_127_FUNCS
+  XDRV_127_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_128
+#ifdef XDRV_128_FUNCS
+  XDRV_128_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+};
+
+static_assert(sizeof(kXdrvFuncs) == xdrv_present, "kXdrvFuncs does not match the driver list");
+
 /*********************************************************************************************/
 
+uint32_t XdrvDriverId(uint32_t position) {
+#ifdef XFUNC_PTR_IN_ROM
+  return pgm_read_byte(kXdrvList + position);
+#else
+  return kXdrvList[position];
+#endif
+}
+
 void XsnsDriverState(void)
 {
   ResponseAppend_P(PSTR(",\"Drivers\":\""));  // Use string for future enable/disable signal
@@ -1131,6 +2176,26 @@ bool XdrvCallDriver(uint32_t driver, uint8_t Function)
  * Function call to all xdrv
 \*********************************************************************************************/
 
+uint8_t xdrv_periodic_count[XFUNC_PERIODIC] = { 0 };     // Number of drivers handling each periodic function
+uint8_t xdrv_periodic[XFUNC_PERIODIC][xdrv_present];     // Drivers handling each periodic function
+bool xdrv_periodic_init = false;
+
+void XdrvPeriodicInit(void) {
+  for (uint32_t x = 0; x < xdrv_present; x++) {
+#ifdef XFUNC_PTR_IN_ROM
+    uint32_t funcs = pgm_read_byte(kXdrvFuncs + x);
+#else
+    uint32_t funcs = kXdrvFuncs[x];
+#endif
+    for (uint32_t i = 0; i < XFUNC_PERIODIC; i++) {
+      if (funcs & (1 << i)) {
+        xdrv_periodic[i][xdrv_periodic_count[i]++] = x;
+      }
+    }
+  }
+  xdrv_periodic_init = true;
+}
+
 bool XdrvCall(uint8_t Function)
 {
   bool result = false;
@@ -1139,12 +2204,24 @@ bool XdrvCall(uint8_t Function)
 
   uint32_t profile_driver_start = millis();
 
-  for (uint32_t x = 0; x < xdrv_present; x++) {
+  uint32_t count = xdrv_present;
+  uint8_t *periodic = nullptr;             // Call all drivers
+  if ((Function >= FUNC_LOOP) && (Function <= FUNC_EVERY_SECOND)) {
+    if (!xdrv_periodic_init) { XdrvPeriodicInit(); }
+    periodic = xdrv_periodic[Function - FUNC_LOOP];
+    count = xdrv_periodic_count[Function - FUNC_LOOP];
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t x = (periodic) ? periodic[i] : i;
 
     uint32_t profile_function_start = millis();
+    PROFILE_STATS_START(profile_stats_start);
 
     result = xdrv_func_ptr[x](Function);
 
+    PROFILE_STATS(PRF_DRV, x, Function, profile_stats_start);
+
 #ifdef USE_PROFILE_FUNCTION
 #ifdef XFUNC_PTR_IN_ROM
       uint32_t index = pgm_read_byte(kXdrvList + x);
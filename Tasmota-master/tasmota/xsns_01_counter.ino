@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XSNS_01             1
+#define XSNS_01_FUNCS       (XFUNC_LOOP | XFUNC_SECOND)
 
 #define D_PRFX_COUNTER "Counter"
 #define D_CMND_COUNTERTYPE "Type"
@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XSNS_05              5
+#define XSNS_05_FUNCS        XFUNC_SECOND
 
 //#define USE_DS18x20_RECONFIGURE    // When sensor is lost keep retrying or re-configure
 //#define DS18x20_USE_ID_AS_NAME      // Use last 3 bytes for naming of sensors
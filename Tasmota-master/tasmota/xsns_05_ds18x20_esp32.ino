@@ -25,6 +25,7 @@
 \*********************************************************************************************/
 
 #define XSNS_05              5
+#define XSNS_05_FUNCS        XFUNC_SECOND
 
 //#define DS18x20_USE_ID_AS_NAME      // Use last 3 bytes for naming of sensors
 
@@ -31,6 +31,7 @@
 \*********************************************************************************************/
 
 #define XSNS_06          6
+#define XSNS_06_FUNCS    XFUNC_SECOND
 
 #define DHT_MAX_SENSORS  4
 #define DHT_MAX_RETRY    8
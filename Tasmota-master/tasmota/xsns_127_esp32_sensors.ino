@@ -31,6 +31,7 @@
 \*********************************************************************************************/
 
 #define XSNS_127                 127
+#define XSNS_127_FUNCS           0
 
 #if CONFIG_IDF_TARGET_ESP32
 
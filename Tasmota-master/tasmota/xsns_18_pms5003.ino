@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_18             18
+#define XSNS_18_FUNCS       XFUNC_SECOND
 
 #include <TasmotaSerial.h>
 
@@ -27,6 +27,7 @@
 \*********************************************************************************************/
 
 #define XSNS_19            19
+#define XSNS_19_FUNCS      0
 #define XI2C_17            17  // See I2CDEVICES.md
 
 #ifndef MGS_SENSOR_ADDR
@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XSNS_20             20
+#define XSNS_20_FUNCS       XFUNC_SECOND
 
 #include <TasmotaSerial.h>
 
@@ -30,6 +30,7 @@
 \*********************************************************************************************/
 
 #define XSNS_22                   22
+#define XSNS_22_FUNCS             XFUNC_SECOND
 
 #ifndef SR04_MAX_SENSOR_DISTANCE
 #define SR04_MAX_SENSOR_DISTANCE  500
@@ -25,6 +25,7 @@
 \*********************************************************************************************/
 
 #define XSNS_28             28
+#define XSNS_28_FUNCS       XFUNC_50MS
 
 #define TM1638_COLOR_NONE   0
 #define TM1638_COLOR_RED    1
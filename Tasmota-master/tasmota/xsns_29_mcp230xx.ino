@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_29                   29
+#define XSNS_29_FUNCS             (XFUNC_50MS | XFUNC_SECOND)
 #define XI2C_22                   22  // See I2CDEVICES.md
 
 /*
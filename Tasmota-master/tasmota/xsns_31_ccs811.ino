@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XSNS_31             31
+#define XSNS_31_FUNCS       XFUNC_SECOND
 #define XI2C_24             24  // See I2CDEVICES.md
 
 #define EVERYNSECONDS 5
@@ -33,6 +33,7 @@
   \*********************************************************************************************/
 
 #define XSNS_33             33
+#define XSNS_33_FUNCS       XFUNC_SECOND
 #define XI2C_26             26  // See I2CDEVICES.md
 
 //DS3232 I2C Address
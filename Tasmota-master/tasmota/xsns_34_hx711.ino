@@ -33,6 +33,7 @@
 \*********************************************************************************************/
 
 #define XSNS_34              34
+#define XSNS_34_FUNCS        XFUNC_100MS
 
 #ifndef HX_MAX_WEIGHT
 #define HX_MAX_WEIGHT        20000   // Default max weight in gram
@@ -33,6 +33,7 @@
 \*********************************************************************************************/
 
 #define XSNS_36                 36
+#define XSNS_36_FUNCS           XFUNC_50MS
 #define XI2C_27                 27  // See I2CDEVICES.md
 
 #warning **** MGC3130: It is recommended to disable all unneeded I2C-drivers ****
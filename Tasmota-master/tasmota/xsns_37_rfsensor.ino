@@ -31,6 +31,7 @@
 \*********************************************************************************************/
 
 #define XSNS_37                   37
+#define XSNS_37_FUNCS             (XFUNC_LOOP | XFUNC_SECOND)
 
 //#define USE_THEO_V2                      // Add support for 434MHz Theo V2 sensors as documented on https://sidweb.nl
 //#define USE_ALECTO_V2                    // Add support for 868MHz Alecto V2 sensors like ACH2010, WS3000 and DKW2012
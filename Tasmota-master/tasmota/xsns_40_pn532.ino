@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XSNS_40                                     40
+#define XSNS_40_FUNCS                               XFUNC_250MS
 
 #include <TasmotaSerial.h>
 
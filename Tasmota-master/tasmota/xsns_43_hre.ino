@@ -47,6 +47,7 @@
 \*********************************************************************************************/
 
 #define XSNS_43             43
+#define XSNS_43_FUNCS       (XFUNC_50MS | XFUNC_SECOND)
 
 enum hre_states {
    hre_idle,    // Initial state,
@@ -21,6 +21,7 @@
 #ifdef USE_SPS30
 
 #define XSNS_44 44
+#define XSNS_44_FUNCS XFUNC_SECOND
 #define XI2C_30 30  // See I2CDEVICES.md
 
 #define SPS30_ADDR 0x69
@@ -45,6 +45,7 @@
 \*********************************************************************************************/
 
 #define XSNS_45            45
+#define XSNS_45_FUNCS      (XFUNC_250MS | XFUNC_SECOND)
 #define XI2C_31            31  // See I2CDEVICES.md
 
 // Uncomment this line to use long range mode. This
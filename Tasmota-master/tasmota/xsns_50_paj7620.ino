@@ -37,6 +37,7 @@
 \*********************************************************************************************/
 
 #define XSNS_50                     50
+#define XSNS_50_FUNCS               XFUNC_100MS
 #define XI2C_34                     34              // See I2CDEVICES.md
 
 #define PAJ7620_ADDR                0x73            // standard address
@@ -56,6 +56,7 @@
 #ifdef USE_BLE_ESP32
 
 #define XSNS_52                       52
+#define XSNS_52_FUNCS                 (XFUNC_LOOP | XFUNC_250MS | XFUNC_SECOND)
 
 // keyfob expires after N seconds
 #define IB_TIMEOUT_INTERVAL 30
@@ -24,6 +24,7 @@
 #ifdef USE_SML_M
 
 #define XSNS_53 53
+#define XSNS_53_FUNCS (XFUNC_LOOP | XFUNC_50MS | XFUNC_100MS)
 
 // default baudrate of D0 output
 #define SML_BAUDRATE 9600
@@ -1285,17 +1286,287 @@ void sml_empty_receiver(uint32_t meters) {
 }
 
 
+/*********************************************************************************************\
+ * Compiled matcher for 's' (SML) meters
+ *
+ * SML_Decode() walks the whole descriptor and compares every OBIS pattern at the start of
+ * smltbuf, which was done for every received byte. At SML_Init() the patterns of each 's' meter
+ * are compiled into an Aho-Corasick automaton, so a byte costs one automaton step. A section is
+ * decoded when its pattern has shifted to the start of smltbuf, as SML_Decode() would find it.
+\*********************************************************************************************/
+
+struct SML_AC_STATE {
+  uint8_t label;        // byte leading to this state
+  uint8_t out;          // first section whose pattern ends here + 1, 0 if none
+  uint16_t child;       // first child state, 0 if none
+  uint16_t sibling;     // next sibling state, 0 if none
+  uint16_t fail;        // failure link
+  uint16_t dict;        // next state on the failure chain with an output, 0 if none
+};
+
+struct SML_SECTION {
+  const char *mp;       // start of the section in the descriptor
+  uint8_t vindex;       // meter_vars index of the section
+  uint8_t dindex;       // delta index, for =d sections
+  uint8_t len;          // pattern length in bytes, 0 for calculated sections
+  uint8_t same;         // next section with the same pattern + 1, 0 if none
+  uint8_t next_calc;    // next calculated section + 1, 0 if none
+};
+
+struct SML_PENDING {
+  uint16_t countdown;   // bytes to receive before the pattern is at the start of smltbuf
+  uint8_t section;
+};
+
+struct SML_MATCHER {
+  struct SML_AC_STATE *states;
+  struct SML_SECTION *sections;
+  struct SML_PENDING *pending;  // patterns found but not yet shifted to the start of smltbuf, nsections entries
+  uint8_t *due;         // sections to decode for the current byte, 2 * nsections entries
+  uint32_t overflow;    // patterns dropped because a section was found again while still pending
+  uint16_t nstates;
+  uint8_t nsections;
+  uint8_t first_calc;   // first calculated section + 1, 0 if none
+  uint8_t npending;
+  uint16_t state;       // current automaton state
+};
+
+struct SML_MATCHER *sml_matcher[MAX_METERS];
+
+uint16_t sml_ac_child(const struct SML_AC_STATE *states, uint16_t state, uint8_t label) {
+  for (uint16_t child = states[state].child; child; child = states[child].sibling) {
+    if (states[child].label == label) return child;
+  }
+  return 0;
+}
+
+void sml_free_matcher(uint32_t meter) {
+  struct SML_MATCHER *mt = sml_matcher[meter];
+  if (!mt) return;
+  if (mt->states) free(mt->states);
+  if (mt->sections) free(mt->sections);
+  if (mt->pending) free(mt->pending);
+  if (mt->due) free(mt->due);
+  free(mt);
+  sml_matcher[meter] = 0;
+}
+
+// walk the descriptor like SML_Decode() does, and collect the sections of meter
+// returns the number of sections, or -1 if a pattern can't be compiled
+// if sections is not null, they are filled in
+int32_t sml_scan_sections(uint32_t meter, struct SML_SECTION *sections, uint32_t *pattern_bytes) {
+  const char *mp = (const char*)meter_p;
+  uint8_t vindex = 0, dcount = 0;
+  int32_t nsections = 0;
+  *pattern_bytes = 0;
+
+  while (mp && *mp) {
+    const char *sect = mp;
+    int8_t mindex = ((*mp) & 7) - 1;
+    if (mindex < 0 || mindex >= meters_used) mindex = 0;
+    mp += 2;
+    if (*mp == '=' && *(mp + 1) == 'h') {
+      // html line, no variable
+      mp = strchr(mp, '|');
+      if (mp) mp++;
+      continue;
+    }
+    uint8_t dindex = dcount;
+    if (*mp == '=' && *(mp + 1) == 'd') dcount++;
+
+    if (mindex == meter) {
+      uint32_t len = 0;
+      if (*mp == '=') {
+        if (*(mp + 1) != 'm' && *(mp + 1) != 'd') goto nextsect;
+      } else {
+        const char *eop = mp;
+        while (*eop && *eop != '@' && *eop != '|') eop++;
+        if (*eop != '@' || ((eop - mp) & 1)) return -1;
+        len = (eop - mp) / 2;
+        if (len > SML_BSIZ || len > 255) goto nextsect;
+        *pattern_bytes += len;
+      }
+      if (nsections >= 255) return -1;
+      if (sections) {
+        sections[nsections].mp = sect;
+        sections[nsections].vindex = vindex;
+        sections[nsections].dindex = dindex;
+        sections[nsections].len = len;
+        sections[nsections].same = 0;
+        sections[nsections].next_calc = 0;
+      }
+      nsections++;
+    }
+nextsect:
+    if (vindex < SML_MAX_VARS - 1) vindex++;
+    mp = strchr(mp, '|');
+    if (mp) mp++;
+  }
+  return nsections;
+}
+
+// compile the patterns of all 's' meters, a meter without matcher uses SML_Decode()
+void SML_CompileMatchers(void) {
+  for (uint32_t meter = 0; meter < MAX_METERS; meter++) {
+    sml_free_matcher(meter);
+    if (meter >= meters_used || meter_desc_p[meter].type != 's') continue;
+
+    uint32_t pattern_bytes;
+    int32_t nsections = sml_scan_sections(meter, 0, &pattern_bytes);
+    if (nsections <= 0 || pattern_bytes >= 0xffff) continue;
+
+    struct SML_MATCHER *mt = (struct SML_MATCHER*)calloc(1, sizeof(struct SML_MATCHER));
+    if (!mt) continue;
+    sml_matcher[meter] = mt;
+    mt->sections = (struct SML_SECTION*)calloc(nsections, sizeof(struct SML_SECTION));
+    mt->states = (struct SML_AC_STATE*)calloc(pattern_bytes + 1, sizeof(struct SML_AC_STATE));
+    // each section is pending at most once, unless its pattern occurs twice within SML_BSIZ bytes
+    mt->pending = (struct SML_PENDING*)calloc(nsections, sizeof(struct SML_PENDING));
+    mt->due = (uint8_t*)malloc(2 * nsections);
+    uint16_t *queue = (uint16_t*)malloc((pattern_bytes + 1) * sizeof(uint16_t));
+    if (!mt->sections || !mt->states || !mt->pending || !mt->due || !queue) {
+      if (queue) free(queue);
+      sml_free_matcher(meter);
+      continue;
+    }
+    mt->nsections = sml_scan_sections(meter, mt->sections, &pattern_bytes);
+    mt->nstates = 1;
+
+    // link the calculated sections
+    for (int32_t sec = mt->nsections - 1; sec >= 0; sec--) {
+      if (mt->sections[sec].len) continue;
+      mt->sections[sec].next_calc = mt->first_calc;
+      mt->first_calc = sec + 1;
+    }
+
+    // build the trie of patterns
+    struct SML_AC_STATE *states = mt->states;
+    for (uint32_t sec = 0; sec < mt->nsections; sec++) {
+      const char *mp = mt->sections[sec].mp + 2;
+      uint16_t state = 0;
+      for (uint32_t cnt = 0; cnt < mt->sections[sec].len; cnt++) {
+        uint8_t val = hexnibble(*mp++) << 4;
+        val |= hexnibble(*mp++);
+        uint16_t next = sml_ac_child(states, state, val);
+        if (!next) {
+          next = mt->nstates++;
+          states[next].label = val;
+          states[next].sibling = states[state].child;
+          states[state].child = next;
+        }
+        state = next;
+      }
+      if (!mt->sections[sec].len) continue;
+      if (!states[state].out) {
+        states[state].out = sec + 1;
+      } else {
+        // same pattern in several sections, chain them
+        uint32_t last = states[state].out - 1;
+        while (mt->sections[last].same) last = mt->sections[last].same - 1;
+        mt->sections[last].same = sec + 1;
+      }
+    }
+
+    // failure and dictionary links, breadth first
+    uint32_t head = 0, tail = 0;
+    for (uint16_t child = states[0].child; child; child = states[child].sibling) {
+      queue[tail++] = child;
+    }
+    while (head < tail) {
+      uint16_t state = queue[head++];
+      for (uint16_t child = states[state].child; child; child = states[child].sibling) {
+        uint16_t fail = states[state].fail;
+        uint16_t next;
+        while (!(next = sml_ac_child(states, fail, states[child].label)) && fail) {
+          fail = states[fail].fail;
+        }
+        states[child].fail = next;
+        states[child].dict = states[next].out ? next : states[next].dict;
+        queue[tail++] = child;
+      }
+    }
+    free(queue);
+    AddLog(LOG_LEVEL_DEBUG, PSTR("SML: meter %d, %d sections compiled in %d states"), meter + 1, mt->nsections, mt->nstates);
+  }
+}
+
+void SML_DecodeSection(uint32_t meter, const struct SML_SECTION *section) {
+  SML_DecodeSections(meter, section->mp, section->vindex, section->dindex, true);
+}
+
+// process the byte just shifted in smltbuf of a compiled meter
+void SML_MatchByte(uint32_t meter, uint8_t iob) {
+  struct SML_MATCHER *mt = sml_matcher[meter];
+  uint8_t *due = mt->due;     // at most the pending sections, and each section once for this byte
+  uint32_t ndue = 0;
+
+  // sections whose pattern has now reached the start of smltbuf
+  for (uint32_t cnt = 0; cnt < mt->npending; ) {
+    if (--mt->pending[cnt].countdown) {
+      cnt++;
+      continue;
+    }
+    due[ndue++] = mt->pending[cnt].section;
+    mt->pending[cnt] = mt->pending[--mt->npending];
+  }
+
+  // automaton step
+  const struct SML_AC_STATE *states = mt->states;
+  uint16_t state = mt->state;
+  uint16_t next;
+  while (!(next = sml_ac_child(states, state, iob)) && state) {
+    state = states[state].fail;
+  }
+  mt->state = next;
+
+  for (uint16_t out = states[next].out ? next : states[next].dict; out; out = states[out].dict) {
+    for (uint32_t sec = states[out].out; sec; sec = mt->sections[sec - 1].same) {
+      uint16_t countdown = SML_BSIZ - mt->sections[sec - 1].len;
+      if (!countdown) {
+        due[ndue++] = sec - 1;
+      } else if (mt->npending < mt->nsections) {
+        mt->pending[mt->npending].countdown = countdown;
+        mt->pending[mt->npending].section = sec - 1;
+        mt->npending++;
+      } else {
+        mt->overflow++;
+        if (!(mt->overflow & (mt->overflow - 1))) {   // 1, 2, 4, 8... don't flood the log on every byte
+          AddLog(LOG_LEVEL_DEBUG, PSTR("SML: meter %d, section %d found again while pending, %d values dropped"), meter + 1, sec, mt->overflow);
+        }
+      }
+    }
+  }
+
+  // decode in descriptor order, with the calculated sections which are evaluated on every byte as before
+  for (uint32_t i = 1; i < ndue; i++) {
+    uint8_t sec = due[i];
+    uint32_t j = i;
+    for (; j > 0 && due[j - 1] > sec; j--) due[j] = due[j - 1];
+    due[j] = sec;
+  }
+  uint32_t cnt = 0;
+  uint32_t calc = mt->first_calc;
+  while (cnt < ndue || calc) {
+    uint32_t sec;
+    if (calc && (cnt >= ndue || calc - 1 < due[cnt])) {
+      sec = calc - 1;
+      calc = mt->sections[sec].next_calc;
+    } else {
+      sec = due[cnt++];
+      if (cnt < ndue && due[cnt] == sec) continue;    // same section found twice
+    }
+    SML_DecodeSection(meter, &mt->sections[sec]);
+  }
+}
+
 void sml_shift_in(uint32_t meters,uint32_t shard) {
-  uint32_t count;
 #ifndef SML_OBIS_LINE
   if (meter_desc_p[meters].type!='e' && meter_desc_p[meters].type!='m' && meter_desc_p[meters].type!='M' && meter_desc_p[meters].type!='p' && meter_desc_p[meters].type!='R' && meter_desc_p[meters].type!='v') {
 #else
   if (meter_desc_p[meters].type!='o' && meter_desc_p[meters].type!='e' && meter_desc_p[meters].type!='m' && meter_desc_p[meters].type!='M' && meter_desc_p[meters].type!='p' && meter_desc_p[meters].type!='R' && meter_desc_p[meters].type!='v') {
 #endif
     // shift in
-    for (count=0; count<SML_BSIZ-1; count++) {
-      smltbuf[meters][count]=smltbuf[meters][count+1];
-    }
+    memmove(&smltbuf[meters][0], &smltbuf[meters][1], SML_BSIZ - 1);
   }
   uint8_t iob=(uint8_t)meter_ss[meters]->read();
 
@@ -1386,6 +1657,10 @@ void sml_shift_in(uint32_t meters,uint32_t shard) {
 		}
   }
   sb_counter++;
+  if (sml_matcher[meters]) {
+    SML_MatchByte(meters, iob);
+    return;
+  }
 #ifndef SML_OBIS_LINE
   if (meter_desc_p[meters].type!='e' && meter_desc_p[meters].type!='m' && meter_desc_p[meters].type!='M' && meter_desc_p[meters].type!='p' && meter_desc_p[meters].type!='R' && meter_desc_p[meters].type!='v') SML_Decode(meters);
 #else
@@ -1438,10 +1713,14 @@ uint32_t vbus_get_septet(uint8_t *cp) {
 
 
 void SML_Decode(uint8_t index) {
-  const char *mp=(const char*)meter_p;
+  SML_DecodeSections(index, (const char*)meter_p, 0, 0, false);
+}
+
+// decode the descriptor sections of meter index, starting at mp
+// if single is set, only the section at mp is decoded, vindex and dindex must be its indexes
+void SML_DecodeSections(uint8_t index, const char *mp, uint8_t vindex, uint8_t dindex, bool single) {
   int8_t mindex;
   uint8_t *cp;
-  uint8_t dindex = 0, vindex = 0;
   delay(0);
 
   while (mp != NULL) {
@@ -1917,6 +2196,7 @@ void SML_Decode(uint8_t index) {
       //AddLog(LOG_LEVEL_INFO, PSTR("set valid in line %d"), vindex);
     }
 nextsect:
+    if (single) break;
     // next section
     if (vindex<SML_MAX_VARS-1) {
       vindex++;
@@ -2275,6 +2555,7 @@ void SML_Init(void) {
 
   for (uint32_t cnt=0;cnt<MAX_METERS;cnt++) {
     meter_spos[cnt]=0;
+    sml_free_matcher(cnt);      // the descriptor may be freed below
   }
 
 #ifdef USE_SCRIPT
@@ -2514,6 +2795,8 @@ next_line:
 #endif
 
 init10:
+  SML_CompileMatchers();
+
   typedef void (*function)();
   uint8_t cindex=0;
   // preloud counters
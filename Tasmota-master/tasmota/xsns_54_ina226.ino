@@ -68,6 +68,7 @@
 // Define driver ID
 
 #define XSNS_54                                 54
+#define XSNS_54_FUNCS                           XFUNC_SECOND
 #define XI2C_35                                 35  // See I2CDEVICES.md
 
 #define INA226_MAX_ADDRESSES                    4
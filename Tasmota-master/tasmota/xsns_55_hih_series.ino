@@ -31,6 +31,7 @@
 \*********************************************************************************************/
 
 #define XSNS_55             55
+#define XSNS_55_FUNCS       XFUNC_SECOND
 #define XI2C_36             36  // See I2CDEVICES.md
 
 #define HIH6_ADDR           0x27
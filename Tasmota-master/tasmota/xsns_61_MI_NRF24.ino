@@ -71,6 +71,7 @@
 \*********************************************************************************************/
 
 #define XSNS_61             61
+#define XSNS_61_FUNCS       (XFUNC_50MS | XFUNC_SECOND)
 
 #include <vector>
 #ifdef USE_MI_DECRYPTION
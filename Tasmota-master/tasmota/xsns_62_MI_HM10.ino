@@ -48,6 +48,7 @@
 #ifdef USE_HM10
 
 #define XSNS_62                    62
+#define XSNS_62_FUNCS              (XFUNC_50MS | XFUNC_100MS | XFUNC_250MS | XFUNC_SECOND)
 
 #include <TasmotaSerial.h>
 #include <vector>
@@ -54,6 +54,7 @@
 #ifdef USE_MI_ESP32
 
 #define XSNS_62                    62
+#define XSNS_62_FUNCS              (XFUNC_50MS | XFUNC_100MS | XFUNC_250MS | XFUNC_SECOND)
 #define USE_MI_DECRYPTION
 
 #include <NimBLEDevice.h>
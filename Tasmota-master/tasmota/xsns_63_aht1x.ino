@@ -44,6 +44,7 @@
 \*********************************************************************************************/
 
 #define XSNS_63              63
+#define XSNS_63_FUNCS        XFUNC_100MS
 #define XI2C_43              43  // See I2CDEVICES.md
 
 #define AHT1X_ADDR1          0x38
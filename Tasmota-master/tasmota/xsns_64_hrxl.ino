@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XSNS_64                      64
+#define XSNS_64_FUNCS                XFUNC_SECOND
 
 #include <TasmotaSerial.h>
 
@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XSNS_67             67
+#define XSNS_67_FUNCS       XFUNC_SECOND
 #define XI2C_48             48  // See I2CDEVICES.md
 
 #define D_NAME_AS3935 "AS3935"
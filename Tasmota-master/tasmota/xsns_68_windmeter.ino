@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XSNS_68             68
+#define XSNS_68_FUNCS       XFUNC_SECOND
 
 #define D_WINDMETER_NAME "WindMeter"
 
@@ -20,6 +20,7 @@
 #ifdef USE_OPENTHERM
 
 #define XSNS_69 69
+#define XSNS_69_FUNCS (XFUNC_LOOP | XFUNC_100MS | XFUNC_SECOND)
 
 #include <OpenTherm.h>
 
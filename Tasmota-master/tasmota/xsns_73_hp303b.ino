@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XSNS_73               73
+#define XSNS_73_FUNCS         XFUNC_SECOND
 #define XI2C_52               52 // See I2CDEVICES.md
 
 #define HP303B_MAX_SENSORS    2
@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XSNS_74		      74
+#define XSNS_74_FUNCS  XFUNC_SECOND
 
 #define LMT01_TIMEOUT   200   // ms timeout for a reading cycle
 
@@ -33,6 +33,7 @@
 \*********************************************************************************************/
 
 #define XSNS_75                    75
+#define XSNS_75_FUNCS              0
 
 // Find appropriate unit for measurement type.
 const char *UnitfromType(const char *type)
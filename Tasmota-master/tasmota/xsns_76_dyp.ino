@@ -32,6 +32,7 @@
 \*********************************************************************************************/
 
 #define XSNS_76 76
+#define XSNS_76_FUNCS XFUNC_SECOND
 
 #include <TasmotaSerial.h>
 
@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XSNS_77     77
+#define XSNS_77_FUNCS (XFUNC_250MS | XFUNC_SECOND)
 #define XI2C_54     54  // See I2CDEVICES.md
 
 #include "VL53L1X.h"
@@ -21,6 +21,7 @@
 #if defined(USE_EZO)
 
 #define XSNS_78 78
+#define XSNS_78_FUNCS XFUNC_SECOND
 #define XI2C_55 55        // See I2CDEVICES.md
 
 #define EZO_ADDR_0  0x61  // First EZO address
@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_79               79
+#define XSNS_79_FUNCS         XFUNC_250MS
 
 //#define USE_AS608_MESSAGES
 
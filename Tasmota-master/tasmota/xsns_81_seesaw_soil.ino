@@ -43,6 +43,7 @@
 \*********************************************************************************************/
 
 #define XSNS_81              81
+#define XSNS_81_FUNCS        (XFUNC_50MS | XFUNC_SECOND)
 #define XI2C_56              56                 // See I2CDEVICES.md
 
 #include "Adafruit_seesaw.h"                    // we only use definitions, no code
@@ -48,6 +48,7 @@
 #pragma message("**** Wiegand interface enabled ****")
 
 #define XSNS_82                82
+#define XSNS_82_FUNCS          XFUNC_100MS
 
 #define WIEGAND_CODE_GAP_FACTOR 3  // Gap between 2 complete RFID codes send by the device. (WIEGAND_CODE_GAP_FACTOR * bitTime) to detect the end of a code 
 #define WIEGAND_BIT_TIME_DEFAULT 1250  // period time (µs) of one bit (impluse + impulse_gap time) 1250µs measured by oscilloscope on my RFID Reader
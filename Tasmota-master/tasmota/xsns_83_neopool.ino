@@ -48,6 +48,7 @@
 \*********************************************************************************************/
 
 #define XSNS_83                      83
+#define XSNS_83_FUNCS                XFUNC_250MS
 
 #ifndef NEOPOOL_MODBUS_SPEED
 #define NEOPOOL_MODBUS_SPEED         19200
@@ -34,6 +34,7 @@
 \*********************************************************************************************/
 
 #define XSNS_84                     84
+#define XSNS_84_FUNCS               (XFUNC_250MS | XFUNC_SECOND)
 #define XI2C_57                     57  // See I2CDEVICES.md
 
 #define TOF10120_ADDRESS            0x52
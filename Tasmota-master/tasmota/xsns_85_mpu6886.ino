@@ -30,6 +30,7 @@
 \*********************************************************************************************/
 
 #define XSNS_85                     85
+#define XSNS_85_FUNCS               XFUNC_SECOND
 #define XI2C_58                     58  // See I2CDEVICES.md
 
 #define MPU_ACCEL_ADDRESS            0x68
@@ -62,6 +62,7 @@
 \*****************************************************************************/
 
 #define XSNS_86 86
+#define XSNS_86_FUNCS XFUNC_SECOND
 
 // Default baudrate
 #define TFMP_SPEED 9600
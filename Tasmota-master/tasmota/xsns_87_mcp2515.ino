@@ -35,6 +35,7 @@
 \*********************************************************************************************/
 
 #define XSNS_87              87
+#define XSNS_87_FUNCS        XFUNC_50MS
 
 // set defaults if not defined
 #ifndef MCP2515_BITRATE
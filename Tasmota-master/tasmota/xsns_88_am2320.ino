@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_88           88
+#define XSNS_88_FUNCS     XFUNC_SECOND
 #define XI2C_60           60     // See I2CDEVICES.md
 
 #define AM2320_ADDR				0x5C	 // use 7bit address: 0xB8 >> 1
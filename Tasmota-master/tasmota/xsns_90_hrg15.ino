@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XSNS_90 90
+#define XSNS_90_FUNCS XFUNC_SECOND
 
 #define RG15_NAME          "RG-15"
 #define RG15_BAUDRATE      9600
@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XSNS_91                   91
+#define XSNS_91_FUNCS             XFUNC_SECOND
 
 //#define VINDRIKTNING_SHOW_PM1         // Display undocumented/supposed PM1.0 values
 //#define VINDRIKTNING_SHOW_PM10        // Display undocumented/supposed PM10 values
@@ -56,6 +56,7 @@
 #ifdef USE_SCD40
 
 #define XSNS_92        92
+#define XSNS_92_FUNCS  XFUNC_SECOND
 #define XI2C_62        62  // See I2CDEVICES.md
 
 // #define SCD40_ADDRESS  0x62 // already defined in lib
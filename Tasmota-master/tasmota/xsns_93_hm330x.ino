@@ -60,6 +60,7 @@
 //#define HM330X_SIM
 
 #define XSNS_93        93
+#define XSNS_93_FUNCS  XFUNC_SECOND
 #define XI2C_63        63  // See I2CDEVICES.md
 
 #ifndef HM330X_DEFAULT_ADDRESS
@@ -1053,6 +1053,1035 @@ const uint8_t kXsnsList[] = {
 #endif
 };
 
+/*********************************************************************************************\
+ * Xsns periodic functions
+\*********************************************************************************************/
+
+#ifdef XFUNC_PTR_IN_ROM
+const uint8_t kXsnsFuncs[] PROGMEM = {
+#else
+const uint8_t kXsnsFuncs[] = {
+#endif
+
+#ifdef XSNS_01
+#ifdef XSNS_01_FUNCS
+  XSNS_01_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_02
+#ifdef XSNS_02_FUNCS
+  XSNS_02_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_03
+#ifdef XSNS_03_FUNCS
+  XSNS_03_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_04
+#ifdef XSNS_04_FUNCS
+  XSNS_04_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_05
+#ifdef XSNS_05_FUNCS
+  XSNS_05_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_06
+#ifdef XSNS_06_FUNCS
+  XSNS_06_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_07
+#ifdef XSNS_07_FUNCS
+  XSNS_07_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_08
+#ifdef XSNS_08_FUNCS
+  XSNS_08_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_09
+#ifdef XSNS_09_FUNCS
+  XSNS_09_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_10
+#ifdef XSNS_10_FUNCS
+  XSNS_10_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_11
+#ifdef XSNS_11_FUNCS
+  XSNS_11_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_12
+#ifdef XSNS_12_FUNCS
+  XSNS_12_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_13
+#ifdef XSNS_13_FUNCS
+  XSNS_13_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_14
+#ifdef XSNS_14_FUNCS
+  XSNS_14_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_15
+#ifdef XSNS_15_FUNCS
+  XSNS_15_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_16
+#ifdef XSNS_16_FUNCS
+  XSNS_16_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_17
+#ifdef XSNS_17_FUNCS
+  XSNS_17_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_18
+#ifdef XSNS_18_FUNCS
+  XSNS_18_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_19
+#ifdef XSNS_19_FUNCS
+  XSNS_19_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_20
+#ifdef XSNS_20_FUNCS
+  XSNS_20_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_21
+#ifdef XSNS_21_FUNCS
+  XSNS_21_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_22
+#ifdef XSNS_22_FUNCS
+  XSNS_22_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_23
+#ifdef XSNS_23_FUNCS
+  XSNS_23_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_24
+#ifdef XSNS_24_FUNCS
+  XSNS_24_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_25
+#ifdef XSNS_25_FUNCS
+  XSNS_25_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_26
+#ifdef XSNS_26_FUNCS
+  XSNS_26_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_27
+#ifdef XSNS_27_FUNCS
+  XSNS_27_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_28
+#ifdef XSNS_28_FUNCS
+  XSNS_28_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_29
+#ifdef XSNS_29_FUNCS
+  XSNS_29_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_30
+#ifdef XSNS_30_FUNCS
+  XSNS_30_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_31
+#ifdef XSNS_31_FUNCS
+  XSNS_31_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_32
+#ifdef XSNS_32_FUNCS
+  XSNS_32_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_33
+#ifdef XSNS_33_FUNCS
+  XSNS_33_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_34
+#ifdef XSNS_34_FUNCS
+  XSNS_34_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_35
+#ifdef XSNS_35_FUNCS
+  XSNS_35_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_36
+#ifdef XSNS_36_FUNCS
+  XSNS_36_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_37
+#ifdef XSNS_37_FUNCS
+  XSNS_37_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_38
+#ifdef XSNS_38_FUNCS
+  XSNS_38_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_39
+#ifdef XSNS_39_FUNCS
+  XSNS_39_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_40
+#ifdef XSNS_40_FUNCS
+  XSNS_40_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_41
+#ifdef XSNS_41_FUNCS
+  XSNS_41_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_42
+#ifdef XSNS_42_FUNCS
+  XSNS_42_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_43
+#ifdef XSNS_43_FUNCS
+  XSNS_43_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_44
+#ifdef XSNS_44_FUNCS
+  XSNS_44_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_45
+#ifdef XSNS_45_FUNCS
+  XSNS_45_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_46
+#ifdef XSNS_46_FUNCS
+  XSNS_46_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_47
+#ifdef XSNS_47_FUNCS
+  XSNS_47_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_48
+#ifdef XSNS_48_FUNCS
+  XSNS_48_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_49
+#ifdef XSNS_49_FUNCS
+  XSNS_49_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_50
+#ifdef XSNS_50_FUNCS
+  XSNS_50_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_51
+#ifdef XSNS_51_FUNCS
+  XSNS_51_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_52
+#ifdef XSNS_52_FUNCS
+  XSNS_52_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_53
+#ifdef XSNS_53_FUNCS
+  XSNS_53_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_54
+#ifdef XSNS_54_FUNCS
+  XSNS_54_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_55
+#ifdef XSNS_55_FUNCS
+  XSNS_55_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_56
+#ifdef XSNS_56_FUNCS
+  XSNS_56_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_57
+#ifdef XSNS_57_FUNCS
+  XSNS_57_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_58
+#ifdef XSNS_58_FUNCS
+  XSNS_58_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_59
+#ifdef XSNS_59_FUNCS
+  XSNS_59_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_60
+#ifdef XSNS_60_FUNCS
+  XSNS_60_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_61
+#ifdef XSNS_61_FUNCS
+  XSNS_61_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_62
+#ifdef XSNS_62_FUNCS
+  XSNS_62_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_63
+#ifdef XSNS_63_FUNCS
+  XSNS_63_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_64
+#ifdef XSNS_64_FUNCS
+  XSNS_64_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_65
+#ifdef XSNS_65_FUNCS
+  XSNS_65_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_66
+#ifdef XSNS_66_FUNCS
+  XSNS_66_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_67
+#ifdef XSNS_67_FUNCS
+  XSNS_67_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_68
+#ifdef XSNS_68_FUNCS
+  XSNS_68_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_69
+#ifdef XSNS_69_FUNCS
+  XSNS_69_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_70
+#ifdef XSNS_70_FUNCS
+  XSNS_70_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_71
+#ifdef XSNS_71_FUNCS
+  XSNS_71_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_72
+#ifdef XSNS_72_FUNCS
+  XSNS_72_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_73
+#ifdef XSNS_73_FUNCS
+  XSNS_73_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_74
+#ifdef XSNS_74_FUNCS
+  XSNS_74_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_75
+#ifdef XSNS_75_FUNCS
+  XSNS_75_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_76
+#ifdef XSNS_76_FUNCS
+  XSNS_76_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_77
+#ifdef XSNS_77_FUNCS
+  XSNS_77_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_78
+#ifdef XSNS_78_FUNCS
+  XSNS_78_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_79
+#ifdef XSNS_79_FUNCS
+  XSNS_79_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_80
+#ifdef XSNS_80_FUNCS
+  XSNS_80_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_81
+#ifdef XSNS_81_FUNCS
+  XSNS_81_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_82
+#ifdef XSNS_82_FUNCS
+  XSNS_82_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_83
+#ifdef XSNS_83_FUNCS
+  XSNS_83_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_84
+#ifdef XSNS_84_FUNCS
+  XSNS_84_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_85
+#ifdef XSNS_85_FUNCS
+  XSNS_85_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_86
+#ifdef XSNS_86_FUNCS
+  XSNS_86_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_87
+#ifdef XSNS_87_FUNCS
+  XSNS_87_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_88
+#ifdef XSNS_88_FUNCS
+  XSNS_88_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_89
+#ifdef XSNS_89_FUNCS
+  XSNS_89_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_90
+#ifdef XSNS_90_FUNCS
+  XSNS_90_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_91
+#ifdef XSNS_91_FUNCS
+  XSNS_91_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_92
+#ifdef XSNS_92_FUNCS
+  XSNS_92_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_93
+#ifdef XSNS_93_FUNCS
+  XSNS_93_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_94
+#ifdef XSNS_94_FUNCS
+  XSNS_94_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_95
+#ifdef XSNS_95_FUNCS
+  XSNS_95_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_96
+#ifdef XSNS_96_FUNCS
+  XSNS_96_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_97
+#ifdef XSNS_97_FUNCS
+  XSNS_97_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_98
+#ifdef XSNS_98_FUNCS
+  XSNS_98_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_99
+#ifdef XSNS_99_FUNCS
+  XSNS_99_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_100
+#ifdef XSNS_100_FUNCS
+  XSNS_100_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_101
+#ifdef XSNS_101_FUNCS
+  XSNS_101_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_102
+#ifdef XSNS_102_FUNCS
+  XSNS_102_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_103
+#ifdef XSNS_103_FUNCS
+  XSNS_103_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_104
+#ifdef XSNS_104_FUNCS
+  XSNS_104_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_105
+#ifdef XSNS_105_FUNCS
+  XSNS_105_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_106
+#ifdef XSNS_106_FUNCS
+  XSNS_106_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_107
+#ifdef XSNS_107_FUNCS
+  XSNS_107_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_108
+#ifdef XSNS_108_FUNCS
+  XSNS_108_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_109
+#ifdef XSNS_109_FUNCS
+  XSNS_109_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_110
+#ifdef XSNS_110_FUNCS
+  XSNS_110_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_111
+#ifdef XSNS_111_FUNCS
+  XSNS_111_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_112
+#ifdef XSNS_112_FUNCS
+  XSNS_112_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_113
+#ifdef XSNS_113_FUNCS
+  XSNS_113_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_114
+#ifdef XSNS_114_FUNCS
+  XSNS_114_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_115
+#ifdef XSNS_115_FUNCS
+  XSNS_115_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_116
+#ifdef XSNS_116_FUNCS
+  XSNS_116_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_117
+#ifdef XSNS_117_FUNCS
+  XSNS_117_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_118
+#ifdef XSNS_118_FUNCS
+  XSNS_118_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_119
+#ifdef XSNS_119_FUNCS
+  XSNS_119_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_120
+#ifdef XSNS_120_FUNCS
+  XSNS_120_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_121
+#ifdef XSNS_121_FUNCS
+  XSNS_121_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_122
+#ifdef XSNS_122_FUNCS
+  XSNS_122_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_123
+#ifdef XSNS_123_FUNCS
+  XSNS_123_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_124
+#ifdef XSNS_124_FUNCS
+  XSNS_124_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_125
+#ifdef XSNS_125_FUNCS
+  XSNS_125_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_126
+#ifdef XSNS_126_FUNCS
+  XSNS_126_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_127
+#ifdef XSNS_127_FUNCS
+  XSNS_127_FUNCS,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+};
+
+static_assert(sizeof(kXsnsFuncs) == xsns_present, "kXsnsFuncs does not match the sensor list");
+
 /*********************************************************************************************/
 
 bool XsnsEnabled(uint32_t sensor_list, uint32_t sns_index) {
@@ -1071,6 +2100,14 @@ bool XsnsEnabled(uint32_t sensor_list, uint32_t sns_index) {
   return true;
 }
 
+uint32_t XsnsDriverId(uint32_t position) {
+#ifdef XFUNC_PTR_IN_ROM
+  return pgm_read_byte(kXsnsList + position);
+#else
+  return kXsnsList[position];
+#endif
+}
+
 void XsnsSensorState(uint32_t sensor_list) {
   // sensor_list 0 = sensors
   // sensor_list 1 = web_sensors
@@ -1111,6 +2148,26 @@ bool XsnsNextCall(uint8_t Function, uint8_t &xsns_index) {
   return xsns_func_ptr[xsns_index](Function);
 }
 
+uint8_t xsns_periodic_count[XFUNC_PERIODIC] = { 0 };     // Number of sensors handling each periodic function
+uint8_t xsns_periodic[XFUNC_PERIODIC][xsns_present];     // Sensors handling each periodic function
+bool xsns_periodic_init = false;
+
+void XsnsPeriodicInit(void) {
+  for (uint32_t x = 0; x < xsns_present; x++) {
+#ifdef XFUNC_PTR_IN_ROM
+    uint32_t funcs = pgm_read_byte(kXsnsFuncs + x);
+#else
+    uint32_t funcs = kXsnsFuncs[x];
+#endif
+    for (uint32_t i = 0; i < XFUNC_PERIODIC; i++) {
+      if (funcs & (1 << i)) {
+        xsns_periodic[i][xsns_periodic_count[i]++] = x;
+      }
+    }
+  }
+  xsns_periodic_init = true;
+}
+
 bool XsnsCall(uint8_t Function) {
   bool result = false;
 
@@ -1118,14 +2175,26 @@ bool XsnsCall(uint8_t Function) {
 
   uint32_t profile_driver_start = millis();
 
-  for (uint32_t x = 0; x < xsns_present; x++) {
+  uint32_t count = xsns_present;
+  uint8_t *periodic = nullptr;             // Call all sensors
+  if ((Function >= FUNC_LOOP) && (Function <= FUNC_EVERY_SECOND)) {
+    if (!xsns_periodic_init) { XsnsPeriodicInit(); }
+    periodic = xsns_periodic[Function - FUNC_LOOP];
+    count = xsns_periodic_count[Function - FUNC_LOOP];
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t x = (periodic) ? periodic[i] : i;
     if (XsnsEnabled(0, x)) {  // Skip disabled sensor
       if ((FUNC_WEB_SENSOR == Function) && !XsnsEnabled(1, x)) { continue; }  // Skip web info for disabled sensors
 
       uint32_t profile_function_start = millis();
+      PROFILE_STATS_START(profile_stats_start);
 
       result = xsns_func_ptr[x](Function);
 
+      PROFILE_STATS(PRF_SNS, x, Function, profile_stats_start);
+
 #ifdef USE_PROFILE_FUNCTION
 #ifdef XFUNC_PTR_IN_ROM
       uint32_t index = pgm_read_byte(kXsnsList + x);